@@ -627,6 +627,59 @@ void* PerlXlib_get_struct_ptr(SV *sv, int lvalue, const char* pkg, int struct_si
     return SvPVX(sv);
 }
 
+/* Get a C array of structs from either a string of packed structs in native
+ * layout (such as perl's pack("s s S S", ...) for XRectangle) or an arrayref of
+ * anything PerlXlib_get_struct_ptr accepts as an rvalue.  A packed string is used
+ * in place; an array is copied into a buffer which lasts until the end of the
+ * XS call.  If pkg is NULL, only packed strings are accepted.  Stores the number
+ * of elements in *count_out.
+ */
+void* PerlXlib_get_struct_array(SV *sv, const char* pkg, int struct_size, PerlXlib_struct_pack_fn *packer, int *count_out) {
+    AV *av;
+    SV **elem, *tmp;
+    char *buf;
+    STRLEN len;
+    int i, n;
+
+    if (SvROK(sv) && SvTYPE(SvRV(sv)) == SVt_PVAV) {
+        if (!pkg) croak("Expected a string of packed structs");
+        av= (AV*) SvRV(sv);
+        n= av_len(av) + 1;
+        tmp= sv_2mortal(newSV(n * struct_size + 1));
+        buf= SvPVX(tmp);
+        for (i= 0; i < n; i++) {
+            elem= av_fetch(av, i, 0);
+            if (!elem) croak("Can't read array elem %d", i);
+            memcpy(buf + i * struct_size, PerlXlib_get_struct_ptr(*elem, 0, pkg, struct_size, packer), struct_size);
+        }
+        *count_out= n;
+        return buf;
+    }
+    buf= SvPV(sv, len);
+    if (len % struct_size)
+        croak("Length of packed %s array (%ld) is not a multiple of %d",
+            pkg? pkg : "struct", (long) len, struct_size);
+    *count_out= (int)(len / struct_size);
+    return buf;
+}
+
+/* Binary search for a field name in one of the generated PerlXlib_*_fields tables.
+ * 'name' does not need to be NUL-terminated.  Returns -1 if not found.
+ */
+int PerlXlib_struct_field_index(const PerlXlib_struct_fields *fields, const char *name, STRLEN len) {
+    int lo= 0, hi= fields->count - 1, mid, cmp;
+    while (lo <= hi) {
+        mid= (lo + hi) >> 1;
+        cmp= strncmp(name, fields->names[mid], len);
+        /* name is a prefix of names[mid], so it sorts first */
+        if (!cmp && fields->names[mid][len]) cmp= -1;
+        if (!cmp) return mid;
+        if (cmp < 0) hi= mid - 1;
+        else lo= mid + 1;
+    }
+    return -1;
+}
+
 #include "keysym_to_codepoint.c"
 
 KeySym PerlXlib_codepoint_to_keysym(int uc) {
@@ -752,6 +805,24 @@ void PerlXlib_install_error_handlers(Bool nonfatal, Bool fatal) {
     }
 }
 
+/* Extension events have type codes assigned by the server, so their classes are
+ * registered when the extension is queried, and looked up by the generated
+ * PerlXlib_xevent_pkg_for_type for any type it doesn't know.  Servers assign the
+ * same codes to every connection, so one table serves all displays, except in
+ * the unusual case of one process talking to servers with different extensions.
+ */
+static const char *PerlXlib_ext_event_pkg[128];
+
+void PerlXlib_register_ext_event(int type, const char *pkg) {
+    if (type >= LASTEvent && type < 128)
+        PerlXlib_ext_event_pkg[type]= pkg;
+}
+
+const char* PerlXlib_xevent_ext_pkg_for_type(int type) {
+    const char *pkg= (type >= LASTEvent && type < 128)? PerlXlib_ext_event_pkg[type] : NULL;
+    return pkg? pkg : "X11::Xlib::XEvent";
+}
+
 /*--------------------------------------------------------------------------*/
 /* BEGIN GENERATED X11_Xlib_XEvent */
 
@@ -792,7 +863,7 @@ const char* PerlXlib_xevent_pkg_for_type(int type) {
   case SelectionRequest: return "X11::Xlib::XSelectionRequestEvent";
   case UnmapNotify: return "X11::Xlib::XUnmapEvent";
   case VisibilityNotify: return "X11::Xlib::XVisibilityEvent";
-  default: return "X11::Xlib::XEvent";
+  default: return PerlXlib_xevent_ext_pkg_for_type(type);
   }
 }
 
@@ -1489,6 +1560,1243 @@ void PerlXlib_XEvent_unpack(XEvent *s, HV *fields) {
         croak("Can't store field in supplied hash (tied maybe?)");
 }
 
+static const char * const PerlXlib_XEvent_field_names[]= {
+    "above",
+    "atom",
+    "b",
+    "border_width",
+    "button",
+    "colormap",
+    "count",
+    "detail",
+    "display",
+    "drawable",
+    "error_code",
+    "event",
+    "evtype",
+    "extension",
+    "first_keycode",
+    "focus",
+    "format",
+    "from_configure",
+    "height",
+    "is_hint",
+    "key_vector",
+    "keycode",
+    "l",
+    "major_code",
+    "message_type",
+    "minor_code",
+    "mode",
+    "new",
+    "override_redirect",
+    "owner",
+    "parent",
+    "place",
+    "property",
+    "request",
+    "request_code",
+    "requestor",
+    "resourceid",
+    "root",
+    "s",
+    "same_screen",
+    "selection",
+    "send_event",
+    "serial",
+    "state",
+    "subwindow",
+    "target",
+    "time",
+    "type",
+    "value_mask",
+    "width",
+    "window",
+    "x",
+    "x_root",
+    "y",
+    "y_root",
+};
+
+static SV* PerlXlib_XEvent_get_field(XEvent *s, int idx, SV *obj_ref) {
+    switch (idx) {
+    case 0:
+      switch (s->type) {
+      case ConfigureNotify:
+        return newSVuv(s->xconfigure.above);
+      case ConfigureRequest:
+        return newSVuv(s->xconfigurerequest.above);
+      }
+      return NULL;
+    case 1:
+      switch (s->type) {
+      case PropertyNotify:
+        return newSVuv(s->xproperty.atom);
+      }
+      return NULL;
+    case 2:
+      switch (s->type) {
+      case ClientMessage:
+        return newSVpvn((void*)s->xclient.data.b, sizeof(char)*20);
+      }
+      return NULL;
+    case 3:
+      switch (s->type) {
+      case ConfigureNotify:
+        return newSViv(s->xconfigure.border_width);
+      case ConfigureRequest:
+        return newSViv(s->xconfigurerequest.border_width);
+      case CreateNotify:
+        return newSViv(s->xcreatewindow.border_width);
+      }
+      return NULL;
+    case 4:
+      switch (s->type) {
+      case ButtonPress:
+      case ButtonRelease:
+        return newSVuv(s->xbutton.button);
+      }
+      return NULL;
+    case 5:
+      switch (s->type) {
+      case ColormapNotify:
+        return newSVuv(s->xcolormap.colormap);
+      }
+      return NULL;
+    case 6:
+      switch (s->type) {
+      case Expose:
+        return newSViv(s->xexpose.count);
+      case GraphicsExpose:
+        return newSViv(s->xgraphicsexpose.count);
+      case MappingNotify:
+        return newSViv(s->xmapping.count);
+      }
+      return NULL;
+    case 7:
+      switch (s->type) {
+      case ConfigureRequest:
+        return newSViv(s->xconfigurerequest.detail);
+      case EnterNotify:
+      case LeaveNotify:
+        return newSViv(s->xcrossing.detail);
+      case FocusIn:
+      case FocusOut:
+        return newSViv(s->xfocus.detail);
+      }
+      return NULL;
+    case 8: return newSVsv(PerlXlib_get_display_objref((s->type? s->xany.display : s->xerror.display), PerlXlib_AUTOCREATE));
+    case 9:
+      switch (s->type) {
+      case GraphicsExpose:
+        return newSVuv(s->xgraphicsexpose.drawable);
+      case NoExpose:
+        return newSVuv(s->xnoexpose.drawable);
+      }
+      return NULL;
+    case 10:
+      switch (s->type) {
+      case 0:
+        return newSVuv(s->xerror.error_code);
+      }
+      return NULL;
+    case 11:
+      switch (s->type) {
+      case CirculateNotify:
+        return newSVuv(s->xcirculate.event);
+      case ConfigureNotify:
+        return newSVuv(s->xconfigure.event);
+      case DestroyNotify:
+        return newSVuv(s->xdestroywindow.event);
+      case GravityNotify:
+        return newSVuv(s->xgravity.event);
+      case MapNotify:
+        return newSVuv(s->xmap.event);
+      case ReparentNotify:
+        return newSVuv(s->xreparent.event);
+      case UnmapNotify:
+        return newSVuv(s->xunmap.event);
+      }
+      return NULL;
+    case 12:
+      switch (s->type) {
+      case GenericEvent:
+        return newSViv(s->xgeneric.evtype);
+      }
+      return NULL;
+    case 13:
+      switch (s->type) {
+      case GenericEvent:
+        return newSViv(s->xgeneric.extension);
+      }
+      return NULL;
+    case 14:
+      switch (s->type) {
+      case MappingNotify:
+        return newSViv(s->xmapping.first_keycode);
+      }
+      return NULL;
+    case 15:
+      switch (s->type) {
+      case EnterNotify:
+      case LeaveNotify:
+        return newSViv(s->xcrossing.focus);
+      }
+      return NULL;
+    case 16:
+      switch (s->type) {
+      case ClientMessage:
+        return newSViv(s->xclient.format);
+      }
+      return NULL;
+    case 17:
+      switch (s->type) {
+      case UnmapNotify:
+        return newSViv(s->xunmap.from_configure);
+      }
+      return NULL;
+    case 18:
+      switch (s->type) {
+      case ConfigureNotify:
+        return newSViv(s->xconfigure.height);
+      case ConfigureRequest:
+        return newSViv(s->xconfigurerequest.height);
+      case CreateNotify:
+        return newSViv(s->xcreatewindow.height);
+      case Expose:
+        return newSViv(s->xexpose.height);
+      case GraphicsExpose:
+        return newSViv(s->xgraphicsexpose.height);
+      case ResizeRequest:
+        return newSViv(s->xresizerequest.height);
+      }
+      return NULL;
+    case 19:
+      switch (s->type) {
+      case MotionNotify:
+        return newSViv(s->xmotion.is_hint);
+      }
+      return NULL;
+    case 20:
+      switch (s->type) {
+      case KeymapNotify:
+        return newSVpvn((void*)s->xkeymap.key_vector, sizeof(char)*32);
+      }
+      return NULL;
+    case 21:
+      switch (s->type) {
+      case KeyPress:
+      case KeyRelease:
+        return newSVuv(s->xkey.keycode);
+      }
+      return NULL;
+    case 22:
+      switch (s->type) {
+      case ClientMessage:
+        return newSVpvn((void*)s->xclient.data.l, sizeof(long)*5);
+      }
+      return NULL;
+    case 23:
+      switch (s->type) {
+      case GraphicsExpose:
+        return newSViv(s->xgraphicsexpose.major_code);
+      case NoExpose:
+        return newSViv(s->xnoexpose.major_code);
+      }
+      return NULL;
+    case 24:
+      switch (s->type) {
+      case ClientMessage:
+        return newSVuv(s->xclient.message_type);
+      }
+      return NULL;
+    case 25:
+      switch (s->type) {
+      case 0:
+        return newSVuv(s->xerror.minor_code);
+      case GraphicsExpose:
+        return newSViv(s->xgraphicsexpose.minor_code);
+      case NoExpose:
+        return newSViv(s->xnoexpose.minor_code);
+      }
+      return NULL;
+    case 26:
+      switch (s->type) {
+      case EnterNotify:
+      case LeaveNotify:
+        return newSViv(s->xcrossing.mode);
+      case FocusIn:
+      case FocusOut:
+        return newSViv(s->xfocus.mode);
+      }
+      return NULL;
+    case 27:
+      switch (s->type) {
+      case ColormapNotify:
+        return newSViv(s->xcolormap.new);
+      }
+      return NULL;
+    case 28:
+      switch (s->type) {
+      case ConfigureNotify:
+        return newSViv(s->xconfigure.override_redirect);
+      case CreateNotify:
+        return newSViv(s->xcreatewindow.override_redirect);
+      case MapNotify:
+        return newSViv(s->xmap.override_redirect);
+      case ReparentNotify:
+        return newSViv(s->xreparent.override_redirect);
+      }
+      return NULL;
+    case 29:
+      switch (s->type) {
+      case SelectionRequest:
+        return newSVuv(s->xselectionrequest.owner);
+      }
+      return NULL;
+    case 30:
+      switch (s->type) {
+      case CirculateRequest:
+        return newSVuv(s->xcirculaterequest.parent);
+      case ConfigureRequest:
+        return newSVuv(s->xconfigurerequest.parent);
+      case CreateNotify:
+        return newSVuv(s->xcreatewindow.parent);
+      case MapRequest:
+        return newSVuv(s->xmaprequest.parent);
+      case ReparentNotify:
+        return newSVuv(s->xreparent.parent);
+      }
+      return NULL;
+    case 31:
+      switch (s->type) {
+      case CirculateNotify:
+        return newSViv(s->xcirculate.place);
+      case CirculateRequest:
+        return newSViv(s->xcirculaterequest.place);
+      }
+      return NULL;
+    case 32:
+      switch (s->type) {
+      case SelectionNotify:
+        return newSVuv(s->xselection.property);
+      case SelectionRequest:
+        return newSVuv(s->xselectionrequest.property);
+      }
+      return NULL;
+    case 33:
+      switch (s->type) {
+      case MappingNotify:
+        return newSViv(s->xmapping.request);
+      }
+      return NULL;
+    case 34:
+      switch (s->type) {
+      case 0:
+        return newSVuv(s->xerror.request_code);
+      }
+      return NULL;
+    case 35:
+      switch (s->type) {
+      case SelectionNotify:
+        return newSVuv(s->xselection.requestor);
+      case SelectionRequest:
+        return newSVuv(s->xselectionrequest.requestor);
+      }
+      return NULL;
+    case 36:
+      switch (s->type) {
+      case 0:
+        return newSVuv(s->xerror.resourceid);
+      }
+      return NULL;
+    case 37:
+      switch (s->type) {
+      case ButtonPress:
+      case ButtonRelease:
+        return newSVuv(s->xbutton.root);
+      case EnterNotify:
+      case LeaveNotify:
+        return newSVuv(s->xcrossing.root);
+      case KeyPress:
+      case KeyRelease:
+        return newSVuv(s->xkey.root);
+      case MotionNotify:
+        return newSVuv(s->xmotion.root);
+      }
+      return NULL;
+    case 38:
+      switch (s->type) {
+      case ClientMessage:
+        return newSVpvn((void*)s->xclient.data.s, sizeof(short)*10);
+      }
+      return NULL;
+    case 39:
+      switch (s->type) {
+      case ButtonPress:
+      case ButtonRelease:
+        return newSViv(s->xbutton.same_screen);
+      case EnterNotify:
+      case LeaveNotify:
+        return newSViv(s->xcrossing.same_screen);
+      case KeyPress:
+      case KeyRelease:
+        return newSViv(s->xkey.same_screen);
+      case MotionNotify:
+        return newSViv(s->xmotion.same_screen);
+      }
+      return NULL;
+    case 40:
+      switch (s->type) {
+      case SelectionNotify:
+        return newSVuv(s->xselection.selection);
+      case SelectionClear:
+        return newSVuv(s->xselectionclear.selection);
+      case SelectionRequest:
+        return newSVuv(s->xselectionrequest.selection);
+      }
+      return NULL;
+    case 41: return s->type? newSViv(s->xany.send_event) : NULL;
+    case 42: return newSVuv((s->type? s->xany.serial : s->xerror.serial));
+    case 43:
+      switch (s->type) {
+      case ButtonPress:
+      case ButtonRelease:
+        return newSVuv(s->xbutton.state);
+      case ColormapNotify:
+        return newSViv(s->xcolormap.state);
+      case EnterNotify:
+      case LeaveNotify:
+        return newSVuv(s->xcrossing.state);
+      case KeyPress:
+      case KeyRelease:
+        return newSVuv(s->xkey.state);
+      case MotionNotify:
+        return newSVuv(s->xmotion.state);
+      case PropertyNotify:
+        return newSViv(s->xproperty.state);
+      case VisibilityNotify:
+        return newSViv(s->xvisibility.state);
+      }
+      return NULL;
+    case 44:
+      switch (s->type) {
+      case ButtonPress:
+      case ButtonRelease:
+        return newSVuv(s->xbutton.subwindow);
+      case EnterNotify:
+      case LeaveNotify:
+        return newSVuv(s->xcrossing.subwindow);
+      case KeyPress:
+      case KeyRelease:
+        return newSVuv(s->xkey.subwindow);
+      case MotionNotify:
+        return newSVuv(s->xmotion.subwindow);
+      }
+      return NULL;
+    case 45:
+      switch (s->type) {
+      case SelectionNotify:
+        return newSVuv(s->xselection.target);
+      case SelectionRequest:
+        return newSVuv(s->xselectionrequest.target);
+      }
+      return NULL;
+    case 46:
+      switch (s->type) {
+      case ButtonPress:
+      case ButtonRelease:
+        return newSVuv(s->xbutton.time);
+      case EnterNotify:
+      case LeaveNotify:
+        return newSVuv(s->xcrossing.time);
+      case KeyPress:
+      case KeyRelease:
+        return newSVuv(s->xkey.time);
+      case MotionNotify:
+        return newSVuv(s->xmotion.time);
+      case PropertyNotify:
+        return newSVuv(s->xproperty.time);
+      case SelectionNotify:
+        return newSVuv(s->xselection.time);
+      case SelectionClear:
+        return newSVuv(s->xselectionclear.time);
+      case SelectionRequest:
+        return newSVuv(s->xselectionrequest.time);
+      }
+      return NULL;
+    case 47: return newSViv(s->type);
+    case 48:
+      switch (s->type) {
+      case ConfigureRequest:
+        return newSVuv(s->xconfigurerequest.value_mask);
+      }
+      return NULL;
+    case 49:
+      switch (s->type) {
+      case ConfigureNotify:
+        return newSViv(s->xconfigure.width);
+      case ConfigureRequest:
+        return newSViv(s->xconfigurerequest.width);
+      case CreateNotify:
+        return newSViv(s->xcreatewindow.width);
+      case Expose:
+        return newSViv(s->xexpose.width);
+      case GraphicsExpose:
+        return newSViv(s->xgraphicsexpose.width);
+      case ResizeRequest:
+        return newSViv(s->xresizerequest.width);
+      }
+      return NULL;
+    case 50:
+      switch (s->type) {
+      case ButtonPress:
+      case ButtonRelease:
+        return newSVuv(s->xbutton.window);
+      case CirculateNotify:
+        return newSVuv(s->xcirculate.window);
+      case CirculateRequest:
+        return newSVuv(s->xcirculaterequest.window);
+      case ClientMessage:
+        return newSVuv(s->xclient.window);
+      case ColormapNotify:
+        return newSVuv(s->xcolormap.window);
+      case ConfigureNotify:
+        return newSVuv(s->xconfigure.window);
+      case ConfigureRequest:
+        return newSVuv(s->xconfigurerequest.window);
+      case CreateNotify:
+        return newSVuv(s->xcreatewindow.window);
+      case EnterNotify:
+      case LeaveNotify:
+        return newSVuv(s->xcrossing.window);
+      case DestroyNotify:
+        return newSVuv(s->xdestroywindow.window);
+      case Expose:
+        return newSVuv(s->xexpose.window);
+      case FocusIn:
+      case FocusOut:
+        return newSVuv(s->xfocus.window);
+      case GravityNotify:
+        return newSVuv(s->xgravity.window);
+      case KeyPress:
+      case KeyRelease:
+        return newSVuv(s->xkey.window);
+      case KeymapNotify:
+        return newSVuv(s->xkeymap.window);
+      case MapNotify:
+        return newSVuv(s->xmap.window);
+      case MappingNotify:
+        return newSVuv(s->xmapping.window);
+      case MapRequest:
+        return newSVuv(s->xmaprequest.window);
+      case MotionNotify:
+        return newSVuv(s->xmotion.window);
+      case PropertyNotify:
+        return newSVuv(s->xproperty.window);
+      case ReparentNotify:
+        return newSVuv(s->xreparent.window);
+      case ResizeRequest:
+        return newSVuv(s->xresizerequest.window);
+      case SelectionClear:
+        return newSVuv(s->xselectionclear.window);
+      case UnmapNotify:
+        return newSVuv(s->xunmap.window);
+      case VisibilityNotify:
+        return newSVuv(s->xvisibility.window);
+      }
+      return NULL;
+    case 51:
+      switch (s->type) {
+      case ButtonPress:
+      case ButtonRelease:
+        return newSViv(s->xbutton.x);
+      case ConfigureNotify:
+        return newSViv(s->xconfigure.x);
+      case ConfigureRequest:
+        return newSViv(s->xconfigurerequest.x);
+      case CreateNotify:
+        return newSViv(s->xcreatewindow.x);
+      case EnterNotify:
+      case LeaveNotify:
+        return newSViv(s->xcrossing.x);
+      case Expose:
+        return newSViv(s->xexpose.x);
+      case GraphicsExpose:
+        return newSViv(s->xgraphicsexpose.x);
+      case GravityNotify:
+        return newSViv(s->xgravity.x);
+      case KeyPress:
+      case KeyRelease:
+        return newSViv(s->xkey.x);
+      case MotionNotify:
+        return newSViv(s->xmotion.x);
+      case ReparentNotify:
+        return newSViv(s->xreparent.x);
+      }
+      return NULL;
+    case 52:
+      switch (s->type) {
+      case ButtonPress:
+      case ButtonRelease:
+        return newSViv(s->xbutton.x_root);
+      case EnterNotify:
+      case LeaveNotify:
+        return newSViv(s->xcrossing.x_root);
+      case KeyPress:
+      case KeyRelease:
+        return newSViv(s->xkey.x_root);
+      case MotionNotify:
+        return newSViv(s->xmotion.x_root);
+      }
+      return NULL;
+    case 53:
+      switch (s->type) {
+      case ButtonPress:
+      case ButtonRelease:
+        return newSViv(s->xbutton.y);
+      case ConfigureNotify:
+        return newSViv(s->xconfigure.y);
+      case ConfigureRequest:
+        return newSViv(s->xconfigurerequest.y);
+      case CreateNotify:
+        return newSViv(s->xcreatewindow.y);
+      case EnterNotify:
+      case LeaveNotify:
+        return newSViv(s->xcrossing.y);
+      case Expose:
+        return newSViv(s->xexpose.y);
+      case GraphicsExpose:
+        return newSViv(s->xgraphicsexpose.y);
+      case GravityNotify:
+        return newSViv(s->xgravity.y);
+      case KeyPress:
+      case KeyRelease:
+        return newSViv(s->xkey.y);
+      case MotionNotify:
+        return newSViv(s->xmotion.y);
+      case ReparentNotify:
+        return newSViv(s->xreparent.y);
+      }
+      return NULL;
+    case 54:
+      switch (s->type) {
+      case ButtonPress:
+      case ButtonRelease:
+        return newSViv(s->xbutton.y_root);
+      case EnterNotify:
+      case LeaveNotify:
+        return newSViv(s->xcrossing.y_root);
+      case KeyPress:
+      case KeyRelease:
+        return newSViv(s->xkey.y_root);
+      case MotionNotify:
+        return newSViv(s->xmotion.y_root);
+      }
+      return NULL;
+    }
+    return NULL;
+}
+
+static Bool PerlXlib_XEvent_set_field(XEvent *s, int idx, SV *value) {
+    int newtype;
+    const char *oldpkg, *newpkg;
+    switch (idx) {
+    case 0:
+      switch (s->type) {
+      case ConfigureNotify:
+        s->xconfigure.above= PerlXlib_sv_to_xid(value); return 1;
+      case ConfigureRequest:
+        s->xconfigurerequest.above= PerlXlib_sv_to_xid(value); return 1;
+      }
+      return 0;
+    case 1:
+      switch (s->type) {
+      case PropertyNotify:
+        s->xproperty.atom= PerlXlib_sv_to_xid(value); return 1;
+      }
+      return 0;
+    case 2:
+      switch (s->type) {
+      case ClientMessage:
+        { if (!SvPOK(value) || SvCUR(value) != sizeof(char)*20)  croak("Expected scalar of length %ld but got %ld", (long)(sizeof(char)*20), (long) SvCUR(value)); memcpy(s->xclient.data.b, SvPVX(value), sizeof(char)*20);} return 1;
+      }
+      return 0;
+    case 3:
+      switch (s->type) {
+      case ConfigureNotify:
+        s->xconfigure.border_width= SvIV(value); return 1;
+      case ConfigureRequest:
+        s->xconfigurerequest.border_width= SvIV(value); return 1;
+      case CreateNotify:
+        s->xcreatewindow.border_width= SvIV(value); return 1;
+      }
+      return 0;
+    case 4:
+      switch (s->type) {
+      case ButtonPress:
+      case ButtonRelease:
+        s->xbutton.button= SvUV(value); return 1;
+      }
+      return 0;
+    case 5:
+      switch (s->type) {
+      case ColormapNotify:
+        s->xcolormap.colormap= PerlXlib_sv_to_xid(value); return 1;
+      }
+      return 0;
+    case 6:
+      switch (s->type) {
+      case Expose:
+        s->xexpose.count= SvIV(value); return 1;
+      case GraphicsExpose:
+        s->xgraphicsexpose.count= SvIV(value); return 1;
+      case MappingNotify:
+        s->xmapping.count= SvIV(value); return 1;
+      }
+      return 0;
+    case 7:
+      switch (s->type) {
+      case ConfigureRequest:
+        s->xconfigurerequest.detail= SvIV(value); return 1;
+      case EnterNotify:
+      case LeaveNotify:
+        s->xcrossing.detail= SvIV(value); return 1;
+      case FocusIn:
+      case FocusOut:
+        s->xfocus.detail= SvIV(value); return 1;
+      }
+      return 0;
+    case 8: if (s->type) s->xany.display= PerlXlib_display_objref_get_pointer(value, PerlXlib_OR_NULL); else s->xerror.display= PerlXlib_display_objref_get_pointer(value, PerlXlib_OR_NULL); return 1;
+    case 9:
+      switch (s->type) {
+      case GraphicsExpose:
+        s->xgraphicsexpose.drawable= PerlXlib_sv_to_xid(value); return 1;
+      case NoExpose:
+        s->xnoexpose.drawable= PerlXlib_sv_to_xid(value); return 1;
+      }
+      return 0;
+    case 10:
+      switch (s->type) {
+      case 0:
+        s->xerror.error_code= SvUV(value); return 1;
+      }
+      return 0;
+    case 11:
+      switch (s->type) {
+      case CirculateNotify:
+        s->xcirculate.event= PerlXlib_sv_to_xid(value); return 1;
+      case ConfigureNotify:
+        s->xconfigure.event= PerlXlib_sv_to_xid(value); return 1;
+      case DestroyNotify:
+        s->xdestroywindow.event= PerlXlib_sv_to_xid(value); return 1;
+      case GravityNotify:
+        s->xgravity.event= PerlXlib_sv_to_xid(value); return 1;
+      case MapNotify:
+        s->xmap.event= PerlXlib_sv_to_xid(value); return 1;
+      case ReparentNotify:
+        s->xreparent.event= PerlXlib_sv_to_xid(value); return 1;
+      case UnmapNotify:
+        s->xunmap.event= PerlXlib_sv_to_xid(value); return 1;
+      }
+      return 0;
+    case 12:
+      switch (s->type) {
+      case GenericEvent:
+        s->xgeneric.evtype= SvIV(value); return 1;
+      }
+      return 0;
+    case 13:
+      switch (s->type) {
+      case GenericEvent:
+        s->xgeneric.extension= SvIV(value); return 1;
+      }
+      return 0;
+    case 14:
+      switch (s->type) {
+      case MappingNotify:
+        s->xmapping.first_keycode= SvIV(value); return 1;
+      }
+      return 0;
+    case 15:
+      switch (s->type) {
+      case EnterNotify:
+      case LeaveNotify:
+        s->xcrossing.focus= SvIV(value); return 1;
+      }
+      return 0;
+    case 16:
+      switch (s->type) {
+      case ClientMessage:
+        s->xclient.format= SvIV(value); return 1;
+      }
+      return 0;
+    case 17:
+      switch (s->type) {
+      case UnmapNotify:
+        s->xunmap.from_configure= SvIV(value); return 1;
+      }
+      return 0;
+    case 18:
+      switch (s->type) {
+      case ConfigureNotify:
+        s->xconfigure.height= SvIV(value); return 1;
+      case ConfigureRequest:
+        s->xconfigurerequest.height= SvIV(value); return 1;
+      case CreateNotify:
+        s->xcreatewindow.height= SvIV(value); return 1;
+      case Expose:
+        s->xexpose.height= SvIV(value); return 1;
+      case GraphicsExpose:
+        s->xgraphicsexpose.height= SvIV(value); return 1;
+      case ResizeRequest:
+        s->xresizerequest.height= SvIV(value); return 1;
+      }
+      return 0;
+    case 19:
+      switch (s->type) {
+      case MotionNotify:
+        s->xmotion.is_hint= SvIV(value); return 1;
+      }
+      return 0;
+    case 20:
+      switch (s->type) {
+      case KeymapNotify:
+        { if (!SvPOK(value) || SvCUR(value) != sizeof(char)*32)  croak("Expected scalar of length %ld but got %ld", (long)(sizeof(char)*32), (long) SvCUR(value)); memcpy(s->xkeymap.key_vector, SvPVX(value), sizeof(char)*32);} return 1;
+      }
+      return 0;
+    case 21:
+      switch (s->type) {
+      case KeyPress:
+      case KeyRelease:
+        s->xkey.keycode= SvUV(value); return 1;
+      }
+      return 0;
+    case 22:
+      switch (s->type) {
+      case ClientMessage:
+        { if (!SvPOK(value) || SvCUR(value) != sizeof(long)*5)  croak("Expected scalar of length %ld but got %ld", (long)(sizeof(long)*5), (long) SvCUR(value)); memcpy(s->xclient.data.l, SvPVX(value), sizeof(long)*5);} return 1;
+      }
+      return 0;
+    case 23:
+      switch (s->type) {
+      case GraphicsExpose:
+        s->xgraphicsexpose.major_code= SvIV(value); return 1;
+      case NoExpose:
+        s->xnoexpose.major_code= SvIV(value); return 1;
+      }
+      return 0;
+    case 24:
+      switch (s->type) {
+      case ClientMessage:
+        s->xclient.message_type= PerlXlib_sv_to_xid(value); return 1;
+      }
+      return 0;
+    case 25:
+      switch (s->type) {
+      case 0:
+        s->xerror.minor_code= SvUV(value); return 1;
+      case GraphicsExpose:
+        s->xgraphicsexpose.minor_code= SvIV(value); return 1;
+      case NoExpose:
+        s->xnoexpose.minor_code= SvIV(value); return 1;
+      }
+      return 0;
+    case 26:
+      switch (s->type) {
+      case EnterNotify:
+      case LeaveNotify:
+        s->xcrossing.mode= SvIV(value); return 1;
+      case FocusIn:
+      case FocusOut:
+        s->xfocus.mode= SvIV(value); return 1;
+      }
+      return 0;
+    case 27:
+      switch (s->type) {
+      case ColormapNotify:
+        s->xcolormap.new= SvIV(value); return 1;
+      }
+      return 0;
+    case 28:
+      switch (s->type) {
+      case ConfigureNotify:
+        s->xconfigure.override_redirect= SvIV(value); return 1;
+      case CreateNotify:
+        s->xcreatewindow.override_redirect= SvIV(value); return 1;
+      case MapNotify:
+        s->xmap.override_redirect= SvIV(value); return 1;
+      case ReparentNotify:
+        s->xreparent.override_redirect= SvIV(value); return 1;
+      }
+      return 0;
+    case 29:
+      switch (s->type) {
+      case SelectionRequest:
+        s->xselectionrequest.owner= PerlXlib_sv_to_xid(value); return 1;
+      }
+      return 0;
+    case 30:
+      switch (s->type) {
+      case CirculateRequest:
+        s->xcirculaterequest.parent= PerlXlib_sv_to_xid(value); return 1;
+      case ConfigureRequest:
+        s->xconfigurerequest.parent= PerlXlib_sv_to_xid(value); return 1;
+      case CreateNotify:
+        s->xcreatewindow.parent= PerlXlib_sv_to_xid(value); return 1;
+      case MapRequest:
+        s->xmaprequest.parent= PerlXlib_sv_to_xid(value); return 1;
+      case ReparentNotify:
+        s->xreparent.parent= PerlXlib_sv_to_xid(value); return 1;
+      }
+      return 0;
+    case 31:
+      switch (s->type) {
+      case CirculateNotify:
+        s->xcirculate.place= SvIV(value); return 1;
+      case CirculateRequest:
+        s->xcirculaterequest.place= SvIV(value); return 1;
+      }
+      return 0;
+    case 32:
+      switch (s->type) {
+      case SelectionNotify:
+        s->xselection.property= PerlXlib_sv_to_xid(value); return 1;
+      case SelectionRequest:
+        s->xselectionrequest.property= PerlXlib_sv_to_xid(value); return 1;
+      }
+      return 0;
+    case 33:
+      switch (s->type) {
+      case MappingNotify:
+        s->xmapping.request= SvIV(value); return 1;
+      }
+      return 0;
+    case 34:
+      switch (s->type) {
+      case 0:
+        s->xerror.request_code= SvUV(value); return 1;
+      }
+      return 0;
+    case 35:
+      switch (s->type) {
+      case SelectionNotify:
+        s->xselection.requestor= PerlXlib_sv_to_xid(value); return 1;
+      case SelectionRequest:
+        s->xselectionrequest.requestor= PerlXlib_sv_to_xid(value); return 1;
+      }
+      return 0;
+    case 36:
+      switch (s->type) {
+      case 0:
+        s->xerror.resourceid= PerlXlib_sv_to_xid(value); return 1;
+      }
+      return 0;
+    case 37:
+      switch (s->type) {
+      case ButtonPress:
+      case ButtonRelease:
+        s->xbutton.root= PerlXlib_sv_to_xid(value); return 1;
+      case EnterNotify:
+      case LeaveNotify:
+        s->xcrossing.root= PerlXlib_sv_to_xid(value); return 1;
+      case KeyPress:
+      case KeyRelease:
+        s->xkey.root= PerlXlib_sv_to_xid(value); return 1;
+      case MotionNotify:
+        s->xmotion.root= PerlXlib_sv_to_xid(value); return 1;
+      }
+      return 0;
+    case 38:
+      switch (s->type) {
+      case ClientMessage:
+        { if (!SvPOK(value) || SvCUR(value) != sizeof(short)*10)  croak("Expected scalar of length %ld but got %ld", (long)(sizeof(short)*10), (long) SvCUR(value)); memcpy(s->xclient.data.s, SvPVX(value), sizeof(short)*10);} return 1;
+      }
+      return 0;
+    case 39:
+      switch (s->type) {
+      case ButtonPress:
+      case ButtonRelease:
+        s->xbutton.same_screen= SvIV(value); return 1;
+      case EnterNotify:
+      case LeaveNotify:
+        s->xcrossing.same_screen= SvIV(value); return 1;
+      case KeyPress:
+      case KeyRelease:
+        s->xkey.same_screen= SvIV(value); return 1;
+      case MotionNotify:
+        s->xmotion.same_screen= SvIV(value); return 1;
+      }
+      return 0;
+    case 40:
+      switch (s->type) {
+      case SelectionNotify:
+        s->xselection.selection= PerlXlib_sv_to_xid(value); return 1;
+      case SelectionClear:
+        s->xselectionclear.selection= PerlXlib_sv_to_xid(value); return 1;
+      case SelectionRequest:
+        s->xselectionrequest.selection= PerlXlib_sv_to_xid(value); return 1;
+      }
+      return 0;
+    case 41: if (!s->type) return 0; s->xany.send_event= SvIV(value); return 1;
+    case 42: if (s->type) s->xany.serial= SvUV(value); else s->xerror.serial= SvUV(value); return 1;
+    case 43:
+      switch (s->type) {
+      case ButtonPress:
+      case ButtonRelease:
+        s->xbutton.state= SvUV(value); return 1;
+      case ColormapNotify:
+        s->xcolormap.state= SvIV(value); return 1;
+      case EnterNotify:
+      case LeaveNotify:
+        s->xcrossing.state= SvUV(value); return 1;
+      case KeyPress:
+      case KeyRelease:
+        s->xkey.state= SvUV(value); return 1;
+      case MotionNotify:
+        s->xmotion.state= SvUV(value); return 1;
+      case PropertyNotify:
+        s->xproperty.state= SvIV(value); return 1;
+      case VisibilityNotify:
+        s->xvisibility.state= SvIV(value); return 1;
+      }
+      return 0;
+    case 44:
+      switch (s->type) {
+      case ButtonPress:
+      case ButtonRelease:
+        s->xbutton.subwindow= PerlXlib_sv_to_xid(value); return 1;
+      case EnterNotify:
+      case LeaveNotify:
+        s->xcrossing.subwindow= PerlXlib_sv_to_xid(value); return 1;
+      case KeyPress:
+      case KeyRelease:
+        s->xkey.subwindow= PerlXlib_sv_to_xid(value); return 1;
+      case MotionNotify:
+        s->xmotion.subwindow= PerlXlib_sv_to_xid(value); return 1;
+      }
+      return 0;
+    case 45:
+      switch (s->type) {
+      case SelectionNotify:
+        s->xselection.target= PerlXlib_sv_to_xid(value); return 1;
+      case SelectionRequest:
+        s->xselectionrequest.target= PerlXlib_sv_to_xid(value); return 1;
+      }
+      return 0;
+    case 46:
+      switch (s->type) {
+      case ButtonPress:
+      case ButtonRelease:
+        s->xbutton.time= SvUV(value); return 1;
+      case EnterNotify:
+      case LeaveNotify:
+        s->xcrossing.time= SvUV(value); return 1;
+      case KeyPress:
+      case KeyRelease:
+        s->xkey.time= SvUV(value); return 1;
+      case MotionNotify:
+        s->xmotion.time= SvUV(value); return 1;
+      case PropertyNotify:
+        s->xproperty.time= SvUV(value); return 1;
+      case SelectionNotify:
+        s->xselection.time= SvUV(value); return 1;
+      case SelectionClear:
+        s->xselectionclear.time= SvUV(value); return 1;
+      case SelectionRequest:
+        s->xselectionrequest.time= SvUV(value); return 1;
+      }
+      return 0;
+    case 47:
+      newtype= SvIV(value);
+      if (s->type != newtype) {
+        oldpkg= PerlXlib_xevent_pkg_for_type(s->type);
+        newpkg= PerlXlib_xevent_pkg_for_type(newtype);
+        s->type= newtype;
+        if (oldpkg != newpkg) {
+          /* re-initialize all fields in the area that changed */
+          memset( ((char*)(void*)s) + sizeof(XAnyEvent), 0, sizeof(XEvent)-sizeof(XAnyEvent) );
+        }
+      }
+      return 1;
+    case 48:
+      switch (s->type) {
+      case ConfigureRequest:
+        s->xconfigurerequest.value_mask= SvUV(value); return 1;
+      }
+      return 0;
+    case 49:
+      switch (s->type) {
+      case ConfigureNotify:
+        s->xconfigure.width= SvIV(value); return 1;
+      case ConfigureRequest:
+        s->xconfigurerequest.width= SvIV(value); return 1;
+      case CreateNotify:
+        s->xcreatewindow.width= SvIV(value); return 1;
+      case Expose:
+        s->xexpose.width= SvIV(value); return 1;
+      case GraphicsExpose:
+        s->xgraphicsexpose.width= SvIV(value); return 1;
+      case ResizeRequest:
+        s->xresizerequest.width= SvIV(value); return 1;
+      }
+      return 0;
+    case 50:
+      switch (s->type) {
+      case ButtonPress:
+      case ButtonRelease:
+        s->xbutton.window= PerlXlib_sv_to_xid(value); return 1;
+      case CirculateNotify:
+        s->xcirculate.window= PerlXlib_sv_to_xid(value); return 1;
+      case CirculateRequest:
+        s->xcirculaterequest.window= PerlXlib_sv_to_xid(value); return 1;
+      case ClientMessage:
+        s->xclient.window= PerlXlib_sv_to_xid(value); return 1;
+      case ColormapNotify:
+        s->xcolormap.window= PerlXlib_sv_to_xid(value); return 1;
+      case ConfigureNotify:
+        s->xconfigure.window= PerlXlib_sv_to_xid(value); return 1;
+      case ConfigureRequest:
+        s->xconfigurerequest.window= PerlXlib_sv_to_xid(value); return 1;
+      case CreateNotify:
+        s->xcreatewindow.window= PerlXlib_sv_to_xid(value); return 1;
+      case EnterNotify:
+      case LeaveNotify:
+        s->xcrossing.window= PerlXlib_sv_to_xid(value); return 1;
+      case DestroyNotify:
+        s->xdestroywindow.window= PerlXlib_sv_to_xid(value); return 1;
+      case Expose:
+        s->xexpose.window= PerlXlib_sv_to_xid(value); return 1;
+      case FocusIn:
+      case FocusOut:
+        s->xfocus.window= PerlXlib_sv_to_xid(value); return 1;
+      case GravityNotify:
+        s->xgravity.window= PerlXlib_sv_to_xid(value); return 1;
+      case KeyPress:
+      case KeyRelease:
+        s->xkey.window= PerlXlib_sv_to_xid(value); return 1;
+      case KeymapNotify:
+        s->xkeymap.window= PerlXlib_sv_to_xid(value); return 1;
+      case MapNotify:
+        s->xmap.window= PerlXlib_sv_to_xid(value); return 1;
+      case MappingNotify:
+        s->xmapping.window= PerlXlib_sv_to_xid(value); return 1;
+      case MapRequest:
+        s->xmaprequest.window= PerlXlib_sv_to_xid(value); return 1;
+      case MotionNotify:
+        s->xmotion.window= PerlXlib_sv_to_xid(value); return 1;
+      case PropertyNotify:
+        s->xproperty.window= PerlXlib_sv_to_xid(value); return 1;
+      case ReparentNotify:
+        s->xreparent.window= PerlXlib_sv_to_xid(value); return 1;
+      case ResizeRequest:
+        s->xresizerequest.window= PerlXlib_sv_to_xid(value); return 1;
+      case SelectionClear:
+        s->xselectionclear.window= PerlXlib_sv_to_xid(value); return 1;
+      case UnmapNotify:
+        s->xunmap.window= PerlXlib_sv_to_xid(value); return 1;
+      case VisibilityNotify:
+        s->xvisibility.window= PerlXlib_sv_to_xid(value); return 1;
+      }
+      return 0;
+    case 51:
+      switch (s->type) {
+      case ButtonPress:
+      case ButtonRelease:
+        s->xbutton.x= SvIV(value); return 1;
+      case ConfigureNotify:
+        s->xconfigure.x= SvIV(value); return 1;
+      case ConfigureRequest:
+        s->xconfigurerequest.x= SvIV(value); return 1;
+      case CreateNotify:
+        s->xcreatewindow.x= SvIV(value); return 1;
+      case EnterNotify:
+      case LeaveNotify:
+        s->xcrossing.x= SvIV(value); return 1;
+      case Expose:
+        s->xexpose.x= SvIV(value); return 1;
+      case GraphicsExpose:
+        s->xgraphicsexpose.x= SvIV(value); return 1;
+      case GravityNotify:
+        s->xgravity.x= SvIV(value); return 1;
+      case KeyPress:
+      case KeyRelease:
+        s->xkey.x= SvIV(value); return 1;
+      case MotionNotify:
+        s->xmotion.x= SvIV(value); return 1;
+      case ReparentNotify:
+        s->xreparent.x= SvIV(value); return 1;
+      }
+      return 0;
+    case 52:
+      switch (s->type) {
+      case ButtonPress:
+      case ButtonRelease:
+        s->xbutton.x_root= SvIV(value); return 1;
+      case EnterNotify:
+      case LeaveNotify:
+        s->xcrossing.x_root= SvIV(value); return 1;
+      case KeyPress:
+      case KeyRelease:
+        s->xkey.x_root= SvIV(value); return 1;
+      case MotionNotify:
+        s->xmotion.x_root= SvIV(value); return 1;
+      }
+      return 0;
+    case 53:
+      switch (s->type) {
+      case ButtonPress:
+      case ButtonRelease:
+        s->xbutton.y= SvIV(value); return 1;
+      case ConfigureNotify:
+        s->xconfigure.y= SvIV(value); return 1;
+      case ConfigureRequest:
+        s->xconfigurerequest.y= SvIV(value); return 1;
+      case CreateNotify:
+        s->xcreatewindow.y= SvIV(value); return 1;
+      case EnterNotify:
+      case LeaveNotify:
+        s->xcrossing.y= SvIV(value); return 1;
+      case Expose:
+        s->xexpose.y= SvIV(value); return 1;
+      case GraphicsExpose:
+        s->xgraphicsexpose.y= SvIV(value); return 1;
+      case GravityNotify:
+        s->xgravity.y= SvIV(value); return 1;
+      case KeyPress:
+      case KeyRelease:
+        s->xkey.y= SvIV(value); return 1;
+      case MotionNotify:
+        s->xmotion.y= SvIV(value); return 1;
+      case ReparentNotify:
+        s->xreparent.y= SvIV(value); return 1;
+      }
+      return 0;
+    case 54:
+      switch (s->type) {
+      case ButtonPress:
+      case ButtonRelease:
+        s->xbutton.y_root= SvIV(value); return 1;
+      case EnterNotify:
+      case LeaveNotify:
+        s->xcrossing.y_root= SvIV(value); return 1;
+      case KeyPress:
+      case KeyRelease:
+        s->xkey.y_root= SvIV(value); return 1;
+      case MotionNotify:
+        s->xmotion.y_root= SvIV(value); return 1;
+      }
+      return 0;
+    }
+    return 0;
+}
+
+const PerlXlib_struct_fields PerlXlib_XEvent_fields= {
+    55, PerlXlib_XEvent_field_names,
+    (PerlXlib_struct_get_field_fn*) &PerlXlib_XEvent_get_field,
+    (PerlXlib_struct_set_field_fn*) &PerlXlib_XEvent_set_field
+};
+
 /* END GENERATED X11_Xlib_XEvent */
 /*--------------------------------------------------------------------------*/
 /* BEGIN GENERATED X11_Xlib_XVisualInfo */
@@ -1552,6 +2860,62 @@ void PerlXlib_XVisualInfo_unpack_obj(XVisualInfo *s, HV *fields, SV *obj_ref) {
         croak("Can't store field in supplied hash (tied maybe?)");
 }
 
+static const char * const PerlXlib_XVisualInfo_field_names[]= {
+    "bits_per_rgb",
+    "blue_mask",
+    "class",
+    "colormap_size",
+    "depth",
+    "green_mask",
+    "red_mask",
+    "screen",
+    "visual",
+    "visualid",
+};
+
+static SV* PerlXlib_XVisualInfo_get_field(XVisualInfo *s, int idx, SV *obj_ref) {
+    switch (idx) {
+    case 0: return newSViv(s->bits_per_rgb);
+    case 1: return newSVuv(s->blue_mask);
+    case 2: return newSViv(s->class);
+    case 3: return newSViv(s->colormap_size);
+    case 4: return newSViv(s->depth);
+    case 5: return newSVuv(s->green_mask);
+    case 6: return newSVuv(s->red_mask);
+    case 7: return newSViv(s->screen);
+    case 8: {
+      SV *dpy_sv= PerlXlib_objref_get_display(obj_ref);
+      Display *dpy= PerlXlib_display_objref_get_pointer(dpy_sv, PerlXlib_OR_NULL);
+      return newSVsv(PerlXlib_get_objref(s->visual, PerlXlib_AUTOCREATE, "Visual", SVt_PVMG, "X11::Xlib::Visual", dpy));
+    }
+    case 9: return newSVuv(s->visualid);
+    }
+    return NULL;
+}
+
+static Bool PerlXlib_XVisualInfo_set_field(XVisualInfo *s, int idx, SV *value) {
+    switch (idx) {
+    case 0: s->bits_per_rgb= SvIV(value); break;
+    case 1: s->blue_mask= SvUV(value); break;
+    case 2: s->class= SvIV(value); break;
+    case 3: s->colormap_size= SvIV(value); break;
+    case 4: s->depth= SvIV(value); break;
+    case 5: s->green_mask= SvUV(value); break;
+    case 6: s->red_mask= SvUV(value); break;
+    case 7: s->screen= SvIV(value); break;
+    case 8: s->visual= (Visual *) PerlXlib_objref_get_pointer(value, "Visual", PerlXlib_OR_NULL); break;
+    case 9: s->visualid= SvUV(value); break;
+    default: return 0;
+    }
+    return 1;
+}
+
+const PerlXlib_struct_fields PerlXlib_XVisualInfo_fields= {
+    10, PerlXlib_XVisualInfo_field_names,
+    (PerlXlib_struct_get_field_fn*) &PerlXlib_XVisualInfo_get_field,
+    (PerlXlib_struct_set_field_fn*) &PerlXlib_XVisualInfo_set_field
+};
+
 /* END GENERATED X11_Xlib_XVisualInfo
 /*--------------------------------------------------------------------------*/
 /* BEGIN GENERATED X11_Xlib_XWindowChanges */
@@ -1601,6 +2965,49 @@ void PerlXlib_XWindowChanges_unpack_obj(XWindowChanges *s, HV *fields, SV *obj_r
         croak("Can't store field in supplied hash (tied maybe?)");
 }
 
+static const char * const PerlXlib_XWindowChanges_field_names[]= {
+    "border_width",
+    "height",
+    "sibling",
+    "stack_mode",
+    "width",
+    "x",
+    "y",
+};
+
+static SV* PerlXlib_XWindowChanges_get_field(XWindowChanges *s, int idx, SV *obj_ref) {
+    switch (idx) {
+    case 0: return newSViv(s->border_width);
+    case 1: return newSViv(s->height);
+    case 2: return newSVuv(s->sibling);
+    case 3: return newSViv(s->stack_mode);
+    case 4: return newSViv(s->width);
+    case 5: return newSViv(s->x);
+    case 6: return newSViv(s->y);
+    }
+    return NULL;
+}
+
+static Bool PerlXlib_XWindowChanges_set_field(XWindowChanges *s, int idx, SV *value) {
+    switch (idx) {
+    case 0: s->border_width= SvIV(value); break;
+    case 1: s->height= SvIV(value); break;
+    case 2: s->sibling= PerlXlib_sv_to_xid(value); break;
+    case 3: s->stack_mode= SvIV(value); break;
+    case 4: s->width= SvIV(value); break;
+    case 5: s->x= SvIV(value); break;
+    case 6: s->y= SvIV(value); break;
+    default: return 0;
+    }
+    return 1;
+}
+
+const PerlXlib_struct_fields PerlXlib_XWindowChanges_fields= {
+    7, PerlXlib_XWindowChanges_field_names,
+    (PerlXlib_struct_get_field_fn*) &PerlXlib_XWindowChanges_get_field,
+    (PerlXlib_struct_set_field_fn*) &PerlXlib_XWindowChanges_set_field
+};
+
 /* END GENERATED X11_Xlib_XWindowChanges */
 /*--------------------------------------------------------------------------*/
 /* BEGIN GENERATED X11_Xlib_XWindowAttributes */
@@ -1715,6 +3122,100 @@ void PerlXlib_XWindowAttributes_unpack_obj(XWindowAttributes *s, HV *fields, SV
         croak("Can't store field in supplied hash (tied maybe?)");
 }
 
+static const char * const PerlXlib_XWindowAttributes_field_names[]= {
+    "all_event_masks",
+    "backing_pixel",
+    "backing_planes",
+    "backing_store",
+    "bit_gravity",
+    "border_width",
+    "class",
+    "colormap",
+    "depth",
+    "do_not_propagate_mask",
+    "height",
+    "map_installed",
+    "map_state",
+    "override_redirect",
+    "root",
+    "save_under",
+    "screen",
+    "visual",
+    "width",
+    "win_gravity",
+    "x",
+    "y",
+    "your_event_mask",
+};
+
+static SV* PerlXlib_XWindowAttributes_get_field(XWindowAttributes *s, int idx, SV *obj_ref) {
+    switch (idx) {
+    case 0: return newSViv(s->all_event_masks);
+    case 1: return newSVuv(s->backing_pixel);
+    case 2: return newSVuv(s->backing_planes);
+    case 3: return newSViv(s->backing_store);
+    case 4: return newSViv(s->bit_gravity);
+    case 5: return newSViv(s->border_width);
+    case 6: return newSViv(s->class);
+    case 7: return newSVuv(s->colormap);
+    case 8: return newSViv(s->depth);
+    case 9: return newSViv(s->do_not_propagate_mask);
+    case 10: return newSViv(s->height);
+    case 11: return newSViv(s->map_installed);
+    case 12: return newSViv(s->map_state);
+    case 13: return newSViv(s->override_redirect);
+    case 14: return newSVuv(s->root);
+    case 15: return newSViv(s->save_under);
+    case 16: return newSVsv(PerlXlib_get_screen_objref(s->screen, PerlXlib_OR_UNDEF));
+    case 17: {
+      Display *dpy= s->screen? DisplayOfScreen(s->screen) : NULL;
+      return newSVsv(PerlXlib_get_objref(s->visual, PerlXlib_AUTOCREATE, "Visual", SVt_PVMG, "X11::Xlib::Visual", dpy));
+    }
+    case 18: return newSViv(s->width);
+    case 19: return newSViv(s->win_gravity);
+    case 20: return newSViv(s->x);
+    case 21: return newSViv(s->y);
+    case 22: return newSViv(s->your_event_mask);
+    }
+    return NULL;
+}
+
+static Bool PerlXlib_XWindowAttributes_set_field(XWindowAttributes *s, int idx, SV *value) {
+    switch (idx) {
+    case 0: s->all_event_masks= SvIV(value); break;
+    case 1: s->backing_pixel= SvUV(value); break;
+    case 2: s->backing_planes= SvUV(value); break;
+    case 3: s->backing_store= SvIV(value); break;
+    case 4: s->bit_gravity= SvIV(value); break;
+    case 5: s->border_width= SvIV(value); break;
+    case 6: s->class= SvIV(value); break;
+    case 7: s->colormap= PerlXlib_sv_to_xid(value); break;
+    case 8: s->depth= SvIV(value); break;
+    case 9: s->do_not_propagate_mask= SvIV(value); break;
+    case 10: s->height= SvIV(value); break;
+    case 11: s->map_installed= SvIV(value); break;
+    case 12: s->map_state= SvIV(value); break;
+    case 13: s->override_redirect= SvIV(value); break;
+    case 14: s->root= PerlXlib_sv_to_xid(value); break;
+    case 15: s->save_under= SvIV(value); break;
+    case 16: s->screen= PerlXlib_screen_objref_get_pointer(value, PerlXlib_OR_NULL); break;
+    case 17: s->visual= (Visual *) PerlXlib_objref_get_pointer(value, "Visual", PerlXlib_OR_NULL); break;
+    case 18: s->width= SvIV(value); break;
+    case 19: s->win_gravity= SvIV(value); break;
+    case 20: s->x= SvIV(value); break;
+    case 21: s->y= SvIV(value); break;
+    case 22: s->your_event_mask= SvIV(value); break;
+    default: return 0;
+    }
+    return 1;
+}
+
+const PerlXlib_struct_fields PerlXlib_XWindowAttributes_fields= {
+    23, PerlXlib_XWindowAttributes_field_names,
+    (PerlXlib_struct_get_field_fn*) &PerlXlib_XWindowAttributes_get_field,
+    (PerlXlib_struct_set_field_fn*) &PerlXlib_XWindowAttributes_set_field
+};
+
 /* END GENERATED X11_Xlib_XWindowAttributes */
 /*--------------------------------------------------------------------------*/
 /* BEGIN GENERATED X11_Xlib_XSetWindowAttributes */
@@ -1796,6 +3297,73 @@ void PerlXlib_XSetWindowAttributes_unpack_obj(XSetWindowAttributes *s, HV *field
         croak("Can't store field in supplied hash (tied maybe?)");
 }
 
+static const char * const PerlXlib_XSetWindowAttributes_field_names[]= {
+    "background_pixel",
+    "background_pixmap",
+    "backing_pixel",
+    "backing_planes",
+    "backing_store",
+    "bit_gravity",
+    "border_pixel",
+    "border_pixmap",
+    "colormap",
+    "cursor",
+    "do_not_propagate_mask",
+    "event_mask",
+    "override_redirect",
+    "save_under",
+    "win_gravity",
+};
+
+static SV* PerlXlib_XSetWindowAttributes_get_field(XSetWindowAttributes *s, int idx, SV *obj_ref) {
+    switch (idx) {
+    case 0: return newSVuv(s->background_pixel);
+    case 1: return newSVuv(s->background_pixmap);
+    case 2: return newSVuv(s->backing_pixel);
+    case 3: return newSVuv(s->backing_planes);
+    case 4: return newSViv(s->backing_store);
+    case 5: return newSViv(s->bit_gravity);
+    case 6: return newSVuv(s->border_pixel);
+    case 7: return newSVuv(s->border_pixmap);
+    case 8: return newSVuv(s->colormap);
+    case 9: return newSVuv(s->cursor);
+    case 10: return newSViv(s->do_not_propagate_mask);
+    case 11: return newSViv(s->event_mask);
+    case 12: return newSViv(s->override_redirect);
+    case 13: return newSViv(s->save_under);
+    case 14: return newSViv(s->win_gravity);
+    }
+    return NULL;
+}
+
+static Bool PerlXlib_XSetWindowAttributes_set_field(XSetWindowAttributes *s, int idx, SV *value) {
+    switch (idx) {
+    case 0: s->background_pixel= SvUV(value); break;
+    case 1: s->background_pixmap= PerlXlib_sv_to_xid(value); break;
+    case 2: s->backing_pixel= SvUV(value); break;
+    case 3: s->backing_planes= SvUV(value); break;
+    case 4: s->backing_store= SvIV(value); break;
+    case 5: s->bit_gravity= SvIV(value); break;
+    case 6: s->border_pixel= SvUV(value); break;
+    case 7: s->border_pixmap= PerlXlib_sv_to_xid(value); break;
+    case 8: s->colormap= PerlXlib_sv_to_xid(value); break;
+    case 9: s->cursor= PerlXlib_sv_to_xid(value); break;
+    case 10: s->do_not_propagate_mask= SvIV(value); break;
+    case 11: s->event_mask= SvIV(value); break;
+    case 12: s->override_redirect= SvIV(value); break;
+    case 13: s->save_under= SvIV(value); break;
+    case 14: s->win_gravity= SvIV(value); break;
+    default: return 0;
+    }
+    return 1;
+}
+
+const PerlXlib_struct_fields PerlXlib_XSetWindowAttributes_fields= {
+    15, PerlXlib_XSetWindowAttributes_field_names,
+    (PerlXlib_struct_get_field_fn*) &PerlXlib_XSetWindowAttributes_get_field,
+    (PerlXlib_struct_set_field_fn*) &PerlXlib_XSetWindowAttributes_set_field
+};
+
 /* END GENERATED X11_Xlib_XSetWindowAttributes */
 /*--------------------------------------------------------------------------*/
 /* BEGIN GENERATED X11_Xlib_XSizeHints */
@@ -1889,6 +3457,82 @@ void PerlXlib_XSizeHints_unpack_obj(XSizeHints *s, HV *fields, SV *obj_ref) {
         croak("Can't store field in supplied hash (tied maybe?)");
 }
 
+static const char * const PerlXlib_XSizeHints_field_names[]= {
+    "base_height",
+    "base_width",
+    "flags",
+    "height",
+    "height_inc",
+    "max_aspect_x",
+    "max_aspect_y",
+    "max_height",
+    "max_width",
+    "min_aspect_x",
+    "min_aspect_y",
+    "min_height",
+    "min_width",
+    "width",
+    "width_inc",
+    "win_gravity",
+    "x",
+    "y",
+};
+
+static SV* PerlXlib_XSizeHints_get_field(XSizeHints *s, int idx, SV *obj_ref) {
+    switch (idx) {
+    case 0: return newSViv(s->base_height);
+    case 1: return newSViv(s->base_width);
+    case 2: return newSViv(s->flags);
+    case 3: return newSViv(s->height);
+    case 4: return newSViv(s->height_inc);
+    case 5: return newSViv(s->max_aspect.x);
+    case 6: return newSViv(s->max_aspect.y);
+    case 7: return newSViv(s->max_height);
+    case 8: return newSViv(s->max_width);
+    case 9: return newSViv(s->min_aspect.x);
+    case 10: return newSViv(s->min_aspect.y);
+    case 11: return newSViv(s->min_height);
+    case 12: return newSViv(s->min_width);
+    case 13: return newSViv(s->width);
+    case 14: return newSViv(s->width_inc);
+    case 15: return newSViv(s->win_gravity);
+    case 16: return newSViv(s->x);
+    case 17: return newSViv(s->y);
+    }
+    return NULL;
+}
+
+static Bool PerlXlib_XSizeHints_set_field(XSizeHints *s, int idx, SV *value) {
+    switch (idx) {
+    case 0: s->flags |= PBaseSize; s->base_height= SvIV(value); break;
+    case 1: s->flags |= PBaseSize; s->base_width= SvIV(value); break;
+    case 2: s->flags= SvIV(value); break;
+    case 3: s->flags |= PSize; s->height= SvIV(value); break;
+    case 4: s->flags |= PResizeInc; s->height_inc= SvIV(value); break;
+    case 5: s->flags |= PAspect; s->max_aspect.x= SvIV(value); break;
+    case 6: s->flags |= PAspect; s->max_aspect.y= SvIV(value); break;
+    case 7: s->flags |= PMaxSize; s->max_height= SvIV(value); break;
+    case 8: s->flags |= PMaxSize; s->max_width= SvIV(value); break;
+    case 9: s->flags |= PAspect; s->min_aspect.x= SvIV(value); break;
+    case 10: s->flags |= PAspect; s->min_aspect.y= SvIV(value); break;
+    case 11: s->flags |= PMinSize; s->min_height= SvIV(value); break;
+    case 12: s->flags |= PMinSize; s->min_width= SvIV(value); break;
+    case 13: s->flags |= PSize; s->width= SvIV(value); break;
+    case 14: s->flags |= PResizeInc; s->width_inc= SvIV(value); break;
+    case 15: s->flags |= PWinGravity; s->win_gravity= SvIV(value); break;
+    case 16: s->flags |= PPosition; s->x= SvIV(value); break;
+    case 17: s->flags |= PPosition; s->y= SvIV(value); break;
+    default: return 0;
+    }
+    return 1;
+}
+
+const PerlXlib_struct_fields PerlXlib_XSizeHints_fields= {
+    18, PerlXlib_XSizeHints_field_names,
+    (PerlXlib_struct_get_field_fn*) &PerlXlib_XSizeHints_get_field,
+    (PerlXlib_struct_set_field_fn*) &PerlXlib_XSizeHints_set_field
+};
+
 /* END GENERATED X11_Xlib_XSizeHints */
 /*--------------------------------------------------------------------------*/
 /* BEGIN GENERATED X11_Xlib_XRectangle */
@@ -1926,6 +3570,40 @@ void PerlXlib_XRectangle_unpack_obj(XRectangle *s, HV *fields, SV *obj_ref) {
         croak("Can't store field in supplied hash (tied maybe?)");
 }
 
+static const char * const PerlXlib_XRectangle_field_names[]= {
+    "height",
+    "width",
+    "x",
+    "y",
+};
+
+static SV* PerlXlib_XRectangle_get_field(XRectangle *s, int idx, SV *obj_ref) {
+    switch (idx) {
+    case 0: return newSVuv(s->height);
+    case 1: return newSVuv(s->width);
+    case 2: return newSViv(s->x);
+    case 3: return newSViv(s->y);
+    }
+    return NULL;
+}
+
+static Bool PerlXlib_XRectangle_set_field(XRectangle *s, int idx, SV *value) {
+    switch (idx) {
+    case 0: s->height= SvUV(value); break;
+    case 1: s->width= SvUV(value); break;
+    case 2: s->x= SvIV(value); break;
+    case 3: s->y= SvIV(value); break;
+    default: return 0;
+    }
+    return 1;
+}
+
+const PerlXlib_struct_fields PerlXlib_XRectangle_fields= {
+    4, PerlXlib_XRectangle_field_names,
+    (PerlXlib_struct_get_field_fn*) &PerlXlib_XRectangle_get_field,
+    (PerlXlib_struct_set_field_fn*) &PerlXlib_XRectangle_set_field
+};
+
 /* END GENERATED X11_Xlib_XRectangle */
 /*--------------------------------------------------------------------------*/
 /* BEGIN GENERATED X11_Xlib_XKeyboardState */
@@ -1975,6 +3653,49 @@ void PerlXlib_XKeyboardState_unpack_obj(XKeyboardState *s, HV *fields, SV *obj_r
         croak("Can't store field in supplied hash (tied maybe?)");
 }
 
+static const char * const PerlXlib_XKeyboardState_field_names[]= {
+    "auto_repeats",
+    "bell_duration",
+    "bell_percent",
+    "bell_pitch",
+    "global_auto_repeat",
+    "key_click_percent",
+    "led_mask",
+};
+
+static SV* PerlXlib_XKeyboardState_get_field(XKeyboardState *s, int idx, SV *obj_ref) {
+    switch (idx) {
+    case 0: return newSVpvn((void*)s->auto_repeats, sizeof(char)*32);
+    case 1: return newSVuv(s->bell_duration);
+    case 2: return newSViv(s->bell_percent);
+    case 3: return newSVuv(s->bell_pitch);
+    case 4: return newSViv(s->global_auto_repeat);
+    case 5: return newSViv(s->key_click_percent);
+    case 6: return newSVuv(s->led_mask);
+    }
+    return NULL;
+}
+
+static Bool PerlXlib_XKeyboardState_set_field(XKeyboardState *s, int idx, SV *value) {
+    switch (idx) {
+    case 0: { if (!SvPOK(value) || SvCUR(value) != sizeof(char)*32)  croak("Expected scalar of length %ld but got %ld", (long)(sizeof(char)*32), (long)SvCUR(value)); memcpy(s->auto_repeats, SvPVX(value), sizeof(char)*32);} break;
+    case 1: s->bell_duration= SvUV(value); break;
+    case 2: s->bell_percent= SvIV(value); break;
+    case 3: s->bell_pitch= SvUV(value); break;
+    case 4: s->global_auto_repeat= SvIV(value); break;
+    case 5: s->key_click_percent= SvIV(value); break;
+    case 6: s->led_mask= SvUV(value); break;
+    default: return 0;
+    }
+    return 1;
+}
+
+const PerlXlib_struct_fields PerlXlib_XKeyboardState_fields= {
+    7, PerlXlib_XKeyboardState_field_names,
+    (PerlXlib_struct_get_field_fn*) &PerlXlib_XKeyboardState_get_field,
+    (PerlXlib_struct_set_field_fn*) &PerlXlib_XKeyboardState_set_field
+};
+
 /* END GENERATED X11_Xlib_XKeyboardState */
 /*--------------------------------------------------------------------------*/
 /* BEGIN GENERATED X11_Xlib_XRenderPictFormat */
@@ -2044,8 +3765,404 @@ void PerlXlib_XRenderPictFormat_unpack_obj(XRenderPictFormat *s, HV *fields, SV
         croak("Can't store field in supplied hash (tied maybe?)");
 }
 
+static const char * const PerlXlib_XRenderPictFormat_field_names[]= {
+    "colormap",
+    "depth",
+    "direct_alpha",
+    "direct_alphaMask",
+    "direct_blue",
+    "direct_blueMask",
+    "direct_green",
+    "direct_greenMask",
+    "direct_red",
+    "direct_redMask",
+    "id",
+    "type",
+};
+
+static SV* PerlXlib_XRenderPictFormat_get_field(XRenderPictFormat *s, int idx, SV *obj_ref) {
+    switch (idx) {
+    case 0: return newSVuv(s->colormap);
+    case 1: return newSViv(s->depth);
+    case 2: return newSViv(s->direct.alpha);
+    case 3: return newSViv(s->direct.alphaMask);
+    case 4: return newSViv(s->direct.blue);
+    case 5: return newSViv(s->direct.blueMask);
+    case 6: return newSViv(s->direct.green);
+    case 7: return newSViv(s->direct.greenMask);
+    case 8: return newSViv(s->direct.red);
+    case 9: return newSViv(s->direct.redMask);
+    case 10: return newSVuv(s->id);
+    case 11: return newSViv(s->type);
+    }
+    return NULL;
+}
+
+static Bool PerlXlib_XRenderPictFormat_set_field(XRenderPictFormat *s, int idx, SV *value) {
+    switch (idx) {
+    case 0: s->colormap= PerlXlib_sv_to_xid(value); break;
+    case 1: s->depth= SvIV(value); break;
+    case 2: s->direct.alpha= SvIV(value); break;
+    case 3: s->direct.alphaMask= SvIV(value); break;
+    case 4: s->direct.blue= SvIV(value); break;
+    case 5: s->direct.blueMask= SvIV(value); break;
+    case 6: s->direct.green= SvIV(value); break;
+    case 7: s->direct.greenMask= SvIV(value); break;
+    case 8: s->direct.red= SvIV(value); break;
+    case 9: s->direct.redMask= SvIV(value); break;
+    case 10: s->id= PerlXlib_sv_to_xid(value); break;
+    case 11: s->type= SvIV(value); break;
+    default: return 0;
+    }
+    return 1;
+}
+
+const PerlXlib_struct_fields PerlXlib_XRenderPictFormat_fields= {
+    12, PerlXlib_XRenderPictFormat_field_names,
+    (PerlXlib_struct_get_field_fn*) &PerlXlib_XRenderPictFormat_get_field,
+    (PerlXlib_struct_set_field_fn*) &PerlXlib_XRenderPictFormat_set_field
+};
+
 /* END GENERATED X11_Xlib_XRenderPictFormat */
 /*--------------------------------------------------------------------------*/
+/* BEGIN GENERATED X11_Xlib_XRenderPictureAttributes */
+
+void PerlXlib_XRenderPictureAttributes_pack(XRenderPictureAttributes *s, HV *fields, Bool consume) {
+    SV **fp;
+    Display *dpy= NULL; /* not available.  Magic display attribute is handled by caller. */
+
+    fp= hv_fetch(fields, "alpha_map", 9, 0);
+    if (fp && *fp) { s->alpha_map= PerlXlib_sv_to_xid(*fp); if (consume) hv_delete(fields, "alpha_map", 9, G_DISCARD); }
+
+    fp= hv_fetch(fields, "alpha_x_origin", 14, 0);
+    if (fp && *fp) { s->alpha_x_origin= SvIV(*fp); if (consume) hv_delete(fields, "alpha_x_origin", 14, G_DISCARD); }
+
+    fp= hv_fetch(fields, "alpha_y_origin", 14, 0);
+    if (fp && *fp) { s->alpha_y_origin= SvIV(*fp); if (consume) hv_delete(fields, "alpha_y_origin", 14, G_DISCARD); }
+
+    fp= hv_fetch(fields, "clip_mask", 9, 0);
+    if (fp && *fp) { s->clip_mask= PerlXlib_sv_to_xid(*fp); if (consume) hv_delete(fields, "clip_mask", 9, G_DISCARD); }
+
+    fp= hv_fetch(fields, "clip_x_origin", 13, 0);
+    if (fp && *fp) { s->clip_x_origin= SvIV(*fp); if (consume) hv_delete(fields, "clip_x_origin", 13, G_DISCARD); }
+
+    fp= hv_fetch(fields, "clip_y_origin", 13, 0);
+    if (fp && *fp) { s->clip_y_origin= SvIV(*fp); if (consume) hv_delete(fields, "clip_y_origin", 13, G_DISCARD); }
+
+    fp= hv_fetch(fields, "component_alpha", 15, 0);
+    if (fp && *fp) { s->component_alpha= SvIV(*fp); if (consume) hv_delete(fields, "component_alpha", 15, G_DISCARD); }
+
+    fp= hv_fetch(fields, "dither", 6, 0);
+    if (fp && *fp) { s->dither= SvUV(*fp); if (consume) hv_delete(fields, "dither", 6, G_DISCARD); }
+
+    fp= hv_fetch(fields, "graphics_exposures", 18, 0);
+    if (fp && *fp) { s->graphics_exposures= SvIV(*fp); if (consume) hv_delete(fields, "graphics_exposures", 18, G_DISCARD); }
+
+    fp= hv_fetch(fields, "poly_edge", 9, 0);
+    if (fp && *fp) { s->poly_edge= SvIV(*fp); if (consume) hv_delete(fields, "poly_edge", 9, G_DISCARD); }
+
+    fp= hv_fetch(fields, "poly_mode", 9, 0);
+    if (fp && *fp) { s->poly_mode= SvIV(*fp); if (consume) hv_delete(fields, "poly_mode", 9, G_DISCARD); }
+
+    fp= hv_fetch(fields, "repeat", 6, 0);
+    if (fp && *fp) { s->repeat= SvIV(*fp); if (consume) hv_delete(fields, "repeat", 6, G_DISCARD); }
+
+    fp= hv_fetch(fields, "subwindow_mode", 14, 0);
+    if (fp && *fp) { s->subwindow_mode= SvIV(*fp); if (consume) hv_delete(fields, "subwindow_mode", 14, G_DISCARD); }
+}
+
+void PerlXlib_XRenderPictureAttributes_unpack_obj(XRenderPictureAttributes *s, HV *fields, SV *obj_ref) {
+    /* hv_store may return NULL if there is an error, or if the hash is tied.
+     * If it does, we need to release the reference to the value we almost inserted,
+     * so track allocated SV in this var.
+     */
+    SV *sv= NULL;
+    if (!hv_store(fields, "alpha_map" ,  9, (sv=newSVuv(s->alpha_map)), 0)) goto store_fail;
+    if (!hv_store(fields, "alpha_x_origin", 14, (sv=newSViv(s->alpha_x_origin)), 0)) goto store_fail;
+    if (!hv_store(fields, "alpha_y_origin", 14, (sv=newSViv(s->alpha_y_origin)), 0)) goto store_fail;
+    if (!hv_store(fields, "clip_mask" ,  9, (sv=newSVuv(s->clip_mask)), 0)) goto store_fail;
+    if (!hv_store(fields, "clip_x_origin", 13, (sv=newSViv(s->clip_x_origin)), 0)) goto store_fail;
+    if (!hv_store(fields, "clip_y_origin", 13, (sv=newSViv(s->clip_y_origin)), 0)) goto store_fail;
+    if (!hv_store(fields, "component_alpha", 15, (sv=newSViv(s->component_alpha)), 0)) goto store_fail;
+    if (!hv_store(fields, "dither"    ,  6, (sv=newSVuv(s->dither)), 0)) goto store_fail;
+    if (!hv_store(fields, "graphics_exposures", 18, (sv=newSViv(s->graphics_exposures)), 0)) goto store_fail;
+    if (!hv_store(fields, "poly_edge" ,  9, (sv=newSViv(s->poly_edge)), 0)) goto store_fail;
+    if (!hv_store(fields, "poly_mode" ,  9, (sv=newSViv(s->poly_mode)), 0)) goto store_fail;
+    if (!hv_store(fields, "repeat"    ,  6, (sv=newSViv(s->repeat)), 0)) goto store_fail;
+    if (!hv_store(fields, "subwindow_mode", 14, (sv=newSViv(s->subwindow_mode)), 0)) goto store_fail;
+    return;
+    store_fail:
+        if (sv) sv_2mortal(sv);
+        croak("Can't store field in supplied hash (tied maybe?)");
+}
+
+static const char * const PerlXlib_XRenderPictureAttributes_field_names[]= {
+    "alpha_map",
+    "alpha_x_origin",
+    "alpha_y_origin",
+    "clip_mask",
+    "clip_x_origin",
+    "clip_y_origin",
+    "component_alpha",
+    "dither",
+    "graphics_exposures",
+    "poly_edge",
+    "poly_mode",
+    "repeat",
+    "subwindow_mode",
+};
+
+static SV* PerlXlib_XRenderPictureAttributes_get_field(XRenderPictureAttributes *s, int idx, SV *obj_ref) {
+    switch (idx) {
+    case 0: return newSVuv(s->alpha_map);
+    case 1: return newSViv(s->alpha_x_origin);
+    case 2: return newSViv(s->alpha_y_origin);
+    case 3: return newSVuv(s->clip_mask);
+    case 4: return newSViv(s->clip_x_origin);
+    case 5: return newSViv(s->clip_y_origin);
+    case 6: return newSViv(s->component_alpha);
+    case 7: return newSVuv(s->dither);
+    case 8: return newSViv(s->graphics_exposures);
+    case 9: return newSViv(s->poly_edge);
+    case 10: return newSViv(s->poly_mode);
+    case 11: return newSViv(s->repeat);
+    case 12: return newSViv(s->subwindow_mode);
+    }
+    return NULL;
+}
+
+static Bool PerlXlib_XRenderPictureAttributes_set_field(XRenderPictureAttributes *s, int idx, SV *value) {
+    switch (idx) {
+    case 0: s->alpha_map= PerlXlib_sv_to_xid(value); break;
+    case 1: s->alpha_x_origin= SvIV(value); break;
+    case 2: s->alpha_y_origin= SvIV(value); break;
+    case 3: s->clip_mask= PerlXlib_sv_to_xid(value); break;
+    case 4: s->clip_x_origin= SvIV(value); break;
+    case 5: s->clip_y_origin= SvIV(value); break;
+    case 6: s->component_alpha= SvIV(value); break;
+    case 7: s->dither= SvUV(value); break;
+    case 8: s->graphics_exposures= SvIV(value); break;
+    case 9: s->poly_edge= SvIV(value); break;
+    case 10: s->poly_mode= SvIV(value); break;
+    case 11: s->repeat= SvIV(value); break;
+    case 12: s->subwindow_mode= SvIV(value); break;
+    default: return 0;
+    }
+    return 1;
+}
+
+const PerlXlib_struct_fields PerlXlib_XRenderPictureAttributes_fields= {
+    13, PerlXlib_XRenderPictureAttributes_field_names,
+    (PerlXlib_struct_get_field_fn*) &PerlXlib_XRenderPictureAttributes_get_field,
+    (PerlXlib_struct_set_field_fn*) &PerlXlib_XRenderPictureAttributes_set_field
+};
+
+/* END GENERATED X11_Xlib_XRenderPictureAttributes */
+/*--------------------------------------------------------------------------*/
+/* BEGIN GENERATED X11_Xlib_XGCValues */
+
+void PerlXlib_XGCValues_pack(XGCValues *s, HV *fields, Bool consume) {
+    SV **fp;
+    Display *dpy= NULL; /* not available.  Magic display attribute is handled by caller. */
+
+    fp= hv_fetch(fields, "arc_mode", 8, 0);
+    if (fp && *fp) { s->arc_mode= SvIV(*fp); if (consume) hv_delete(fields, "arc_mode", 8, G_DISCARD); }
+
+    fp= hv_fetch(fields, "background", 10, 0);
+    if (fp && *fp) { s->background= SvUV(*fp); if (consume) hv_delete(fields, "background", 10, G_DISCARD); }
+
+    fp= hv_fetch(fields, "cap_style", 9, 0);
+    if (fp && *fp) { s->cap_style= SvIV(*fp); if (consume) hv_delete(fields, "cap_style", 9, G_DISCARD); }
+
+    fp= hv_fetch(fields, "clip_mask", 9, 0);
+    if (fp && *fp) { s->clip_mask= PerlXlib_sv_to_xid(*fp); if (consume) hv_delete(fields, "clip_mask", 9, G_DISCARD); }
+
+    fp= hv_fetch(fields, "clip_x_origin", 13, 0);
+    if (fp && *fp) { s->clip_x_origin= SvIV(*fp); if (consume) hv_delete(fields, "clip_x_origin", 13, G_DISCARD); }
+
+    fp= hv_fetch(fields, "clip_y_origin", 13, 0);
+    if (fp && *fp) { s->clip_y_origin= SvIV(*fp); if (consume) hv_delete(fields, "clip_y_origin", 13, G_DISCARD); }
+
+    fp= hv_fetch(fields, "dash_offset", 11, 0);
+    if (fp && *fp) { s->dash_offset= SvIV(*fp); if (consume) hv_delete(fields, "dash_offset", 11, G_DISCARD); }
+
+    fp= hv_fetch(fields, "dashes", 6, 0);
+    if (fp && *fp) { s->dashes= SvIV(*fp); if (consume) hv_delete(fields, "dashes", 6, G_DISCARD); }
+
+    fp= hv_fetch(fields, "fill_rule", 9, 0);
+    if (fp && *fp) { s->fill_rule= SvIV(*fp); if (consume) hv_delete(fields, "fill_rule", 9, G_DISCARD); }
+
+    fp= hv_fetch(fields, "fill_style", 10, 0);
+    if (fp && *fp) { s->fill_style= SvIV(*fp); if (consume) hv_delete(fields, "fill_style", 10, G_DISCARD); }
+
+    fp= hv_fetch(fields, "font", 4, 0);
+    if (fp && *fp) { s->font= PerlXlib_sv_to_xid(*fp); if (consume) hv_delete(fields, "font", 4, G_DISCARD); }
+
+    fp= hv_fetch(fields, "foreground", 10, 0);
+    if (fp && *fp) { s->foreground= SvUV(*fp); if (consume) hv_delete(fields, "foreground", 10, G_DISCARD); }
+
+    fp= hv_fetch(fields, "function", 8, 0);
+    if (fp && *fp) { s->function= SvIV(*fp); if (consume) hv_delete(fields, "function", 8, G_DISCARD); }
+
+    fp= hv_fetch(fields, "graphics_exposures", 18, 0);
+    if (fp && *fp) { s->graphics_exposures= SvIV(*fp); if (consume) hv_delete(fields, "graphics_exposures", 18, G_DISCARD); }
+
+    fp= hv_fetch(fields, "join_style", 10, 0);
+    if (fp && *fp) { s->join_style= SvIV(*fp); if (consume) hv_delete(fields, "join_style", 10, G_DISCARD); }
+
+    fp= hv_fetch(fields, "line_style", 10, 0);
+    if (fp && *fp) { s->line_style= SvIV(*fp); if (consume) hv_delete(fields, "line_style", 10, G_DISCARD); }
+
+    fp= hv_fetch(fields, "line_width", 10, 0);
+    if (fp && *fp) { s->line_width= SvIV(*fp); if (consume) hv_delete(fields, "line_width", 10, G_DISCARD); }
+
+    fp= hv_fetch(fields, "plane_mask", 10, 0);
+    if (fp && *fp) { s->plane_mask= SvUV(*fp); if (consume) hv_delete(fields, "plane_mask", 10, G_DISCARD); }
+
+    fp= hv_fetch(fields, "stipple", 7, 0);
+    if (fp && *fp) { s->stipple= PerlXlib_sv_to_xid(*fp); if (consume) hv_delete(fields, "stipple", 7, G_DISCARD); }
+
+    fp= hv_fetch(fields, "subwindow_mode", 14, 0);
+    if (fp && *fp) { s->subwindow_mode= SvIV(*fp); if (consume) hv_delete(fields, "subwindow_mode", 14, G_DISCARD); }
+
+    fp= hv_fetch(fields, "tile", 4, 0);
+    if (fp && *fp) { s->tile= PerlXlib_sv_to_xid(*fp); if (consume) hv_delete(fields, "tile", 4, G_DISCARD); }
+
+    fp= hv_fetch(fields, "ts_x_origin", 11, 0);
+    if (fp && *fp) { s->ts_x_origin= SvIV(*fp); if (consume) hv_delete(fields, "ts_x_origin", 11, G_DISCARD); }
+
+    fp= hv_fetch(fields, "ts_y_origin", 11, 0);
+    if (fp && *fp) { s->ts_y_origin= SvIV(*fp); if (consume) hv_delete(fields, "ts_y_origin", 11, G_DISCARD); }
+}
+
+void PerlXlib_XGCValues_unpack_obj(XGCValues *s, HV *fields, SV *obj_ref) {
+    /* hv_store may return NULL if there is an error, or if the hash is tied.
+     * If it does, we need to release the reference to the value we almost inserted,
+     * so track allocated SV in this var.
+     */
+    SV *sv= NULL;
+    if (!hv_store(fields, "arc_mode"  ,  8, (sv=newSViv(s->arc_mode)), 0)) goto store_fail;
+    if (!hv_store(fields, "background", 10, (sv=newSVuv(s->background)), 0)) goto store_fail;
+    if (!hv_store(fields, "cap_style" ,  9, (sv=newSViv(s->cap_style)), 0)) goto store_fail;
+    if (!hv_store(fields, "clip_mask" ,  9, (sv=newSVuv(s->clip_mask)), 0)) goto store_fail;
+    if (!hv_store(fields, "clip_x_origin", 13, (sv=newSViv(s->clip_x_origin)), 0)) goto store_fail;
+    if (!hv_store(fields, "clip_y_origin", 13, (sv=newSViv(s->clip_y_origin)), 0)) goto store_fail;
+    if (!hv_store(fields, "dash_offset", 11, (sv=newSViv(s->dash_offset)), 0)) goto store_fail;
+    if (!hv_store(fields, "dashes"    ,  6, (sv=newSViv(s->dashes)), 0)) goto store_fail;
+    if (!hv_store(fields, "fill_rule" ,  9, (sv=newSViv(s->fill_rule)), 0)) goto store_fail;
+    if (!hv_store(fields, "fill_style", 10, (sv=newSViv(s->fill_style)), 0)) goto store_fail;
+    if (!hv_store(fields, "font"      ,  4, (sv=newSVuv(s->font)), 0)) goto store_fail;
+    if (!hv_store(fields, "foreground", 10, (sv=newSVuv(s->foreground)), 0)) goto store_fail;
+    if (!hv_store(fields, "function"  ,  8, (sv=newSViv(s->function)), 0)) goto store_fail;
+    if (!hv_store(fields, "graphics_exposures", 18, (sv=newSViv(s->graphics_exposures)), 0)) goto store_fail;
+    if (!hv_store(fields, "join_style", 10, (sv=newSViv(s->join_style)), 0)) goto store_fail;
+    if (!hv_store(fields, "line_style", 10, (sv=newSViv(s->line_style)), 0)) goto store_fail;
+    if (!hv_store(fields, "line_width", 10, (sv=newSViv(s->line_width)), 0)) goto store_fail;
+    if (!hv_store(fields, "plane_mask", 10, (sv=newSVuv(s->plane_mask)), 0)) goto store_fail;
+    if (!hv_store(fields, "stipple"   ,  7, (sv=newSVuv(s->stipple)), 0)) goto store_fail;
+    if (!hv_store(fields, "subwindow_mode", 14, (sv=newSViv(s->subwindow_mode)), 0)) goto store_fail;
+    if (!hv_store(fields, "tile"      ,  4, (sv=newSVuv(s->tile)), 0)) goto store_fail;
+    if (!hv_store(fields, "ts_x_origin", 11, (sv=newSViv(s->ts_x_origin)), 0)) goto store_fail;
+    if (!hv_store(fields, "ts_y_origin", 11, (sv=newSViv(s->ts_y_origin)), 0)) goto store_fail;
+    return;
+    store_fail:
+        if (sv) sv_2mortal(sv);
+        croak("Can't store field in supplied hash (tied maybe?)");
+}
+
+static const char * const PerlXlib_XGCValues_field_names[]= {
+    "arc_mode",
+    "background",
+    "cap_style",
+    "clip_mask",
+    "clip_x_origin",
+    "clip_y_origin",
+    "dash_offset",
+    "dashes",
+    "fill_rule",
+    "fill_style",
+    "font",
+    "foreground",
+    "function",
+    "graphics_exposures",
+    "join_style",
+    "line_style",
+    "line_width",
+    "plane_mask",
+    "stipple",
+    "subwindow_mode",
+    "tile",
+    "ts_x_origin",
+    "ts_y_origin",
+};
+
+static SV* PerlXlib_XGCValues_get_field(XGCValues *s, int idx, SV *obj_ref) {
+    switch (idx) {
+    case 0: return newSViv(s->arc_mode);
+    case 1: return newSVuv(s->background);
+    case 2: return newSViv(s->cap_style);
+    case 3: return newSVuv(s->clip_mask);
+    case 4: return newSViv(s->clip_x_origin);
+    case 5: return newSViv(s->clip_y_origin);
+    case 6: return newSViv(s->dash_offset);
+    case 7: return newSViv(s->dashes);
+    case 8: return newSViv(s->fill_rule);
+    case 9: return newSViv(s->fill_style);
+    case 10: return newSVuv(s->font);
+    case 11: return newSVuv(s->foreground);
+    case 12: return newSViv(s->function);
+    case 13: return newSViv(s->graphics_exposures);
+    case 14: return newSViv(s->join_style);
+    case 15: return newSViv(s->line_style);
+    case 16: return newSViv(s->line_width);
+    case 17: return newSVuv(s->plane_mask);
+    case 18: return newSVuv(s->stipple);
+    case 19: return newSViv(s->subwindow_mode);
+    case 20: return newSVuv(s->tile);
+    case 21: return newSViv(s->ts_x_origin);
+    case 22: return newSViv(s->ts_y_origin);
+    }
+    return NULL;
+}
+
+static Bool PerlXlib_XGCValues_set_field(XGCValues *s, int idx, SV *value) {
+    switch (idx) {
+    case 0: s->arc_mode= SvIV(value); break;
+    case 1: s->background= SvUV(value); break;
+    case 2: s->cap_style= SvIV(value); break;
+    case 3: s->clip_mask= PerlXlib_sv_to_xid(value); break;
+    case 4: s->clip_x_origin= SvIV(value); break;
+    case 5: s->clip_y_origin= SvIV(value); break;
+    case 6: s->dash_offset= SvIV(value); break;
+    case 7: s->dashes= SvIV(value); break;
+    case 8: s->fill_rule= SvIV(value); break;
+    case 9: s->fill_style= SvIV(value); break;
+    case 10: s->font= PerlXlib_sv_to_xid(value); break;
+    case 11: s->foreground= SvUV(value); break;
+    case 12: s->function= SvIV(value); break;
+    case 13: s->graphics_exposures= SvIV(value); break;
+    case 14: s->join_style= SvIV(value); break;
+    case 15: s->line_style= SvIV(value); break;
+    case 16: s->line_width= SvIV(value); break;
+    case 17: s->plane_mask= SvUV(value); break;
+    case 18: s->stipple= PerlXlib_sv_to_xid(value); break;
+    case 19: s->subwindow_mode= SvIV(value); break;
+    case 20: s->tile= PerlXlib_sv_to_xid(value); break;
+    case 21: s->ts_x_origin= SvIV(value); break;
+    case 22: s->ts_y_origin= SvIV(value); break;
+    default: return 0;
+    }
+    return 1;
+}
+
+const PerlXlib_struct_fields PerlXlib_XGCValues_fields= {
+    23, PerlXlib_XGCValues_field_names,
+    (PerlXlib_struct_get_field_fn*) &PerlXlib_XGCValues_get_field,
+    (PerlXlib_struct_set_field_fn*) &PerlXlib_XGCValues_set_field
+};
+
+/* END GENERATED X11_Xlib_XGCValues */
+/*--------------------------------------------------------------------------*/
 
 /* provide these exports for back-compat */
 extern void PerlXlib_XVisualInfo_unpack(XVisualInfo *s, HV *fields) {
@@ -59,7 +59,41 @@ extern SV * PerlXlib_get_screen_objref(Screen *screen, int create_flag);
  */
 typedef void PerlXlib_struct_pack_fn(void*, HV*, Bool consume);
 extern void* PerlXlib_get_struct_ptr(SV *sv, int lvalue, const char* pkg, int struct_size, PerlXlib_struct_pack_fn *packer);
+extern void* PerlXlib_get_struct_array(SV *sv, const char* pkg, int struct_size, PerlXlib_struct_pack_fn *packer, int *count_out);
 extern const char* PerlXlib_xevent_pkg_for_type(int type);
+extern const char* PerlXlib_xevent_ext_pkg_for_type(int type);
+extern void PerlXlib_register_ext_event(int type, const char *pkg);
+
+/*-----------------------------------------------------------
+ * Compile-time tables of struct fields, used by the generated
+ * get / get_list / set methods.
+ *
+ * names[] is sorted, and PerlXlib_struct_field_index does a binary
+ * search on it.  get_field returns a new SV for field number 'idx',
+ * or NULL if that field is not valid for the current contents of the
+ * struct (XEvent).  set_field returns false in the same situation.
+ */
+typedef SV* PerlXlib_struct_get_field_fn(void*, int idx, SV *obj_ref);
+typedef Bool PerlXlib_struct_set_field_fn(void*, int idx, SV *value);
+typedef struct PerlXlib_struct_fields {
+    int count;
+    const char * const *names;
+    PerlXlib_struct_get_field_fn *get_field;
+    PerlXlib_struct_set_field_fn *set_field;
+} PerlXlib_struct_fields;
+extern int PerlXlib_struct_field_index(const PerlXlib_struct_fields *fields, const char *name, STRLEN len);
+extern const PerlXlib_struct_fields PerlXlib_XEvent_fields;
+extern const PerlXlib_struct_fields PerlXlib_XVisualInfo_fields;
+extern const PerlXlib_struct_fields PerlXlib_XWindowAttributes_fields;
+extern const PerlXlib_struct_fields PerlXlib_XSetWindowAttributes_fields;
+extern const PerlXlib_struct_fields PerlXlib_XWindowChanges_fields;
+extern const PerlXlib_struct_fields PerlXlib_XSizeHints_fields;
+extern const PerlXlib_struct_fields PerlXlib_XKeyboardState_fields;
+extern const PerlXlib_struct_fields PerlXlib_XRectangle_fields;
+extern const PerlXlib_struct_fields PerlXlib_XRenderPictFormat_fields;
+extern const PerlXlib_struct_fields PerlXlib_XRenderPictureAttributes_fields;
+extern const PerlXlib_struct_fields PerlXlib_XGCValues_fields;
+
 extern void PerlXlib_XEvent_pack(XEvent *s, HV *fields, Bool consume);
 extern void PerlXlib_XEvent_unpack(XEvent *s, HV *fields);
 extern void PerlXlib_XVisualInfo_pack(XVisualInfo *s, HV *fields, Bool consume);
@@ -83,6 +117,8 @@ extern void PerlXlib_XKeyboardState_unpack_obj(XKeyboardState *s, HV *fields, SV
 extern void PerlXlib_XRectangle_pack(XRectangle *s, HV *fields, Bool consume);
 extern void PerlXlib_XRectangle_unpack(XRectangle *s, HV *fields);
 extern void PerlXlib_XRectangle_unpack_obj(XRectangle *s, HV *fields, SV *obj_ref);
+extern void PerlXlib_XGCValues_pack(XGCValues *s, HV *fields, Bool consume);
+extern void PerlXlib_XGCValues_unpack_obj(XGCValues *s, HV *fields, SV *obj_ref);
 #ifndef HAVE_XRENDER
 /* Copied from X11/extensions/Xrender.h because I decided it was better to define the struct
    than to have the perl interface change depending on whether it found a header file or not.
@@ -107,10 +143,161 @@ typedef struct {
     XRenderDirectFormat direct;
     Colormap            colormap;
 } XRenderPictFormat;
+typedef XID Picture;
+typedef struct {
+    int                 repeat;
+    Picture             alpha_map;
+    int                 alpha_x_origin;
+    int                 alpha_y_origin;
+    int                 clip_x_origin;
+    int                 clip_y_origin;
+    Pixmap              clip_mask;
+    Bool                graphics_exposures;
+    int                 subwindow_mode;
+    int                 poly_edge;
+    int                 poly_mode;
+    Atom                dither;
+    Bool                component_alpha;
+} XRenderPictureAttributes;
 #endif
 extern void PerlXlib_XRenderPictFormat_pack(XRenderPictFormat *s, HV *fields, Bool consume);
 extern void PerlXlib_XRenderPictFormat_unpack(XRenderPictFormat *s, HV *fields);
 extern void PerlXlib_XRenderPictFormat_unpack_obj(XRenderPictFormat *s, HV *fields, SV *obj_ref);
+extern void PerlXlib_XRenderPictureAttributes_pack(XRenderPictureAttributes *s, HV *fields, Bool consume);
+extern void PerlXlib_XRenderPictureAttributes_unpack_obj(XRenderPictureAttributes *s, HV *fields, SV *obj_ref);
+
+/* Window tree snapshot (PerlXlib_tree.c)
+ * Rows are in breadth-first order, so a parent always precedes its children,
+ * and siblings are in stacking order (bottom to top).  The perl pack() template
+ * for a row is "l L l l L L L L l l".  xid is set to None for windows that were
+ * destroyed during the walk.
+ */
+#define PerlXlib_TREE_GEOMETRY   1
+#define PerlXlib_TREE_ATTRIBUTES 2
+typedef struct PerlXlib_tree_row {
+    I32 parent;          /* index of parent row, or -1 for the root */
+    U32 xid;
+    I32 x, y;
+    U32 width, height, border_width, depth;
+    I32 map_state, override_redirect;
+} PerlXlib_tree_row;
+extern int PerlXlib_snapshot_tree(Display *dpy, Window root, int flags, PerlXlib_tree_row **rows_out, unsigned long **event_masks_out);
+
+/* Window tree mirror (PerlXlib_tree.c)
+ * Nodes refer to eachother by index into 'nodes'; -1 means none.
+ * Siblings are linked from bottom (first_child) to top (last_child) of the stacking order.
+ */
+typedef struct PerlXlib_wtree_node {
+    Window xid;
+    int parent, first_child, last_child, below, above;
+    int x, y, width, height, border_width;
+    char mapped, override_redirect;
+    /* spatial index, for mapped children of the root: range of grid cells it occupies */
+    char indexed;
+    int cell_x0, cell_y0, cell_x1, cell_y1;
+    int stack_pos, visit;
+} PerlXlib_wtree_node;
+typedef struct PerlXlib_wtree_cell {
+    int *items, count, max;
+} PerlXlib_wtree_cell;
+typedef struct PerlXlib_wtree {
+    Display *dpy;
+    Bool select_input;
+    int root, root_map_state;
+    PerlXlib_wtree_node *nodes;
+    int n_nodes, max_nodes, free_head, count;
+    int *hash, hash_size, hash_used;
+    /* uniform grid over the root, listing the top-level windows overlapping each cell */
+    PerlXlib_wtree_cell *cells;
+    int grid_cols, grid_rows, cell_w, cell_h;
+    Bool stack_dirty;
+    int visit;
+} PerlXlib_wtree;
+extern PerlXlib_wtree * PerlXlib_wtree_new(Display *dpy, Window root, Bool select_input);
+extern void PerlXlib_wtree_free(PerlXlib_wtree *t);
+extern int  PerlXlib_wtree_find(PerlXlib_wtree *t, Window w);
+extern int  PerlXlib_wtree_map_state(PerlXlib_wtree *t, int idx);
+extern Bool PerlXlib_wtree_apply_event(PerlXlib_wtree *t, XEvent *e);
+extern int  PerlXlib_wtree_window_at(PerlXlib_wtree *t, int x, int y);
+extern int  PerlXlib_wtree_windows_in_rect(PerlXlib_wtree *t, int x, int y, int w, int h, int **idx_out);
+
+/* XImage with pixels stored in a perl scalar (PerlXlib_image.c) */
+extern size_t PerlXlib_ximage_data_size(XImage *img);
+extern XImage * PerlXlib_ximage_sync(SV *objref, Bool for_write);
+extern SV * PerlXlib_ximage_wrap(XImage *img, SV *data_sv, SV *dpy_sv);
+extern void PerlXlib_ximage_destroy(SV *objref);
+extern SV * PerlXlib_get_image(Display *dpy, Drawable d, int x, int y, unsigned width, unsigned height,
+    unsigned long plane_mask, int format, SV *data);
+extern Bool PerlXlib_get_sub_image(Display *dpy, Drawable d, int x, int y, unsigned width, unsigned height,
+    unsigned long plane_mask, int format, SV *dest_objref, int dest_x, int dest_y);
+
+/* MIT-SHM segment, mapped into perl as a scalar (PerlXlib_image.c).
+ * 'info' must be first, so that a PerlXlib_shm* is also a XShmSegmentInfo*.
+ */
+#ifdef _XSHM_H_
+typedef struct PerlXlib_shm {
+    XShmSegmentInfo info;
+    size_t size;
+    Bool removed;
+} PerlXlib_shm;
+extern PerlXlib_shm * PerlXlib_shm_new(size_t size, Bool read_only);
+extern SV * PerlXlib_shm_new_sv(PerlXlib_shm *shm);
+extern void PerlXlib_shm_remove_id(PerlXlib_shm *shm);
+extern Bool PerlXlib_shm_attach(Display *dpy, PerlXlib_shm *shm);
+extern void PerlXlib_shm_free(PerlXlib_shm *shm, SV *sv);
+extern XImage * PerlXlib_ximage_shm_sync(SV *objref);
+extern Pixmap PerlXlib_shm_create_pixmap(Display *dpy, Drawable d, PerlXlib_shm *shm,
+    unsigned width, unsigned height, unsigned depth);
+#endif
+
+/* Pixel format conversion with runtime-selected SIMD kernels (PerlXlib_pixels.c) */
+#define PerlXlib_SIMD_NONE 0
+#define PerlXlib_SIMD_SSE2 1
+#define PerlXlib_SIMD_AVX2 2
+extern int PerlXlib_pixels_max_simd_level(void);
+extern int PerlXlib_pixels_simd_level(void);
+extern int PerlXlib_pixels_set_simd_level(int level);
+extern Bool PerlXlib_pixels_to_rgb(const U8 *src, size_t src_stride, int width, int height,
+    int bits_per_pixel, int byte_order, unsigned long red_mask, unsigned long green_mask,
+    unsigned long blue_mask, int alpha, U8 *dst, size_t dst_stride, int dst_channels);
+extern void PerlXlib_pixels_premultiply(U8 *buf, size_t stride, int width, int height, Bool reverse);
+extern void PerlXlib_pixels_downsample_2x(const U8 *src, size_t src_stride, int width, int height,
+    U8 *dst, size_t dst_stride);
+extern void PerlXlib_pixels_blend_over(U8 *dst, size_t dst_stride, int dst_w, int dst_h,
+    const U8 *src, size_t src_stride, int src_w, int src_h, int x, int y);
+extern int PerlXlib_tile_diff(const U8 *src, size_t stride, int width, int height, int bytes_per_pixel,
+    int tile_w, int tile_h, U64 *hashes, Bool compare, XRectangle *out);
+
+/* Pool of worker threads for splitting pixel operations into bands (PerlXlib_workers.c) */
+#define PerlXlib_WORKERS_MAX 64
+typedef void PerlXlib_job_fn(void *ctx, int job);
+extern int PerlXlib_workers_max_threads(void);
+extern int PerlXlib_workers_threads(void);
+extern int PerlXlib_workers_set_threads(int n);
+extern int PerlXlib_workers_bands(int rows, int min_rows);
+extern void PerlXlib_parallel_for(int n_jobs, PerlXlib_job_fn *fn, void *ctx);
+
+/* QOI lossless image encoding (PerlXlib_qoi.c) */
+extern size_t PerlXlib_qoi_max_size(int width, int height, int channels);
+extern size_t PerlXlib_qoi_encode(const U8 *src, size_t src_stride, int width, int height,
+    int bits_per_pixel, int byte_order, unsigned long red_mask, unsigned long green_mask,
+    unsigned long blue_mask, int alpha, int channels, U8 *prev, Bool delta, U8 *out);
+extern Bool PerlXlib_qoi_header(const U8 *src, size_t len, int *width, int *height, int *channels);
+extern Bool PerlXlib_qoi_decode(const U8 *src, size_t len, U8 *dst, const U8 *prev);
+
+/* Y-X banded regions stored as arrays of boxes in a perl scalar (PerlXlib_region.c) */
+typedef struct PerlXlib_box {
+    I32 x1, y1, x2, y2;
+} PerlXlib_box;
+#define PerlXlib_REGION_UNION     0
+#define PerlXlib_REGION_INTERSECT 1
+#define PerlXlib_REGION_SUBTRACT  2
+extern void PerlXlib_region_op(const PerlXlib_box *a, int na, const PerlXlib_box *b, int nb, int op, SV *dst);
+extern void PerlXlib_region_from_boxes(const PerlXlib_box *boxes, int n, SV *dst);
+extern void PerlXlib_region_extents(const PerlXlib_box *r, int n, PerlXlib_box *ext);
+extern Bool PerlXlib_region_contains_point(const PerlXlib_box *r, int n, int x, int y);
+extern void PerlXlib_region_from_mask(const U8 *mask, int width, int height, size_t stride,
+    int depth, Bool msb_first, int threshold, SV *dst);
 
 /* Keysym/Unicode utility functions */
 extern int PerlXlib_keysym_to_codepoint(KeySym keysym);
@@ -0,0 +1,343 @@
+#include "EXTERN.h"
+#include "perl.h"
+#include "XSUB.h"
+#include "ppport.h"
+
+/* Xlibint.h is needed to read a GetImage reply directly into a buffer of our
+ * choosing, the same way XGetImage reads it into a buffer from malloc().
+ */
+#include <X11/Xlibint.h>
+#include <X11/Xproto.h>
+#include <X11/Xutil.h>
+#include <X11/ImUtil.h>
+#ifdef HAVE_XRENDER
+#include <X11/extensions/Xrender.h>
+#endif
+#ifdef HAVE_XSHM
+#include <errno.h>
+#include <sys/ipc.h>
+#include <sys/shm.h>
+#include <X11/extensions/XShm.h>
+#endif
+
+#include "PerlXlib.h"
+
+/*-----------------------------------------------------------------------------------
+ * XImage
+ *
+ * The pixel data of an X11::Xlib::XImage lives in a perl scalar stored in the
+ * object's {data} field.  Perl may reallocate that scalar's buffer at any time,
+ * so ->data of the XImage is pointed at the scalar's buffer right before each use,
+ * and set to NULL before XDestroyImage so that Xlib doesn't free perl's memory.
+ */
+
+/* Number of bytes of pixel data described by the image's fields */
+size_t PerlXlib_ximage_data_size(XImage *img) {
+    size_t rows= img->height;
+    if (img->format != ZPixmap) rows *= img->depth;
+    return (size_t) img->bytes_per_line * rows;
+}
+
+/* Return the scalar holding the pixel data of an XImage object, creating it if needed. */
+static SV* PerlXlib_ximage_buffer(SV *objref) {
+    HV *hv;
+    SV **fp;
+    if (!SvROK(objref) || SvTYPE(SvRV(objref)) != SVt_PVHV)
+        croak("Expected X11::Xlib::XImage object");
+    hv= (HV*) SvRV(objref);
+    fp= hv_fetch(hv, "data", 4, 1);
+    if (!fp || !*fp) croak("Can't store XImage data");
+    return *fp;
+}
+
+/* Get the XImage* of an object, with ->data pointing to the perl buffer.
+ * The buffer is grown (with zeroes) if it is too short for the image.
+ * If for_write is true, the buffer is also made safe to write into, i.e. not
+ * shared copy-on-write with some other scalar.
+ */
+XImage* PerlXlib_ximage_sync(SV *objref, Bool for_write) {
+    XImage *img= (XImage*) PerlXlib_objref_get_pointer(objref, "XImage", PerlXlib_OR_DIE);
+    SV *buf= PerlXlib_ximage_buffer(objref);
+    size_t need= PerlXlib_ximage_data_size(img), len;
+    if (!SvOK(buf))
+        sv_setpvn(buf, "", 0);
+    else if (!SvPOK(buf) || for_write || SvCUR(buf) < need)
+        SvPV_force(buf, len);
+    if (SvCUR(buf) < need) {
+        SvGROW(buf, need + 1);
+        Zero(SvPVX(buf) + SvCUR(buf), need - SvCUR(buf), char);
+        SvCUR_set(buf, need);
+        SvPVX(buf)[need]= '\0';
+    }
+    img->data= SvPVX(buf);
+    return img;
+}
+
+/* Wrap an XImage* in a new X11::Xlib::XImage object.  If data_sv is given, that
+ * scalar becomes the pixel buffer (not a copy of it) so the caller can keep
+ * using their own variable.  Returns a mortal reference.
+ */
+SV* PerlXlib_ximage_wrap(XImage *img, SV *data_sv, SV *dpy_sv) {
+    SV *objref= PerlXlib_get_objref(img, PerlXlib_AUTOCREATE, "XImage", SVt_PVHV, "X11::Xlib::XImage", NULL);
+    HV *hv= (HV*) SvRV(objref);
+    if (data_sv && !SvREADONLY(data_sv))
+        hv_store(hv, "data", 4, SvREFCNT_inc(data_sv), 0);
+    else
+        hv_store(hv, "data", 4, data_sv? newSVsv(data_sv) : newSVpvn("", 0), 0);
+    if (dpy_sv && SvOK(dpy_sv))
+        PerlXlib_objref_set_display(objref, dpy_sv);
+    return objref;
+}
+
+/* Release the XImage* of an object, leaving the perl buffer alone */
+void PerlXlib_ximage_destroy(SV *objref) {
+    XImage *img= (XImage*) PerlXlib_objref_get_pointer(objref, "XImage", PerlXlib_OR_NULL);
+    if (img) {
+        PerlXlib_objref_set_pointer(objref, NULL, NULL);
+        /* XDestroyImage would free these, but they belong to perl (or to the XShmSegmentInfo) */
+        img->data= NULL;
+        img->obdata= NULL;
+        XDestroyImage(img);
+    }
+}
+
+static int PerlXlib_popcount(unsigned long x) {
+    int n= 0;
+    while (x) { x &= x - 1; n++; }
+    return n;
+}
+
+/* Send a GetImage request and read the reply pixels into 'buf' (grown as needed).
+ * On success, returns True and stores the depth and visual of the drawable.
+ * Errors go to the error handler, as with XGetImage, and return False.
+ */
+static Bool PerlXlib_read_image(Display *dpy, Drawable d, int x, int y,
+    unsigned width, unsigned height, unsigned long plane_mask, int format,
+    SV *buf, size_t *nbytes_out, int *depth_out, Visual **visual_out
+) {
+    xGetImageReply rep;
+    xGetImageReq *req;
+    size_t nbytes, len;
+
+    /* Anything that can croak must happen before the request, or the reply would
+     * be left unread on a locked display */
+    if (!SvOK(buf)) sv_setpvn(buf, "", 0);
+    SvPV_force(buf, len);
+
+    LockDisplay(dpy);
+    GetReq(GetImage, req);
+    req->drawable= d;
+    req->x= x;
+    req->y= y;
+    req->width= width;
+    req->height= height;
+    req->planeMask= plane_mask;
+    req->format= format;
+    if (_XReply(dpy, (xReply *) &rep, 0, xFalse) == 0 || rep.length == 0) {
+        UnlockDisplay(dpy);
+        SyncHandle();
+        return False;
+    }
+    nbytes= (size_t) rep.length << 2;
+    SvGROW(buf, nbytes + 1);
+    _XReadPad(dpy, SvPVX(buf), nbytes);
+    SvCUR_set(buf, nbytes);
+    SvPVX(buf)[nbytes]= '\0';
+    UnlockDisplay(dpy);
+    SyncHandle();
+    *nbytes_out= nbytes;
+    *depth_out= rep.depth;
+    *visual_out= _XVIDtoVisual(dpy, rep.visual);
+    return True;
+}
+
+/* Same as XGetImage, but the pixels are read straight into a perl scalar, which is
+ * 'data' if given, and becomes the {data} of the new image.
+ * Returns a mortal reference to an X11::Xlib::XImage, or undef.
+ */
+SV* PerlXlib_get_image(Display *dpy, Drawable d, int x, int y, unsigned width, unsigned height,
+    unsigned long plane_mask, int format, SV *data
+) {
+    SV *buf= data? data : sv_2mortal(newSVpvn("", 0));
+    size_t nbytes;
+    int depth;
+    Visual *visual;
+    XImage *img;
+
+    if (!PerlXlib_read_image(dpy, d, x, y, width, height, plane_mask, format, buf, &nbytes, &depth, &visual))
+        return &PL_sv_undef;
+    if (format == XYPixmap) {
+        /* one bitplane per bit of plane_mask which exists in the drawable */
+        if (depth < 8 * sizeof(long)) plane_mask &= (1UL << depth) - 1;
+        img= XCreateImage(dpy, visual, PerlXlib_popcount(plane_mask),
+            format, 0, NULL, width, height, dpy->bitmap_pad, 0);
+    }
+    else /* ZPixmap */
+        img= XCreateImage(dpy, visual, depth, ZPixmap, 0, NULL, width, height, _XGetScanlinePad(dpy, depth), 0);
+    if (!img)
+        croak("XCreateImage failed");
+    if (PerlXlib_ximage_data_size(img) > nbytes) {
+        XDestroyImage(img);
+        croak("GetImage reply is shorter than expected");
+    }
+    return PerlXlib_ximage_wrap(img, buf, PerlXlib_get_display_objref(dpy, PerlXlib_OR_UNDEF));
+}
+
+/* Same as XGetSubImage, but when the rectangle covers the whole destination image
+ * and the layout matches, the pixels are read directly into its buffer instead of
+ * copying them in pixel by pixel.
+ */
+Bool PerlXlib_get_sub_image(Display *dpy, Drawable d, int x, int y, unsigned width, unsigned height,
+    unsigned long plane_mask, int format, SV *dest_objref, int dest_x, int dest_y
+) {
+    XImage *dest= (XImage*) PerlXlib_objref_get_pointer(dest_objref, "XImage", PerlXlib_OR_DIE);
+    SV *buf= PerlXlib_ximage_buffer(dest_objref);
+    size_t nbytes;
+    int depth;
+    Visual *visual;
+    int pad;
+
+    /* The direct path only handles ZPixmap, which is what anyone copying pixels will use */
+    if (format == ZPixmap && dest->format == ZPixmap && dest->xoffset == 0
+        && dest_x == 0 && dest_y == 0 && width == dest->width && height == dest->height
+        && dest->bits_per_pixel == _XGetBitsPerPixel(dpy, dest->depth)
+        && (pad= _XGetScanlinePad(dpy, dest->depth)) > 0
+        && dest->bytes_per_line == (int)((width * dest->bits_per_pixel + pad - 1) / pad) * (pad >> 3)
+        && dest->byte_order == ImageByteOrder(dpy)
+    ) {
+        if (!PerlXlib_read_image(dpy, d, x, y, width, height, plane_mask, format, buf, &nbytes, &depth, &visual))
+            return False;
+        if (depth != dest->depth)
+            croak("Drawable depth %d does not match XImage depth %d", depth, dest->depth);
+        PerlXlib_ximage_sync(dest_objref, True);
+        return True;
+    }
+    dest= PerlXlib_ximage_sync(dest_objref, True);
+    return XGetSubImage(dpy, d, x, y, width, height, plane_mask, format, dest, dest_x, dest_y) != NULL;
+}
+
+#ifdef HAVE_XSHM
+/*-----------------------------------------------------------------------------------
+ * MIT-SHM segments
+ *
+ * The memory of a segment is exposed as a perl scalar whose buffer *is* the
+ * segment.  Its SvLEN is 0 so that perl never frees it, and if perl code assigns
+ * a longer value to the scalar, perl moves the value to a new buffer instead of
+ * reallocating this one.  Images check for that before each use, rather than
+ * telling the server to use some offset into the wrong memory.
+ *
+ * The segment is one byte longer than 'size', for the NUL terminator perl
+ * expects after SvCUR.
+ */
+
+PerlXlib_shm* PerlXlib_shm_new(size_t size, Bool read_only) {
+    PerlXlib_shm *shm;
+    int err;
+    if (!size)
+        croak("Shared memory segment size must be greater than 0");
+    Newxz(shm, 1, PerlXlib_shm);
+    shm->info.shmid= shmget(IPC_PRIVATE, size+1, IPC_CREAT | 0600);
+    if (shm->info.shmid < 0) {
+        err= errno;
+        Safefree(shm);
+        croak("shmget(%lu): %s", (unsigned long) size, strerror(err));
+    }
+    shm->info.shmaddr= (char*) shmat(shm->info.shmid, NULL, 0);
+    if (shm->info.shmaddr == (char*) -1) {
+        err= errno;
+        shmctl(shm->info.shmid, IPC_RMID, NULL);
+        Safefree(shm);
+        croak("shmat: %s", strerror(err));
+    }
+    shm->info.shmaddr[size]= '\0';
+    shm->info.readOnly= read_only;
+    shm->size= size;
+    return shm;
+}
+
+/* Return a new scalar whose buffer is the segment */
+SV* PerlXlib_shm_new_sv(PerlXlib_shm *shm) {
+    SV *sv= newSV(0);
+    sv_upgrade(sv, SVt_PV);
+    SvPV_set(sv, shm->info.shmaddr);
+    SvLEN_set(sv, 0);
+    SvCUR_set(sv, shm->size);
+    SvPOK_only(sv);
+    return sv;
+}
+
+/* Mark the segment to be destroyed once every process (including the X server)
+ * has detached it.  After this, it can't leak even if this process is killed.
+ */
+void PerlXlib_shm_remove_id(PerlXlib_shm *shm) {
+    if (!shm->removed) {
+        shmctl(shm->info.shmid, IPC_RMID, NULL);
+        shm->removed= True;
+    }
+}
+
+/* Detach the segment from this process.  'sv' is the scalar of PerlXlib_shm_new_sv,
+ * which gets emptied if it still refers to the segment.
+ */
+void PerlXlib_shm_free(PerlXlib_shm *shm, SV *sv) {
+    if (sv && SvPOK(sv) && SvPVX(sv) == shm->info.shmaddr) {
+        SvPV_set(sv, NULL);
+        SvCUR_set(sv, 0);
+        SvOK_off(sv);
+    }
+    PerlXlib_shm_remove_id(shm);
+    shmdt(shm->info.shmaddr);
+    Safefree(shm);
+}
+
+/* XShmAttach only fails locally if the extension is missing.  The server's answer
+ * (BadAccess when it can't map the segment, as when it runs on another machine)
+ * is an asynchronous error, which this catches instead of the installed handler.
+ */
+static int PerlXlib_shm_attach_error;
+static int PerlXlib_shm_attach_error_handler(Display *dpy, XErrorEvent *e) {
+    PerlXlib_shm_attach_error= e->error_code;
+    return 0;
+}
+
+Bool PerlXlib_shm_attach(Display *dpy, PerlXlib_shm *shm) {
+    int (*prev)(Display*, XErrorEvent*);
+    Bool ok;
+    /* Errors from earlier requests go to the usual handler */
+    XSync(dpy, False);
+    PerlXlib_shm_attach_error= 0;
+    prev= XSetErrorHandler(&PerlXlib_shm_attach_error_handler);
+    ok= XShmAttach(dpy, &shm->info);
+    XSync(dpy, False);
+    XSetErrorHandler(prev);
+    return ok && !PerlXlib_shm_attach_error;
+}
+
+/* Get the XImage* of an object created by XShmCreateImage, after making sure that
+ * its data is still the shared memory segment.
+ */
+XImage* PerlXlib_ximage_shm_sync(SV *objref) {
+    XImage *img= PerlXlib_ximage_sync(objref, True);
+    SV **fp= hv_fetch((HV*) SvRV(objref), "shminfo", 7, 0);
+    PerlXlib_shm *shm;
+    if (!fp || !*fp)
+        croak("XImage was not created by XShmCreateImage");
+    shm= (PerlXlib_shm*) PerlXlib_objref_get_pointer(*fp, "XShmSegmentInfo", PerlXlib_OR_DIE);
+    if (img->obdata != (char*) &shm->info || img->data != shm->info.shmaddr)
+        croak("XImage data no longer refers to the shared memory segment (was it assigned a longer value?)");
+    return img;
+}
+
+/* Same as XShmCreatePixmap, with the pixmap data at the start of the segment,
+ * after checking that the segment is large enough.
+ */
+Pixmap PerlXlib_shm_create_pixmap(Display *dpy, Drawable d, PerlXlib_shm *shm,
+    unsigned width, unsigned height, unsigned depth
+) {
+    int pad= _XGetScanlinePad(dpy, depth), bpp= _XGetBitsPerPixel(dpy, depth);
+    size_t need= (size_t) height * (((size_t) width * bpp + pad - 1) / pad) * (pad >> 3);
+    if (need > shm->size)
+        croak("Pixmap needs %lu bytes, but segment is only %lu", (unsigned long) need, (unsigned long) shm->size);
+    return XShmCreatePixmap(dpy, d, shm->info.shmaddr, &shm->info, width, height, depth);
+}
+#endif /* HAVE_XSHM */
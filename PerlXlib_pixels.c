@@ -0,0 +1,829 @@
+#include "EXTERN.h"
+#include "perl.h"
+#include "XSUB.h"
+#include "ppport.h"
+
+#include <X11/Xlib.h>
+#include <X11/Xutil.h>
+#ifdef HAVE_XRENDER
+#include <X11/extensions/Xrender.h>
+#endif
+
+#include "PerlXlib.h"
+
+/*-----------------------------------------------------------------------------------
+ * Pixel format conversion
+ *
+ * Captured images arrive in whatever layout the visual uses, described by its
+ * red/green/blue masks.  Everything here converts them to plain 8-bit RGBA or
+ * RGB, plus a few operations on RGBA8 buffers.  The two layouts seen in practice
+ * (32bpp BGRX, i.e. masks ff0000/ff00/ff in LSBFirst order, and RGB565) have
+ * dedicated kernels with SSE2 and AVX2 versions chosen at runtime from CPUID.
+ * Every other layout goes through the generic mask-driven loop.
+ *
+ * Every vector kernel produces exactly the same bytes as its scalar version, so
+ * the results do not depend on the CPU; t/48-pixels.t checks that.
+ *
+ * The tile hash used for frame differencing lives here too, since it wants the
+ * same runtime selection of vector code.
+ */
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define PERLXLIB_PIXELS_X86 1
+#include <immintrin.h>
+#define TARGET_SSE2 __attribute__((target("sse2")))
+#define TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+
+typedef void PerlXlib_row_fn(const U8 *src, U8 *dst, int n, int alpha);
+typedef void PerlXlib_row2_fn(const U8 *src0, const U8 *src1, U8 *dst, int n);
+typedef void PerlXlib_hash_fn(U64 *acc, const U8 *src, size_t n_stripes);
+
+static struct PerlXlib_pixel_kernels {
+    int level;
+    PerlXlib_row_fn *bgrx_to_rgba;
+    PerlXlib_row_fn *rgb565_to_rgba;
+    PerlXlib_row_fn *premultiply;
+    PerlXlib_row_fn *unpremultiply;
+    PerlXlib_row2_fn *downsample_2x;
+    PerlXlib_hash_fn *hash_stripes;
+} kernels= { -1 };
+
+/* Expand an n-bit channel value to 8 bits by repeating its bits, so that the
+ * maximum maps to 255 and 0 to 0.  (For 5 bits this is (v << 3) | (v >> 2).)
+ */
+static inline unsigned PerlXlib_expand_bits(unsigned v, int bits) {
+    if (bits >= 8) return (v >> (bits - 8)) & 0xFF;
+    if (bits <= 0) return 0;
+    v <<= 8 - bits;
+    v |= v >> bits;
+    v |= v >> (bits * 2);
+    v |= v >> (bits * 4);
+    return v & 0xFF;
+}
+
+/* 16.8 fixed-point reciprocal of alpha used to un-premultiply: c * 255 / a ==
+ * (c * unpremul_tab[a]) >> 8.  Index 0 is 0 so that fully transparent pixels
+ * become black.  Every entry fits in 16 bits, which the vector versions need.
+ */
+static U16 unpremul_tab[256];
+
+static void init_unpremul_tab(void) {
+    int a;
+    unpremul_tab[0]= 0;
+    for (a= 1; a < 256; a++)
+        unpremul_tab[a]= (U16)((255 * 256 + a / 2) / a);
+}
+
+/* Tile hash, in the style of XXH3: four 64-bit lanes each take 8 bytes of a
+ * 32-byte stripe, xor it with a key, and add the product of the low and high
+ * halves, while the raw input is added to the neighbouring lane.  The key
+ * cycles over 8 stripes so that moving data sideways changes the hash, and the
+ * lanes are scrambled after every 8 stripes and at the end of every row.
+ * Only 32x32->64 multiplies are needed, which SSE2 has.
+ */
+#define TILE_HASH_KEY_STRIPES 8
+#define TILE_HASH_PRIME32 0x9E3779B1U
+static U64 tile_hash_keys[TILE_HASH_KEY_STRIPES * 4 + 4];
+
+static U64 splitmix64(U64 *state) {
+    U64 z= (*state += 0x9E3779B97F4A7C15ULL);
+    z= (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z= (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+static void init_tile_hash_keys(void) {
+    U64 state= 0x5846697865734478ULL;
+    int i;
+    for (i= 0; i < TILE_HASH_KEY_STRIPES * 4 + 4; i++)
+        tile_hash_keys[i]= splitmix64(&state);
+}
+
+static inline void tile_hash_scramble(U64 *acc) {
+    const U64 *skey= tile_hash_keys + TILE_HASH_KEY_STRIPES * 4;
+    int j;
+    for (j= 0; j < 4; j++) {
+        U64 a= acc[j];
+        a ^= a >> 47;
+        a ^= skey[j];
+        acc[j]= a * TILE_HASH_PRIME32;
+    }
+}
+
+/*-----------------------------------------------------------------------------------
+ * Scalar kernels
+ */
+
+static void bgrx_to_rgba_scalar(const U8 *src, U8 *dst, int n, int alpha) {
+    int i;
+    for (i= 0; i < n; i++, src += 4, dst += 4) {
+        dst[0]= src[2];
+        dst[1]= src[1];
+        dst[2]= src[0];
+        dst[3]= alpha < 0? src[3] : alpha;
+    }
+}
+
+static void rgb565_to_rgba_scalar(const U8 *src, U8 *dst, int n, int alpha) {
+    int i;
+    unsigned v;
+    for (i= 0; i < n; i++, src += 2, dst += 4) {
+        v= src[0] | (src[1] << 8);
+        dst[0]= ((v >> 8) & 0xF8) | (v >> 13);
+        dst[1]= ((v >> 3) & 0xFC) | ((v >> 9) & 0x03);
+        dst[2]= ((v << 3) & 0xF8) | ((v >> 2) & 0x07);
+        dst[3]= alpha;
+    }
+}
+
+/* round(c * a / 255), exact for all 8-bit inputs */
+static inline U8 PerlXlib_mul_div255(unsigned c, unsigned a) {
+    unsigned t= c * a + 128;
+    return (U8)((t + (t >> 8)) >> 8);
+}
+
+static void premultiply_scalar(const U8 *src, U8 *dst, int n, int unused) {
+    int i;
+    for (i= 0; i < n; i++, src += 4, dst += 4) {
+        unsigned a= src[3];
+        dst[0]= PerlXlib_mul_div255(src[0], a);
+        dst[1]= PerlXlib_mul_div255(src[1], a);
+        dst[2]= PerlXlib_mul_div255(src[2], a);
+        dst[3]= a;
+    }
+}
+
+static void unpremultiply_scalar(const U8 *src, U8 *dst, int n, int unused) {
+    int i, ch;
+    for (i= 0; i < n; i++, src += 4, dst += 4) {
+        unsigned r= unpremul_tab[src[3]], c;
+        for (ch= 0; ch < 3; ch++) {
+            c= (src[ch] * r) >> 8;
+            dst[ch]= c > 255? 255 : c;
+        }
+        dst[3]= src[3];
+    }
+}
+
+static void downsample_2x_scalar(const U8 *src0, const U8 *src1, U8 *dst, int n) {
+    int i, ch;
+    for (i= 0; i < n; i++, src0 += 8, src1 += 8, dst += 4)
+        for (ch= 0; ch < 4; ch++)
+            dst[ch]= (src0[ch] + src0[ch+4] + src1[ch] + src1[ch+4] + 2) >> 2;
+}
+
+static inline void hash_stripe_scalar(U64 *acc, const U8 *src, const U64 *key) {
+    U64 d[4], dk;
+    int j;
+    memcpy(d, src, 32);
+    for (j= 0; j < 4; j++) {
+        dk= d[j] ^ key[j];
+        acc[j ^ 1] += d[j];
+        acc[j] += (dk & 0xFFFFFFFFU) * (dk >> 32);
+    }
+}
+
+static void hash_stripes_scalar(U64 *acc, const U8 *src, size_t n) {
+    size_t s;
+    for (s= 0; s < n; s++, src += 32) {
+        hash_stripe_scalar(acc, src, tile_hash_keys + (s % TILE_HASH_KEY_STRIPES) * 4);
+        if (s % TILE_HASH_KEY_STRIPES == TILE_HASH_KEY_STRIPES - 1)
+            tile_hash_scramble(acc);
+    }
+}
+
+#ifdef PERLXLIB_PIXELS_X86
+
+/*-----------------------------------------------------------------------------------
+ * SSE2 kernels, 4 or 8 pixels per iteration, scalar loop for the remainder
+ */
+
+TARGET_SSE2
+static void bgrx_to_rgba_sse2(const U8 *src, U8 *dst, int n, int alpha) {
+    const __m128i m_lo= _mm_set1_epi32(0xFF), m_g= _mm_set1_epi32(0xFF00),
+        m_keep= _mm_set1_epi32(alpha < 0? 0xFF000000 : 0),
+        a_const= _mm_set1_epi32(alpha < 0? 0 : (int)((unsigned) alpha << 24));
+    int i;
+    for (i= 0; i + 4 <= n; i += 4) {
+        __m128i v= _mm_loadu_si128((const __m128i*)(src + i*4));
+        __m128i r= _mm_and_si128(_mm_srli_epi32(v, 16), m_lo);
+        __m128i b= _mm_slli_epi32(_mm_and_si128(v, m_lo), 16);
+        __m128i o= _mm_or_si128(_mm_or_si128(r, b), _mm_and_si128(v, m_g));
+        o= _mm_or_si128(o, _mm_or_si128(_mm_and_si128(v, m_keep), a_const));
+        _mm_storeu_si128((__m128i*)(dst + i*4), o);
+    }
+    bgrx_to_rgba_scalar(src + i*4, dst + i*4, n - i, alpha);
+}
+
+TARGET_SSE2
+static void rgb565_to_rgba_sse2(const U8 *src, U8 *dst, int n, int alpha) {
+    const __m128i c_f8= _mm_set1_epi16(0xF8), c_fc= _mm_set1_epi16(0xFC),
+        c_03= _mm_set1_epi16(0x03), c_07= _mm_set1_epi16(0x07),
+        a16= _mm_set1_epi16((short)(alpha << 8));
+    int i;
+    for (i= 0; i + 8 <= n; i += 8) {
+        __m128i v= _mm_loadu_si128((const __m128i*)(src + i*2));
+        __m128i r= _mm_or_si128(_mm_and_si128(_mm_srli_epi16(v, 8), c_f8), _mm_srli_epi16(v, 13));
+        __m128i g= _mm_or_si128(_mm_and_si128(_mm_srli_epi16(v, 3), c_fc),
+                                _mm_and_si128(_mm_srli_epi16(v, 9), c_03));
+        __m128i b= _mm_or_si128(_mm_and_si128(_mm_slli_epi16(v, 3), c_f8),
+                                _mm_and_si128(_mm_srli_epi16(v, 2), c_07));
+        /* 16-bit lanes of R|G<<8 and B|A<<8 interleave into RGBA pixels */
+        __m128i rg= _mm_or_si128(r, _mm_slli_epi16(g, 8)), ba= _mm_or_si128(b, a16);
+        _mm_storeu_si128((__m128i*)(dst + i*4), _mm_unpacklo_epi16(rg, ba));
+        _mm_storeu_si128((__m128i*)(dst + i*4 + 16), _mm_unpackhi_epi16(rg, ba));
+    }
+    rgb565_to_rgba_scalar(src + i*2, dst + i*4, n - i, alpha);
+}
+
+/* PerlXlib_mul_div255 on 16-bit lanes */
+#define MUL_DIV255_SSE2(x, m) do { \
+    __m128i t= _mm_add_epi16(_mm_mullo_epi16(x, m), c_128); \
+    x= _mm_srli_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), 8); \
+  } while (0)
+
+TARGET_SSE2
+static void premultiply_sse2(const U8 *src, U8 *dst, int n, int unused) {
+    const __m128i zero= _mm_setzero_si128(), c_128= _mm_set1_epi16(128),
+        m_rgb= _mm_set_epi16(0,-1,-1,-1, 0,-1,-1,-1),
+        a_255= _mm_set_epi16(255,0,0,0, 255,0,0,0);
+    int i;
+    for (i= 0; i + 4 <= n; i += 4) {
+        __m128i v= _mm_loadu_si128((const __m128i*)(src + i*4));
+        __m128i lo= _mm_unpacklo_epi8(v, zero), hi= _mm_unpackhi_epi8(v, zero);
+        /* multiplier is [a,a,a,255] for each pixel, so alpha is unchanged */
+        __m128i ma= _mm_shufflehi_epi16(_mm_shufflelo_epi16(lo, 0xFF), 0xFF);
+        __m128i mb= _mm_shufflehi_epi16(_mm_shufflelo_epi16(hi, 0xFF), 0xFF);
+        ma= _mm_or_si128(_mm_and_si128(ma, m_rgb), a_255);
+        mb= _mm_or_si128(_mm_and_si128(mb, m_rgb), a_255);
+        MUL_DIV255_SSE2(lo, ma);
+        MUL_DIV255_SSE2(hi, mb);
+        _mm_storeu_si128((__m128i*)(dst + i*4), _mm_packus_epi16(lo, hi));
+    }
+    premultiply_scalar(src + i*4, dst + i*4, n - i, 0);
+}
+
+/* There is no vector divide for integers, so the per-pixel reciprocal comes from
+ * unpremul_tab, and (c << 8) * r >> 16 is computed with a high-half multiply.
+ * The alpha lane uses 256, which leaves it unchanged.  Colors larger than their
+ * alpha can exceed 255 and even 32767, where packus (which saturates as signed)
+ * would turn them into 0, so they are clamped with an unsigned add/subtract first.
+ */
+TARGET_SSE2
+static void unpremultiply_sse2(const U8 *src, U8 *dst, int n, int unused) {
+    const __m128i zero= _mm_setzero_si128(), c_ff00= _mm_set1_epi16((short) 0xFF00);
+    int i;
+    for (i= 0; i + 4 <= n; i += 4) {
+        const U8 *p= src + i*4;
+        __m128i v= _mm_loadu_si128((const __m128i*) p);
+        short r0= unpremul_tab[p[3]], r1= unpremul_tab[p[7]],
+              r2= unpremul_tab[p[11]], r3= unpremul_tab[p[15]];
+        __m128i lo= _mm_slli_epi16(_mm_unpacklo_epi8(v, zero), 8);
+        __m128i hi= _mm_slli_epi16(_mm_unpackhi_epi8(v, zero), 8);
+        lo= _mm_mulhi_epu16(lo, _mm_set_epi16(256,r1,r1,r1, 256,r0,r0,r0));
+        hi= _mm_mulhi_epu16(hi, _mm_set_epi16(256,r3,r3,r3, 256,r2,r2,r2));
+        lo= _mm_subs_epu16(_mm_adds_epu16(lo, c_ff00), c_ff00);
+        hi= _mm_subs_epu16(_mm_adds_epu16(hi, c_ff00), c_ff00);
+        _mm_storeu_si128((__m128i*)(dst + i*4), _mm_packus_epi16(lo, hi));
+    }
+    unpremultiply_scalar(src + i*4, dst + i*4, n - i, 0);
+}
+
+/* 4 source pixels from each of two rows become 2 output pixels */
+TARGET_SSE2
+static void downsample_2x_sse2(const U8 *src0, const U8 *src1, U8 *dst, int n) {
+    const __m128i zero= _mm_setzero_si128(), c_2= _mm_set1_epi16(2);
+    int i;
+    for (i= 0; i + 2 <= n; i += 2) {
+        __m128i a= _mm_loadu_si128((const __m128i*)(src0 + i*8));
+        __m128i b= _mm_loadu_si128((const __m128i*)(src1 + i*8));
+        __m128i lo= _mm_add_epi16(_mm_unpacklo_epi8(a, zero), _mm_unpacklo_epi8(b, zero));
+        __m128i hi= _mm_add_epi16(_mm_unpackhi_epi8(a, zero), _mm_unpackhi_epi8(b, zero));
+        lo= _mm_add_epi16(lo, _mm_srli_si128(lo, 8));
+        hi= _mm_add_epi16(hi, _mm_srli_si128(hi, 8));
+        lo= _mm_srli_epi16(_mm_add_epi16(_mm_unpacklo_epi64(lo, hi), c_2), 2);
+        _mm_storel_epi64((__m128i*)(dst + i*4), _mm_packus_epi16(lo, lo));
+    }
+    downsample_2x_scalar(src0 + i*8, src1 + i*8, dst + i*4, n - i);
+}
+
+TARGET_SSE2
+static void hash_stripes_sse2(U64 *acc, const U8 *src, size_t n) {
+    __m128i a0= _mm_loadu_si128((const __m128i*) acc), a1= _mm_loadu_si128((const __m128i*)(acc + 2));
+    const __m128i *skey= (const __m128i*)(tile_hash_keys + TILE_HASH_KEY_STRIPES * 4);
+    const __m128i prime= _mm_set1_epi32(TILE_HASH_PRIME32);
+    size_t s;
+    for (s= 0; s < n; s++, src += 32) {
+        const __m128i *key= (const __m128i*)(tile_hash_keys + (s % TILE_HASH_KEY_STRIPES) * 4);
+        __m128i d0= _mm_loadu_si128((const __m128i*) src), d1= _mm_loadu_si128((const __m128i*)(src + 16));
+        __m128i k0= _mm_xor_si128(d0, _mm_loadu_si128(key)), k1= _mm_xor_si128(d1, _mm_loadu_si128(key + 1));
+        a0= _mm_add_epi64(a0, _mm_shuffle_epi32(d0, _MM_SHUFFLE(1,0,3,2)));
+        a1= _mm_add_epi64(a1, _mm_shuffle_epi32(d1, _MM_SHUFFLE(1,0,3,2)));
+        a0= _mm_add_epi64(a0, _mm_mul_epu32(k0, _mm_srli_epi64(k0, 32)));
+        a1= _mm_add_epi64(a1, _mm_mul_epu32(k1, _mm_srli_epi64(k1, 32)));
+        if (s % TILE_HASH_KEY_STRIPES == TILE_HASH_KEY_STRIPES - 1) {
+            /* a * prime == lo(a) * prime + (hi(a) * prime << 32) mod 2^64 */
+            a0= _mm_xor_si128(_mm_xor_si128(a0, _mm_srli_epi64(a0, 47)), _mm_loadu_si128(skey));
+            a1= _mm_xor_si128(_mm_xor_si128(a1, _mm_srli_epi64(a1, 47)), _mm_loadu_si128(skey + 1));
+            a0= _mm_add_epi64(_mm_mul_epu32(a0, prime), _mm_slli_epi64(_mm_mul_epu32(_mm_srli_epi64(a0, 32), prime), 32));
+            a1= _mm_add_epi64(_mm_mul_epu32(a1, prime), _mm_slli_epi64(_mm_mul_epu32(_mm_srli_epi64(a1, 32), prime), 32));
+        }
+    }
+    _mm_storeu_si128((__m128i*) acc, a0);
+    _mm_storeu_si128((__m128i*)(acc + 2), a1);
+}
+
+/*-----------------------------------------------------------------------------------
+ * AVX2 kernels.  Most AVX2 operations work within each 128-bit half, so these
+ * are the SSE2 algorithms done twice at once, with a permute wherever the
+ * pixel order would otherwise come out interleaved.
+ */
+
+TARGET_AVX2
+static void bgrx_to_rgba_avx2(const U8 *src, U8 *dst, int n, int alpha) {
+    const __m256i m_lo= _mm256_set1_epi32(0xFF), m_g= _mm256_set1_epi32(0xFF00),
+        m_keep= _mm256_set1_epi32(alpha < 0? 0xFF000000 : 0),
+        a_const= _mm256_set1_epi32(alpha < 0? 0 : (int)((unsigned) alpha << 24));
+    int i;
+    for (i= 0; i + 8 <= n; i += 8) {
+        __m256i v= _mm256_loadu_si256((const __m256i*)(src + i*4));
+        __m256i r= _mm256_and_si256(_mm256_srli_epi32(v, 16), m_lo);
+        __m256i b= _mm256_slli_epi32(_mm256_and_si256(v, m_lo), 16);
+        __m256i o= _mm256_or_si256(_mm256_or_si256(r, b), _mm256_and_si256(v, m_g));
+        o= _mm256_or_si256(o, _mm256_or_si256(_mm256_and_si256(v, m_keep), a_const));
+        _mm256_storeu_si256((__m256i*)(dst + i*4), o);
+    }
+    bgrx_to_rgba_scalar(src + i*4, dst + i*4, n - i, alpha);
+}
+
+TARGET_AVX2
+static void rgb565_to_rgba_avx2(const U8 *src, U8 *dst, int n, int alpha) {
+    const __m256i c_f8= _mm256_set1_epi16(0xF8), c_fc= _mm256_set1_epi16(0xFC),
+        c_03= _mm256_set1_epi16(0x03), c_07= _mm256_set1_epi16(0x07),
+        a16= _mm256_set1_epi16((short)(alpha << 8));
+    int i;
+    for (i= 0; i + 16 <= n; i += 16) {
+        __m256i v= _mm256_loadu_si256((const __m256i*)(src + i*2));
+        __m256i r= _mm256_or_si256(_mm256_and_si256(_mm256_srli_epi16(v, 8), c_f8), _mm256_srli_epi16(v, 13));
+        __m256i g= _mm256_or_si256(_mm256_and_si256(_mm256_srli_epi16(v, 3), c_fc),
+                                   _mm256_and_si256(_mm256_srli_epi16(v, 9), c_03));
+        __m256i b= _mm256_or_si256(_mm256_and_si256(_mm256_slli_epi16(v, 3), c_f8),
+                                   _mm256_and_si256(_mm256_srli_epi16(v, 2), c_07));
+        __m256i rg= _mm256_or_si256(r, _mm256_slli_epi16(g, 8)), ba= _mm256_or_si256(b, a16);
+        __m256i lo= _mm256_unpacklo_epi16(rg, ba), hi= _mm256_unpackhi_epi16(rg, ba);
+        /* lo holds pixels 0-3 and 8-11, hi holds 4-7 and 12-15 */
+        _mm256_storeu_si256((__m256i*)(dst + i*4), _mm256_permute2x128_si256(lo, hi, 0x20));
+        _mm256_storeu_si256((__m256i*)(dst + i*4 + 32), _mm256_permute2x128_si256(lo, hi, 0x31));
+    }
+    rgb565_to_rgba_scalar(src + i*2, dst + i*4, n - i, alpha);
+}
+
+#define MUL_DIV255_AVX2(x, m) do { \
+    __m256i t= _mm256_add_epi16(_mm256_mullo_epi16(x, m), c_128); \
+    x= _mm256_srli_epi16(_mm256_add_epi16(t, _mm256_srli_epi16(t, 8)), 8); \
+  } while (0)
+
+TARGET_AVX2
+static void premultiply_avx2(const U8 *src, U8 *dst, int n, int unused) {
+    const __m256i zero= _mm256_setzero_si256(), c_128= _mm256_set1_epi16(128),
+        m_rgb= _mm256_set_epi16(0,-1,-1,-1, 0,-1,-1,-1, 0,-1,-1,-1, 0,-1,-1,-1),
+        a_255= _mm256_set_epi16(255,0,0,0, 255,0,0,0, 255,0,0,0, 255,0,0,0);
+    int i;
+    for (i= 0; i + 8 <= n; i += 8) {
+        __m256i v= _mm256_loadu_si256((const __m256i*)(src + i*4));
+        __m256i lo= _mm256_unpacklo_epi8(v, zero), hi= _mm256_unpackhi_epi8(v, zero);
+        __m256i ma= _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(lo, 0xFF), 0xFF);
+        __m256i mb= _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(hi, 0xFF), 0xFF);
+        ma= _mm256_or_si256(_mm256_and_si256(ma, m_rgb), a_255);
+        mb= _mm256_or_si256(_mm256_and_si256(mb, m_rgb), a_255);
+        MUL_DIV255_AVX2(lo, ma);
+        MUL_DIV255_AVX2(hi, mb);
+        /* packus undoes the in-lane unpack, so pixel order is preserved */
+        _mm256_storeu_si256((__m256i*)(dst + i*4), _mm256_packus_epi16(lo, hi));
+    }
+    premultiply_scalar(src + i*4, dst + i*4, n - i, 0);
+}
+
+TARGET_AVX2
+static void unpremultiply_avx2(const U8 *src, U8 *dst, int n, int unused) {
+    const __m256i zero= _mm256_setzero_si256(), c_255= _mm256_set1_epi16(255);
+    int i;
+    for (i= 0; i + 8 <= n; i += 8) {
+        const U8 *p= src + i*4;
+        __m256i v= _mm256_loadu_si256((const __m256i*) p);
+        short r0= unpremul_tab[p[3]],  r1= unpremul_tab[p[7]],
+              r2= unpremul_tab[p[11]], r3= unpremul_tab[p[15]],
+              r4= unpremul_tab[p[19]], r5= unpremul_tab[p[23]],
+              r6= unpremul_tab[p[27]], r7= unpremul_tab[p[31]];
+        /* in-lane unpack: lo is pixels 0,1,4,5 and hi is 2,3,6,7 */
+        __m256i lo= _mm256_slli_epi16(_mm256_unpacklo_epi8(v, zero), 8);
+        __m256i hi= _mm256_slli_epi16(_mm256_unpackhi_epi8(v, zero), 8);
+        lo= _mm256_mulhi_epu16(lo, _mm256_set_epi16(256,r5,r5,r5, 256,r4,r4,r4, 256,r1,r1,r1, 256,r0,r0,r0));
+        hi= _mm256_mulhi_epu16(hi, _mm256_set_epi16(256,r7,r7,r7, 256,r6,r6,r6, 256,r3,r3,r3, 256,r2,r2,r2));
+        lo= _mm256_min_epu16(lo, c_255);
+        hi= _mm256_min_epu16(hi, c_255);
+        _mm256_storeu_si256((__m256i*)(dst + i*4), _mm256_packus_epi16(lo, hi));
+    }
+    unpremultiply_scalar(src + i*4, dst + i*4, n - i, 0);
+}
+
+/* 8 source pixels from each of two rows become 4 output pixels */
+TARGET_AVX2
+static void downsample_2x_avx2(const U8 *src0, const U8 *src1, U8 *dst, int n) {
+    const __m256i zero= _mm256_setzero_si256(), c_2= _mm256_set1_epi16(2);
+    int i;
+    for (i= 0; i + 4 <= n; i += 4) {
+        __m256i a= _mm256_loadu_si256((const __m256i*)(src0 + i*8));
+        __m256i b= _mm256_loadu_si256((const __m256i*)(src1 + i*8));
+        /* lo is pixels 0,1 | 4,5 and hi is 2,3 | 6,7 */
+        __m256i lo= _mm256_add_epi16(_mm256_unpacklo_epi8(a, zero), _mm256_unpacklo_epi8(b, zero));
+        __m256i hi= _mm256_add_epi16(_mm256_unpackhi_epi8(a, zero), _mm256_unpackhi_epi8(b, zero));
+        lo= _mm256_add_epi16(lo, _mm256_srli_si256(lo, 8));
+        hi= _mm256_add_epi16(hi, _mm256_srli_si256(hi, 8));
+        lo= _mm256_srli_epi16(_mm256_add_epi16(_mm256_unpacklo_epi64(lo, hi), c_2), 2);
+        lo= _mm256_packus_epi16(lo, lo);
+        /* output pixels 0,1 are in qword 0 and 2,3 in qword 2 */
+        lo= _mm256_permute4x64_epi64(lo, 0x08);
+        _mm_storeu_si128((__m128i*)(dst + i*4), _mm256_castsi256_si128(lo));
+    }
+    downsample_2x_scalar(src0 + i*8, src1 + i*8, dst + i*4, n - i);
+}
+
+TARGET_AVX2
+static void hash_stripes_avx2(U64 *acc, const U8 *src, size_t n) {
+    __m256i a= _mm256_loadu_si256((const __m256i*) acc);
+    const __m256i skey= _mm256_loadu_si256((const __m256i*)(tile_hash_keys + TILE_HASH_KEY_STRIPES * 4));
+    const __m256i prime= _mm256_set1_epi32(TILE_HASH_PRIME32);
+    size_t s;
+    for (s= 0; s < n; s++, src += 32) {
+        __m256i d= _mm256_loadu_si256((const __m256i*) src);
+        __m256i k= _mm256_xor_si256(d,
+            _mm256_loadu_si256((const __m256i*)(tile_hash_keys + (s % TILE_HASH_KEY_STRIPES) * 4)));
+        a= _mm256_add_epi64(a, _mm256_shuffle_epi32(d, _MM_SHUFFLE(1,0,3,2)));
+        a= _mm256_add_epi64(a, _mm256_mul_epu32(k, _mm256_srli_epi64(k, 32)));
+        if (s % TILE_HASH_KEY_STRIPES == TILE_HASH_KEY_STRIPES - 1) {
+            a= _mm256_xor_si256(_mm256_xor_si256(a, _mm256_srli_epi64(a, 47)), skey);
+            a= _mm256_add_epi64(_mm256_mul_epu32(a, prime),
+                _mm256_slli_epi64(_mm256_mul_epu32(_mm256_srli_epi64(a, 32), prime), 32));
+        }
+    }
+    _mm256_storeu_si256((__m256i*) acc, a);
+}
+
+#endif /* PERLXLIB_PIXELS_X86 */
+
+/*-----------------------------------------------------------------------------------
+ * Dispatch
+ */
+
+int PerlXlib_pixels_max_simd_level(void) {
+#ifdef PERLXLIB_PIXELS_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) return PerlXlib_SIMD_AVX2;
+    if (__builtin_cpu_supports("sse2")) return PerlXlib_SIMD_SSE2;
+#endif
+    return PerlXlib_SIMD_NONE;
+}
+
+int PerlXlib_pixels_set_simd_level(int level) {
+    int max= PerlXlib_pixels_max_simd_level();
+    if (level < 0 || level > max) level= max;
+    if (kernels.level < 0) {
+        init_unpremul_tab();
+        init_tile_hash_keys();
+    }
+    kernels.level= level;
+    kernels.bgrx_to_rgba=   bgrx_to_rgba_scalar;
+    kernels.rgb565_to_rgba= rgb565_to_rgba_scalar;
+    kernels.premultiply=    premultiply_scalar;
+    kernels.unpremultiply=  unpremultiply_scalar;
+    kernels.downsample_2x=  downsample_2x_scalar;
+    kernels.hash_stripes=   hash_stripes_scalar;
+#ifdef PERLXLIB_PIXELS_X86
+    if (level >= PerlXlib_SIMD_SSE2) {
+        kernels.bgrx_to_rgba=   bgrx_to_rgba_sse2;
+        kernels.rgb565_to_rgba= rgb565_to_rgba_sse2;
+        kernels.premultiply=    premultiply_sse2;
+        kernels.unpremultiply=  unpremultiply_sse2;
+        kernels.downsample_2x=  downsample_2x_sse2;
+        kernels.hash_stripes=   hash_stripes_sse2;
+    }
+    if (level >= PerlXlib_SIMD_AVX2) {
+        kernels.bgrx_to_rgba=   bgrx_to_rgba_avx2;
+        kernels.rgb565_to_rgba= rgb565_to_rgba_avx2;
+        kernels.premultiply=    premultiply_avx2;
+        kernels.unpremultiply=  unpremultiply_avx2;
+        kernels.downsample_2x=  downsample_2x_avx2;
+        kernels.hash_stripes=   hash_stripes_avx2;
+    }
+#endif
+    return level;
+}
+
+int PerlXlib_pixels_simd_level(void) {
+    if (kernels.level < 0) PerlXlib_pixels_set_simd_level(-1);
+    return kernels.level;
+}
+
+/*-----------------------------------------------------------------------------------
+ * Conversions
+ */
+
+static void PerlXlib_mask_shift(unsigned long mask, int *shift, int *bits) {
+    int s= 0, b= 0;
+    if (mask) {
+        while (!(mask & 1)) { mask >>= 1; s++; }
+        while (mask & 1) { mask >>= 1; b++; }
+    }
+    *shift= s;
+    *bits= b;
+}
+
+/* Work is split into bands of at least this many rows for the worker pool */
+#define PIXELS_BAND_MIN_ROWS 32
+
+/* First row of band i of n */
+static inline int band_start(int rows, int n, int i) {
+    return (int)((long long) rows * i / n);
+}
+
+typedef struct to_rgb_job {
+    const U8 *src;
+    size_t src_stride, dst_stride;
+    int width, height, bits_per_pixel, byte_order, alpha, dst_channels, n_bands;
+    unsigned long red_mask, green_mask, blue_mask;
+    U8 *dst;
+} to_rgb_job;
+
+static void pixels_to_rgb_rows(const U8 *src, size_t src_stride, int width, int height,
+    int bits_per_pixel, int byte_order, unsigned long red_mask, unsigned long green_mask,
+    unsigned long blue_mask, int alpha, U8 *dst, size_t dst_stride, int dst_channels);
+
+static void to_rgb_band(void *ctx, int i) {
+    to_rgb_job *j= (to_rgb_job*) ctx;
+    int y0= band_start(j->height, j->n_bands, i), y1= band_start(j->height, j->n_bands, i+1);
+    pixels_to_rgb_rows(j->src + y0 * j->src_stride, j->src_stride, j->width, y1 - y0,
+        j->bits_per_pixel, j->byte_order, j->red_mask, j->green_mask, j->blue_mask, j->alpha,
+        j->dst + y0 * j->dst_stride, j->dst_stride, j->dst_channels);
+}
+
+/* Convert 'height' rows of 'width' pixels described by bits_per_pixel, byte_order
+ * and the channel masks to 8-bit RGBA (dst_channels == 4) or RGB (== 3).
+ * alpha is the constant alpha value, or -1 to take alpha from the bits of the pixel
+ * not covered by any of the masks (255 if there are none).
+ * Returns False for unsupported bits_per_pixel.
+ */
+Bool PerlXlib_pixels_to_rgb(const U8 *src, size_t src_stride, int width, int height,
+    int bits_per_pixel, int byte_order, unsigned long red_mask, unsigned long green_mask,
+    unsigned long blue_mask, int alpha, U8 *dst, size_t dst_stride, int dst_channels
+) {
+    to_rgb_job j;
+    if (bits_per_pixel != 8 && bits_per_pixel != 16 && bits_per_pixel != 24 && bits_per_pixel != 32)
+        return False;
+    PerlXlib_pixels_simd_level();
+    j.src= src; j.src_stride= src_stride; j.width= width; j.height= height;
+    j.bits_per_pixel= bits_per_pixel; j.byte_order= byte_order; j.alpha= alpha;
+    j.red_mask= red_mask; j.green_mask= green_mask; j.blue_mask= blue_mask;
+    j.dst= dst; j.dst_stride= dst_stride; j.dst_channels= dst_channels;
+    j.n_bands= PerlXlib_workers_bands(height, PIXELS_BAND_MIN_ROWS);
+    PerlXlib_parallel_for(j.n_bands, to_rgb_band, &j);
+    return True;
+}
+
+static void pixels_to_rgb_rows(const U8 *src, size_t src_stride, int width, int height,
+    int bits_per_pixel, int byte_order, unsigned long red_mask, unsigned long green_mask,
+    unsigned long blue_mask, int alpha, U8 *dst, size_t dst_stride, int dst_channels
+) {
+    int y, x, bpp= bits_per_pixel / 8, rs, rb, gs, gb, bs, bb, as, ab;
+    unsigned long all= bits_per_pixel >= 32? 0xFFFFFFFFUL : (1UL << bits_per_pixel) - 1, amask, v;
+    PerlXlib_row_fn *fast= NULL;
+
+    amask= alpha < 0? all & ~(red_mask | green_mask | blue_mask) : 0;
+    if (alpha < 0 && !amask) alpha= 255;
+
+    if (dst_channels == 4 && byte_order == LSBFirst) {
+        if (bits_per_pixel == 32 && red_mask == 0xFF0000 && green_mask == 0xFF00 && blue_mask == 0xFF
+            && (alpha >= 0 || amask == 0xFF000000UL))
+            fast= kernels.bgrx_to_rgba;
+        else if (bits_per_pixel == 16 && red_mask == 0xF800 && green_mask == 0x07E0 && blue_mask == 0x001F)
+            fast= kernels.rgb565_to_rgba;
+    }
+    if (fast) {
+        for (y= 0; y < height; y++)
+            fast(src + y * src_stride, dst + y * dst_stride, width, alpha);
+        return;
+    }
+
+    PerlXlib_mask_shift(red_mask, &rs, &rb);
+    PerlXlib_mask_shift(green_mask, &gs, &gb);
+    PerlXlib_mask_shift(blue_mask, &bs, &bb);
+    PerlXlib_mask_shift(amask, &as, &ab);
+    for (y= 0; y < height; y++) {
+        const U8 *s= src + y * src_stride;
+        U8 *d= dst + y * dst_stride;
+        for (x= 0; x < width; x++, s += bpp, d += dst_channels) {
+            switch (bpp) {
+            case 1: v= s[0]; break;
+            case 2: v= byte_order == LSBFirst? s[0] | (s[1] << 8) : (s[0] << 8) | s[1]; break;
+            case 3: v= byte_order == LSBFirst? s[0] | (s[1] << 8) | ((unsigned long)s[2] << 16)
+                                             : ((unsigned long)s[0] << 16) | (s[1] << 8) | s[2];
+                    break;
+            default:
+                    v= byte_order == LSBFirst
+                        ? s[0] | (s[1] << 8) | ((unsigned long)s[2] << 16) | ((unsigned long)s[3] << 24)
+                        : ((unsigned long)s[0] << 24) | ((unsigned long)s[1] << 16) | (s[2] << 8) | s[3];
+            }
+            d[0]= PerlXlib_expand_bits((v & red_mask) >> rs, rb);
+            d[1]= PerlXlib_expand_bits((v & green_mask) >> gs, gb);
+            d[2]= PerlXlib_expand_bits((v & blue_mask) >> bs, bb);
+            if (dst_channels == 4)
+                d[3]= alpha >= 0? alpha : PerlXlib_expand_bits((v & amask) >> as, ab);
+        }
+    }
+}
+
+/* Premultiply (or undo premultiplication of) the color channels of RGBA8 by alpha,
+ * in place.
+ */
+typedef struct row_job {
+    PerlXlib_row_fn *fn;
+    U8 *buf;
+    size_t stride;
+    int width, height, n_bands;
+} row_job;
+
+static void row_band(void *ctx, int i) {
+    row_job *j= (row_job*) ctx;
+    int y= band_start(j->height, j->n_bands, i), y1= band_start(j->height, j->n_bands, i+1);
+    for (; y < y1; y++)
+        j->fn(j->buf + y * j->stride, j->buf + y * j->stride, j->width, 0);
+}
+
+void PerlXlib_pixels_premultiply(U8 *buf, size_t stride, int width, int height, Bool reverse) {
+    row_job j;
+    PerlXlib_pixels_simd_level();
+    j.fn= reverse? kernels.unpremultiply : kernels.premultiply;
+    j.buf= buf; j.stride= stride; j.width= width; j.height= height;
+    j.n_bands= PerlXlib_workers_bands(height, PIXELS_BAND_MIN_ROWS);
+    PerlXlib_parallel_for(j.n_bands, row_band, &j);
+}
+
+/* Average each 2x2 block of 4-byte pixels.  The output is width/2 by height/2;
+ * an odd last row or column is dropped.
+ */
+typedef struct downsample_job {
+    const U8 *src;
+    U8 *dst;
+    size_t src_stride, dst_stride;
+    int width, height, n_bands;
+} downsample_job;
+
+static void downsample_band(void *ctx, int i) {
+    downsample_job *j= (downsample_job*) ctx;
+    int y= band_start(j->height, j->n_bands, i), y1= band_start(j->height, j->n_bands, i+1);
+    for (; y < y1; y++)
+        kernels.downsample_2x(j->src + y * 2 * j->src_stride, j->src + (y * 2 + 1) * j->src_stride,
+            j->dst + y * j->dst_stride, j->width);
+}
+
+void PerlXlib_pixels_downsample_2x(const U8 *src, size_t src_stride, int width, int height,
+    U8 *dst, size_t dst_stride
+) {
+    downsample_job j;
+    PerlXlib_pixels_simd_level();
+    j.src= src; j.src_stride= src_stride; j.dst= dst; j.dst_stride= dst_stride;
+    j.width= width / 2; j.height= height / 2;
+    j.n_bands= PerlXlib_workers_bands(j.height, PIXELS_BAND_MIN_ROWS / 2);
+    PerlXlib_parallel_for(j.n_bands, downsample_band, &j);
+}
+
+/* Composite premultiplied native 32-bit ARGB pixels over 32-bit pixels of the same
+ * layout, with the top-left of src at x,y of dst, clipped to dst.  This is meant for
+ * small images like cursors, so it is scalar and single-threaded.
+ */
+void PerlXlib_pixels_blend_over(U8 *dst, size_t dst_stride, int dst_w, int dst_h,
+    const U8 *src, size_t src_stride, int src_w, int src_h, int x, int y
+) {
+    int x0= x < 0? -x : 0, y0= y < 0? -y : 0, x1= src_w, y1= src_h, i, j;
+    U32 s, d, inv;
+    if (x + x1 > dst_w) x1= dst_w - x;
+    if (y + y1 > dst_h) y1= dst_h - y;
+    for (j= y0; j < y1; j++) {
+        const U32 *sp= (const U32*)(src + j * src_stride);
+        U32 *dp= (U32*)(dst + (y + j) * dst_stride) + x;
+        for (i= x0; i < x1; i++) {
+            s= sp[i];
+            if (!(s >> 24)) continue;
+            if ((s >> 24) == 0xFF) { dp[i]= s; continue; }
+            d= dp[i];
+            inv= 0xFF - (s >> 24);
+            dp[i]= ((U32)((s >> 24) + PerlXlib_mul_div255(d >> 24, inv)) << 24)
+                | ((U32)(((s >> 16) & 0xFF) + PerlXlib_mul_div255((d >> 16) & 0xFF, inv)) << 16)
+                | ((U32)(((s >> 8) & 0xFF) + PerlXlib_mul_div255((d >> 8) & 0xFF, inv)) << 8)
+                | (U32)((s & 0xFF) + PerlXlib_mul_div255(d & 0xFF, inv));
+        }
+    }
+}
+
+/*-----------------------------------------------------------------------------------
+ * Frame differencing
+ */
+
+/* Hash 'rows' rows of 'row_bytes' bytes. */
+static U64 PerlXlib_tile_hash(const U8 *src, size_t stride, size_t row_bytes, int rows) {
+    U64 acc[4]= { TILE_HASH_PRIME32, 0x9E3779B185EBCA87ULL, 0xC2B2AE3D27D4EB4FULL, 0x165667B19E3779F9ULL };
+    U64 h;
+    U8 tail[32];
+    size_t n_stripes= row_bytes / 32, rest= row_bytes % 32;
+    int y;
+    for (y= 0; y < rows; y++, src += stride) {
+        kernels.hash_stripes(acc, src, n_stripes);
+        if (rest) {
+            memset(tail, 0, sizeof(tail));
+            memcpy(tail, src + n_stripes * 32, rest);
+            hash_stripe_scalar(acc, tail, tile_hash_keys + (n_stripes % TILE_HASH_KEY_STRIPES) * 4);
+        }
+        tile_hash_scramble(acc);
+    }
+    /* xxh64 avalanche of the combined lanes */
+    h= acc[0] + (acc[1] * 0xC2B2AE3D27D4EB4FULL) + ((acc[2] << 31) | (acc[2] >> 33)) + (acc[3] ^ row_bytes);
+    h ^= h >> 33;
+    h *= 0xC2B2AE3D27D4EB4FULL;
+    h ^= h >> 29;
+    h *= 0x165667B19E3779F9ULL;
+    h ^= h >> 32;
+    return h;
+}
+
+typedef struct tile_diff_job {
+    const U8 *src;
+    size_t stride;
+    int width, height, bytes_per_pixel, tile_w, tile_h, cols;
+    U64 *hashes;
+    Bool compare;
+    XRectangle *out;
+    int *counts;
+} tile_diff_job;
+
+/* Diff one row of tiles, writing its rectangles at out + ty * cols */
+static void tile_diff_row(void *ctx, int ty) {
+    tile_diff_job *j= (tile_diff_job*) ctx;
+    int x, y= ty * j->tile_h, w, h= j->height - y < j->tile_h? j->height - y : j->tile_h, n= 0;
+    U64 *hashes= j->hashes + ty * j->cols, hash;
+    XRectangle *out= j->out + ty * j->cols;
+    Bool run= False;
+    for (x= 0; x < j->width; x += j->tile_w, hashes++) {
+        w= j->width - x < j->tile_w? j->width - x : j->tile_w;
+        hash= PerlXlib_tile_hash(j->src + y * j->stride + (size_t) x * j->bytes_per_pixel, j->stride,
+            (size_t) w * j->bytes_per_pixel, h);
+        if (j->compare && hash == *hashes) {
+            run= False;
+            continue;
+        }
+        *hashes= hash;
+        if (run) {
+            out[n-1].width += w;
+        } else {
+            out[n].x= x;
+            out[n].y= y;
+            out[n].width= w;
+            out[n].height= h;
+            n++;
+            run= True;
+        }
+    }
+    j->counts[ty]= n;
+}
+
+/* Hash every tile_w x tile_h tile of the image (tiles on the right and bottom edge
+ * may be smaller) and compare with the previous hashes, which are updated.  The
+ * hashes array holds one entry per tile in row-major order.  If 'compare' is
+ * false (no previous frame) every tile counts as changed.
+ * Changed tiles which are adjacent within a row of tiles are merged, and the
+ * resulting rectangles are written to 'out', which must have room for one per
+ * tile.  Returns the number of rectangles.
+ * Each row of tiles is a separate job for the worker pool.
+ */
+int PerlXlib_tile_diff(const U8 *src, size_t stride, int width, int height, int bytes_per_pixel,
+    int tile_w, int tile_h, U64 *hashes, Bool compare, XRectangle *out
+) {
+    tile_diff_job j;
+    int rows= (height + tile_h - 1) / tile_h, ty, n= 0;
+    if (!rows || width <= 0) return 0;
+    PerlXlib_pixels_simd_level();
+    j.src= src; j.stride= stride; j.width= width; j.height= height;
+    j.bytes_per_pixel= bytes_per_pixel; j.tile_w= tile_w; j.tile_h= tile_h;
+    j.cols= (width + tile_w - 1) / tile_w;
+    j.hashes= hashes; j.compare= compare; j.out= out;
+    Newx(j.counts, rows, int);
+    PerlXlib_parallel_for(rows, tile_diff_row, &j);
+    /* Pack the rectangles of each row together */
+    for (ty= 0; ty < rows; ty++) {
+        if (n != ty * j.cols)
+            memmove(out + n, out + ty * j.cols, j.counts[ty] * sizeof(XRectangle));
+        n += j.counts[ty];
+    }
+    Safefree(j.counts);
+    return n;
+}
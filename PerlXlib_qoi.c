@@ -0,0 +1,325 @@
+#include "EXTERN.h"
+#include "perl.h"
+#include "XSUB.h"
+#include "ppport.h"
+
+#include <X11/Xlib.h>
+#include <X11/Xutil.h>
+#ifdef HAVE_XRENDER
+#include <X11/extensions/Xrender.h>
+#endif
+
+#include "PerlXlib.h"
+
+/*-----------------------------------------------------------------------------------
+ * QOI encoding
+ *
+ * QOI ("Quite OK Image", https://qoiformat.org/) is a lossless format which
+ * encodes each pixel as a run, a reference into a 64-entry table of recently
+ * seen colors, a small difference from the previous pixel, or a literal.  It
+ * compresses screen contents nearly as well as PNG at a small fraction of the
+ * cost, and is simple enough to encode a row at a time straight from the
+ * captured buffer.
+ *
+ * Rows are first converted to RGBA8 with PerlXlib_pixels_to_rgb, so any visual
+ * layout is accepted.  In delta mode, the image that gets encoded is the
+ * per-channel difference (mod 256) from the previous frame, so unchanged areas
+ * become long runs of zero pixels.  Such a frame is still a valid QOI image;
+ * the reader adds it back onto the previous frame.
+ */
+
+#define QOI_OP_INDEX  0x00
+#define QOI_OP_DIFF   0x40
+#define QOI_OP_LUMA   0x80
+#define QOI_OP_RUN    0xC0
+#define QOI_OP_RGB    0xFE
+#define QOI_OP_RGBA   0xFF
+#define QOI_MASK_2    0xC0
+#define QOI_HEADER_SIZE 14
+#define QOI_PADDING_SIZE 8
+
+#define QOI_HASH(r,g,b,a) (((r)*3 + (g)*5 + (b)*7 + (a)*11) & 63)
+
+/* Pixels are compared as U32 in memory order, so px and index hold the same bytes
+ * as an RGBA8 buffer.
+ */
+typedef struct PerlXlib_qoi_state {
+    U32 index[64];
+    union { U32 v; U8 c[4]; } px;
+    int run;
+} PerlXlib_qoi_state;
+
+static void qoi_state_init(PerlXlib_qoi_state *st) {
+    memset(st, 0, sizeof(*st));
+    st->px.c[3]= 255;
+}
+
+static U8 * qoi_write32(U8 *out, U32 v) {
+    out[0]= v >> 24; out[1]= v >> 16; out[2]= v >> 8; out[3]= v;
+    return out + 4;
+}
+
+static U32 qoi_read32(const U8 *p) {
+    return ((U32)p[0] << 24) | ((U32)p[1] << 16) | ((U32)p[2] << 8) | p[3];
+}
+
+/* Encode n RGBA8 pixels, continuing from the state of the previous call */
+static U8 * qoi_encode_pixels(PerlXlib_qoi_state *st, const U8 *px, int n, U8 *out) {
+    int i, h;
+    U32 v;
+    for (i= 0; i < n; i++, px += 4) {
+        memcpy(&v, px, 4);
+        if (v == st->px.v) {
+            /* Screens are mostly runs, so find the end of this one in a tight loop */
+            const U8 *p= px + 4;
+            U32 next;
+            int end= i + 1;
+            while (end < n) {
+                memcpy(&next, p, 4);
+                if (next != v) break;
+                end++;
+                p += 4;
+            }
+            st->run += end - i;
+            for (; st->run >= 62; st->run -= 62)
+                *out++= QOI_OP_RUN | 61;
+            px += (end - i - 1) * 4;
+            i= end - 1;
+            continue;
+        }
+        if (st->run) {
+            *out++= QOI_OP_RUN | (st->run - 1);
+            st->run= 0;
+        }
+        h= QOI_HASH(px[0], px[1], px[2], px[3]);
+        if (st->index[h] == v) {
+            *out++= QOI_OP_INDEX | h;
+        }
+        else {
+            st->index[h]= v;
+            if (px[3] == st->px.c[3]) {
+                signed char vr= px[0] - st->px.c[0], vg= px[1] - st->px.c[1], vb= px[2] - st->px.c[2];
+                signed char vg_r= vr - vg, vg_b= vb - vg;
+                if (vr >= -2 && vr <= 1 && vg >= -2 && vg <= 1 && vb >= -2 && vb <= 1) {
+                    *out++= QOI_OP_DIFF | ((vr + 2) << 4) | ((vg + 2) << 2) | (vb + 2);
+                }
+                else if (vg_r >= -8 && vg_r <= 7 && vg >= -32 && vg <= 31 && vg_b >= -8 && vg_b <= 7) {
+                    *out++= QOI_OP_LUMA | (vg + 32);
+                    *out++= ((vg_r + 8) << 4) | (vg_b + 8);
+                }
+                else {
+                    *out++= QOI_OP_RGB;
+                    *out++= px[0]; *out++= px[1]; *out++= px[2];
+                }
+            }
+            else {
+                *out++= QOI_OP_RGBA;
+                *out++= px[0]; *out++= px[1]; *out++= px[2]; *out++= px[3];
+            }
+        }
+        st->px.v= v;
+    }
+    return out;
+}
+
+/* Subtract (per byte, mod 256) the previous frame from a row of RGBA8, and store
+ * the row as the new previous frame.  Works on two pixels at a time, without
+ * carries between the bytes.  'keep' is OR-ed into each pixel of the result.
+ */
+#define QOI_SUB_BYTES(a, b, H) ((((a) | (H)) - ((b) & ~(H))) ^ (((a) ^ ~(b)) & (H)))
+static void qoi_delta_row(U8 *row, U8 *prev, int n, U32 keep) {
+    const U64 K= ((U64) keep << 32) | keep;
+    U64 a, b, d;
+    U32 a1, b1, d1;
+    int i;
+    for (i= 0; i + 2 <= n; i += 2, row += 8, prev += 8) {
+        memcpy(&a, row, 8);
+        memcpy(&b, prev, 8);
+        d= QOI_SUB_BYTES(a, b, 0x8080808080808080ULL) | K;
+        memcpy(prev, &a, 8);
+        memcpy(row, &d, 8);
+    }
+    if (i < n) {
+        memcpy(&a1, row, 4);
+        memcpy(&b1, prev, 4);
+        d1= QOI_SUB_BYTES(a1, b1, 0x80808080U) | keep;
+        memcpy(prev, &a1, 4);
+        memcpy(row, &d1, 4);
+    }
+}
+
+/* With more than one thread, rows are converted (and delta'd) in bands in
+ * parallel into a buffer for the whole frame, then encoded in one pass.
+ */
+typedef struct qoi_convert_job {
+    const U8 *src;
+    size_t src_stride;
+    int width, height, bits_per_pixel, byte_order, alpha, n_bands;
+    unsigned long red_mask, green_mask, blue_mask;
+    U8 *frame, *prev;
+    Bool delta;
+    U32 keep;
+} qoi_convert_job;
+
+static void qoi_convert_band(void *ctx, int i) {
+    qoi_convert_job *j= (qoi_convert_job*) ctx;
+    int y0= (int)((long long) j->height * i / j->n_bands), y1= (int)((long long) j->height * (i+1) / j->n_bands), y;
+    size_t row_bytes= (size_t) j->width * 4;
+    PerlXlib_pixels_to_rgb(j->src + y0 * j->src_stride, j->src_stride, j->width, y1 - y0,
+        j->bits_per_pixel, j->byte_order, j->red_mask, j->green_mask, j->blue_mask, j->alpha,
+        j->frame + y0 * row_bytes, row_bytes, 4);
+    if (!j->prev) return;
+    if (j->delta) {
+        for (y= y0; y < y1; y++)
+            qoi_delta_row(j->frame + y * row_bytes, j->prev + y * row_bytes, j->width, j->keep);
+    }
+    else {
+        memcpy(j->prev + y0 * row_bytes, j->frame + y0 * row_bytes, (y1 - y0) * row_bytes);
+    }
+}
+
+/* Largest possible encoding of a width x height image */
+size_t PerlXlib_qoi_max_size(int width, int height, int channels) {
+    return (size_t) width * height * (channels + 1) + QOI_HEADER_SIZE + QOI_PADDING_SIZE;
+}
+
+/* Encode an image described like an XImage (see PerlXlib_pixels_to_rgb) as QOI
+ * with 3 or 4 channels into 'out', which must hold PerlXlib_qoi_max_size bytes.
+ * If 'prev' is not NULL it is a width*height*4 buffer holding the previous frame
+ * as RGBA8; if 'delta' is true the difference from it is encoded, and either way
+ * it is overwritten with the current frame.
+ * Returns the number of bytes written, or 0 for an unsupported pixel format.
+ */
+size_t PerlXlib_qoi_encode(const U8 *src, size_t src_stride, int width, int height,
+    int bits_per_pixel, int byte_order, unsigned long red_mask, unsigned long green_mask,
+    unsigned long blue_mask, int alpha, int channels, U8 *prev, Bool delta, U8 *out
+) {
+    PerlXlib_qoi_state st;
+    U8 *p= out, *row;
+    int y;
+    size_t row_bytes= (size_t) width * 4;
+    union { U32 v; U8 c[4]; } keep= { 0 };
+
+    if (bits_per_pixel != 8 && bits_per_pixel != 16 && bits_per_pixel != 24 && bits_per_pixel != 32)
+        return 0;
+    /* With 3 channels the alpha of a delta stays 255, so it never costs anything */
+    if (channels == 3) {
+        alpha= 255;
+        keep.c[3]= 255;
+    }
+    memcpy(p, "qoif", 4);
+    p= qoi_write32(p + 4, width);
+    p= qoi_write32(p, height);
+    *p++= channels;
+    *p++= 0; /* sRGB with linear alpha */
+    qoi_state_init(&st);
+    if (PerlXlib_workers_threads() > 1 && height >= 64) {
+        qoi_convert_job j;
+        j.src= src; j.src_stride= src_stride; j.width= width; j.height= height;
+        j.bits_per_pixel= bits_per_pixel; j.byte_order= byte_order; j.alpha= alpha;
+        j.red_mask= red_mask; j.green_mask= green_mask; j.blue_mask= blue_mask;
+        j.prev= prev; j.delta= delta; j.keep= keep.v;
+        j.n_bands= PerlXlib_workers_bands(height, 32);
+        Newx(j.frame, row_bytes * height, U8);
+        PerlXlib_parallel_for(j.n_bands, qoi_convert_band, &j);
+        p= qoi_encode_pixels(&st, j.frame, width * height, p);
+        Safefree(j.frame);
+    }
+    else {
+        Newx(row, row_bytes? row_bytes : 1, U8);
+        for (y= 0; y < height; y++) {
+            PerlXlib_pixels_to_rgb(src + y * src_stride, src_stride, width, 1, bits_per_pixel,
+                byte_order, red_mask, green_mask, blue_mask, alpha, row, row_bytes, 4);
+            if (prev && delta)
+                qoi_delta_row(row, prev + y * row_bytes, width, keep.v);
+            else if (prev)
+                memcpy(prev + y * row_bytes, row, row_bytes);
+            p= qoi_encode_pixels(&st, row, width, p);
+        }
+        Safefree(row);
+    }
+    if (st.run)
+        *p++= QOI_OP_RUN | (st.run - 1);
+    memset(p, 0, QOI_PADDING_SIZE - 1);
+    p[QOI_PADDING_SIZE - 1]= 1;
+    p += QOI_PADDING_SIZE;
+    return p - out;
+}
+
+/* Read the width, height and channels of a QOI image.  Returns False if the
+ * header is not valid.
+ */
+Bool PerlXlib_qoi_header(const U8 *src, size_t len, int *width, int *height, int *channels) {
+    U32 w, h;
+    if (len < QOI_HEADER_SIZE + QOI_PADDING_SIZE || memcmp(src, "qoif", 4) != 0)
+        return False;
+    w= qoi_read32(src + 4);
+    h= qoi_read32(src + 8);
+    if (w > 0x7FFF || h > 0x7FFF || (src[12] != 3 && src[12] != 4))
+        return False;
+    *width= w;
+    *height= h;
+    *channels= src[12];
+    return True;
+}
+
+/* Decode a QOI image into dst, which must hold width*height*channels bytes as
+ * given by PerlXlib_qoi_header.  If 'prev' is not NULL, the decoded image is a
+ * delta and is added to it.  (dst and prev may be the same buffer.)
+ * Returns False if the data is truncated.
+ */
+Bool PerlXlib_qoi_decode(const U8 *src, size_t len, U8 *dst, const U8 *prev) {
+    PerlXlib_qoi_state st;
+    int width, height, channels, ch;
+    size_t n, i, pos= QOI_HEADER_SIZE, end= len - QOI_PADDING_SIZE;
+    if (!PerlXlib_qoi_header(src, len, &width, &height, &channels))
+        return False;
+    qoi_state_init(&st);
+    n= (size_t) width * height;
+    for (i= 0; i < n; i++) {
+        if (st.run) {
+            st.run--;
+        }
+        else {
+            int b1;
+            if (pos >= end) return False;
+            b1= src[pos++];
+            if (b1 == QOI_OP_RGB) {
+                if (pos + 3 > end) return False;
+                st.px.c[0]= src[pos]; st.px.c[1]= src[pos+1]; st.px.c[2]= src[pos+2];
+                pos += 3;
+            }
+            else if (b1 == QOI_OP_RGBA) {
+                if (pos + 4 > end) return False;
+                memcpy(st.px.c, src + pos, 4);
+                pos += 4;
+            }
+            else if ((b1 & QOI_MASK_2) == QOI_OP_INDEX) {
+                st.px.v= st.index[b1];
+            }
+            else if ((b1 & QOI_MASK_2) == QOI_OP_DIFF) {
+                st.px.c[0] += ((b1 >> 4) & 3) - 2;
+                st.px.c[1] += ((b1 >> 2) & 3) - 2;
+                st.px.c[2] += (b1 & 3) - 2;
+            }
+            else if ((b1 & QOI_MASK_2) == QOI_OP_LUMA) {
+                int b2, vg;
+                if (pos >= end) return False;
+                b2= src[pos++];
+                vg= (b1 & 0x3F) - 32;
+                st.px.c[0] += vg - 8 + ((b2 >> 4) & 0xF);
+                st.px.c[1] += vg;
+                st.px.c[2] += vg - 8 + (b2 & 0xF);
+            }
+            else {
+                st.run= b1 & 0x3F;
+            }
+            st.index[QOI_HASH(st.px.c[0], st.px.c[1], st.px.c[2], st.px.c[3])]= st.px.v;
+        }
+        for (ch= 0; ch < channels; ch++)
+            dst[ch]= prev? (U8)(prev[ch] + st.px.c[ch]) : st.px.c[ch];
+        dst += channels;
+        if (prev) prev += channels;
+    }
+    return True;
+}
@@ -0,0 +1,361 @@
+#include "EXTERN.h"
+#include "perl.h"
+#include "XSUB.h"
+#include "ppport.h"
+
+#include <X11/Xlib.h>
+#include <X11/Xutil.h>
+#ifdef HAVE_XRENDER
+#include <X11/extensions/Xrender.h>
+#endif
+
+#include "PerlXlib.h"
+
+/*-----------------------------------------------------------------------------------
+ * Client-side regions
+ *
+ * A region is an array of boxes (x1, y1, x2, y2, with x2 and y2 exclusive) in
+ * "y-x banded" form, the same as the X server's miRegion and Xlib's Region:
+ * the boxes are sorted by y1 then x1, boxes with the same y1 all have the same
+ * y2 and form a band, boxes within a band don't touch, bands don't overlap, and
+ * two bands which touch vertically never have identical lists of x spans (they
+ * would have been merged into one band).  So every region has exactly one
+ * representation, and equality is a memcmp.
+ *
+ * All operations are one sweep down the y axis, stopping at each y where a band
+ * of either input starts or ends, and combining the x spans of the two bands
+ * active there.  The result is built directly in an SV buffer.
+ */
+
+typedef struct region_out {
+    SV *sv;
+    int n;          /* boxes written */
+    int prev_band;  /* index of first box of the last band, or -1 */
+} region_out;
+
+static PerlXlib_box* region_out_reserve(region_out *out, int more) {
+    STRLEN need= (STRLEN)(out->n + more) * sizeof(PerlXlib_box);
+    if (SvLEN(out->sv) <= need)
+        SvGROW(out->sv, need + need / 2 + sizeof(PerlXlib_box));
+    return ((PerlXlib_box*) SvPVX(out->sv)) + out->n;
+}
+
+/* Append a band of 'n' spans (x1 and x2 of 'spans', y of the arguments), merging
+ * it into the previous band if that ends at y1 and has the same spans. */
+static void region_out_band(region_out *out, const PerlXlib_box *spans, int n, int y1, int y2) {
+    PerlXlib_box *dst, *prev;
+    int i, prev_n;
+    if (!n) return;
+    if (out->prev_band >= 0) {
+        prev= ((PerlXlib_box*) SvPVX(out->sv)) + out->prev_band;
+        prev_n= out->n - out->prev_band;
+        if (prev_n == n && prev->y2 == y1) {
+            for (i= 0; i < n; i++)
+                if (prev[i].x1 != spans[i].x1 || prev[i].x2 != spans[i].x2) break;
+            if (i == n) {
+                for (i= 0; i < n; i++) prev[i].y2= y2;
+                return;
+            }
+        }
+    }
+    dst= region_out_reserve(out, n);
+    for (i= 0; i < n; i++) {
+        dst[i].x1= spans[i].x1;
+        dst[i].x2= spans[i].x2;
+        dst[i].y1= y1;
+        dst[i].y2= y2;
+    }
+    out->prev_band= out->n;
+    out->n += n;
+}
+
+/* Index just past the band starting at i */
+static inline int band_end(const PerlXlib_box *r, int n, int i) {
+    int y1= r[i].y1;
+    while (++i < n && r[i].y1 == y1);
+    return i;
+}
+
+/* Combine two sorted, disjoint lists of spans.  'tmp' must have room for na+nb. */
+static int combine_spans(const PerlXlib_box *a, int na, const PerlXlib_box *b, int nb,
+    int op, PerlXlib_box *tmp
+) {
+    int ia= 0, ib= 0, n= 0, x1, x2;
+    switch (op) {
+    case PerlXlib_REGION_UNION:
+        while (ia < na || ib < nb) {
+            const PerlXlib_box *s= (ib >= nb || (ia < na && a[ia].x1 <= b[ib].x1))? &a[ia++] : &b[ib++];
+            if (n && s->x1 <= tmp[n-1].x2) {
+                if (s->x2 > tmp[n-1].x2) tmp[n-1].x2= s->x2;
+            }
+            else {
+                tmp[n].x1= s->x1;
+                tmp[n++].x2= s->x2;
+            }
+        }
+        break;
+    case PerlXlib_REGION_INTERSECT:
+        while (ia < na && ib < nb) {
+            x1= a[ia].x1 > b[ib].x1? a[ia].x1 : b[ib].x1;
+            x2= a[ia].x2 < b[ib].x2? a[ia].x2 : b[ib].x2;
+            if (x1 < x2) {
+                tmp[n].x1= x1;
+                tmp[n++].x2= x2;
+            }
+            if (a[ia].x2 < b[ib].x2) ia++; else ib++;
+        }
+        break;
+    case PerlXlib_REGION_SUBTRACT:
+        for (; ia < na; ia++) {
+            x1= a[ia].x1;
+            /* skip spans of b entirely left of this one */
+            while (ib < nb && b[ib].x2 <= x1) ib++;
+            while (ib < nb && b[ib].x1 < a[ia].x2) {
+                if (b[ib].x1 > x1) {
+                    tmp[n].x1= x1;
+                    tmp[n++].x2= b[ib].x1;
+                }
+                if (b[ib].x2 >= a[ia].x2) { x1= a[ia].x2; break; }
+                x1= b[ib++].x2;
+            }
+            if (x1 < a[ia].x2) {
+                tmp[n].x1= x1;
+                tmp[n++].x2= a[ia].x2;
+            }
+        }
+        break;
+    default:
+        croak("BUG: unknown region op %d", op);
+    }
+    return n;
+}
+
+void PerlXlib_region_op(const PerlXlib_box *a, int na, const PerlXlib_box *b, int nb, int op, SV *dst) {
+    region_out out;
+    PerlXlib_box *tmp;
+    int ia= 0, ib= 0, ea, eb, y, y2, n;
+    Bool a_on, b_on;
+
+    out.sv= dst;
+    out.n= 0;
+    out.prev_band= -1;
+    if (!SvOK(dst)) sv_setpvn(dst, "", 0);
+    SvPV_force_nolen(dst);
+    /* Shortcuts, which also spare the temp buffer for the common empty cases */
+    if (op == PerlXlib_REGION_INTERSECT && (!na || !nb)) na= nb= 0;
+    else if (op == PerlXlib_REGION_SUBTRACT && !na) nb= 0;
+    if (na + nb) {
+        Newx(tmp, na + nb, PerlXlib_box);
+        ea= na? band_end(a, na, 0) : 0;
+        eb= nb? band_end(b, nb, 0) : 0;
+        y= (!nb || (na && a[0].y1 < b[0].y1))? a[0].y1 : b[0].y1;
+        while (ia < na || ib < nb) {
+            /* drop bands which end at or above y */
+            while (ia < na && a[ia].y2 <= y) { ia= ea; if (ia < na) ea= band_end(a, na, ia); }
+            while (ib < nb && b[ib].y2 <= y) { ib= eb; if (ib < nb) eb= band_end(b, nb, ib); }
+            if (ia >= na && ib >= nb) break;
+            /* next y where something starts or ends */
+            y2= INT_MAX;
+            a_on= ia < na && a[ia].y1 <= y;
+            b_on= ib < nb && b[ib].y1 <= y;
+            if (ia < na) { int e= a_on? a[ia].y2 : a[ia].y1; if (e < y2) y2= e; }
+            if (ib < nb) { int e= b_on? b[ib].y2 : b[ib].y1; if (e < y2) y2= e; }
+            if (a_on || b_on) {
+                n= combine_spans(a + ia, a_on? ea - ia : 0, b + ib, b_on? eb - ib : 0, op, tmp);
+                region_out_band(&out, tmp, n, y, y2);
+            }
+            y= y2;
+        }
+        Safefree(tmp);
+    }
+    SvCUR_set(dst, (STRLEN)out.n * sizeof(PerlXlib_box));
+    SvPOK_only(dst);
+}
+
+/* Build a banded region from boxes in any order, possibly overlapping.  Empty
+ * boxes are skipped.  Boxes are merged pairwise, like a merge sort, so this takes
+ * O(n log n) for typical inputs. */
+void PerlXlib_region_from_boxes(const PerlXlib_box *boxes, int n, SV *dst) {
+    SV **parts, *tmp;
+    int n_parts= 0, i, j;
+
+    if (!SvOK(dst)) sv_setpvn(dst, "", 0);
+    SvPV_force_nolen(dst);
+    Newx(parts, n + 1, SV*);
+    SAVEFREEPV(parts);
+    for (i= 0; i < n; i++)
+        if (boxes[i].x1 < boxes[i].x2 && boxes[i].y1 < boxes[i].y2)
+            parts[n_parts++]= newSVpvn((const char*)(boxes + i), sizeof(PerlXlib_box));
+    if (!n_parts) {
+        sv_setpvn(dst, "", 0);
+        return;
+    }
+    while (n_parts > 1) {
+        for (i= 0, j= 0; i + 1 < n_parts; i += 2) {
+            tmp= newSVpvn("", 0);
+            PerlXlib_region_op(
+                (PerlXlib_box*) SvPVX(parts[i]), SvCUR(parts[i]) / sizeof(PerlXlib_box),
+                (PerlXlib_box*) SvPVX(parts[i+1]), SvCUR(parts[i+1]) / sizeof(PerlXlib_box),
+                PerlXlib_REGION_UNION, tmp);
+            SvREFCNT_dec(parts[i]);
+            SvREFCNT_dec(parts[i+1]);
+            parts[j++]= tmp;
+        }
+        if (i < n_parts) parts[j++]= parts[i];
+        n_parts= j;
+    }
+    sv_setsv(dst, parts[0]);
+    SvREFCNT_dec(parts[0]);
+}
+
+void PerlXlib_region_extents(const PerlXlib_box *r, int n, PerlXlib_box *ext) {
+    int i;
+    if (!n) {
+        ext->x1= ext->y1= ext->x2= ext->y2= 0;
+        return;
+    }
+    ext->y1= r[0].y1;
+    ext->y2= r[n-1].y2;
+    ext->x1= r[0].x1;
+    ext->x2= r[0].x2;
+    for (i= 1; i < n; i++) {
+        if (r[i].x1 < ext->x1) ext->x1= r[i].x1;
+        if (r[i].x2 > ext->x2) ext->x2= r[i].x2;
+    }
+}
+
+/* Whether point x,y is inside, using binary search for the band. */
+Bool PerlXlib_region_contains_point(const PerlXlib_box *r, int n, int x, int y) {
+    int lo= 0, hi= n - 1, mid;
+    while (lo <= hi) {
+        mid= (lo + hi) >> 1;
+        if (r[mid].y2 <= y || (r[mid].y1 <= y && r[mid].x2 <= x)) lo= mid + 1;
+        else hi= mid - 1;
+    }
+    return lo < n && r[lo].y1 <= y && y < r[lo].y2 && r[lo].x1 <= x && x < r[lo].x2;
+}
+
+/*-----------------------------------------------------------------------------------
+ * Regions from masks
+ *
+ * Each row of the mask becomes one band of spans, and region_out_band merges it
+ * into the band above when the spans are the same, so the result comes out in
+ * banded form without any region operations.  1-bit rows are read 64 pixels at a
+ * time and runs are found with count-trailing-zeros, so fully set or fully clear
+ * stretches cost one test per word.  8-bit rows skip whole words of 0x00 or 0xFF.
+ */
+
+#ifdef __GNUC__
+#define CTZ64(w) __builtin_ctzll(w)
+#else
+static int CTZ64(U64 w) {
+    int n= 0;
+    while (!(w & 1)) { w >>= 1; n++; }
+    return n;
+}
+#endif
+
+/* Load up to 8 bytes so that byte i is bits 8*i..8*i+7 of the result */
+static inline U64 load_le64(const U8 *p, int n) {
+    U64 w= 0;
+    int i;
+#if BYTEORDER == 0x1234 || BYTEORDER == 0x12345678
+    if (n == 8) {
+        memcpy(&w, p, 8);
+        return w;
+    }
+#endif
+    for (i= n - 1; i >= 0; i--)
+        w= (w << 8) | p[i];
+    return w;
+}
+
+static int mask_row_spans_1bpp(const U8 *row, int width, Bool msb_first, PerlXlib_box *spans) {
+    int n= 0, start= 0, base, pos, row_bytes= (width + 7) >> 3, off;
+    Bool in_run= 0;
+    U64 w, v;
+    for (off= 0; off < row_bytes; off += 8) {
+        w= load_le64(row + off, row_bytes - off < 8? row_bytes - off : 8);
+        if (msb_first) {
+            /* reverse the bits of each byte, so pixel i of the word is bit i */
+            w= ((w >> 1) & 0x5555555555555555ULL) | ((w & 0x5555555555555555ULL) << 1);
+            w= ((w >> 2) & 0x3333333333333333ULL) | ((w & 0x3333333333333333ULL) << 2);
+            w= ((w >> 4) & 0x0F0F0F0F0F0F0F0FULL) | ((w & 0x0F0F0F0F0F0F0F0FULL) << 4);
+        }
+        base= off * 8;
+        /* ignore the padding bits past the end of the row */
+        if (width - base < 64)
+            w &= (((U64)1) << (width - base)) - 1;
+        for (pos= 0; pos < 64; ) {
+            v= (in_run? ~w : w) >> pos;
+            if (!v) break;
+            pos += CTZ64(v);
+            if (in_run) {
+                spans[n].x1= start;
+                spans[n++].x2= base + pos;
+            }
+            else start= base + pos;
+            in_run= !in_run;
+        }
+    }
+    if (in_run) {
+        spans[n].x1= start;
+        spans[n++].x2= width;
+    }
+    return n;
+}
+
+static int mask_row_spans_8bpp(const U8 *row, int width, int threshold, PerlXlib_box *spans) {
+    int n= 0, start= 0, x= 0;
+    Bool in_run= 0;
+    U64 w;
+    while (x < width) {
+        if (x + 8 <= width) {
+            memcpy(&w, row + x, 8);
+            if (w == (in_run? ~(U64)0 : 0)) {
+                x += 8;
+                continue;
+            }
+        }
+        if ((row[x] >= threshold) != in_run) {
+            if (in_run) {
+                spans[n].x1= start;
+                spans[n++].x2= x;
+            }
+            else start= x;
+            in_run= !in_run;
+        }
+        x++;
+    }
+    if (in_run) {
+        spans[n].x1= start;
+        spans[n++].x2= width;
+    }
+    return n;
+}
+
+/* Region of the pixels set in a mask of 1 bit per pixel (LSB or MSB first within
+ * each byte) or 8 bits per pixel (set if >= threshold, which must be at least 1). */
+void PerlXlib_region_from_mask(const U8 *mask, int width, int height, size_t stride,
+    int depth, Bool msb_first, int threshold, SV *dst
+) {
+    region_out out;
+    PerlXlib_box *spans;
+    int y, n;
+
+    out.sv= dst;
+    out.n= 0;
+    out.prev_band= -1;
+    if (!SvOK(dst)) sv_setpvn(dst, "", 0);
+    SvPV_force_nolen(dst);
+    if (threshold < 1) threshold= 1;
+    Newx(spans, width / 2 + 1, PerlXlib_box);
+    for (y= 0; y < height; y++) {
+        n= depth == 1? mask_row_spans_1bpp(mask + y * stride, width, msb_first, spans)
+            : mask_row_spans_8bpp(mask + y * stride, width, threshold, spans);
+        region_out_band(&out, spans, n, y, y + 1);
+    }
+    Safefree(spans);
+    SvCUR_set(dst, (STRLEN)out.n * sizeof(PerlXlib_box));
+    SvPOK_only(dst);
+}
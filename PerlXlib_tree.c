@@ -0,0 +1,750 @@
+#include "EXTERN.h"
+#include "perl.h"
+#include "XSUB.h"
+#include "ppport.h"
+
+/* Xlibint.h gives access to the request buffer and async reply handlers,
+ * which are the only way to pipeline requests that have replies without
+ * going through XCB.  Xlib does the same thing internally for
+ * XGetWindowAttributes.
+ */
+#include <X11/Xlibint.h>
+#include <X11/Xproto.h>
+#include <X11/Xutil.h>
+#ifdef HAVE_XRENDER
+#include <X11/extensions/Xrender.h>
+#endif
+
+#include "PerlXlib.h"
+
+#ifndef X_DPY_GET_REQUEST
+#define X_DPY_GET_REQUEST(dpy) ((dpy)->request)
+#endif
+#ifndef X_DPY_GET_LAST_REQUEST_READ
+#define X_DPY_GET_LAST_REQUEST_READ(dpy) ((dpy)->last_request_read)
+#endif
+
+/*-----------------------------------------------------------------------------------
+ * Window tree snapshot
+ *
+ * The tree is walked breadth-first.  For each level, every request (QueryTree,
+ * plus optional GetWindowAttributes and GetGeometry) for every window of that
+ * level is written to the request buffer, followed by one GetInputFocus whose
+ * reply we wait for.  By the time that reply arrives, all the others have been
+ * processed by the async handler, so the cost is one round trip per level of
+ * the tree instead of up to three per window.
+ */
+
+struct PerlXlib_tree_snapshot {
+    Display *dpy;
+    PerlXlib_tree_row *rows;
+    unsigned long *event_masks; /* optional, parallel to rows */
+    int n_rows, max_rows;
+    int level_start;          /* first row of the level being queried */
+    int per_row;              /* number of requests issued per row */
+    int kinds[3];             /* request opcode for each of those */
+    unsigned long first_seq;  /* sequence number of first request of this level */
+    unsigned long last_seq;   /* sequence number of last request of this level */
+    CARD32 *child_buf;
+    int child_buf_len;
+    XErrorHandler prev_error_handler;
+};
+
+/* XSetErrorHandler is global, so the error handler needs to find the snapshot in progress */
+static struct PerlXlib_tree_snapshot *PerlXlib_tree_snapshot_active= NULL;
+
+static PerlXlib_tree_row * PerlXlib_tree_snapshot_add_rows(struct PerlXlib_tree_snapshot *st, int n) {
+    if (st->n_rows + n > st->max_rows) {
+        st->max_rows= (st->n_rows + n) * 2;
+        Renew(st->rows, st->max_rows, PerlXlib_tree_row);
+        if (st->event_masks)
+            Renew(st->event_masks, st->max_rows, unsigned long);
+    }
+    Zero(st->rows + st->n_rows, n, PerlXlib_tree_row);
+    if (st->event_masks)
+        Zero(st->event_masks + st->n_rows, n, unsigned long);
+    st->n_rows += n;
+    return st->rows + st->n_rows - n;
+}
+
+/* Errors for our requests mean the window was destroyed while we were looking
+ * at it.  Mark the row as gone, and hide the error from the application. */
+static int PerlXlib_tree_snapshot_error_handler(Display *dpy, XErrorEvent *err) {
+    struct PerlXlib_tree_snapshot *st= PerlXlib_tree_snapshot_active;
+    if (st && dpy == st->dpy && err->serial >= st->first_seq && err->serial <= st->last_seq) {
+        st->rows[st->level_start + (err->serial - st->first_seq) / st->per_row].xid= None;
+        return 0;
+    }
+    return st && st->prev_error_handler? st->prev_error_handler(dpy, err) : 0;
+}
+
+static Bool PerlXlib_tree_snapshot_reply_handler(Display *dpy, xReply *rep, char *buf, int len, XPointer data) {
+    struct PerlXlib_tree_snapshot *st= (struct PerlXlib_tree_snapshot*) data;
+    unsigned long seq= X_DPY_GET_LAST_REQUEST_READ(dpy);
+    PerlXlib_tree_row *row;
+    int idx, i, n;
+
+    if (seq < st->first_seq || seq > st->last_seq)
+        return False;
+    /* let errors go to the error handler */
+    if (rep->generic.type == X_Error)
+        return False;
+
+    idx= st->level_start + (seq - st->first_seq) / st->per_row;
+    switch (st->kinds[(seq - st->first_seq) % st->per_row]) {
+    case X_QueryTree: {
+        xQueryTreeReply qt_buf, *qt;
+        qt= (xQueryTreeReply*) _XGetAsyncReply(dpy, (char*) &qt_buf, rep, buf, len,
+            (SIZEOF(xQueryTreeReply) - SIZEOF(xReply)) >> 2, False);
+        n= qt->nChildren;
+        if (n > st->child_buf_len) {
+            st->child_buf_len= n;
+            Renew(st->child_buf, n, CARD32);
+        }
+        _XGetAsyncData(dpy, (char*) st->child_buf, buf, len,
+            SIZEOF(xQueryTreeReply), n * 4, qt->length << 2);
+        row= PerlXlib_tree_snapshot_add_rows(st, n);
+        for (i= 0; i < n; i++) {
+            row[i].parent= idx;
+            row[i].xid= st->child_buf[i];
+        }
+        break;
+    }
+    case X_GetWindowAttributes: {
+        xGetWindowAttributesReply wa_buf, *wa;
+        wa= (xGetWindowAttributesReply*) _XGetAsyncReply(dpy, (char*) &wa_buf, rep, buf, len,
+            (SIZEOF(xGetWindowAttributesReply) - SIZEOF(xReply)) >> 2, True);
+        row= st->rows + idx;
+        row->map_state= wa->mapState;
+        row->override_redirect= wa->override;
+        if (st->event_masks)
+            st->event_masks[idx]= wa->yourEventMask;
+        break;
+    }
+    case X_GetGeometry: {
+        xGetGeometryReply geom_buf, *geom;
+        geom= (xGetGeometryReply*) _XGetAsyncReply(dpy, (char*) &geom_buf, rep, buf, len,
+            (SIZEOF(xGetGeometryReply) - SIZEOF(xReply)) >> 2, True);
+        row= st->rows + idx;
+        row->x= geom->x;
+        row->y= geom->y;
+        row->width= geom->width;
+        row->height= geom->height;
+        row->border_width= geom->borderWidth;
+        row->depth= geom->depth;
+        break;
+    }
+    }
+    return True;
+}
+
+/* Walk the tree below (and including) 'root', returning a newly allocated
+ * array of rows in *rows_out (to be released with Safefree).  'flags' is a
+ * combination of PerlXlib_TREE_GEOMETRY and PerlXlib_TREE_ATTRIBUTES.
+ * If event_masks_out is not NULL, it receives a parallel array of this
+ * client's event mask for each window (which requires PerlXlib_TREE_ATTRIBUTES).
+ * Returns the number of rows.
+ */
+int PerlXlib_snapshot_tree(Display *dpy, Window root, int flags, PerlXlib_tree_row **rows_out, unsigned long **event_masks_out) {
+    struct PerlXlib_tree_snapshot st;
+    _XAsyncHandler async;
+    xGetInputFocusReply sync_rep;
+    xResourceReq *req;
+    int i, level_end;
+
+    if (PerlXlib_tree_snapshot_active)
+        croak("snapshot_tree is not re-entrant");
+    Zero(&st, 1, struct PerlXlib_tree_snapshot);
+    st.dpy= dpy;
+    if (event_masks_out) {
+        flags |= PerlXlib_TREE_ATTRIBUTES;
+        Newxz(st.event_masks, 1, unsigned long);
+    }
+    st.kinds[st.per_row++]= X_QueryTree;
+    if (flags & PerlXlib_TREE_ATTRIBUTES) st.kinds[st.per_row++]= X_GetWindowAttributes;
+    if (flags & PerlXlib_TREE_GEOMETRY)   st.kinds[st.per_row++]= X_GetGeometry;
+    PerlXlib_tree_snapshot_add_rows(&st, 1);
+    st.rows[0].parent= -1;
+    st.rows[0].xid= root;
+
+    PerlXlib_tree_snapshot_active= &st;
+    st.prev_error_handler= XSetErrorHandler(&PerlXlib_tree_snapshot_error_handler);
+    LockDisplay(dpy);
+    /* The async handler must be registered before the first request gets flushed */
+    async.next= dpy->async_handlers;
+    async.handler= &PerlXlib_tree_snapshot_reply_handler;
+    async.data= (XPointer) &st;
+    dpy->async_handlers= &async;
+
+    while (st.level_start < st.n_rows) {
+        level_end= st.n_rows;
+        st.first_seq= X_DPY_GET_REQUEST(dpy) + 1;
+        for (i= st.level_start; i < level_end; i++) {
+            GetResReq(QueryTree, st.rows[i].xid, req);
+            if (flags & PerlXlib_TREE_ATTRIBUTES)
+                GetResReq(GetWindowAttributes, st.rows[i].xid, req);
+            if (flags & PerlXlib_TREE_GEOMETRY)
+                GetResReq(GetGeometry, st.rows[i].xid, req);
+        }
+        st.last_seq= X_DPY_GET_REQUEST(dpy);
+        /* One round trip collects all replies of this level */
+        {
+            xReq *sync_req;
+            GetEmptyReq(GetInputFocus, sync_req);
+            (void) sync_req;
+        }
+        _XReply(dpy, (xReply*) &sync_rep, 0, xTrue);
+        st.level_start= level_end;
+    }
+
+    DeqAsyncHandler(dpy, &async);
+    UnlockDisplay(dpy);
+    XSetErrorHandler(st.prev_error_handler);
+    PerlXlib_tree_snapshot_active= NULL;
+    SyncHandle();
+    if (st.child_buf) Safefree(st.child_buf);
+    *rows_out= st.rows;
+    if (event_masks_out) *event_masks_out= st.event_masks;
+    return st.n_rows;
+}
+
+/*-----------------------------------------------------------------------------------
+ * Window tree mirror
+ *
+ * A copy of the window hierarchy below some root, built from a snapshot and
+ * then kept up to date from the events of SubstructureNotifyMask, so that
+ * questions about parent, children, stacking and geometry can be answered
+ * without asking the server.
+ *
+ * Nodes live in one array and refer to each other by index.  Siblings are a
+ * doubly-linked list from bottom (parent->first_child) to top (parent->last_child).
+ * An open-addressed hash table maps Window to node index.
+ */
+
+#define WTREE_SLOT_EMPTY   -1
+#define WTREE_SLOT_DELETED -2
+
+#define WTREE_HASH(w) ((unsigned long)(w) * 2654435761UL)
+
+static int PerlXlib_wtree_slot(PerlXlib_wtree *t, Window w) {
+    unsigned long mask= t->hash_size - 1, i= WTREE_HASH(w) & mask;
+    int ent;
+    while ((ent= t->hash[i]) != WTREE_SLOT_EMPTY) {
+        if (ent >= 0 && t->nodes[ent].xid == w)
+            return i;
+        i= (i + 1) & mask;
+    }
+    return -1;
+}
+
+int PerlXlib_wtree_find(PerlXlib_wtree *t, Window w) {
+    int slot= (w && t->hash_size)? PerlXlib_wtree_slot(t, w) : -1;
+    return slot < 0? -1 : t->hash[slot];
+}
+
+static void PerlXlib_wtree_hash_insert(PerlXlib_wtree *t, Window w, int idx) {
+    unsigned long mask, i;
+    int *old_hash, old_size, j;
+    /* Rebuild at 3/4 full, counting tombstones, but size the new table for the
+     * live entries alone, so that churn with a steady number of windows only
+     * clears out the tombstones instead of doubling the table every time. */
+    if ((t->hash_used + 1) * 4 > t->hash_size * 3) {
+        old_hash= t->hash;
+        old_size= t->hash_size;
+        t->hash_size= 64;
+        while (t->count * 2 > t->hash_size) t->hash_size *= 2;
+        Newx(t->hash, t->hash_size, int);
+        for (j= 0; j < t->hash_size; j++) t->hash[j]= WTREE_SLOT_EMPTY;
+        t->hash_used= 0;
+        for (j= 0; j < old_size; j++)
+            if (old_hash[j] >= 0)
+                PerlXlib_wtree_hash_insert(t, t->nodes[old_hash[j]].xid, old_hash[j]);
+        if (old_hash) Safefree(old_hash);
+    }
+    mask= t->hash_size - 1;
+    i= WTREE_HASH(w) & mask;
+    while (t->hash[i] >= 0)
+        i= (i + 1) & mask;
+    if (t->hash[i] == WTREE_SLOT_EMPTY)
+        t->hash_used++;
+    t->hash[i]= idx;
+}
+
+static int PerlXlib_wtree_alloc_node(PerlXlib_wtree *t, Window w) {
+    PerlXlib_wtree_node *node;
+    int idx;
+    if (t->free_head >= 0) {
+        idx= t->free_head;
+        t->free_head= t->nodes[idx].above;
+    }
+    else {
+        if (t->n_nodes >= t->max_nodes) {
+            t->max_nodes= t->max_nodes? t->max_nodes * 2 : 64;
+            Renew(t->nodes, t->max_nodes, PerlXlib_wtree_node);
+        }
+        idx= t->n_nodes++;
+    }
+    node= t->nodes + idx;
+    Zero(node, 1, PerlXlib_wtree_node);
+    node->xid= w;
+    node->parent= node->first_child= node->last_child= node->below= node->above= -1;
+    t->count++;
+    PerlXlib_wtree_hash_insert(t, w, idx);
+    return idx;
+}
+
+/* Remove a node from its parent's list of children */
+static void PerlXlib_wtree_unlink(PerlXlib_wtree *t, int idx) {
+    PerlXlib_wtree_node *node= t->nodes + idx;
+    if (node->parent < 0) return;
+    if (node->parent == t->root) t->stack_dirty= True;
+    if (node->below >= 0) t->nodes[node->below].above= node->above;
+    else t->nodes[node->parent].first_child= node->above;
+    if (node->above >= 0) t->nodes[node->above].below= node->below;
+    else t->nodes[node->parent].last_child= node->below;
+    node->parent= node->below= node->above= -1;
+}
+
+/* Insert a node as a child of 'parent', directly above sibling 'below' (or at the bottom if -1) */
+static void PerlXlib_wtree_link(PerlXlib_wtree *t, int idx, int parent, int below) {
+    PerlXlib_wtree_node *node= t->nodes + idx;
+    if (parent == t->root) t->stack_dirty= True;
+    node->parent= parent;
+    node->below= below;
+    node->above= below >= 0? t->nodes[below].above : t->nodes[parent].first_child;
+    if (below >= 0) t->nodes[below].above= idx;
+    else t->nodes[parent].first_child= idx;
+    if (node->above >= 0) t->nodes[node->above].below= idx;
+    else t->nodes[parent].last_child= idx;
+}
+
+#define PerlXlib_wtree_link_top(t, idx, parent) PerlXlib_wtree_link(t, idx, parent, (t)->nodes[parent].last_child)
+
+/* Spatial index
+ *
+ * The mapped children of the root are registered in each cell of a uniform grid
+ * which their outer rectangle (including border) overlaps.  Windows partly outside
+ * the root are clamped to the edge cells, so the grid covers the whole plane.
+ * Stacking order among them is given by stack_pos, renumbered lazily after restacks.
+ */
+
+#define WTREE_GRID_MAX   32
+#define WTREE_CELL_MIN   64
+
+static void PerlXlib_wtree_cell_add(PerlXlib_wtree_cell *cell, int idx) {
+    if (cell->count >= cell->max) {
+        cell->max= cell->max? cell->max * 2 : 8;
+        Renew(cell->items, cell->max, int);
+    }
+    cell->items[cell->count++]= idx;
+}
+
+static void PerlXlib_wtree_cell_del(PerlXlib_wtree_cell *cell, int idx) {
+    int i;
+    for (i= 0; i < cell->count; i++)
+        if (cell->items[i] == idx) {
+            cell->items[i]= cell->items[--cell->count];
+            return;
+        }
+}
+
+static int PerlXlib_wtree_cell_col(PerlXlib_wtree *t, int x) {
+    return x < 0? 0 : x / t->cell_w >= t->grid_cols? t->grid_cols - 1 : x / t->cell_w;
+}
+
+static int PerlXlib_wtree_cell_row(PerlXlib_wtree *t, int y) {
+    return y < 0? 0 : y / t->cell_h >= t->grid_rows? t->grid_rows - 1 : y / t->cell_h;
+}
+
+static void PerlXlib_wtree_unindex(PerlXlib_wtree *t, int idx) {
+    PerlXlib_wtree_node *node= t->nodes + idx;
+    int col, row;
+    if (!node->indexed) return;
+    for (row= node->cell_y0; row <= node->cell_y1; row++)
+        for (col= node->cell_x0; col <= node->cell_x1; col++)
+            PerlXlib_wtree_cell_del(t->cells + row * t->grid_cols + col, idx);
+    node->indexed= 0;
+}
+
+/* Bring a node's grid registration up to date with its geometry and map state */
+static void PerlXlib_wtree_reindex(PerlXlib_wtree *t, int idx) {
+    PerlXlib_wtree_node *node= t->nodes + idx;
+    int col, row, x0, y0, x1, y1;
+    if (!t->cells || node->parent != t->root || !node->mapped) {
+        PerlXlib_wtree_unindex(t, idx);
+        return;
+    }
+    x0= PerlXlib_wtree_cell_col(t, node->x);
+    y0= PerlXlib_wtree_cell_row(t, node->y);
+    x1= PerlXlib_wtree_cell_col(t, node->x + node->width + node->border_width * 2 - 1);
+    y1= PerlXlib_wtree_cell_row(t, node->y + node->height + node->border_width * 2 - 1);
+    if (node->indexed && x0 == node->cell_x0 && y0 == node->cell_y0
+        && x1 == node->cell_x1 && y1 == node->cell_y1)
+        return;
+    PerlXlib_wtree_unindex(t, idx);
+    for (row= y0; row <= y1; row++)
+        for (col= x0; col <= x1; col++)
+            PerlXlib_wtree_cell_add(t->cells + row * t->grid_cols + col, idx);
+    node->cell_x0= x0;
+    node->cell_y0= y0;
+    node->cell_x1= x1;
+    node->cell_y1= y1;
+    node->indexed= 1;
+}
+
+static void PerlXlib_wtree_free_grid(PerlXlib_wtree *t) {
+    int i;
+    if (!t->cells) return;
+    for (i= t->grid_cols * t->grid_rows - 1; i >= 0; i--)
+        if (t->cells[i].items) Safefree(t->cells[i].items);
+    Safefree(t->cells);
+    t->cells= NULL;
+}
+
+/* (Re)build the grid to fit the current size of the root */
+static void PerlXlib_wtree_init_grid(PerlXlib_wtree *t) {
+    PerlXlib_wtree_node *root= t->nodes + t->root;
+    int idx;
+    PerlXlib_wtree_free_grid(t);
+    t->cell_w= root->width / WTREE_GRID_MAX + 1;
+    if (t->cell_w < WTREE_CELL_MIN) t->cell_w= WTREE_CELL_MIN;
+    t->cell_h= root->height / WTREE_GRID_MAX + 1;
+    if (t->cell_h < WTREE_CELL_MIN) t->cell_h= WTREE_CELL_MIN;
+    t->grid_cols= (root->width + t->cell_w - 1) / t->cell_w;
+    if (t->grid_cols < 1) t->grid_cols= 1;
+    t->grid_rows= (root->height + t->cell_h - 1) / t->cell_h;
+    if (t->grid_rows < 1) t->grid_rows= 1;
+    Newxz(t->cells, t->grid_cols * t->grid_rows, PerlXlib_wtree_cell);
+    for (idx= root->first_child; idx >= 0; idx= t->nodes[idx].above) {
+        t->nodes[idx].indexed= 0;
+        PerlXlib_wtree_reindex(t, idx);
+    }
+}
+
+static void PerlXlib_wtree_renumber(PerlXlib_wtree *t) {
+    int idx, pos= 0;
+    for (idx= t->nodes[t->root].first_child; idx >= 0; idx= t->nodes[idx].above)
+        t->nodes[idx].stack_pos= pos++;
+    t->stack_dirty= False;
+}
+
+#define WTREE_NODE_CONTAINS(n, px, py) ( \
+    (px) >= (n)->x && (px) < (n)->x + (n)->width + (n)->border_width * 2 \
+    && (py) >= (n)->y && (py) < (n)->y + (n)->height + (n)->border_width * 2 )
+
+/* Returns the index of the top-most mapped child of the root containing (x,y), or -1 */
+int PerlXlib_wtree_window_at(PerlXlib_wtree *t, int x, int y) {
+    PerlXlib_wtree_cell *cell;
+    PerlXlib_wtree_node *node;
+    int i, best= -1;
+    if (!t->cells) return -1;
+    if (t->stack_dirty) PerlXlib_wtree_renumber(t);
+    cell= t->cells + PerlXlib_wtree_cell_row(t, y) * t->grid_cols + PerlXlib_wtree_cell_col(t, x);
+    for (i= 0; i < cell->count; i++) {
+        node= t->nodes + cell->items[i];
+        if (WTREE_NODE_CONTAINS(node, x, y)
+            && (best < 0 || node->stack_pos > t->nodes[best].stack_pos))
+            best= cell->items[i];
+    }
+    return best;
+}
+
+static int PerlXlib_wtree_cmp_stack_pos(const void *a, const void *b) {
+    return ((const int*)a)[1] - ((const int*)b)[1];
+}
+
+/* Find the mapped children of the root which overlap a rectangle.  Stores a newly
+ * allocated array of node indices, in stacking order from bottom to top, into
+ * *idx_out (to be freed with Safefree) and returns the number of elements. */
+int PerlXlib_wtree_windows_in_rect(PerlXlib_wtree *t, int x, int y, int w, int h, int **idx_out) {
+    PerlXlib_wtree_cell *cell;
+    PerlXlib_wtree_node *node;
+    int col, row, col1, row1, i, n= 0, max= 0, *pairs= NULL;
+    *idx_out= NULL;
+    if (!t->cells || w <= 0 || h <= 0) return 0;
+    if (t->stack_dirty) PerlXlib_wtree_renumber(t);
+    /* a window spanning several cells is only reported once per query */
+    if (++t->visit == 0) {
+        for (i= 0; i < t->n_nodes; i++) t->nodes[i].visit= 0;
+        t->visit= 1;
+    }
+    col1= PerlXlib_wtree_cell_col(t, x + w - 1);
+    row1= PerlXlib_wtree_cell_row(t, y + h - 1);
+    for (row= PerlXlib_wtree_cell_row(t, y); row <= row1; row++) {
+        for (col= PerlXlib_wtree_cell_col(t, x); col <= col1; col++) {
+            cell= t->cells + row * t->grid_cols + col;
+            for (i= 0; i < cell->count; i++) {
+                node= t->nodes + cell->items[i];
+                if (node->visit == t->visit) continue;
+                node->visit= t->visit;
+                if (node->x < x + w && x < node->x + node->width + node->border_width * 2
+                    && node->y < y + h && y < node->y + node->height + node->border_width * 2
+                ) {
+                    if (n >= max) {
+                        max= max? max * 2 : 16;
+                        Renew(pairs, max * 2, int);
+                    }
+                    pairs[n*2]= cell->items[i];
+                    pairs[n*2+1]= node->stack_pos;
+                    n++;
+                }
+            }
+        }
+    }
+    if (n) {
+        qsort(pairs, n, sizeof(int) * 2, PerlXlib_wtree_cmp_stack_pos);
+        for (i= 0; i < n; i++) pairs[i]= pairs[i*2];
+    }
+    *idx_out= pairs;
+    return n;
+}
+
+/* Remove a node and all its descendants */
+static void PerlXlib_wtree_remove(PerlXlib_wtree *t, int idx) {
+    PerlXlib_wtree_node *node= t->nodes + idx;
+    int slot;
+    while (node->first_child >= 0)
+        PerlXlib_wtree_remove(t, node->first_child);
+    PerlXlib_wtree_unindex(t, idx);
+    PerlXlib_wtree_unlink(t, idx);
+    slot= PerlXlib_wtree_slot(t, node->xid);
+    if (slot >= 0) t->hash[slot]= WTREE_SLOT_DELETED;
+    node->xid= None;
+    node->above= t->free_head;
+    t->free_head= idx;
+    t->count--;
+}
+
+/* Ask for the events in 'want' on a window, without losing the event mask this
+ * client had already selected on it. */
+static void PerlXlib_wtree_select(PerlXlib_wtree *t, Window w, long cur_mask, long want) {
+    if (t->select_input && (cur_mask & want) != want)
+        XSelectInput(t->dpy, w, cur_mask | want);
+}
+
+/* Add the subtree rooted at 'w' (fetched from the server) as the top-most
+ * child of 'parent', or as the root of the mirror if parent is -1. */
+static int PerlXlib_wtree_graft(PerlXlib_wtree *t, Window w, int parent) {
+    PerlXlib_tree_row *rows;
+    unsigned long *masks;
+    int n, i, *map, idx;
+    PerlXlib_wtree_node *node;
+
+    n= PerlXlib_snapshot_tree(t->dpy, w, PerlXlib_TREE_GEOMETRY|PerlXlib_TREE_ATTRIBUTES, &rows, &masks);
+    Newx(map, n, int);
+    for (i= 0; i < n; i++) {
+        map[i]= -1;
+        /* windows that vanished during the snapshot, or whose parent vanished */
+        if (!rows[i].xid || (i > 0 && map[rows[i].parent] < 0))
+            continue;
+        /* A window can't be in the tree twice; trust the newer information */
+        if ((idx= PerlXlib_wtree_find(t, rows[i].xid)) >= 0)
+            PerlXlib_wtree_remove(t, idx);
+        map[i]= idx= PerlXlib_wtree_alloc_node(t, rows[i].xid);
+        node= t->nodes + idx;
+        node->x= rows[i].x;
+        node->y= rows[i].y;
+        node->width= rows[i].width;
+        node->height= rows[i].height;
+        node->border_width= rows[i].border_width;
+        node->mapped= rows[i].map_state != IsUnmapped;
+        node->override_redirect= rows[i].override_redirect;
+        if (i > 0)
+            PerlXlib_wtree_link_top(t, idx, map[rows[i].parent]);
+        else if (parent >= 0)
+            PerlXlib_wtree_link_top(t, idx, parent);
+        else {
+            t->root= idx;
+            t->root_map_state= rows[i].map_state;
+            PerlXlib_wtree_init_grid(t);
+        }
+        PerlXlib_wtree_reindex(t, idx);
+        /* The root's own resize and map state come from StructureNotify */
+        PerlXlib_wtree_select(t, rows[i].xid, masks[i],
+            i == 0 && parent < 0? SubstructureNotifyMask|StructureNotifyMask : SubstructureNotifyMask);
+    }
+    idx= map[0];
+    Safefree(map);
+    Safefree(rows);
+    Safefree(masks);
+    return idx;
+}
+
+PerlXlib_wtree * PerlXlib_wtree_new(Display *dpy, Window root, Bool select_input) {
+    PerlXlib_wtree *t;
+    Newxz(t, 1, PerlXlib_wtree);
+    t->dpy= dpy;
+    t->select_input= select_input;
+    t->free_head= -1;
+    t->root= -1;
+    t->root= PerlXlib_wtree_graft(t, root, -1);
+    if (t->select_input) XFlush(dpy);
+    return t;
+}
+
+void PerlXlib_wtree_free(PerlXlib_wtree *t) {
+    PerlXlib_wtree_free_grid(t);
+    if (t->nodes) Safefree(t->nodes);
+    if (t->hash) Safefree(t->hash);
+    Safefree(t);
+}
+
+/* Map state as the server would report it: a mapped window is only viewable
+ * if all of its ancestors are mapped. */
+int PerlXlib_wtree_map_state(PerlXlib_wtree *t, int idx) {
+    if (idx == t->root) return t->root_map_state;
+    if (!t->nodes[idx].mapped) return IsUnmapped;
+    for (idx= t->nodes[idx].parent; idx != t->root; idx= t->nodes[idx].parent)
+        if (!t->nodes[idx].mapped) return IsUnviewable;
+    return t->root_map_state == IsViewable? IsViewable : IsUnviewable;
+}
+
+/* Errors for the query below mean the root was destroyed, which its DestroyNotify
+ * will report.  Hide them from the application, and pass on any others. */
+static unsigned long PerlXlib_wtree_query_serial;
+static Bool PerlXlib_wtree_query_failed;
+static XErrorHandler PerlXlib_wtree_query_prev_handler;
+static int PerlXlib_wtree_query_error_handler(Display *dpy, XErrorEvent *err) {
+    if (err->serial >= PerlXlib_wtree_query_serial) {
+        PerlXlib_wtree_query_failed= True;
+        return 0;
+    }
+    return PerlXlib_wtree_query_prev_handler? PerlXlib_wtree_query_prev_handler(dpy, err) : 0;
+}
+
+/* Ask the server for the map state of a window, or return -1 if it is gone */
+static int PerlXlib_wtree_query_map_state(PerlXlib_wtree *t, Window w) {
+    XWindowAttributes attrs;
+    Status ok;
+    PerlXlib_wtree_query_serial= NextRequest(t->dpy);
+    PerlXlib_wtree_query_failed= False;
+    PerlXlib_wtree_query_prev_handler= XSetErrorHandler(&PerlXlib_wtree_query_error_handler);
+    ok= XGetWindowAttributes(t->dpy, w, &attrs);
+    XSetErrorHandler(PerlXlib_wtree_query_prev_handler);
+    return ok && !PerlXlib_wtree_query_failed? attrs.map_state : -1;
+}
+
+/* Update the tree from an event.  Returns true if the event was relevant. */
+Bool PerlXlib_wtree_apply_event(PerlXlib_wtree *t, XEvent *e) {
+    PerlXlib_wtree_node *node;
+    int idx, parent, below, state;
+
+    switch (e->type) {
+    case CreateNotify:
+        if ((parent= PerlXlib_wtree_find(t, e->xcreatewindow.parent)) < 0) return False;
+        if ((idx= PerlXlib_wtree_find(t, e->xcreatewindow.window)) >= 0)
+            PerlXlib_wtree_remove(t, idx);
+        if (t->select_input) {
+            /* Only this client could have already selected events on its own new
+             * window, and XSelectInput would replace them, so graft loads those from
+             * the server.  Another client's window can be selected right away. */
+            if ((e->xcreatewindow.window & ~t->dpy->resource_mask) != t->dpy->resource_base)
+                PerlXlib_wtree_select(t, e->xcreatewindow.window, 0, SubstructureNotifyMask);
+            /* Children created before the selection took effect produce no CreateNotify,
+             * so fetch the window along with any children it already has. */
+            PerlXlib_wtree_graft(t, e->xcreatewindow.window, parent);
+            return True;
+        }
+        idx= PerlXlib_wtree_alloc_node(t, e->xcreatewindow.window);
+        node= t->nodes + idx;
+        node->x= e->xcreatewindow.x;
+        node->y= e->xcreatewindow.y;
+        node->width= e->xcreatewindow.width;
+        node->height= e->xcreatewindow.height;
+        node->border_width= e->xcreatewindow.border_width;
+        node->override_redirect= e->xcreatewindow.override_redirect;
+        /* new windows start on top of their siblings */
+        PerlXlib_wtree_link_top(t, idx, parent);
+        return True;
+    case DestroyNotify:
+        if ((idx= PerlXlib_wtree_find(t, e->xdestroywindow.window)) < 0 || idx == t->root) return False;
+        PerlXlib_wtree_remove(t, idx);
+        return True;
+    case ReparentNotify:
+        idx= PerlXlib_wtree_find(t, e->xreparent.window);
+        parent= PerlXlib_wtree_find(t, e->xreparent.parent);
+        if (idx == t->root) return False;
+        if (idx < 0) {
+            /* A window moved in from outside the mirror needs to be fetched, with its children */
+            if (parent < 0) return False;
+            PerlXlib_wtree_graft(t, e->xreparent.window, parent);
+            return True;
+        }
+        if (parent < 0) {
+            /* moved out of the mirror */
+            PerlXlib_wtree_remove(t, idx);
+            return True;
+        }
+        node= t->nodes + idx;
+        /* the same event arrives once per parent (and once more for StructureNotify) */
+        if (node->parent != parent) {
+            PerlXlib_wtree_unlink(t, idx);
+            PerlXlib_wtree_link_top(t, idx, parent);
+        }
+        node->x= e->xreparent.x;
+        node->y= e->xreparent.y;
+        node->override_redirect= e->xreparent.override_redirect;
+        PerlXlib_wtree_reindex(t, idx);
+        return True;
+    case ConfigureNotify:
+        if ((idx= PerlXlib_wtree_find(t, e->xconfigure.window)) < 0) return False;
+        node= t->nodes + idx;
+        if (idx == t->root && (node->width != e->xconfigure.width || node->height != e->xconfigure.height)) {
+            node->width= e->xconfigure.width;
+            node->height= e->xconfigure.height;
+            PerlXlib_wtree_init_grid(t);
+        }
+        node->x= e->xconfigure.x;
+        node->y= e->xconfigure.y;
+        node->width= e->xconfigure.width;
+        node->height= e->xconfigure.height;
+        node->border_width= e->xconfigure.border_width;
+        node->override_redirect= e->xconfigure.override_redirect;
+        /* 'above' is the sibling this window is now directly on top of, or None for the bottom */
+        below= PerlXlib_wtree_find(t, e->xconfigure.above);
+        if (node->parent >= 0 && below != idx && (below < 0 || t->nodes[below].parent == node->parent)) {
+            parent= node->parent;
+            PerlXlib_wtree_unlink(t, idx);
+            PerlXlib_wtree_link(t, idx, parent, below);
+        }
+        PerlXlib_wtree_reindex(t, idx);
+        return True;
+    case GravityNotify:
+        if ((idx= PerlXlib_wtree_find(t, e->xgravity.window)) < 0) return False;
+        t->nodes[idx].x= e->xgravity.x;
+        t->nodes[idx].y= e->xgravity.y;
+        PerlXlib_wtree_reindex(t, idx);
+        return True;
+    case MapNotify:
+        if ((idx= PerlXlib_wtree_find(t, e->xmap.window)) < 0) return False;
+        if (idx == t->root) {
+            /* Viewable depends on the ancestors outside the mirror */
+            if ((state= PerlXlib_wtree_query_map_state(t, e->xmap.window)) < 0) return False;
+            t->root_map_state= state;
+            return True;
+        }
+        t->nodes[idx].mapped= 1;
+        t->nodes[idx].override_redirect= e->xmap.override_redirect;
+        PerlXlib_wtree_reindex(t, idx);
+        return True;
+    case UnmapNotify:
+        if ((idx= PerlXlib_wtree_find(t, e->xunmap.window)) < 0) return False;
+        if (idx == t->root) {
+            t->root_map_state= IsUnmapped;
+            return True;
+        }
+        t->nodes[idx].mapped= 0;
+        PerlXlib_wtree_reindex(t, idx);
+        return True;
+    case CirculateNotify:
+        if ((idx= PerlXlib_wtree_find(t, e->xcirculate.window)) < 0 || idx == t->root) return False;
+        parent= t->nodes[idx].parent;
+        PerlXlib_wtree_unlink(t, idx);
+        if (e->xcirculate.place == PlaceOnTop)
+            PerlXlib_wtree_link_top(t, idx, parent);
+        else
+            PerlXlib_wtree_link(t, idx, parent, -1);
+        return True;
+    }
+    return False;
+}
@@ -0,0 +1,198 @@
+#include "EXTERN.h"
+#include "perl.h"
+#include "XSUB.h"
+#include "ppport.h"
+
+#include <X11/Xlib.h>
+#include <X11/Xutil.h>
+#ifdef HAVE_XRENDER
+#include <X11/extensions/Xrender.h>
+#endif
+#ifdef HAVE_PTHREAD
+#include <pthread.h>
+#include <signal.h>
+#include <unistd.h>
+#endif
+
+#include "PerlXlib.h"
+
+/*-----------------------------------------------------------------------------------
+ * Worker pool
+ *
+ * The pixel operations split images into bands of rows and hand them to
+ * PerlXlib_parallel_for, which runs them on a pool of plain pthreads and on the
+ * calling thread, and returns when all are done.  Jobs only ever touch the C
+ * buffers they are given, never the perl interpreter, so perl's own threading
+ * (which this module doesn't support anyway) has nothing to do with it.
+ *
+ * The pool is started on first use with (thread count - 1) workers.  If the pool
+ * is already busy (another interpreter in the same process) or the count is 1,
+ * jobs run on the calling thread.  After a fork() the child has no workers, so
+ * the pool remembers which process started it and starts over in a new one.
+ */
+
+#ifdef HAVE_PTHREAD
+
+static struct PerlXlib_pool {
+    pthread_mutex_t mutex;
+    pthread_cond_t work_cv, done_cv;
+    pthread_t *threads;
+    int n_threads;      /* workers running, not counting the caller */
+    int want_threads;   /* total threads requested, including the caller */
+    pid_t pid;
+    Bool busy, shutdown;
+    unsigned generation;
+    PerlXlib_job_fn *fn;
+    void *ctx;
+    int n_jobs, next_job, done_jobs;
+} pool= { PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER, PTHREAD_COND_INITIALIZER, NULL, 0, 1 };
+
+static void* PerlXlib_pool_worker(void *unused) {
+    unsigned seen= 0;
+    int job;
+    pthread_mutex_lock(&pool.mutex);
+    while (1) {
+        while (!pool.shutdown && (seen == pool.generation || pool.next_job >= pool.n_jobs))
+            pthread_cond_wait(&pool.work_cv, &pool.mutex);
+        if (pool.shutdown) break;
+        seen= pool.generation;
+        while (pool.next_job < pool.n_jobs) {
+            job= pool.next_job++;
+            pthread_mutex_unlock(&pool.mutex);
+            pool.fn(pool.ctx, job);
+            pthread_mutex_lock(&pool.mutex);
+            if (++pool.done_jobs == pool.n_jobs)
+                pthread_cond_signal(&pool.done_cv);
+        }
+    }
+    pthread_mutex_unlock(&pool.mutex);
+    return NULL;
+}
+
+/* Stop all workers.  Called with the mutex held and the pool not busy. */
+static void PerlXlib_pool_stop(void) {
+    int i, n= pool.n_threads;
+    if (!n) return;
+    if (pool.pid == getpid()) {
+        pool.shutdown= pool.busy= True;
+        pthread_cond_broadcast(&pool.work_cv);
+        pthread_mutex_unlock(&pool.mutex);
+        for (i= 0; i < n; i++)
+            pthread_join(pool.threads[i], NULL);
+        pthread_mutex_lock(&pool.mutex);
+        pool.shutdown= pool.busy= False;
+    }
+    /* else: forked child, where the threads don't exist */
+    free(pool.threads);
+    pool.threads= NULL;
+    pool.n_threads= 0;
+}
+
+/* Start workers up to the requested count.  Called with the mutex held. */
+static void PerlXlib_pool_start(void) {
+    int i, n= pool.want_threads - 1;
+    sigset_t all, prev;
+    if (pool.n_threads && pool.pid != getpid())
+        PerlXlib_pool_stop();
+    if (pool.n_threads >= n) return;
+    PerlXlib_pool_stop();
+    pool.threads= (pthread_t*) malloc(sizeof(pthread_t) * n);
+    if (!pool.threads) return;
+    pool.pid= getpid();
+    pool.next_job= pool.n_jobs= 0;
+    /* Workers inherit the signal mask.  Blocking everything makes sure signals
+     * are delivered to the perl thread, whose handlers can't run on a worker. */
+    sigfillset(&all);
+    pthread_sigmask(SIG_SETMASK, &all, &prev);
+    for (i= 0; i < n; i++) {
+        if (pthread_create(&pool.threads[i], NULL, PerlXlib_pool_worker, NULL) != 0)
+            break;
+        pool.n_threads++;
+    }
+    pthread_sigmask(SIG_SETMASK, &prev, NULL);
+}
+
+#endif /* HAVE_PTHREAD */
+
+int PerlXlib_workers_max_threads(void) {
+#if defined(HAVE_PTHREAD) && defined(_SC_NPROCESSORS_ONLN)
+    long n= sysconf(_SC_NPROCESSORS_ONLN);
+    return n < 1? 1 : n > PerlXlib_WORKERS_MAX? PerlXlib_WORKERS_MAX : (int) n;
+#else
+    return 1;
+#endif
+}
+
+int PerlXlib_workers_threads(void) {
+#ifdef HAVE_PTHREAD
+    return pool.want_threads;
+#else
+    return 1;
+#endif
+}
+
+/* Set the total number of threads used, including the caller.  0 means one per
+ * CPU.  Returns the number in effect.
+ */
+int PerlXlib_workers_set_threads(int n) {
+#ifdef HAVE_PTHREAD
+    if (n <= 0) n= PerlXlib_workers_max_threads();
+    if (n > PerlXlib_WORKERS_MAX) n= PerlXlib_WORKERS_MAX;
+    pthread_mutex_lock(&pool.mutex);
+    if (!pool.busy) {
+        pool.want_threads= n;
+        if (pool.n_threads > n - 1) PerlXlib_pool_stop();
+    }
+    n= pool.want_threads;
+    pthread_mutex_unlock(&pool.mutex);
+    return n;
+#else
+    return 1;
+#endif
+}
+
+/* Number of bands to split 'rows' rows into, so that each has at least
+ * 'min_rows' rows and there are a few per thread to even out the load.
+ */
+int PerlXlib_workers_bands(int rows, int min_rows) {
+    int n= PerlXlib_workers_threads() * 4, max= rows / (min_rows > 0? min_rows : 1);
+    if (n > max) n= max;
+    return n < 1? 1 : n;
+}
+
+/* Run fn(ctx, i) for i in 0..n_jobs-1, in parallel, and return when all are done. */
+void PerlXlib_parallel_for(int n_jobs, PerlXlib_job_fn *fn, void *ctx) {
+    int job;
+#ifdef HAVE_PTHREAD
+    if (n_jobs > 1 && pool.want_threads > 1) {
+        pthread_mutex_lock(&pool.mutex);
+        if (!pool.busy) {
+            PerlXlib_pool_start();
+            if (pool.n_threads) {
+                pool.busy= True;
+                pool.fn= fn;
+                pool.ctx= ctx;
+                pool.n_jobs= n_jobs;
+                pool.next_job= pool.done_jobs= 0;
+                pool.generation++;
+                pthread_cond_broadcast(&pool.work_cv);
+                while (pool.next_job < pool.n_jobs) {
+                    job= pool.next_job++;
+                    pthread_mutex_unlock(&pool.mutex);
+                    fn(ctx, job);
+                    pthread_mutex_lock(&pool.mutex);
+                    pool.done_jobs++;
+                }
+                while (pool.done_jobs < pool.n_jobs)
+                    pthread_cond_wait(&pool.done_cv, &pool.mutex);
+                pool.busy= False;
+                pthread_mutex_unlock(&pool.mutex);
+                return;
+            }
+        }
+        pthread_mutex_unlock(&pool.mutex);
+    }
+#endif
+    for (job= 0; job < n_jobs; job++)
+        fn(ctx, job);
+}
@@ -18,6 +18,14 @@
 #ifdef HAVE_XRENDER
 #include <X11/extensions/Xrender.h>
 #endif
+#ifdef HAVE_XDAMAGE
+#include <X11/extensions/Xdamage.h>
+#endif
+#ifdef HAVE_XSHM
+#include <sys/ipc.h>
+#include <sys/shm.h>
+#include <X11/extensions/XShm.h>
+#endif
 
 #include "PerlXlib.h"
 void PerlXlib_sanity_check_data_structures();
@@ -68,6 +76,129 @@ static Bool is_an_integer(SV *sv) {
     return len > 0;
 }
 
+/* Make a banded region from an arrayref of XRectangle (or hashrefs) or a string
+ * of packed XRectangle, storing its boxes in 'dst'. */
+static void rects_to_region(SV *rects, SV *dst) {
+    XRectangle *r;
+    PerlXlib_box *boxes;
+    int n, i;
+
+    r= (XRectangle*) PerlXlib_get_struct_array(rects, "X11::Xlib::XRectangle", sizeof(XRectangle),
+        (PerlXlib_struct_pack_fn*) PerlXlib_XRectangle_pack, &n);
+    Newx(boxes, n + 1, PerlXlib_box);
+    SAVEFREEPV(boxes);
+    for (i= 0; i < n; i++) {
+        boxes[i].x1= r[i].x;
+        boxes[i].y1= r[i].y;
+        boxes[i].x2= r[i].x + r[i].width;
+        boxes[i].y2= r[i].y + r[i].height;
+    }
+    PerlXlib_region_from_boxes(boxes, n, dst);
+}
+
+/* Boxes of an X11::Xlib::Region, or of a temporary region made from rectangles */
+static PerlXlib_box* sv_to_region_boxes(SV *sv, int *count_out) {
+    SV *tmp;
+    const char *buf;
+    STRLEN len;
+
+    if (sv_isobject(sv) && SvTYPE(SvRV(sv)) < SVt_PVAV && sv_derived_from(sv, "X11::Xlib::Region"))
+        buf= SvPV(SvRV(sv), len);
+    else {
+        tmp= sv_2mortal(newSVpvn("", 0));
+        rects_to_region(sv, tmp);
+        buf= SvPV(tmp, len);
+    }
+    *count_out= (int)(len / sizeof(PerlXlib_box));
+    return (PerlXlib_box*) buf;
+}
+
+#define CLIP16(v, lo, hi) ((v) < (lo)? (lo) : (v) > (hi)? (hi) : (v))
+
+/* New region object of the same class as 'proto' (a region or class name) */
+static SV* new_region_obj(SV *proto, SV **boxes_out) {
+    SV *boxes= newSVpvn("", 0);
+    HV *stash= sv_isobject(proto)? SvSTASH(SvRV(proto)) : gv_stashsv(proto, GV_ADD);
+    *boxes_out= boxes;
+    return sv_bless(newRV_noinc(boxes), stash);
+}
+
+#ifdef HAVE_XRENDER
+/* XRenderColor from an arrayref of [ red, green, blue, alpha ] (16 bits each,
+ * alpha defaulting to 0xFFFF) or a string of 4 packed native shorts. */
+static void sv_to_render_color(SV *sv, XRenderColor *color) {
+    AV *av;
+    SV **elem;
+    STRLEN len;
+    const char *buf;
+    int i;
+    unsigned short *chan[4];
+
+    if (SvROK(sv) && SvTYPE(SvRV(sv)) == SVt_PVAV) {
+        av= (AV*) SvRV(sv);
+        chan[0]= &color->red, chan[1]= &color->green, chan[2]= &color->blue, chan[3]= &color->alpha;
+        for (i= 0; i < 4; i++) {
+            elem= av_fetch(av, i, 0);
+            *chan[i]= elem && SvOK(*elem)? (unsigned short) SvUV(*elem) : i == 3? 0xFFFF : 0;
+        }
+        return;
+    }
+    buf= SvPV(sv, len);
+    if (len != sizeof(XRenderColor))
+        croak("Expected arrayref of [ red, green, blue, alpha ] or packed XRenderColor");
+    memcpy(color, buf, sizeof(XRenderColor));
+}
+
+/* Array of glyph ids, each 'out_size' bytes wide, from an arrayref of integers or a
+ * string of packed native unsigned integers 'packed_size' bytes wide.  A packed
+ * string of the same width is used in place; anything else is copied to a mortal
+ * buffer. */
+static void* sv_to_glyph_ids(SV *sv, int packed_size, int out_size, int *count_out) {
+    AV *av= NULL;
+    SV **elem;
+    const char *src= NULL;
+    char *buf;
+    STRLEN len;
+    unsigned long val;
+    int i, n;
+
+    if (SvROK(sv) && SvTYPE(SvRV(sv)) == SVt_PVAV) {
+        av= (AV*) SvRV(sv);
+        n= av_len(av) + 1;
+    }
+    else {
+        src= SvPV(sv, len);
+        if (len % packed_size)
+            croak("Length of packed glyph array (%ld) is not a multiple of %d", (long) len, packed_size);
+        n= (int)(len / packed_size);
+        if (packed_size == out_size) {
+            *count_out= n;
+            return (void*) src;
+        }
+    }
+    buf= SvPVX(sv_2mortal(newSV(n * out_size + 1)));
+    for (i= 0; i < n; i++) {
+        if (av) {
+            elem= av_fetch(av, i, 0);
+            val= elem && SvOK(*elem)? (unsigned long) SvUV(*elem) : 0;
+        }
+        else switch (packed_size) {
+            case 1: val= ((const unsigned char*) src)[i]; break;
+            case 2: val= ((const unsigned short*) src)[i]; break;
+            default: val= ((const unsigned int*) src)[i];
+        }
+        switch (out_size) {
+            case 1: ((unsigned char*) buf)[i]= (unsigned char) val; break;
+            case 2: ((unsigned short*) buf)[i]= (unsigned short) val; break;
+            case 4: ((unsigned int*) buf)[i]= (unsigned int) val; break;
+            default: ((Glyph*) buf)[i]= (Glyph) val;
+        }
+    }
+    *count_out= n;
+    return buf;
+}
+#endif
+
 MODULE = X11::Xlib                PACKAGE = X11::Xlib
 
 void
@@ -209,6 +340,43 @@ int
 ConnectionNumber(dpy)
     Display * dpy
 
+unsigned long
+XNextRequest(dpy)
+    Display * dpy
+
+unsigned long
+LastKnownRequestProcessed(dpy)
+    Display * dpy
+
+void
+_free_xids(dpy, kind, xids)
+    Display * dpy
+    int kind
+    SV *xids
+    INIT:
+        const XID *ids;
+        STRLEN len, n, i;
+        unsigned long first;
+    PPCODE:
+        ids= (const XID*) SvPVbyte(xids, len);
+        if (len % sizeof(XID))
+            croak("Packed XID list length must be a multiple of %d", (int) sizeof(XID));
+        n= len / sizeof(XID);
+        first= XNextRequest(dpy);
+        switch (kind) {
+        case 0: for (i= 0; i < n; i++) XDestroyWindow(dpy, ids[i]); break;
+        case 1: for (i= 0; i < n; i++) XFreePixmap(dpy, ids[i]); break;
+        case 2: for (i= 0; i < n; i++) XFreeColormap(dpy, ids[i]); break;
+#if defined(XFIXES_VERSION) && XFIXES_MAJOR >= 2
+        case 3: for (i= 0; i < n; i++) XFixesDestroyRegion(dpy, ids[i]); break;
+#endif
+        default: croak("Unsupported resource kind %d", kind);
+        }
+        /* serial range of the requests just queued */
+        EXTEND(SP, 2);
+        PUSHs(sv_2mortal(newSVuv(first)));
+        PUSHs(sv_2mortal(newSVuv(XNextRequest(dpy) - 1)));
+
 void
 XSetCloseDownMode(dpy, close_mode)
     Display * dpy
@@ -559,9 +727,12 @@ _wait_event(dpy, wnd, event_type, event_mask, event_return, max_wait_msec)
         struct timeval tv;
     CODE:
         retry:
+        /* XCheckMaskEvent never matches extension events, which have no mask bit,
+         * so the unfiltered case (wait_event's default mask) takes any event. */
         RETVAL= wnd && event_type? XCheckTypedWindowEvent(dpy, wnd, event_type, &event)
               : wnd?               XCheckWindowEvent(dpy, wnd, event_mask, &event)
               : event_type?        XCheckTypedEvent(dpy, event_type, &event)
+              : event_mask == 0x7FFFFFFF? (XPending(dpy) > 0 && XNextEvent(dpy, &event) == 0)
               :                    XCheckMaskEvent(dpy, event_mask, &event);
         if (!RETVAL && !retried) {
             x11_fd= ConnectionNumber(dpy);
@@ -800,6 +971,320 @@ XCreatePixmapFromBitmapData(dpy, drw, data, width, height, fg, bg, depth)
     OUTPUT:
         RETVAL
 
+# Image Functions (fn_image) -------------------------------------------------
+
+void
+XCreateImage(dpy, visual, depth, format, offset, data, width, height, bitmap_pad, bytes_per_line= 0)
+    Display * dpy
+    VisualOrNull visual
+    unsigned int depth
+    int format
+    int offset
+    SV * data
+    unsigned int width
+    unsigned int height
+    int bitmap_pad
+    int bytes_per_line
+    INIT:
+        XImage *img;
+        SV *objref;
+    PPCODE:
+        img= XCreateImage(dpy, visual, depth, format, offset, NULL, width, height, bitmap_pad, bytes_per_line);
+        if (!img)
+            croak("XCreateImage failed");
+        objref= PerlXlib_ximage_wrap(img, data, ST(0));
+        PerlXlib_ximage_sync(objref, False);
+        PUSHs(objref);
+
+void
+XGetImage(dpy, drw, x, y, width, height, plane_mask, format, data= NULL)
+    Display * dpy
+    Drawable drw
+    int x
+    int y
+    unsigned int width
+    unsigned int height
+    unsigned long plane_mask
+    int format
+    SV * data
+    PPCODE:
+        PUSHs(PerlXlib_get_image(dpy, drw, x, y, width, height, plane_mask, format, data));
+
+void
+XGetSubImage(dpy, drw, x, y, width, height, plane_mask, format, dest_image, dest_x, dest_y)
+    Display * dpy
+    Drawable drw
+    int x
+    int y
+    unsigned int width
+    unsigned int height
+    unsigned long plane_mask
+    int format
+    SV * dest_image
+    int dest_x
+    int dest_y
+    PPCODE:
+        if (PerlXlib_get_sub_image(dpy, drw, x, y, width, height, plane_mask, format, dest_image, dest_x, dest_y))
+            PUSHs(dest_image);
+        else
+            PUSHs(&PL_sv_undef);
+
+void
+XPutImage(dpy, drw, gc, image, src_x, src_y, dest_x, dest_y, width, height)
+    Display * dpy
+    Drawable drw
+    GC gc
+    SV * image
+    int src_x
+    int src_y
+    int dest_x
+    int dest_y
+    unsigned int width
+    unsigned int height
+    INIT:
+        XImage *img= PerlXlib_ximage_sync(image, False);
+    CODE:
+        XPutImage(dpy, drw, gc, img, src_x, src_y, dest_x, dest_y, width, height);
+
+void
+XDestroyImage(image)
+    SV * image
+    CODE:
+        PerlXlib_ximage_destroy(image);
+
+unsigned long
+XGetPixel(image, x, y)
+    SV * image
+    int x
+    int y
+    INIT:
+        XImage *img= PerlXlib_ximage_sync(image, False);
+    CODE:
+        if (x < 0 || y < 0 || x >= img->width || y >= img->height)
+            croak("Pixel %d,%d is outside of %dx%d image", x, y, img->width, img->height);
+        RETVAL= XGetPixel(img, x, y);
+    OUTPUT:
+        RETVAL
+
+void
+XPutPixel(image, x, y, pixel)
+    SV * image
+    int x
+    int y
+    unsigned long pixel
+    INIT:
+        XImage *img= PerlXlib_ximage_sync(image, True);
+    CODE:
+        if (x < 0 || y < 0 || x >= img->width || y >= img->height)
+            croak("Pixel %d,%d is outside of %dx%d image", x, y, img->width, img->height);
+        XPutPixel(img, x, y, pixel);
+
+# GC Functions (fn_gc) ------------------------------------------------------
+
+GC
+XCreateGC(dpy, drawable, valuemask= 0, values= NULL)
+    Display *dpy
+    Drawable drawable
+    unsigned long valuemask
+    XGCValues *values
+    CODE:
+        if (valuemask && !values)
+            croak("values may only be NULL if valuemask is 0");
+        RETVAL = XCreateGC(dpy, drawable, valuemask, values);
+    OUTPUT:
+        RETVAL
+
+void
+XChangeGC(dpy, gc, valuemask, values)
+    Display *dpy
+    GC gc
+    unsigned long valuemask
+    XGCValues *values
+
+int
+XGetGCValues(dpy, gc, valuemask, values_out)
+    Display *dpy
+    GC gc
+    unsigned long valuemask
+    SV *values_out
+    INIT:
+        XGCValues vals, *dest;
+    CODE:
+        memset(&vals, 0, sizeof(vals));
+        RETVAL = XGetGCValues(dpy, gc, valuemask, &vals);
+        if (RETVAL) {
+            dest= (XGCValues*) PerlXlib_get_struct_ptr(
+                values_out, 1,
+                "X11::Xlib::XGCValues", sizeof(XGCValues),
+                (PerlXlib_struct_pack_fn*) PerlXlib_XGCValues_pack
+            );
+            memcpy(dest, &vals, sizeof(vals));
+        }
+    OUTPUT:
+        RETVAL
+
+void
+XFreeGC(dpy, gc)
+    Display *dpy
+    GC gc
+    CODE:
+        XFreeGC(dpy, gc);
+        PerlXlib_objref_set_pointer(ST(1), NULL, NULL);
+
+void
+XSetForeground(dpy, gc, pixel)
+    Display *dpy
+    GC gc
+    unsigned long pixel
+
+void
+XSetBackground(dpy, gc, pixel)
+    Display *dpy
+    GC gc
+    unsigned long pixel
+
+void
+XSetFunction(dpy, gc, function)
+    Display *dpy
+    GC gc
+    int function
+
+void
+XSetLineAttributes(dpy, gc, line_width, line_style, cap_style, join_style)
+    Display *dpy
+    GC gc
+    unsigned int line_width
+    int line_style
+    int cap_style
+    int join_style
+
+void
+XDrawPoints(dpy, drawable, gc, points, mode= CoordModeOrigin)
+    Display *dpy
+    Drawable drawable
+    GC gc
+    SV *points
+    int mode
+    INIT:
+        XPoint *p;
+        int n;
+    CODE:
+        p= (XPoint*) PerlXlib_get_struct_array(points, NULL, sizeof(XPoint), NULL, &n);
+        if (n) XDrawPoints(dpy, drawable, gc, p, n, mode);
+
+void
+XDrawLines(dpy, drawable, gc, points, mode= CoordModeOrigin)
+    Display *dpy
+    Drawable drawable
+    GC gc
+    SV *points
+    int mode
+    INIT:
+        XPoint *p;
+        int n;
+    CODE:
+        p= (XPoint*) PerlXlib_get_struct_array(points, NULL, sizeof(XPoint), NULL, &n);
+        if (n) XDrawLines(dpy, drawable, gc, p, n, mode);
+
+void
+XDrawSegments(dpy, drawable, gc, segments)
+    Display *dpy
+    Drawable drawable
+    GC gc
+    SV *segments
+    INIT:
+        XSegment *s;
+        int n;
+    CODE:
+        s= (XSegment*) PerlXlib_get_struct_array(segments, NULL, sizeof(XSegment), NULL, &n);
+        if (n) XDrawSegments(dpy, drawable, gc, s, n);
+
+void
+XDrawRectangles(dpy, drawable, gc, rects)
+    Display *dpy
+    Drawable drawable
+    GC gc
+    SV *rects
+    INIT:
+        XRectangle *r;
+        int n;
+    CODE:
+        r= (XRectangle*) PerlXlib_get_struct_array(rects, "X11::Xlib::XRectangle", sizeof(XRectangle),
+            (PerlXlib_struct_pack_fn*) PerlXlib_XRectangle_pack, &n);
+        if (n) XDrawRectangles(dpy, drawable, gc, r, n);
+
+void
+XFillRectangles(dpy, drawable, gc, rects)
+    Display *dpy
+    Drawable drawable
+    GC gc
+    SV *rects
+    INIT:
+        XRectangle *r;
+        int n;
+    CODE:
+        r= (XRectangle*) PerlXlib_get_struct_array(rects, "X11::Xlib::XRectangle", sizeof(XRectangle),
+            (PerlXlib_struct_pack_fn*) PerlXlib_XRectangle_pack, &n);
+        if (n) XFillRectangles(dpy, drawable, gc, r, n);
+
+void
+XDrawArcs(dpy, drawable, gc, arcs)
+    Display *dpy
+    Drawable drawable
+    GC gc
+    SV *arcs
+    INIT:
+        XArc *a;
+        int n;
+    CODE:
+        a= (XArc*) PerlXlib_get_struct_array(arcs, NULL, sizeof(XArc), NULL, &n);
+        if (n) XDrawArcs(dpy, drawable, gc, a, n);
+
+void
+XFillArcs(dpy, drawable, gc, arcs)
+    Display *dpy
+    Drawable drawable
+    GC gc
+    SV *arcs
+    INIT:
+        XArc *a;
+        int n;
+    CODE:
+        a= (XArc*) PerlXlib_get_struct_array(arcs, NULL, sizeof(XArc), NULL, &n);
+        if (n) XFillArcs(dpy, drawable, gc, a, n);
+
+void
+XCopyArea(dpy, src, dst, gc, src_x, src_y, width, height, dst_x, dst_y)
+    Display *dpy
+    Drawable src
+    Drawable dst
+    GC gc
+    int src_x
+    int src_y
+    unsigned int width
+    unsigned int height
+    int dst_x
+    int dst_y
+
+void
+_copy_areas(dpy, src, dst, gc, areas)
+    Display *dpy
+    Drawable src
+    Drawable dst
+    GC gc
+    SV *areas
+    INIT:
+        const short *a;
+        STRLEN len;
+        int n, i;
+    CODE:
+        a= (const short*) SvPV(areas, len);
+        if (len % (sizeof(short) * 6))
+            croak("Length of packed areas (%ld) is not a multiple of %d", (long) len, (int)(sizeof(short) * 6));
+        n= len / (sizeof(short) * 6);
+        for (i= 0; i < n; i++, a += 6)
+            XCopyArea(dpy, src, dst, gc, a[0], a[1], (unsigned short) a[2], (unsigned short) a[3], a[4], a[5]);
+
 # Window Functions (fn_win) --------------------------------------------------
 
 Window
@@ -1180,6 +1665,16 @@ XUndefineCursor(dpy, wnd)
     Display *dpy
     Window wnd
 
+Cursor
+XCreateFontCursor(dpy, shape)
+    Display *dpy
+    unsigned int shape
+
+void
+XFreeCursor(dpy, cursor)
+    Display *dpy
+    Cursor cursor
+
 void
 XReparentWindow(dpy, wnd, parent, x, y)
     Display *dpy
@@ -1240,6 +1735,21 @@ XQueryTree(dpy, wnd)
             if (children) XFree(children);
         }
 
+SV *
+_snapshot_tree(dpy, root, flags)
+    Display *dpy
+    Window root
+    int flags
+    INIT:
+        PerlXlib_tree_row *rows;
+        int n;
+    CODE:
+        n= PerlXlib_snapshot_tree(dpy, root, flags, &rows, NULL);
+        RETVAL= newSVpvn((char*) rows, n * sizeof(PerlXlib_tree_row));
+        Safefree(rows);
+    OUTPUT:
+        RETVAL
+
 void
 XRaiseWindow(dpy, wnd)
     Display *dpy
@@ -1299,6 +1809,74 @@ XTestFakeKeyEvent(dpy, kc, pressed, EventSendDelay = 10)
     int pressed
     int EventSendDelay
 
+int
+_fake_input_script(dpy, script, local_timing= 0, flush_every= 0)
+    Display * dpy
+    SV *script
+    int local_timing
+    int flush_every
+    INIT:
+        /* matches pack('S S s s L') */
+        struct { U16 type, detail; I16 x, y; U32 delay_ms; } rec;
+        const char *p;
+        STRLEN len, n, i;
+        struct timeval start, now, tv;
+        double due_ms= 0, wait_ms;
+        unsigned long delay;
+        int since_flush= 0;
+    CODE:
+        p= SvPVbyte(script, len);
+        if (len % sizeof(rec))
+            croak("Length of input script (%ld) is not a multiple of %d", (long) len, (int) sizeof(rec));
+        n= len / sizeof(rec);
+        /* Check every record first, so a bad one can't leave a key held down */
+        for (i= 0; i < n; i++) {
+            memcpy(&rec, p + i * sizeof(rec), sizeof(rec));
+            if (rec.type < KeyPress || rec.type > MotionNotify)
+                croak("Input script record %ld has unsupported event type %d", (long) i, (int) rec.type);
+        }
+        if (local_timing)
+            gettimeofday(&start, NULL);
+        for (i= 0; i < n; i++) {
+            memcpy(&rec, p + i * sizeof(rec), sizeof(rec));
+            delay= rec.delay_ms;
+            if (local_timing && delay) {
+                /* Sleep until the scheduled time, so the per-event overhead doesn't add up */
+                XFlush(dpy);
+                since_flush= 0;
+                due_ms += delay;
+                while (1) {
+                    gettimeofday(&now, NULL);
+                    wait_ms= due_ms - ((now.tv_sec - start.tv_sec) * 1000.0 + (now.tv_usec - start.tv_usec) / 1000.0);
+                    if (wait_ms <= 0) break;
+                    tv.tv_sec= (long) (wait_ms / 1000);
+                    tv.tv_usec= (long) ((wait_ms - tv.tv_sec * 1000.0) * 1000);
+                    select(0, NULL, NULL, NULL, &tv);
+                }
+                delay= 0;
+            }
+            switch (rec.type) {
+            case KeyPress:
+            case KeyRelease:
+                XTestFakeKeyEvent(dpy, rec.detail, rec.type == KeyPress, delay);
+                break;
+            case ButtonPress:
+            case ButtonRelease:
+                XTestFakeButtonEvent(dpy, rec.detail, rec.type == ButtonPress, delay);
+                break;
+            default:
+                XTestFakeMotionEvent(dpy, rec.detail == 0xFFFF? -1 : rec.detail, rec.x, rec.y, delay);
+            }
+            if (flush_every > 0 && ++since_flush >= flush_every) {
+                XFlush(dpy);
+                since_flush= 0;
+            }
+        }
+        XFlush(dpy);
+        RETVAL= n;
+    OUTPUT:
+        RETVAL
+
 # KeySym Utility Functions (fn_keysym) ---------------------------------------
 
 char *
@@ -1972,6 +2550,7 @@ XFixesQueryExtension(dpy)
         int event_base, error_base;
     PPCODE:
         if (XFixesQueryExtension(dpy, &event_base, &error_base)) {
+            PerlXlib_register_ext_event(event_base + XFixesCursorNotify, "X11::Xlib::XFixesCursorNotifyEvent");
             XPUSHs(sv_2mortal(newSViv(event_base)));
             XPUSHs(sv_2mortal(newSViv(error_base)));
         }
@@ -1990,38 +2569,114 @@ XFixesQueryVersion(dpy)
 int
 XFixesVersion()
 
+void
+XFixesSelectCursorInput(dpy, wnd, event_mask)
+    Display *dpy
+    Window wnd
+    unsigned long event_mask
+
+void
+XFixesGetCursorImage(dpy)
+    Display *dpy
+    INIT:
+        XFixesCursorImage *img;
+        HV *hv;
+        SV *pixels;
+        U32 *p;
+        int i, n;
+    PPCODE:
+        img= XFixesGetCursorImage(dpy);
+        if (img) {
+            /* Xlib stores each pixel in an unsigned long, but they are only 32 bits */
+            n= img->width * img->height;
+            pixels= newSV(n * 4 + 1);
+            p= (U32*) SvPVX(pixels);
+            for (i= 0; i < n; i++)
+                p[i]= (U32) img->pixels[i];
+            SvPVX(pixels)[n * 4]= '\0';
+            SvCUR_set(pixels, n * 4);
+            SvPOK_on(pixels);
+            hv= newHV();
+            hv_stores(hv, "x", newSViv(img->x));
+            hv_stores(hv, "y", newSViv(img->y));
+            hv_stores(hv, "width", newSVuv(img->width));
+            hv_stores(hv, "height", newSVuv(img->height));
+            hv_stores(hv, "xhot", newSVuv(img->xhot));
+            hv_stores(hv, "yhot", newSVuv(img->yhot));
+            hv_stores(hv, "cursor_serial", newSVuv(img->cursor_serial));
+            hv_stores(hv, "pixels", pixels);
+#if XFIXES_MAJOR >= 2
+            hv_stores(hv, "atom", newSVuv(img->atom));
+            hv_stores(hv, "name", newSVpv(img->name? img->name : "", 0));
+#endif
+            XFree(img);
+            PUSHs(sv_2mortal(newRV_noinc((SV*) hv)));
+        }
+
 #if XFIXES_MAJOR >= 2
 
 XserverRegion
-XFixesCreateRegion(dpy, rect_av)
+XFixesCreateRegion(dpy, rects)
     Display *dpy
-    AV *rect_av
+    SV *rects
     INIT:
-        XRectangle *rects, *rect;
-        int nrects, i;
-        SV **elem;
+        XRectangle *r;
+        int nrects;
     CODE:
-        nrects= av_len(rect_av)+1;
-        if (nrects) {
-            Newx(rects, nrects, XRectangle);
-            SAVEFREEPV(rects);
-            for (i= 0; i < nrects; i++) {
-                elem= av_fetch(rect_av, i, 0);
-                if (!elem) croak("Can't read array elem %d", i);
-                rect= (XRectangle*) PerlXlib_get_struct_ptr(
-                    *elem, 0,
-                    "X11::Xlib::XRectangle", sizeof(XRectangle),
-                    (PerlXlib_struct_pack_fn*) PerlXlib_XRectangle_pack
-                );
-                memcpy(rects+i, rect, sizeof(XRectangle));
-            }
-        } else {
-            rects= NULL;
-        }
-        RETVAL = XFixesCreateRegion(dpy, rects, nrects);
+        r= (XRectangle*) PerlXlib_get_struct_array(rects, "X11::Xlib::XRectangle", sizeof(XRectangle),
+            (PerlXlib_struct_pack_fn*) PerlXlib_XRectangle_pack, &nrects);
+        RETVAL = XFixesCreateRegion(dpy, nrects? r : NULL, nrects);
     OUTPUT:
         RETVAL
 
+void
+XFixesSetRegion(dpy, region, rects)
+    Display *dpy
+    XserverRegion region
+    SV *rects
+    INIT:
+        XRectangle *r;
+        int nrects;
+    CODE:
+        r= (XRectangle*) PerlXlib_get_struct_array(rects, "X11::Xlib::XRectangle", sizeof(XRectangle),
+            (PerlXlib_struct_pack_fn*) PerlXlib_XRectangle_pack, &nrects);
+        XFixesSetRegion(dpy, region, nrects? r : NULL, nrects);
+
+void
+XFixesCopyRegion(dpy, dst, src)
+    Display *dpy
+    XserverRegion dst
+    XserverRegion src
+
+void
+XFixesUnionRegion(dpy, dst, src1, src2)
+    Display *dpy
+    XserverRegion dst
+    XserverRegion src1
+    XserverRegion src2
+    ALIAS:
+        XFixesIntersectRegion = 1
+        XFixesSubtractRegion = 2
+    CODE:
+        switch (ix) {
+        case 0: XFixesUnionRegion(dpy, dst, src1, src2); break;
+        case 1: XFixesIntersectRegion(dpy, dst, src1, src2); break;
+        default: XFixesSubtractRegion(dpy, dst, src1, src2);
+        }
+
+void
+XFixesTranslateRegion(dpy, region, dx, dy)
+    Display *dpy
+    XserverRegion region
+    int dx
+    int dy
+
+void
+XFixesRegionExtents(dpy, dst, src)
+    Display *dpy
+    XserverRegion dst
+    XserverRegion src
+
 void
 XFixesDestroyRegion(dpy, region)
     Display *dpy
@@ -2036,7 +2691,28 @@ XFixesSetWindowShapeRegion(dpy, wnd, shape_kind, x_off, y_off, region)
     int y_off
     XserverRegion region
 
+void
+XFixesFetchRegion(dpy, region)
+    Display *dpy
+    XserverRegion region
+    INIT:
+        XRectangle *rects;
+        int nrects, i;
+    PPCODE:
+        rects= XFixesFetchRegion(dpy, region, &nrects);
+        if (rects) {
+            EXTEND(SP, nrects);
+            for (i= 0; i < nrects; i++)
+                PUSHs(sv_2mortal(sv_setref_pvn(newSV(0), "X11::Xlib::XRectangle", (char*)(rects+i), sizeof(XRectangle))));
+            XFree(rects);
+        }
+
 #endif  /* XFIXES_MAJOR >= 2 */
+#else /* (not) XFIXES_VERSION */
+
+#define XFixesDisplayCursorNotify       0
+#define XFixesDisplayCursorNotifyMask   (1L << 0)
+
 #endif  /* XFIXES_VERSION */
 
 #ifndef SHAPE_MAJOR_VERSION
@@ -2050,7 +2726,67 @@ XFixesSetWindowShapeRegion(dpy, wnd, shape_kind, x_off, y_off, region)
 #define ShapeInput                      2
 #endif
 
-# Xrender Extension () -------------------------------------------------------
+# Xdamage Extension () -------------------------------------------------------
+
+#ifdef HAVE_XDAMAGE
+
+void
+XDamageQueryExtension(dpy)
+    Display *dpy
+    INIT:
+        int event_base, error_base;
+    PPCODE:
+        if (XDamageQueryExtension(dpy, &event_base, &error_base)) {
+            PerlXlib_register_ext_event(event_base + XDamageNotify, "X11::Xlib::XDamageNotifyEvent");
+            XPUSHs(sv_2mortal(newSViv(event_base)));
+            XPUSHs(sv_2mortal(newSViv(error_base)));
+        }
+
+void
+XDamageQueryVersion(dpy)
+    Display *dpy
+    INIT:
+        int major, minor;
+    PPCODE:
+        if (XDamageQueryVersion(dpy, &major, &minor)) {
+            XPUSHs(sv_2mortal(newSViv(major)));
+            XPUSHs(sv_2mortal(newSViv(minor)));
+        }
+
+Damage
+XDamageCreate(dpy, drawable, level)
+    Display *dpy
+    Drawable drawable
+    int level
+
+void
+XDamageDestroy(dpy, damage)
+    Display *dpy
+    Damage damage
+
+void
+XDamageSubtract(dpy, damage, repair, parts)
+    Display *dpy
+    Damage damage
+    XserverRegion repair
+    XserverRegion parts
+
+void
+XDamageAdd(dpy, drawable, region)
+    Display *dpy
+    Drawable drawable
+    XserverRegion region
+
+#else /* HAVE_XDAMAGE */
+
+#define XDamageReportRawRectangles   0
+#define XDamageReportDeltaRectangles 1
+#define XDamageReportBoundingBox     2
+#define XDamageReportNonEmpty        3
+
+#endif /* HAVE_XDAMAGE */
+
+# Xrender Extension () -------------------------------------------------------
 
 #ifdef HAVE_XRENDER
 
@@ -2091,6 +2827,198 @@ XRenderFindVisualFormat(dpy, vis)
         }
         /* doesn't need freed? */
 
+void
+XRenderFindStandardFormat(dpy, format)
+    Display *dpy
+    int format
+    INIT:
+        XRenderPictFormat *fmt;
+    PPCODE:
+        fmt= XRenderFindStandardFormat(dpy, format);
+        if (fmt) {
+            PUSHs(sv_2mortal(
+                sv_setref_pvn(newSV(0), "X11::Xlib::XRenderPictFormat", (char*)fmt, sizeof(XRenderPictFormat))
+            ));
+        }
+
+Picture
+XRenderCreatePicture(dpy, drawable, format, valuemask= 0, attrs= NULL)
+    Display *dpy
+    Drawable drawable
+    XRenderPictFormat *format
+    unsigned long valuemask
+    XRenderPictureAttributes *attrs
+    CODE:
+        if (valuemask && !attrs)
+            croak("Attrs may only be NULL if valuemask is 0");
+        RETVAL = XRenderCreatePicture(dpy, drawable, format, valuemask, attrs);
+    OUTPUT:
+        RETVAL
+
+void
+XRenderChangePicture(dpy, picture, valuemask, attrs)
+    Display *dpy
+    Picture picture
+    unsigned long valuemask
+    XRenderPictureAttributes *attrs
+
+void
+XRenderFreePicture(dpy, picture)
+    Display *dpy
+    Picture picture
+
+void
+XRenderComposite(dpy, op, src, mask, dst, src_x, src_y, mask_x, mask_y, dst_x, dst_y, width, height)
+    Display *dpy
+    int op
+    Picture src
+    Picture mask
+    Picture dst
+    int src_x
+    int src_y
+    int mask_x
+    int mask_y
+    int dst_x
+    int dst_y
+    unsigned int width
+    unsigned int height
+
+void
+XRenderFillRectangle(dpy, op, dst, color, x, y, width, height)
+    Display *dpy
+    int op
+    Picture dst
+    SV *color
+    int x
+    int y
+    unsigned int width
+    unsigned int height
+    INIT:
+        XRenderColor c;
+    CODE:
+        sv_to_render_color(color, &c);
+        XRenderFillRectangle(dpy, op, dst, &c, x, y, width, height);
+
+void
+XRenderFillRectangles(dpy, op, dst, color, rects)
+    Display *dpy
+    int op
+    Picture dst
+    SV *color
+    SV *rects
+    INIT:
+        XRenderColor c;
+        XRectangle *r;
+        int n;
+    CODE:
+        sv_to_render_color(color, &c);
+        r= (XRectangle*) PerlXlib_get_struct_array(rects, "X11::Xlib::XRectangle", sizeof(XRectangle),
+            (PerlXlib_struct_pack_fn*) PerlXlib_XRectangle_pack, &n);
+        if (n)
+            XRenderFillRectangles(dpy, op, dst, &c, r, n);
+
+void
+XRenderCompositeTrapezoids(dpy, op, src, dst, mask_format, src_x, src_y, traps)
+    Display *dpy
+    int op
+    Picture src
+    Picture dst
+    SV *mask_format
+    int src_x
+    int src_y
+    SV *traps
+    ALIAS:
+        XRenderCompositeTriangles = 1
+    INIT:
+        XRenderPictFormat *fmt= NULL;
+        void *shapes;
+        int n;
+    CODE:
+        if (SvOK(mask_format))
+            fmt= (XRenderPictFormat*) PerlXlib_get_struct_ptr(mask_format, 0, "X11::Xlib::XRenderPictFormat",
+                sizeof(XRenderPictFormat), (PerlXlib_struct_pack_fn*) PerlXlib_XRenderPictFormat_pack);
+        shapes= PerlXlib_get_struct_array(traps, NULL, ix? sizeof(XTriangle) : sizeof(XTrapezoid), NULL, &n);
+        if (n) {
+            if (ix) XRenderCompositeTriangles(dpy, op, src, dst, fmt, src_x, src_y, (XTriangle*) shapes, n);
+            else XRenderCompositeTrapezoids(dpy, op, src, dst, fmt, src_x, src_y, (XTrapezoid*) shapes, n);
+        }
+
+GlyphSet
+XRenderCreateGlyphSet(dpy, format)
+    Display *dpy
+    XRenderPictFormat *format
+
+void
+XRenderFreeGlyphSet(dpy, glyphset)
+    Display *dpy
+    GlyphSet glyphset
+
+void
+XRenderAddGlyphs(dpy, glyphset, gids, glyphs, images)
+    Display *dpy
+    GlyphSet glyphset
+    SV *gids
+    SV *glyphs
+    SV *images
+    INIT:
+        Glyph *ids;
+        XGlyphInfo *info;
+        const char *data;
+        STRLEN len;
+        int n, n_info;
+    CODE:
+        ids= (Glyph*) sv_to_glyph_ids(gids, 4, sizeof(Glyph), &n);
+        info= (XGlyphInfo*) PerlXlib_get_struct_array(glyphs, NULL, sizeof(XGlyphInfo), NULL, &n_info);
+        if (n != n_info)
+            croak("Got %d glyph ids but %d glyph infos", n, n_info);
+        data= SvPV(images, len);
+        if (n)
+            XRenderAddGlyphs(dpy, glyphset, ids, info, n, data, (int) len);
+
+void
+XRenderFreeGlyphs(dpy, glyphset, gids)
+    Display *dpy
+    GlyphSet glyphset
+    SV *gids
+    INIT:
+        Glyph *ids;
+        int n;
+    CODE:
+        ids= (Glyph*) sv_to_glyph_ids(gids, 4, sizeof(Glyph), &n);
+        if (n)
+            XRenderFreeGlyphs(dpy, glyphset, ids, n);
+
+void
+XRenderCompositeString32(dpy, op, src, dst, mask_format, glyphset, src_x, src_y, dst_x, dst_y, string)
+    Display *dpy
+    int op
+    Picture src
+    Picture dst
+    SV *mask_format
+    GlyphSet glyphset
+    int src_x
+    int src_y
+    int dst_x
+    int dst_y
+    SV *string
+    ALIAS:
+        XRenderCompositeString8 = 1
+        XRenderCompositeString16 = 2
+    INIT:
+        XRenderPictFormat *fmt= NULL;
+        void *chars;
+        int n, width= ix == 1? 1 : ix == 2? 2 : 4;
+    CODE:
+        if (SvOK(mask_format))
+            fmt= (XRenderPictFormat*) PerlXlib_get_struct_ptr(mask_format, 0, "X11::Xlib::XRenderPictFormat",
+                sizeof(XRenderPictFormat), (PerlXlib_struct_pack_fn*) PerlXlib_XRenderPictFormat_pack);
+        chars= sv_to_glyph_ids(string, width, width, &n);
+        if (n) switch (ix) {
+            case 1: XRenderCompositeString8(dpy, op, src, dst, fmt, glyphset, src_x, src_y, dst_x, dst_y, (char*) chars, n); break;
+            case 2: XRenderCompositeString16(dpy, op, src, dst, fmt, glyphset, src_x, src_y, dst_x, dst_y, (unsigned short*) chars, n); break;
+            default: XRenderCompositeString32(dpy, op, src, dst, fmt, glyphset, src_x, src_y, dst_x, dst_y, (unsigned int*) chars, n);
+        }
+
 #else /* (not) HAVE_XRENDER */
 
 #define PictFormatID        (1 << 0)
@@ -2106,8 +3034,194 @@ XRenderFindVisualFormat(dpy, vis)
 #define PictFormatAlphaMask (1 << 10)
 #define PictFormatColormap  (1 << 11)
 
+#define PictStandardARGB32  0
+#define PictStandardRGB24   1
+#define PictStandardA8      2
+#define PictStandardA4      3
+#define PictStandardA1      4
+
+#define PictOpClear         0
+#define PictOpSrc           1
+#define PictOpDst           2
+#define PictOpOver          3
+#define PictOpOverReverse   4
+#define PictOpIn            5
+#define PictOpInReverse     6
+#define PictOpOut           7
+#define PictOpOutReverse    8
+#define PictOpAtop          9
+#define PictOpAtopReverse   10
+#define PictOpXor           11
+#define PictOpAdd           12
+#define PictOpSaturate      13
+
+#define PolyEdgeSharp       0
+#define PolyEdgeSmooth      1
+#define PolyModePrecise     0
+#define PolyModeImprecise   1
+
+#define RepeatNone          0
+#define RepeatNormal        1
+#define RepeatPad           2
+#define RepeatReflect       3
+
+#define CPRepeat            (1 << 0)
+#define CPAlphaMap          (1 << 1)
+#define CPAlphaXOrigin      (1 << 2)
+#define CPAlphaYOrigin      (1 << 3)
+#define CPClipXOrigin       (1 << 4)
+#define CPClipYOrigin       (1 << 5)
+#define CPClipMask          (1 << 6)
+#define CPGraphicsExposure  (1 << 7)
+#define CPSubwindowMode     (1 << 8)
+#define CPPolyEdge          (1 << 9)
+#define CPPolyMode          (1 << 10)
+#define CPDither            (1 << 11)
+#define CPComponentAlpha    (1 << 12)
+
 #endif /* HAVE_XRENDER */
 
+# XShm Extension () ----------------------------------------------------------
+
+#ifdef HAVE_XSHM
+
+Bool
+XShmQueryExtension(dpy)
+    Display *dpy
+
+void
+XShmQueryVersion(dpy)
+    Display *dpy
+    INIT:
+        int major, minor;
+        Bool pixmaps;
+    PPCODE:
+        if (XShmQueryVersion(dpy, &major, &minor, &pixmaps)) {
+            XPUSHs(sv_2mortal(newSViv(major)));
+            XPUSHs(sv_2mortal(newSViv(minor)));
+            XPUSHs(sv_2mortal(newSViv(pixmaps)));
+        }
+
+int
+XShmPixmapFormat(dpy)
+    Display *dpy
+
+int
+XShmGetEventBase(dpy)
+    Display *dpy
+
+Bool
+XShmAttach(dpy, shminfo)
+    Display *dpy
+    SV *shminfo
+    INIT:
+        PerlXlib_shm *shm= (PerlXlib_shm*) PerlXlib_objref_get_pointer(shminfo, "XShmSegmentInfo", PerlXlib_OR_DIE);
+    CODE:
+        RETVAL= PerlXlib_shm_attach(dpy, shm);
+        if (RETVAL) {
+            PerlXlib_objref_set_display(shminfo, ST(0));
+            /* Once the server has attached, the id can be removed so the segment can't leak */
+            PerlXlib_shm_remove_id(shm);
+        }
+    OUTPUT:
+        RETVAL
+
+Bool
+XShmDetach(dpy, shminfo)
+    Display *dpy
+    SV *shminfo
+    INIT:
+        PerlXlib_shm *shm= (PerlXlib_shm*) PerlXlib_objref_get_pointer(shminfo, "XShmSegmentInfo", PerlXlib_OR_DIE);
+    CODE:
+        RETVAL= XShmDetach(dpy, &shm->info);
+        PerlXlib_objref_set_display(shminfo, NULL);
+    OUTPUT:
+        RETVAL
+
+void
+XShmCreateImage(dpy, visual, depth, format, shminfo, width, height)
+    Display *dpy
+    VisualOrNull visual
+    unsigned int depth
+    int format
+    SV *shminfo
+    unsigned int width
+    unsigned int height
+    INIT:
+        PerlXlib_shm *shm= (PerlXlib_shm*) PerlXlib_objref_get_pointer(shminfo, "XShmSegmentInfo", PerlXlib_OR_DIE);
+        SV **data, *objref;
+        XImage *img;
+    PPCODE:
+        data= hv_fetch((HV*) SvRV(shminfo), "data", 4, 0);
+        if (!data || !*data)
+            croak("XShmSegmentInfo has no data");
+        img= XShmCreateImage(dpy, visual, depth, format, NULL, &shm->info, width, height);
+        if (!img)
+            croak("XShmCreateImage failed");
+        if (PerlXlib_ximage_data_size(img) > shm->size) {
+            unsigned long need= PerlXlib_ximage_data_size(img);
+            img->obdata= NULL;
+            XDestroyImage(img);
+            croak("Image needs %lu bytes, but segment is only %lu", need, (unsigned long) shm->size);
+        }
+        objref= PerlXlib_ximage_wrap(img, *data, ST(0));
+        /* the image holds a reference to the segment, so it stays mapped */
+        hv_store((HV*) SvRV(objref), "shminfo", 7, newSVsv(shminfo), 0);
+        PerlXlib_ximage_shm_sync(objref);
+        PUSHs(objref);
+
+Bool
+XShmGetImage(dpy, drw, image, x, y, plane_mask)
+    Display *dpy
+    Drawable drw
+    SV *image
+    int x
+    int y
+    unsigned long plane_mask
+    INIT:
+        XImage *img= PerlXlib_ximage_shm_sync(image);
+    CODE:
+        RETVAL= XShmGetImage(dpy, drw, img, x, y, plane_mask);
+    OUTPUT:
+        RETVAL
+
+Bool
+XShmPutImage(dpy, drw, gc, image, src_x, src_y, dst_x, dst_y, width, height, send_event= 0)
+    Display *dpy
+    Drawable drw
+    GC gc
+    SV *image
+    int src_x
+    int src_y
+    int dst_x
+    int dst_y
+    unsigned int width
+    unsigned int height
+    Bool send_event
+    INIT:
+        XImage *img= PerlXlib_ximage_shm_sync(image);
+    CODE:
+        RETVAL= XShmPutImage(dpy, drw, gc, img, src_x, src_y, dst_x, dst_y, width, height, send_event);
+    OUTPUT:
+        RETVAL
+
+Pixmap
+XShmCreatePixmap(dpy, drw, shminfo, width, height, depth)
+    Display *dpy
+    Drawable drw
+    SV *shminfo
+    unsigned int width
+    unsigned int height
+    unsigned int depth
+    INIT:
+        PerlXlib_shm *shm= (PerlXlib_shm*) PerlXlib_objref_get_pointer(shminfo, "XShmSegmentInfo", PerlXlib_OR_DIE);
+    CODE:
+        RETVAL= PerlXlib_shm_create_pixmap(dpy, drw, shm, width, height, depth);
+    OUTPUT:
+        RETVAL
+
+#endif /* HAVE_XSHM */
+
 MODULE = X11::Xlib                PACKAGE = X11::Xlib::Opaque
 
 void
@@ -2147,1149 +3261,5471 @@ id(visual)
     OUTPUT:
         RETVAL
 
-MODULE = X11::Xlib                PACKAGE = X11::Xlib::XEvent
+MODULE = X11::Xlib                PACKAGE = X11::Xlib::WindowTree
 
-# ----------------------------------------------------------------------------
-# BEGIN GENERATED X11_Xlib_XEvent
 void
-_initialize(s)
-    SV *s
+_init(self, dpy, root, select_input)
+    SV *self
+    Display *dpy
+    Window root
+    Bool select_input
     INIT:
-        void *sptr;
+        PerlXlib_wtree *t= (PerlXlib_wtree*) PerlXlib_objref_get_pointer(self, "WindowTree", PerlXlib_OR_NULL);
     PPCODE:
-        sptr= PerlXlib_get_struct_ptr(s, 1, "X11::Xlib::XEvent", sizeof(XEvent),
-            (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack
-        );
-        memset((void*) sptr, 0, sizeof(XEvent));
+        if (t) {
+            PerlXlib_objref_set_pointer(self, NULL, NULL);
+            PerlXlib_wtree_free(t);
+        }
+        t= PerlXlib_wtree_new(dpy, root, select_input);
+        if (t->root < 0) {
+            PerlXlib_wtree_free(t);
+            croak("Root window %ld does not exist", (long) root);
+        }
+        PerlXlib_objref_set_pointer(self, t, "WindowTree");
+
+void
+_free(self)
+    SV *self
+    INIT:
+        PerlXlib_wtree *t= (PerlXlib_wtree*) PerlXlib_objref_get_pointer(self, "WindowTree", PerlXlib_OR_NULL);
+    PPCODE:
+        if (t) {
+            PerlXlib_objref_set_pointer(self, NULL, NULL);
+            PerlXlib_wtree_free(t);
+        }
+
+Bool
+apply_event(self, event)
+    SV *self
+    XEvent *event
+    INIT:
+        PerlXlib_wtree *t= (PerlXlib_wtree*) PerlXlib_objref_get_pointer(self, "WindowTree", PerlXlib_OR_DIE);
+    CODE:
+        RETVAL= PerlXlib_wtree_apply_event(t, event);
+    OUTPUT:
+        RETVAL
 
 int
-_sizeof(ignored)
-    SV *ignored
+window_count(self)
+    SV *self
+    INIT:
+        PerlXlib_wtree *t= (PerlXlib_wtree*) PerlXlib_objref_get_pointer(self, "WindowTree", PerlXlib_OR_DIE);
     CODE:
-        RETVAL = sizeof(XEvent);
+        RETVAL= t->count;
     OUTPUT:
         RETVAL
 
 void
-_pack(e, fields, consume)
-    XEvent *e
-    HV *fields
-    Bool consume
+contains(self, wnd)
+    SV *self
+    Window wnd
+    ALIAS:
+        parent = 1
+        map_state = 2
+        override_redirect = 3
     INIT:
-        const char *oldpkg, *newpkg;
+        PerlXlib_wtree *t= (PerlXlib_wtree*) PerlXlib_objref_get_pointer(self, "WindowTree", PerlXlib_OR_DIE);
+        int idx= PerlXlib_wtree_find(t, wnd);
     PPCODE:
-        oldpkg= PerlXlib_xevent_pkg_for_type(e->type);
-        PerlXlib_XEvent_pack(e, fields, consume);
-        newpkg= PerlXlib_xevent_pkg_for_type(e->type);
-        /* re-bless the object if the thing passed to us was actually an object */
-        if (oldpkg != newpkg && sv_derived_from(ST(0), "X11::Xlib::XEvent"))
-            sv_bless(ST(0), gv_stashpv(newpkg, GV_ADD));
+        if (ix == 0)
+            PUSHs(idx >= 0? &PL_sv_yes : &PL_sv_no);
+        else if (idx < 0 || (ix == 1 && idx == t->root))
+            PUSHs(&PL_sv_undef);
+        else if (ix == 1)
+            PUSHs(sv_2mortal(newSVuv(t->nodes[t->nodes[idx].parent].xid)));
+        else if (ix == 2)
+            PUSHs(sv_2mortal(newSViv(PerlXlib_wtree_map_state(t, idx))));
+        else
+            PUSHs(t->nodes[idx].override_redirect? &PL_sv_yes : &PL_sv_no);
 
 void
-_unpack(e, fields)
-    XEvent *e
-    HV *fields
+children(self, wnd)
+    SV *self
+    Window wnd
+    INIT:
+        PerlXlib_wtree *t= (PerlXlib_wtree*) PerlXlib_objref_get_pointer(self, "WindowTree", PerlXlib_OR_DIE);
+        int idx= PerlXlib_wtree_find(t, wnd);
     PPCODE:
-        PerlXlib_XEvent_unpack(e, fields);
-
-void
-_above(event, value=NULL)
-  XEvent *event
-  SV *value
-  INIT:
-    Window c_value= 0;
-  PPCODE:
-    if (value) { c_value= PerlXlib_sv_to_xid(value); }
-    switch (event->type) {
-    case ConfigureNotify:
-      if (value) { event->xconfigure.above = c_value; } else { c_value= event->xconfigure.above; } break;
-    case ConfigureRequest:
-      if (value) { event->xconfigurerequest.above = c_value; } else { c_value= event->xconfigurerequest.above; } break;
-    default: croak("Can't access XEvent.above for type=%d", event->type);
-    }
-    PUSHs(value? value : sv_2mortal(newSVuv(c_value)));
+        if (idx >= 0) {
+            for (idx= t->nodes[idx].first_child; idx >= 0; idx= t->nodes[idx].above)
+                XPUSHs(sv_2mortal(newSVuv(t->nodes[idx].xid)));
+        }
+
+void
+geometry(self, wnd)
+    SV *self
+    Window wnd
+    INIT:
+        PerlXlib_wtree *t= (PerlXlib_wtree*) PerlXlib_objref_get_pointer(self, "WindowTree", PerlXlib_OR_DIE);
+        int idx= PerlXlib_wtree_find(t, wnd);
+        PerlXlib_wtree_node *node;
+    PPCODE:
+        if (idx >= 0) {
+            node= t->nodes + idx;
+            EXTEND(SP, 5);
+            PUSHs(sv_2mortal(newSViv(node->x)));
+            PUSHs(sv_2mortal(newSViv(node->y)));
+            PUSHs(sv_2mortal(newSViv(node->width)));
+            PUSHs(sv_2mortal(newSViv(node->height)));
+            PUSHs(sv_2mortal(newSViv(node->border_width)));
+        }
+
+void
+window_at(self, x, y)
+    SV *self
+    int x
+    int y
+    INIT:
+        PerlXlib_wtree *t= (PerlXlib_wtree*) PerlXlib_objref_get_pointer(self, "WindowTree", PerlXlib_OR_DIE);
+        int idx= PerlXlib_wtree_window_at(t, x, y);
+    PPCODE:
+        PUSHs(idx < 0? &PL_sv_undef : sv_2mortal(newSVuv(t->nodes[idx].xid)));
+
+void
+windows_in_rect(self, x, y, w, h)
+    SV *self
+    int x
+    int y
+    int w
+    int h
+    INIT:
+        PerlXlib_wtree *t= (PerlXlib_wtree*) PerlXlib_objref_get_pointer(self, "WindowTree", PerlXlib_OR_DIE);
+        int *found, n, i;
+    PPCODE:
+        n= PerlXlib_wtree_windows_in_rect(t, x, y, w, h, &found);
+        EXTEND(SP, n);
+        for (i= 0; i < n; i++)
+            PUSHs(sv_2mortal(newSVuv(t->nodes[found[i]].xid)));
+        if (found) Safefree(found);
+
+MODULE = X11::Xlib                PACKAGE = X11::Xlib::XImage
+
+void
+width(self)
+    SV *self
+    ALIAS:
+        height = 1
+        xoffset = 2
+        format = 3
+        byte_order = 4
+        bitmap_unit = 5
+        bitmap_bit_order = 6
+        bitmap_pad = 7
+        depth = 8
+        bytes_per_line = 9
+        bits_per_pixel = 10
+        red_mask = 11
+        green_mask = 12
+        blue_mask = 13
+    INIT:
+        XImage *img= (XImage*) PerlXlib_objref_get_pointer(self, "XImage", PerlXlib_OR_DIE);
+        UV val;
+    PPCODE:
+        switch (ix) {
+        case 0: val= img->width; break;
+        case 1: val= img->height; break;
+        case 2: val= img->xoffset; break;
+        case 3: val= img->format; break;
+        case 4: val= img->byte_order; break;
+        case 5: val= img->bitmap_unit; break;
+        case 6: val= img->bitmap_bit_order; break;
+        case 7: val= img->bitmap_pad; break;
+        case 8: val= img->depth; break;
+        case 9: val= img->bytes_per_line; break;
+        case 10: val= img->bits_per_pixel; break;
+        case 11: val= img->red_mask; break;
+        case 12: val= img->green_mask; break;
+        case 13: val= img->blue_mask; break;
+        default: croak("BUG: unhandled alias %d", (int) ix);
+        }
+        PUSHs(sv_2mortal(newSVuv(val)));
+
+void
+data(self)
+    SV *self
+    PPCODE:
+        PerlXlib_ximage_sync(self, False);
+        PUSHs(*hv_fetch((HV*) SvRV(self), "data", 4, 0));
+
+MODULE = X11::Xlib                PACKAGE = X11::Xlib::XShmSegmentInfo
+
+#ifdef HAVE_XSHM
+
+void
+_init(self, size, read_only)
+    SV *self
+    UV size
+    Bool read_only
+    INIT:
+        PerlXlib_shm *shm;
+    PPCODE:
+        if (PerlXlib_objref_get_pointer(self, "XShmSegmentInfo", PerlXlib_OR_NULL))
+            croak("Segment is already initialized");
+        shm= PerlXlib_shm_new(size, read_only);
+        PerlXlib_objref_set_pointer(self, shm, "XShmSegmentInfo");
+        hv_store((HV*) SvRV(self), "data", 4, PerlXlib_shm_new_sv(shm), 0);
+
+void
+_free(self)
+    SV *self
+    INIT:
+        PerlXlib_shm *shm= (PerlXlib_shm*) PerlXlib_objref_get_pointer(self, "XShmSegmentInfo", PerlXlib_OR_NULL);
+        SV **data, *dpy_sv;
+        Display *dpy;
+    PPCODE:
+        if (shm) {
+            /* Tell the server to detach, unless the connection was closed */
+            dpy_sv= PerlXlib_objref_get_display(self);
+            dpy= dpy_sv && SvOK(dpy_sv)? PerlXlib_display_objref_get_pointer(dpy_sv, PerlXlib_OR_NULL) : NULL;
+            if (dpy)
+                XShmDetach(dpy, &shm->info);
+            PerlXlib_objref_set_pointer(self, NULL, NULL);
+            data= hv_fetch((HV*) SvRV(self), "data", 4, 0);
+            PerlXlib_shm_free(shm, data? *data : NULL);
+        }
+
+void
+shmseg(self)
+    SV *self
+    ALIAS:
+        shmid = 1
+        size = 2
+        read_only = 3
+    INIT:
+        PerlXlib_shm *shm= (PerlXlib_shm*) PerlXlib_objref_get_pointer(self, "XShmSegmentInfo", PerlXlib_OR_DIE);
+        UV val;
+    PPCODE:
+        switch (ix) {
+        case 0: val= shm->info.shmseg; break;
+        case 1: val= shm->info.shmid; break;
+        case 2: val= shm->size; break;
+        case 3: val= shm->info.readOnly; break;
+        default: croak("BUG: unhandled alias %d", (int) ix);
+        }
+        PUSHs(sv_2mortal(newSVuv(val)));
+
+#endif /* HAVE_XSHM */
+
+MODULE = X11::Xlib                PACKAGE = X11::Xlib::XDamageNotifyEvent
+
+#ifdef HAVE_XDAMAGE
+
+void
+drawable(self)
+    SV *self
+    ALIAS:
+        damage = 1
+        level = 2
+        more = 3
+        timestamp = 4
+        area = 5
+        geometry = 6
+    INIT:
+        XDamageNotifyEvent *event= (XDamageNotifyEvent*) PerlXlib_get_struct_ptr(self, 0,
+            "X11::Xlib::XDamageNotifyEvent", sizeof(XEvent), (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+        SV *ret;
+    PPCODE:
+        switch (ix) {
+        case 0: ret= newSVuv(event->drawable); break;
+        case 1: ret= newSVuv(event->damage); break;
+        case 2: ret= newSViv(event->level); break;
+        case 3: ret= newSViv(event->more); break;
+        case 4: ret= newSVuv(event->timestamp); break;
+        case 5: ret= sv_setref_pvn(newSV(0), "X11::Xlib::XRectangle", (char*) &event->area, sizeof(XRectangle)); break;
+        case 6: ret= sv_setref_pvn(newSV(0), "X11::Xlib::XRectangle", (char*) &event->geometry, sizeof(XRectangle)); break;
+        default: croak("BUG: unhandled alias %d", (int) ix);
+        }
+        PUSHs(sv_2mortal(ret));
+
+#endif /* HAVE_XDAMAGE */
+
+MODULE = X11::Xlib                PACKAGE = X11::Xlib::XFixesCursorNotifyEvent
+
+#ifdef XFIXES_VERSION
+
+void
+window(self)
+    SV *self
+    ALIAS:
+        subtype = 1
+        cursor_serial = 2
+        timestamp = 3
+        cursor_name = 4
+    INIT:
+        XFixesCursorNotifyEvent *event= (XFixesCursorNotifyEvent*) PerlXlib_get_struct_ptr(self, 0,
+            "X11::Xlib::XFixesCursorNotifyEvent", sizeof(XEvent), (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+        SV *ret;
+    PPCODE:
+        switch (ix) {
+        case 0: ret= newSVuv(event->window); break;
+        case 1: ret= newSViv(event->subtype); break;
+        case 2: ret= newSVuv(event->cursor_serial); break;
+        case 3: ret= newSVuv(event->timestamp); break;
+        case 4: ret= newSVuv(event->cursor_name); break;
+        default: croak("BUG: unhandled alias %d", (int) ix);
+        }
+        PUSHs(sv_2mortal(ret));
+
+#endif /* XFIXES_VERSION */
+
+MODULE = X11::Xlib                PACKAGE = X11::Xlib::Pixels
+
+int
+max_simd_level()
+    CODE:
+        RETVAL= PerlXlib_pixels_max_simd_level();
+    OUTPUT:
+        RETVAL
+
+int
+simd_level(level= NULL)
+    SV *level
+    CODE:
+        RETVAL= level? PerlXlib_pixels_set_simd_level(SvOK(level)? SvIV(level) : -1)
+            : PerlXlib_pixels_simd_level();
+    OUTPUT:
+        RETVAL
+
+int
+max_threads()
+    CODE:
+        RETVAL= PerlXlib_workers_max_threads();
+    OUTPUT:
+        RETVAL
+
+int
+threads(n= NULL)
+    SV *n
+    CODE:
+        RETVAL= n? PerlXlib_workers_set_threads(SvOK(n)? SvIV(n) : 1)
+            : PerlXlib_workers_threads();
+    OUTPUT:
+        RETVAL
+
+void
+_to_rgb(src, stride, width, height, bits_per_pixel, byte_order, red_mask, green_mask, blue_mask, alpha, channels, dst)
+    SV *src
+    UV stride
+    int width
+    int height
+    int bits_per_pixel
+    int byte_order
+    unsigned long red_mask
+    unsigned long green_mask
+    unsigned long blue_mask
+    int alpha
+    int channels
+    SV *dst
+    INIT:
+        STRLEN src_len, need;
+        const char *src_p;
+        char *dst_p;
+    PPCODE:
+        if (width < 0 || height < 0) croak("Invalid dimensions %dx%d", width, height);
+        if (channels != 3 && channels != 4) croak("channels must be 3 or 4");
+        if (src == dst) croak("Destination must be a different scalar than the source");
+        src_p= SvPV(src, src_len);
+        need= height? stride * (height-1) + (STRLEN)width * ((bits_per_pixel+7) / 8) : 0;
+        if (src_len < need)
+            croak("Source is %ld bytes, but %dx%d pixels need %ld", (long) src_len, width, height, (long) need);
+        need= (STRLEN)width * height * channels;
+        if (!SvOK(dst)) sv_setpvn(dst, "", 0);
+        SvPV_force_nolen(dst);
+        dst_p= SvGROW(dst, need+1);
+        if (!PerlXlib_pixels_to_rgb((const U8*) src_p, stride, width, height, bits_per_pixel,
+            byte_order, red_mask, green_mask, blue_mask, alpha, (U8*) dst_p, (STRLEN)width * channels, channels))
+            croak("Unsupported bits_per_pixel %d", bits_per_pixel);
+        SvCUR_set(dst, need);
+        dst_p[need]= '\0';
+        SvPOK_only(dst);
+        SvSETMAGIC(dst);
+
+void
+premultiply(buf, width, height, stride= 0)
+    SV *buf
+    int width
+    int height
+    UV stride
+    ALIAS:
+        unpremultiply = 1
+    INIT:
+        STRLEN len, need;
+        char *p;
+    PPCODE:
+        if (width < 0 || height < 0) croak("Invalid dimensions %dx%d", width, height);
+        if (!stride) stride= (UV)width * 4;
+        p= SvPV_force(buf, len);
+        need= height? stride * (height-1) + (STRLEN)width * 4 : 0;
+        if (len < need)
+            croak("Buffer is %ld bytes, but %dx%d pixels need %ld", (long) len, width, height, (long) need);
+        PerlXlib_pixels_premultiply((U8*) p, stride, width, height, ix == 1);
+        SvSETMAGIC(buf);
+
+void
+downsample_2x(src, width, height, stride, dst)
+    SV *src
+    int width
+    int height
+    UV stride
+    SV *dst
+    INIT:
+        STRLEN src_len, need;
+        const char *src_p;
+        char *dst_p;
+    PPCODE:
+        if (width < 0 || height < 0) croak("Invalid dimensions %dx%d", width, height);
+        if (src == dst) croak("Destination must be a different scalar than the source");
+        if (!stride) stride= (UV)width * 4;
+        src_p= SvPV(src, src_len);
+        need= height? stride * (height-1) + (STRLEN)width * 4 : 0;
+        if (src_len < need)
+            croak("Source is %ld bytes, but %dx%d pixels need %ld", (long) src_len, width, height, (long) need);
+        need= (STRLEN)(width/2) * (height/2) * 4;
+        if (!SvOK(dst)) sv_setpvn(dst, "", 0);
+        SvPV_force_nolen(dst);
+        dst_p= SvGROW(dst, need+1);
+        PerlXlib_pixels_downsample_2x((const U8*) src_p, stride, width, height, (U8*) dst_p, (width/2) * 4);
+        SvCUR_set(dst, need);
+        dst_p[need]= '\0';
+        SvPOK_only(dst);
+        SvSETMAGIC(dst);
+
+void
+blend_over(dst, dst_width, dst_height, dst_stride, src, src_width, src_height, x, y)
+    SV *dst
+    int dst_width
+    int dst_height
+    UV dst_stride
+    SV *src
+    int src_width
+    int src_height
+    int x
+    int y
+    INIT:
+        STRLEN src_len, dst_len, need;
+        const char *src_p;
+        char *dst_p;
+    PPCODE:
+        if (dst_width < 0 || dst_height < 0) croak("Invalid dimensions %dx%d", dst_width, dst_height);
+        if (src_width < 0 || src_height < 0) croak("Invalid dimensions %dx%d", src_width, src_height);
+        if (!dst_stride) dst_stride= (UV)dst_width * 4;
+        src_p= SvPV(src, src_len);
+        need= (STRLEN)src_width * src_height * 4;
+        if (src_len < need)
+            croak("Source is %ld bytes, but %dx%d pixels need %ld", (long) src_len, src_width, src_height, (long) need);
+        dst_p= SvPV_force(dst, dst_len);
+        need= dst_height? dst_stride * (dst_height-1) + (STRLEN)dst_width * 4 : 0;
+        if (dst_len < need)
+            croak("Buffer is %ld bytes, but %dx%d pixels need %ld", (long) dst_len, dst_width, dst_height, (long) need);
+        if (src == dst) croak("Destination must be a different scalar than the source");
+        PerlXlib_pixels_blend_over((U8*) dst_p, dst_stride, dst_width, dst_height,
+            (const U8*) src_p, (size_t)src_width * 4, src_width, src_height, x, y);
+        SvSETMAGIC(dst);
+
+MODULE = X11::Xlib                PACKAGE = X11::Xlib::Region
+
+SV*
+new(cls, rects= NULL)
+    SV *cls
+    SV *rects
+    INIT:
+        SV *boxes;
+    CODE:
+        RETVAL= new_region_obj(cls, &boxes);
+        if (rects && SvOK(rects))
+            rects_to_region(rects, boxes);
+    OUTPUT:
+        RETVAL
+
+SV*
+_from_mask(cls, mask, width, height, depth, stride, msb_first, threshold)
+    SV *cls
+    SV *mask
+    int width
+    int height
+    int depth
+    UV stride
+    Bool msb_first
+    int threshold
+    INIT:
+        STRLEN len, need;
+        const char *p;
+        SV *boxes;
+    CODE:
+        if (width < 0 || height < 0) croak("Invalid dimensions %dx%d", width, height);
+        if (depth != 1 && depth != 8) croak("Mask depth must be 1 or 8");
+        need= depth == 1? ((STRLEN)width + 7) / 8 : (STRLEN)width;
+        if (stride < need) croak("bytes_per_line %ld is less than the %ld bytes of a row", (long) stride, (long) need);
+        p= SvPV(mask, len);
+        need= height? stride * (height-1) + need : 0;
+        if (len < need)
+            croak("Mask is %ld bytes, but %dx%d pixels need %ld", (long) len, width, height, (long) need);
+        RETVAL= new_region_obj(cls, &boxes);
+        PerlXlib_region_from_mask((const U8*) p, width, height, stride, depth, msb_first, threshold, boxes);
+    OUTPUT:
+        RETVAL
+
+SV*
+union(self, other)
+    SV *self
+    SV *other
+    ALIAS:
+        intersect = 1
+        subtract = 2
+    INIT:
+        PerlXlib_box *a, *b;
+        int na, nb;
+        SV *boxes;
+    CODE:
+        a= sv_to_region_boxes(self, &na);
+        b= sv_to_region_boxes(other, &nb);
+        RETVAL= new_region_obj(self, &boxes);
+        PerlXlib_region_op(a, na, b, nb, ix == 1? PerlXlib_REGION_INTERSECT
+            : ix == 2? PerlXlib_REGION_SUBTRACT : PerlXlib_REGION_UNION, boxes);
+    OUTPUT:
+        RETVAL
+
+SV*
+translate(self, dx, dy)
+    SV *self
+    int dx
+    int dy
+    INIT:
+        PerlXlib_box *src, *dst;
+        int n, i;
+        SV *boxes;
+    CODE:
+        src= sv_to_region_boxes(self, &n);
+        RETVAL= new_region_obj(self, &boxes);
+        dst= (PerlXlib_box*) SvGROW(boxes, n * sizeof(PerlXlib_box) + 1);
+        for (i= 0; i < n; i++) {
+            dst[i].x1= src[i].x1 + dx;
+            dst[i].y1= src[i].y1 + dy;
+            dst[i].x2= src[i].x2 + dx;
+            dst[i].y2= src[i].y2 + dy;
+        }
+        SvCUR_set(boxes, n * sizeof(PerlXlib_box));
+    OUTPUT:
+        RETVAL
+
+void
+extents(self)
+    SV *self
+    INIT:
+        PerlXlib_box *r, ext;
+        int n;
+    PPCODE:
+        r= sv_to_region_boxes(self, &n);
+        PerlXlib_region_extents(r, n, &ext);
+        EXTEND(SP, 4);
+        PUSHs(sv_2mortal(newSViv(ext.x1)));
+        PUSHs(sv_2mortal(newSViv(ext.y1)));
+        PUSHs(sv_2mortal(newSViv(ext.x2 - ext.x1)));
+        PUSHs(sv_2mortal(newSViv(ext.y2 - ext.y1)));
+
+int
+count(self)
+    SV *self
+    CODE:
+        sv_to_region_boxes(self, &RETVAL);
+    OUTPUT:
+        RETVAL
+
+Bool
+is_empty(self)
+    SV *self
+    INIT:
+        int n;
+    CODE:
+        sv_to_region_boxes(self, &n);
+        RETVAL= !n;
+    OUTPUT:
+        RETVAL
+
+Bool
+equals(self, other)
+    SV *self
+    SV *other
+    INIT:
+        PerlXlib_box *a, *b;
+        int na, nb;
+    CODE:
+        a= sv_to_region_boxes(self, &na);
+        b= sv_to_region_boxes(other, &nb);
+        RETVAL= na == nb && memcmp(a, b, na * sizeof(PerlXlib_box)) == 0;
+    OUTPUT:
+        RETVAL
+
+Bool
+contains(self, x, y, width= 1, height= 1)
+    SV *self
+    int x
+    int y
+    int width
+    int height
+    ALIAS:
+        overlaps = 1
+    INIT:
+        PerlXlib_box *r, rect;
+        int n;
+        SV *tmp;
+    CODE:
+        r= sv_to_region_boxes(self, &n);
+        if (width <= 0 || height <= 0)
+            RETVAL= 0;
+        else if (width == 1 && height == 1)
+            RETVAL= PerlXlib_region_contains_point(r, n, x, y);
+        else {
+            rect.x1= x; rect.y1= y; rect.x2= x + width; rect.y2= y + height;
+            tmp= sv_2mortal(newSVpvn("", 0));
+            /* contains: nothing of the rect is left after removing the region */
+            if (ix == 0) {
+                PerlXlib_region_op(&rect, 1, r, n, PerlXlib_REGION_SUBTRACT, tmp);
+                RETVAL= SvCUR(tmp) == 0;
+            }
+            else {
+                PerlXlib_region_op(&rect, 1, r, n, PerlXlib_REGION_INTERSECT, tmp);
+                RETVAL= SvCUR(tmp) != 0;
+            }
+        }
+    OUTPUT:
+        RETVAL
+
+void
+packed_rects(self)
+    SV *self
+    ALIAS:
+        rects = 1
+    INIT:
+        PerlXlib_box *r;
+        XRectangle *out;
+        SV *packed;
+        int n, i;
+        IV v;
+    PPCODE:
+        r= sv_to_region_boxes(self, &n);
+        packed= sv_2mortal(newSV(n * sizeof(XRectangle) + 1));
+        out= (XRectangle*) SvPVX(packed);
+        /* XRectangle only holds 16 bits; clip to that range */
+        for (i= 0; i < n; i++) {
+            out[i].x= CLIP16(r[i].x1, -32768, 32767);
+            out[i].y= CLIP16(r[i].y1, -32768, 32767);
+            v= (IV) r[i].x2 - out[i].x; out[i].width= CLIP16(v, 0, 65535);
+            v= (IV) r[i].y2 - out[i].y; out[i].height= CLIP16(v, 0, 65535);
+        }
+        if (ix == 0) {
+            SvCUR_set(packed, n * sizeof(XRectangle));
+            SvPOK_on(packed);
+            PUSHs(packed);
+        }
+        else {
+            EXTEND(SP, n);
+            for (i= 0; i < n; i++)
+                PUSHs(sv_2mortal(sv_setref_pvn(newSV(0), "X11::Xlib::XRectangle", (char*)(out+i), sizeof(XRectangle))));
+        }
+
+SV*
+boxes(self)
+    SV *self
+    INIT:
+        PerlXlib_box *r;
+        int n;
+    CODE:
+        r= sv_to_region_boxes(self, &n);
+        RETVAL= newSVpvn((char*) r, n * sizeof(PerlXlib_box));
+    OUTPUT:
+        RETVAL
+
+#if defined(XFIXES_VERSION) && XFIXES_MAJOR >= 2
+
+SV*
+from_server(cls, dpy, region)
+    SV *cls
+    Display *dpy
+    XserverRegion region
+    INIT:
+        XRectangle *rects;
+        PerlXlib_box *boxes;
+        SV *dst;
+        int nrects, i;
+    CODE:
+        RETVAL= new_region_obj(cls, &dst);
+        rects= XFixesFetchRegion(dpy, region, &nrects);
+        if (rects) {
+            Newx(boxes, nrects + 1, PerlXlib_box);
+            SAVEFREEPV(boxes);
+            for (i= 0; i < nrects; i++) {
+                boxes[i].x1= rects[i].x;
+                boxes[i].y1= rects[i].y;
+                boxes[i].x2= rects[i].x + rects[i].width;
+                boxes[i].y2= rects[i].y + rects[i].height;
+            }
+            XFree(rects);
+            PerlXlib_region_from_boxes(boxes, nrects, dst);
+        }
+    OUTPUT:
+        RETVAL
+
+#endif
+
+MODULE = X11::Xlib                PACKAGE = X11::Xlib::FrameDiff
+
+void
+_diff(src, stride, width, height, bytes_per_pixel, tile_width, tile_height, hashes)
+    SV *src
+    UV stride
+    int width
+    int height
+    int bytes_per_pixel
+    int tile_width
+    int tile_height
+    SV *hashes
+    INIT:
+        STRLEN src_len, need, n_tiles, hashes_len;
+        const char *src_p;
+        char *hashes_p;
+        XRectangle *rects;
+        Bool compare;
+        int n, i;
+    PPCODE:
+        if (width < 0 || height < 0) croak("Invalid dimensions %dx%d", width, height);
+        if (tile_width <= 0 || tile_height <= 0) croak("Invalid tile size %dx%d", tile_width, tile_height);
+        if (bytes_per_pixel < 1 || bytes_per_pixel > 4) croak("Invalid bytes_per_pixel %d", bytes_per_pixel);
+        src_p= SvPV(src, src_len);
+        need= height? stride * (height-1) + (STRLEN)width * bytes_per_pixel : 0;
+        if (src_len < need)
+            croak("Source is %ld bytes, but %dx%d pixels need %ld", (long) src_len, width, height, (long) need);
+        n_tiles= (STRLEN)((width + tile_width - 1) / tile_width) * ((height + tile_height - 1) / tile_height);
+        /* The previous hashes are only valid if there is the right number of them */
+        if (!SvOK(hashes)) sv_setpvn(hashes, "", 0);
+        hashes_p= SvPV_force(hashes, hashes_len);
+        compare= hashes_len == n_tiles * sizeof(U64);
+        hashes_p= SvGROW(hashes, n_tiles * sizeof(U64) + 1);
+        if (!n_tiles) XSRETURN(0);
+        Newx(rects, n_tiles, XRectangle);
+        SAVEFREEPV(rects);
+        n= PerlXlib_tile_diff((const U8*) src_p, stride, width, height, bytes_per_pixel,
+            tile_width, tile_height, (U64*) hashes_p, compare, rects);
+        SvCUR_set(hashes, n_tiles * sizeof(U64));
+        SvPOK_only(hashes);
+        SvSETMAGIC(hashes);
+        EXTEND(SP, n);
+        for (i= 0; i < n; i++)
+            PUSHs(sv_2mortal(sv_setref_pvn(newSV(0), "X11::Xlib::XRectangle", (char*)(rects+i), sizeof(XRectangle))));
+
+MODULE = X11::Xlib                PACKAGE = X11::Xlib::FrameEncoder
+
+void
+_encode(src, stride, width, height, bits_per_pixel, byte_order, red_mask, green_mask, blue_mask, alpha, channels, prev, delta, dst)
+    SV *src
+    UV stride
+    int width
+    int height
+    int bits_per_pixel
+    int byte_order
+    unsigned long red_mask
+    unsigned long green_mask
+    unsigned long blue_mask
+    int alpha
+    int channels
+    SV *prev
+    Bool delta
+    SV *dst
+    INIT:
+        STRLEN src_len, prev_len, need, frame_size;
+        const char *src_p;
+        char *dst_p, *prev_p= NULL;
+        size_t len;
+    PPCODE:
+        if (width < 0 || height < 0 || width > 0x7FFF || height > 0x7FFF)
+            croak("Invalid dimensions %dx%d", width, height);
+        if (channels != 3 && channels != 4) croak("channels must be 3 or 4");
+        if (src == dst || src == prev || prev == dst) croak("Source, previous frame, and destination must be different scalars");
+        src_p= SvPV(src, src_len);
+        need= height? stride * (height-1) + (STRLEN)width * ((bits_per_pixel+7) / 8) : 0;
+        if (src_len < need)
+            croak("Source is %ld bytes, but %dx%d pixels need %ld", (long) src_len, width, height, (long) need);
+        /* The previous frame is kept (and updated) if prev is defined */
+        if (SvOK(prev)) {
+            frame_size= (STRLEN)width * height * 4;
+            prev_p= SvPV_force(prev, prev_len);
+            if (delta && prev_len != frame_size)
+                croak("Previous frame is %ld bytes, expected %ld", (long) prev_len, (long) frame_size);
+            prev_p= SvGROW(prev, frame_size+1);
+            SvCUR_set(prev, frame_size);
+        }
+        need= PerlXlib_qoi_max_size(width, height, channels);
+        if (!SvOK(dst)) sv_setpvn(dst, "", 0);
+        SvPV_force_nolen(dst);
+        dst_p= SvGROW(dst, need+1);
+        len= PerlXlib_qoi_encode((const U8*) src_p, stride, width, height, bits_per_pixel, byte_order,
+            red_mask, green_mask, blue_mask, alpha, channels, (U8*) prev_p, delta, (U8*) dst_p);
+        if (!len) croak("Unsupported bits_per_pixel %d", bits_per_pixel);
+        SvCUR_set(dst, len);
+        SvPOK_only(dst);
+        SvSETMAGIC(dst);
+        if (prev_p) {
+            SvPOK_only(prev);
+            SvSETMAGIC(prev);
+        }
+
+void
+qoi_decode(src, prev= NULL)
+    SV *src
+    SV *prev
+    INIT:
+        STRLEN src_len, prev_len, frame_size;
+        const char *src_p, *prev_p= NULL;
+        int width, height, channels;
+        SV *pixels;
+    PPCODE:
+        src_p= SvPV(src, src_len);
+        if (!PerlXlib_qoi_header((const U8*) src_p, src_len, &width, &height, &channels))
+            croak("Not a QOI image");
+        frame_size= (STRLEN)width * height * channels;
+        if (prev && SvOK(prev)) {
+            prev_p= SvPV(prev, prev_len);
+            if (prev_len != frame_size)
+                croak("Previous frame is %ld bytes, expected %ld", (long) prev_len, (long) frame_size);
+        }
+        pixels= sv_2mortal(newSV(frame_size+1));
+        SvPOK_only(pixels);
+        if (!PerlXlib_qoi_decode((const U8*) src_p, src_len, (U8*) SvPVX(pixels), (const U8*) prev_p))
+            croak("QOI image is truncated");
+        SvCUR_set(pixels, frame_size);
+        SvPVX(pixels)[frame_size]= '\0';
+        EXTEND(SP, 4);
+        PUSHs(sv_2mortal(newSViv(width)));
+        PUSHs(sv_2mortal(newSViv(height)));
+        PUSHs(sv_2mortal(newSViv(channels)));
+        PUSHs(pixels);
+
+MODULE = X11::Xlib                PACKAGE = X11::Xlib::XEvent
+
+# ----------------------------------------------------------------------------
+# BEGIN GENERATED X11_Xlib_XEvent
+void
+_initialize(s)
+    SV *s
+    INIT:
+        void *sptr;
+    PPCODE:
+        sptr= PerlXlib_get_struct_ptr(s, 1, "X11::Xlib::XEvent", sizeof(XEvent),
+            (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack
+        );
+        memset((void*) sptr, 0, sizeof(XEvent));
+
+int
+_sizeof(ignored)
+    SV *ignored
+    CODE:
+        RETVAL = sizeof(XEvent);
+    OUTPUT:
+        RETVAL
+
+void
+_pack(e, fields, consume)
+    XEvent *e
+    HV *fields
+    Bool consume
+    INIT:
+        const char *oldpkg, *newpkg;
+    PPCODE:
+        oldpkg= PerlXlib_xevent_pkg_for_type(e->type);
+        PerlXlib_XEvent_pack(e, fields, consume);
+        newpkg= PerlXlib_xevent_pkg_for_type(e->type);
+        /* re-bless the object if the thing passed to us was actually an object */
+        if (oldpkg != newpkg && sv_derived_from(ST(0), "X11::Xlib::XEvent"))
+            sv_bless(ST(0), gv_stashpv(newpkg, GV_ADD));
+
+void
+_unpack(e, fields)
+    XEvent *e
+    HV *fields
+    PPCODE:
+        PerlXlib_XEvent_unpack(e, fields);
+
+void
+get(self, ...)
+  SV *self
+  ALIAS:
+    get_list = 1
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+    const PerlXlib_struct_fields *f= &PerlXlib_XEvent_fields;
+    SV **names, *val;
+    const char *name;
+    STRLEN len;
+    int i, idx, n= items - 1;
+  PPCODE:
+    if (ix == 1 && n == 0) {
+      /* all fields which are valid for this event type */
+      EXTEND(SP, f->count * 2);
+      for (i= 0; i < f->count; i++) {
+        if (!(val= f->get_field(event, i, self))) continue;
+        PUSHs(sv_2mortal(newSVpv(f->names[i], 0)));
+        PUSHs(sv_2mortal(val));
+      }
+    }
+    else if (n > 0) {
+      /* results overwrite the argument list, so save the names first */
+      Newx(names, n, SV*);
+      SAVEFREEPV(names);
+      Copy(&ST(1), names, n, SV*);
+      EXTEND(SP, ix? n * 2 : n);
+      for (i= 0; i < n; i++) {
+        name= SvPV(names[i], len);
+        if ((idx= PerlXlib_struct_field_index(f, name, len)) < 0)
+          croak("No field '%s' in X11::Xlib::XEvent", name);
+        if (!(val= f->get_field(event, idx, self)))
+          croak("Can't access XEvent.%s for type=%d", name, event->type);
+        if (ix) PUSHs(names[i]);
+        PUSHs(sv_2mortal(val));
+      }
+    }
+
+void
+set(self, ...)
+  SV *self
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+    const PerlXlib_struct_fields *f= &PerlXlib_XEvent_fields;
+    const char *name, *oldpkg, *newpkg;
+    STRLEN len;
+    int i, idx, type_idx= PerlXlib_struct_field_index(f, "type", 4);
+  PPCODE:
+    if (!(items & 1)) croak("Odd number of arguments to set()");
+    oldpkg= PerlXlib_xevent_pkg_for_type(event->type);
+    /* type must be applied first, since it determines which other fields exist */
+    for (i= 1; i < items; i+= 2) {
+      name= SvPV(ST(i), len);
+      if (len == 4 && memcmp(name, "type", 4) == 0)
+        f->set_field(event, type_idx, ST(i+1));
+    }
+    for (i= 1; i < items; i+= 2) {
+      name= SvPV(ST(i), len);
+      if ((idx= PerlXlib_struct_field_index(f, name, len)) < 0)
+        croak("No field '%s' in X11::Xlib::XEvent", name);
+      if (idx != type_idx && !f->set_field(event, idx, ST(i+1)))
+        croak("Can't access XEvent.%s for type=%d", name, event->type);
+    }
+    newpkg= PerlXlib_xevent_pkg_for_type(event->type);
+    /* re-bless the object if the thing passed to us was actually an object */
+    if (oldpkg != newpkg && sv_derived_from(self, "X11::Xlib::XEvent"))
+      sv_bless(self, gv_stashpv(newpkg, GV_ADD));
+    PUSHs(self);
+
+void
+_above(event, value=NULL)
+  XEvent *event
+  SV *value
+  INIT:
+    Window c_value= 0;
+  PPCODE:
+    if (value) { c_value= PerlXlib_sv_to_xid(value); }
+    switch (event->type) {
+    case ConfigureNotify:
+      if (value) { event->xconfigure.above = c_value; } else { c_value= event->xconfigure.above; } break;
+    case ConfigureRequest:
+      if (value) { event->xconfigurerequest.above = c_value; } else { c_value= event->xconfigurerequest.above; } break;
+    default: croak("Can't access XEvent.above for type=%d", event->type);
+    }
+    PUSHs(value? value : sv_2mortal(newSVuv(c_value)));
 
 void
 _atom(event, value=NULL)
   XEvent *event
   SV *value
   INIT:
-    Atom c_value= 0;
+    Atom c_value= 0;
+  PPCODE:
+    if (value) { c_value= PerlXlib_sv_to_xid(value); }
+    switch (event->type) {
+    case PropertyNotify:
+      if (value) { event->xproperty.atom = c_value; } else { c_value= event->xproperty.atom; } break;
+    default: croak("Can't access XEvent.atom for type=%d", event->type);
+    }
+    PUSHs(value? value : sv_2mortal(newSVuv(c_value)));
+
+void
+_b(event, value=NULL)
+  XEvent *event
+  SV *value
+  PPCODE:
+    switch (event->type) {
+    case ClientMessage:
+      if (value) { { if (!SvPOK(value) || SvCUR(value) != sizeof(char)*20)  croak("Expected scalar of length %ld but got %ld", (long)(sizeof(char)*20), (long) SvCUR(value)); memcpy(event->xclient.data.b, SvPVX(value), sizeof(char)*20);} } else { PUSHs(sv_2mortal(newSVpvn((void*)event->xclient.data.b, sizeof(char)*20))); } break;
+    default: croak("Can't access XEvent.b for type=%d", event->type);
+    }
+
+void
+_border_width(event, value=NULL)
+  XEvent *event
+  SV *value
+  INIT:
+    int c_value= 0;
+  PPCODE:
+    if (value) { c_value= SvIV(value); }
+    switch (event->type) {
+    case ConfigureNotify:
+      if (value) { event->xconfigure.border_width = c_value; } else { c_value= event->xconfigure.border_width; } break;
+    case ConfigureRequest:
+      if (value) { event->xconfigurerequest.border_width = c_value; } else { c_value= event->xconfigurerequest.border_width; } break;
+    case CreateNotify:
+      if (value) { event->xcreatewindow.border_width = c_value; } else { c_value= event->xcreatewindow.border_width; } break;
+    default: croak("Can't access XEvent.border_width for type=%d", event->type);
+    }
+    PUSHs(value? value : sv_2mortal(newSViv(c_value)));
+
+void
+_button(event, value=NULL)
+  XEvent *event
+  SV *value
+  INIT:
+    unsigned int c_value= 0;
+  PPCODE:
+    if (value) { c_value= SvUV(value); }
+    switch (event->type) {
+    case ButtonPress:
+    case ButtonRelease:
+      if (value) { event->xbutton.button = c_value; } else { c_value= event->xbutton.button; } break;
+    default: croak("Can't access XEvent.button for type=%d", event->type);
+    }
+    PUSHs(value? value : sv_2mortal(newSVuv(c_value)));
+
+void
+_colormap(event, value=NULL)
+  XEvent *event
+  SV *value
+  INIT:
+    Colormap c_value= 0;
+  PPCODE:
+    if (value) { c_value= PerlXlib_sv_to_xid(value); }
+    switch (event->type) {
+    case ColormapNotify:
+      if (value) { event->xcolormap.colormap = c_value; } else { c_value= event->xcolormap.colormap; } break;
+    default: croak("Can't access XEvent.colormap for type=%d", event->type);
+    }
+    PUSHs(value? value : sv_2mortal(newSVuv(c_value)));
+
+void
+_cookie(event, value=NULL)
+  XEvent *event
+  SV *value
+  INIT:
+    unsigned int c_value= 0;
+  PPCODE:
+    if (value) { c_value= SvUV(value); }
+    switch (event->type) {
+    default: croak("Can't access XEvent.cookie for type=%d", event->type);
+    }
+    PUSHs(value? value : sv_2mortal(newSVuv(c_value)));
+
+void
+_count(event, value=NULL)
+  XEvent *event
+  SV *value
+  INIT:
+    int c_value= 0;
+  PPCODE:
+    if (value) { c_value= SvIV(value); }
+    switch (event->type) {
+    case Expose:
+      if (value) { event->xexpose.count = c_value; } else { c_value= event->xexpose.count; } break;
+    case GraphicsExpose:
+      if (value) { event->xgraphicsexpose.count = c_value; } else { c_value= event->xgraphicsexpose.count; } break;
+    case MappingNotify:
+      if (value) { event->xmapping.count = c_value; } else { c_value= event->xmapping.count; } break;
+    default: croak("Can't access XEvent.count for type=%d", event->type);
+    }
+    PUSHs(value? value : sv_2mortal(newSViv(c_value)));
+
+void
+_detail(event, value=NULL)
+  XEvent *event
+  SV *value
+  INIT:
+    int c_value= 0;
+  PPCODE:
+    if (value) { c_value= SvIV(value); }
+    switch (event->type) {
+    case ConfigureRequest:
+      if (value) { event->xconfigurerequest.detail = c_value; } else { c_value= event->xconfigurerequest.detail; } break;
+    case EnterNotify:
+    case LeaveNotify:
+      if (value) { event->xcrossing.detail = c_value; } else { c_value= event->xcrossing.detail; } break;
+    case FocusIn:
+    case FocusOut:
+      if (value) { event->xfocus.detail = c_value; } else { c_value= event->xfocus.detail; } break;
+    default: croak("Can't access XEvent.detail for type=%d", event->type);
+    }
+    PUSHs(value? value : sv_2mortal(newSViv(c_value)));
+
+void
+display(event, value=NULL)
+  XEvent *event
+  SV *value
+  PPCODE:
+    if (value) {
+      if (event->type) event->xany.display= PerlXlib_display_objref_get_pointer(value, PerlXlib_OR_NULL); else event->xerror.display= PerlXlib_display_objref_get_pointer(value, PerlXlib_OR_NULL);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVsv(PerlXlib_get_display_objref((event->type? event->xany.display : event->xerror.display), PerlXlib_AUTOCREATE))));
+    }
+
+void
+_drawable(event, value=NULL)
+  XEvent *event
+  SV *value
+  INIT:
+    Drawable c_value= 0;
+  PPCODE:
+    if (value) { c_value= PerlXlib_sv_to_xid(value); }
+    switch (event->type) {
+    case GraphicsExpose:
+      if (value) { event->xgraphicsexpose.drawable = c_value; } else { c_value= event->xgraphicsexpose.drawable; } break;
+    case NoExpose:
+      if (value) { event->xnoexpose.drawable = c_value; } else { c_value= event->xnoexpose.drawable; } break;
+    default: croak("Can't access XEvent.drawable for type=%d", event->type);
+    }
+    PUSHs(value? value : sv_2mortal(newSVuv(c_value)));
+
+void
+_error_code(event, value=NULL)
+  XEvent *event
+  SV *value
+  INIT:
+    unsigned char c_value= 0;
+  PPCODE:
+    if (value) { c_value= SvUV(value); }
+    switch (event->type) {
+    case 0:
+      if (value) { event->xerror.error_code = c_value; } else { c_value= event->xerror.error_code; } break;
+    default: croak("Can't access XEvent.error_code for type=%d", event->type);
+    }
+    PUSHs(value? value : sv_2mortal(newSVuv(c_value)));
+
+void
+_event(event, value=NULL)
+  XEvent *event
+  SV *value
+  INIT:
+    Window c_value= 0;
+  PPCODE:
+    if (value) { c_value= PerlXlib_sv_to_xid(value); }
+    switch (event->type) {
+    case CirculateNotify:
+      if (value) { event->xcirculate.event = c_value; } else { c_value= event->xcirculate.event; } break;
+    case ConfigureNotify:
+      if (value) { event->xconfigure.event = c_value; } else { c_value= event->xconfigure.event; } break;
+    case DestroyNotify:
+      if (value) { event->xdestroywindow.event = c_value; } else { c_value= event->xdestroywindow.event; } break;
+    case GravityNotify:
+      if (value) { event->xgravity.event = c_value; } else { c_value= event->xgravity.event; } break;
+    case MapNotify:
+      if (value) { event->xmap.event = c_value; } else { c_value= event->xmap.event; } break;
+    case ReparentNotify:
+      if (value) { event->xreparent.event = c_value; } else { c_value= event->xreparent.event; } break;
+    case UnmapNotify:
+      if (value) { event->xunmap.event = c_value; } else { c_value= event->xunmap.event; } break;
+    default: croak("Can't access XEvent.event for type=%d", event->type);
+    }
+    PUSHs(value? value : sv_2mortal(newSVuv(c_value)));
+
+void
+_evtype(event, value=NULL)
+  XEvent *event
+  SV *value
+  INIT:
+    int c_value= 0;
+  PPCODE:
+    if (value) { c_value= SvIV(value); }
+    switch (event->type) {
+    case GenericEvent:
+      if (value) { event->xgeneric.evtype = c_value; } else { c_value= event->xgeneric.evtype; } break;
+    default: croak("Can't access XEvent.evtype for type=%d", event->type);
+    }
+    PUSHs(value? value : sv_2mortal(newSViv(c_value)));
+
+void
+_extension(event, value=NULL)
+  XEvent *event
+  SV *value
+  INIT:
+    int c_value= 0;
+  PPCODE:
+    if (value) { c_value= SvIV(value); }
+    switch (event->type) {
+    case GenericEvent:
+      if (value) { event->xgeneric.extension = c_value; } else { c_value= event->xgeneric.extension; } break;
+    default: croak("Can't access XEvent.extension for type=%d", event->type);
+    }
+    PUSHs(value? value : sv_2mortal(newSViv(c_value)));
+
+void
+_first_keycode(event, value=NULL)
+  XEvent *event
+  SV *value
+  INIT:
+    int c_value= 0;
+  PPCODE:
+    if (value) { c_value= SvIV(value); }
+    switch (event->type) {
+    case MappingNotify:
+      if (value) { event->xmapping.first_keycode = c_value; } else { c_value= event->xmapping.first_keycode; } break;
+    default: croak("Can't access XEvent.first_keycode for type=%d", event->type);
+    }
+    PUSHs(value? value : sv_2mortal(newSViv(c_value)));
+
+void
+_focus(event, value=NULL)
+  XEvent *event
+  SV *value
+  INIT:
+    Bool c_value= 0;
+  PPCODE:
+    if (value) { c_value= SvIV(value); }
+    switch (event->type) {
+    case EnterNotify:
+    case LeaveNotify:
+      if (value) { event->xcrossing.focus = c_value; } else { c_value= event->xcrossing.focus; } break;
+    default: croak("Can't access XEvent.focus for type=%d", event->type);
+    }
+    PUSHs(value? value : sv_2mortal(newSViv(c_value)));
+
+void
+_format(event, value=NULL)
+  XEvent *event
+  SV *value
+  INIT:
+    int c_value= 0;
+  PPCODE:
+    if (value) { c_value= SvIV(value); }
+    switch (event->type) {
+    case ClientMessage:
+      if (value) { event->xclient.format = c_value; } else { c_value= event->xclient.format; } break;
+    default: croak("Can't access XEvent.format for type=%d", event->type);
+    }
+    PUSHs(value? value : sv_2mortal(newSViv(c_value)));
+
+void
+_from_configure(event, value=NULL)
+  XEvent *event
+  SV *value
+  INIT:
+    Bool c_value= 0;
+  PPCODE:
+    if (value) { c_value= SvIV(value); }
+    switch (event->type) {
+    case UnmapNotify:
+      if (value) { event->xunmap.from_configure = c_value; } else { c_value= event->xunmap.from_configure; } break;
+    default: croak("Can't access XEvent.from_configure for type=%d", event->type);
+    }
+    PUSHs(value? value : sv_2mortal(newSViv(c_value)));
+
+void
+_height(event, value=NULL)
+  XEvent *event
+  SV *value
+  INIT:
+    int c_value= 0;
+  PPCODE:
+    if (value) { c_value= SvIV(value); }
+    switch (event->type) {
+    case ConfigureNotify:
+      if (value) { event->xconfigure.height = c_value; } else { c_value= event->xconfigure.height; } break;
+    case ConfigureRequest:
+      if (value) { event->xconfigurerequest.height = c_value; } else { c_value= event->xconfigurerequest.height; } break;
+    case CreateNotify:
+      if (value) { event->xcreatewindow.height = c_value; } else { c_value= event->xcreatewindow.height; } break;
+    case Expose:
+      if (value) { event->xexpose.height = c_value; } else { c_value= event->xexpose.height; } break;
+    case GraphicsExpose:
+      if (value) { event->xgraphicsexpose.height = c_value; } else { c_value= event->xgraphicsexpose.height; } break;
+    case ResizeRequest:
+      if (value) { event->xresizerequest.height = c_value; } else { c_value= event->xresizerequest.height; } break;
+    default: croak("Can't access XEvent.height for type=%d", event->type);
+    }
+    PUSHs(value? value : sv_2mortal(newSViv(c_value)));
+
+void
+_is_hint(event, value=NULL)
+  XEvent *event
+  SV *value
+  INIT:
+    char c_value= 0;
+  PPCODE:
+    if (value) { c_value= SvIV(value); }
+    switch (event->type) {
+    case MotionNotify:
+      if (value) { event->xmotion.is_hint = c_value; } else { c_value= event->xmotion.is_hint; } break;
+    default: croak("Can't access XEvent.is_hint for type=%d", event->type);
+    }
+    PUSHs(value? value : sv_2mortal(newSViv(c_value)));
+
+void
+_key_vector(event, value=NULL)
+  XEvent *event
+  SV *value
+  PPCODE:
+    switch (event->type) {
+    case KeymapNotify:
+      if (value) { { if (!SvPOK(value) || SvCUR(value) != sizeof(char)*32)  croak("Expected scalar of length %ld but got %ld", (long)(sizeof(char)*32), (long) SvCUR(value)); memcpy(event->xkeymap.key_vector, SvPVX(value), sizeof(char)*32);} } else { PUSHs(sv_2mortal(newSVpvn((void*)event->xkeymap.key_vector, sizeof(char)*32))); } break;
+    default: croak("Can't access XEvent.key_vector for type=%d", event->type);
+    }
+
+void
+_keycode(event, value=NULL)
+  XEvent *event
+  SV *value
+  INIT:
+    unsigned int c_value= 0;
+  PPCODE:
+    if (value) { c_value= SvUV(value); }
+    switch (event->type) {
+    case KeyPress:
+    case KeyRelease:
+      if (value) { event->xkey.keycode = c_value; } else { c_value= event->xkey.keycode; } break;
+    default: croak("Can't access XEvent.keycode for type=%d", event->type);
+    }
+    PUSHs(value? value : sv_2mortal(newSVuv(c_value)));
+
+void
+_l(event, value=NULL)
+  XEvent *event
+  SV *value
+  PPCODE:
+    switch (event->type) {
+    case ClientMessage:
+      if (value) { { if (!SvPOK(value) || SvCUR(value) != sizeof(long)*5)  croak("Expected scalar of length %ld but got %ld", (long)(sizeof(long)*5), (long) SvCUR(value)); memcpy(event->xclient.data.l, SvPVX(value), sizeof(long)*5);} } else { PUSHs(sv_2mortal(newSVpvn((void*)event->xclient.data.l, sizeof(long)*5))); } break;
+    default: croak("Can't access XEvent.l for type=%d", event->type);
+    }
+
+void
+_major_code(event, value=NULL)
+  XEvent *event
+  SV *value
+  INIT:
+    int c_value= 0;
+  PPCODE:
+    if (value) { c_value= SvIV(value); }
+    switch (event->type) {
+    case GraphicsExpose:
+      if (value) { event->xgraphicsexpose.major_code = c_value; } else { c_value= event->xgraphicsexpose.major_code; } break;
+    case NoExpose:
+      if (value) { event->xnoexpose.major_code = c_value; } else { c_value= event->xnoexpose.major_code; } break;
+    default: croak("Can't access XEvent.major_code for type=%d", event->type);
+    }
+    PUSHs(value? value : sv_2mortal(newSViv(c_value)));
+
+void
+_message_type(event, value=NULL)
+  XEvent *event
+  SV *value
+  INIT:
+    Atom c_value= 0;
+  PPCODE:
+    if (value) { c_value= PerlXlib_sv_to_xid(value); }
+    switch (event->type) {
+    case ClientMessage:
+      if (value) { event->xclient.message_type = c_value; } else { c_value= event->xclient.message_type; } break;
+    default: croak("Can't access XEvent.message_type for type=%d", event->type);
+    }
+    PUSHs(value? value : sv_2mortal(newSVuv(c_value)));
+
+void
+_minor_code(event, value=NULL)
+  XEvent *event
+  SV *value
+  PPCODE:
+    switch (event->type) {
+    case 0:
+      if (value) { event->xerror.minor_code= SvUV(value); } else { PUSHs(sv_2mortal(newSVuv(event->xerror.minor_code))); } break;
+    case GraphicsExpose:
+      if (value) { event->xgraphicsexpose.minor_code= SvIV(value); } else { PUSHs(sv_2mortal(newSViv(event->xgraphicsexpose.minor_code))); } break;
+    case NoExpose:
+      if (value) { event->xnoexpose.minor_code= SvIV(value); } else { PUSHs(sv_2mortal(newSViv(event->xnoexpose.minor_code))); } break;
+    default: croak("Can't access XEvent.minor_code for type=%d", event->type);
+    }
+
+void
+_mode(event, value=NULL)
+  XEvent *event
+  SV *value
+  INIT:
+    int c_value= 0;
+  PPCODE:
+    if (value) { c_value= SvIV(value); }
+    switch (event->type) {
+    case EnterNotify:
+    case LeaveNotify:
+      if (value) { event->xcrossing.mode = c_value; } else { c_value= event->xcrossing.mode; } break;
+    case FocusIn:
+    case FocusOut:
+      if (value) { event->xfocus.mode = c_value; } else { c_value= event->xfocus.mode; } break;
+    default: croak("Can't access XEvent.mode for type=%d", event->type);
+    }
+    PUSHs(value? value : sv_2mortal(newSViv(c_value)));
+
+void
+_new(event, value=NULL)
+  XEvent *event
+  SV *value
+  INIT:
+    Bool c_value= 0;
+  PPCODE:
+    if (value) { c_value= SvIV(value); }
+    switch (event->type) {
+    case ColormapNotify:
+      if (value) { event->xcolormap.new = c_value; } else { c_value= event->xcolormap.new; } break;
+    default: croak("Can't access XEvent.new for type=%d", event->type);
+    }
+    PUSHs(value? value : sv_2mortal(newSViv(c_value)));
+
+void
+_override_redirect(event, value=NULL)
+  XEvent *event
+  SV *value
+  INIT:
+    Bool c_value= 0;
+  PPCODE:
+    if (value) { c_value= SvIV(value); }
+    switch (event->type) {
+    case ConfigureNotify:
+      if (value) { event->xconfigure.override_redirect = c_value; } else { c_value= event->xconfigure.override_redirect; } break;
+    case CreateNotify:
+      if (value) { event->xcreatewindow.override_redirect = c_value; } else { c_value= event->xcreatewindow.override_redirect; } break;
+    case MapNotify:
+      if (value) { event->xmap.override_redirect = c_value; } else { c_value= event->xmap.override_redirect; } break;
+    case ReparentNotify:
+      if (value) { event->xreparent.override_redirect = c_value; } else { c_value= event->xreparent.override_redirect; } break;
+    default: croak("Can't access XEvent.override_redirect for type=%d", event->type);
+    }
+    PUSHs(value? value : sv_2mortal(newSViv(c_value)));
+
+void
+_owner(event, value=NULL)
+  XEvent *event
+  SV *value
+  INIT:
+    Window c_value= 0;
+  PPCODE:
+    if (value) { c_value= PerlXlib_sv_to_xid(value); }
+    switch (event->type) {
+    case SelectionRequest:
+      if (value) { event->xselectionrequest.owner = c_value; } else { c_value= event->xselectionrequest.owner; } break;
+    default: croak("Can't access XEvent.owner for type=%d", event->type);
+    }
+    PUSHs(value? value : sv_2mortal(newSVuv(c_value)));
+
+void
+_pad(event, value=NULL)
+  XEvent *event
+  SV *value
+  PPCODE:
+    switch (event->type) {
+    default: croak("Can't access XEvent.pad for type=%d", event->type);
+    }
+
+void
+_parent(event, value=NULL)
+  XEvent *event
+  SV *value
+  INIT:
+    Window c_value= 0;
+  PPCODE:
+    if (value) { c_value= PerlXlib_sv_to_xid(value); }
+    switch (event->type) {
+    case CirculateRequest:
+      if (value) { event->xcirculaterequest.parent = c_value; } else { c_value= event->xcirculaterequest.parent; } break;
+    case ConfigureRequest:
+      if (value) { event->xconfigurerequest.parent = c_value; } else { c_value= event->xconfigurerequest.parent; } break;
+    case CreateNotify:
+      if (value) { event->xcreatewindow.parent = c_value; } else { c_value= event->xcreatewindow.parent; } break;
+    case MapRequest:
+      if (value) { event->xmaprequest.parent = c_value; } else { c_value= event->xmaprequest.parent; } break;
+    case ReparentNotify:
+      if (value) { event->xreparent.parent = c_value; } else { c_value= event->xreparent.parent; } break;
+    default: croak("Can't access XEvent.parent for type=%d", event->type);
+    }
+    PUSHs(value? value : sv_2mortal(newSVuv(c_value)));
+
+void
+_place(event, value=NULL)
+  XEvent *event
+  SV *value
+  INIT:
+    int c_value= 0;
+  PPCODE:
+    if (value) { c_value= SvIV(value); }
+    switch (event->type) {
+    case CirculateNotify:
+      if (value) { event->xcirculate.place = c_value; } else { c_value= event->xcirculate.place; } break;
+    case CirculateRequest:
+      if (value) { event->xcirculaterequest.place = c_value; } else { c_value= event->xcirculaterequest.place; } break;
+    default: croak("Can't access XEvent.place for type=%d", event->type);
+    }
+    PUSHs(value? value : sv_2mortal(newSViv(c_value)));
+
+void
+_property(event, value=NULL)
+  XEvent *event
+  SV *value
+  INIT:
+    Atom c_value= 0;
+  PPCODE:
+    if (value) { c_value= PerlXlib_sv_to_xid(value); }
+    switch (event->type) {
+    case SelectionNotify:
+      if (value) { event->xselection.property = c_value; } else { c_value= event->xselection.property; } break;
+    case SelectionRequest:
+      if (value) { event->xselectionrequest.property = c_value; } else { c_value= event->xselectionrequest.property; } break;
+    default: croak("Can't access XEvent.property for type=%d", event->type);
+    }
+    PUSHs(value? value : sv_2mortal(newSVuv(c_value)));
+
+void
+_request(event, value=NULL)
+  XEvent *event
+  SV *value
+  INIT:
+    int c_value= 0;
+  PPCODE:
+    if (value) { c_value= SvIV(value); }
+    switch (event->type) {
+    case MappingNotify:
+      if (value) { event->xmapping.request = c_value; } else { c_value= event->xmapping.request; } break;
+    default: croak("Can't access XEvent.request for type=%d", event->type);
+    }
+    PUSHs(value? value : sv_2mortal(newSViv(c_value)));
+
+void
+_request_code(event, value=NULL)
+  XEvent *event
+  SV *value
+  INIT:
+    unsigned char c_value= 0;
+  PPCODE:
+    if (value) { c_value= SvUV(value); }
+    switch (event->type) {
+    case 0:
+      if (value) { event->xerror.request_code = c_value; } else { c_value= event->xerror.request_code; } break;
+    default: croak("Can't access XEvent.request_code for type=%d", event->type);
+    }
+    PUSHs(value? value : sv_2mortal(newSVuv(c_value)));
+
+void
+_requestor(event, value=NULL)
+  XEvent *event
+  SV *value
+  INIT:
+    Window c_value= 0;
+  PPCODE:
+    if (value) { c_value= PerlXlib_sv_to_xid(value); }
+    switch (event->type) {
+    case SelectionNotify:
+      if (value) { event->xselection.requestor = c_value; } else { c_value= event->xselection.requestor; } break;
+    case SelectionRequest:
+      if (value) { event->xselectionrequest.requestor = c_value; } else { c_value= event->xselectionrequest.requestor; } break;
+    default: croak("Can't access XEvent.requestor for type=%d", event->type);
+    }
+    PUSHs(value? value : sv_2mortal(newSVuv(c_value)));
+
+void
+_resourceid(event, value=NULL)
+  XEvent *event
+  SV *value
+  INIT:
+    XID c_value= 0;
+  PPCODE:
+    if (value) { c_value= PerlXlib_sv_to_xid(value); }
+    switch (event->type) {
+    case 0:
+      if (value) { event->xerror.resourceid = c_value; } else { c_value= event->xerror.resourceid; } break;
+    default: croak("Can't access XEvent.resourceid for type=%d", event->type);
+    }
+    PUSHs(value? value : sv_2mortal(newSVuv(c_value)));
+
+void
+_root(event, value=NULL)
+  XEvent *event
+  SV *value
+  INIT:
+    Window c_value= 0;
+  PPCODE:
+    if (value) { c_value= PerlXlib_sv_to_xid(value); }
+    switch (event->type) {
+    case ButtonPress:
+    case ButtonRelease:
+      if (value) { event->xbutton.root = c_value; } else { c_value= event->xbutton.root; } break;
+    case EnterNotify:
+    case LeaveNotify:
+      if (value) { event->xcrossing.root = c_value; } else { c_value= event->xcrossing.root; } break;
+    case KeyPress:
+    case KeyRelease:
+      if (value) { event->xkey.root = c_value; } else { c_value= event->xkey.root; } break;
+    case MotionNotify:
+      if (value) { event->xmotion.root = c_value; } else { c_value= event->xmotion.root; } break;
+    default: croak("Can't access XEvent.root for type=%d", event->type);
+    }
+    PUSHs(value? value : sv_2mortal(newSVuv(c_value)));
+
+void
+_s(event, value=NULL)
+  XEvent *event
+  SV *value
+  PPCODE:
+    switch (event->type) {
+    case ClientMessage:
+      if (value) { { if (!SvPOK(value) || SvCUR(value) != sizeof(short)*10)  croak("Expected scalar of length %ld but got %ld", (long)(sizeof(short)*10), (long) SvCUR(value)); memcpy(event->xclient.data.s, SvPVX(value), sizeof(short)*10);} } else { PUSHs(sv_2mortal(newSVpvn((void*)event->xclient.data.s, sizeof(short)*10))); } break;
+    default: croak("Can't access XEvent.s for type=%d", event->type);
+    }
+
+void
+_same_screen(event, value=NULL)
+  XEvent *event
+  SV *value
+  INIT:
+    Bool c_value= 0;
+  PPCODE:
+    if (value) { c_value= SvIV(value); }
+    switch (event->type) {
+    case ButtonPress:
+    case ButtonRelease:
+      if (value) { event->xbutton.same_screen = c_value; } else { c_value= event->xbutton.same_screen; } break;
+    case EnterNotify:
+    case LeaveNotify:
+      if (value) { event->xcrossing.same_screen = c_value; } else { c_value= event->xcrossing.same_screen; } break;
+    case KeyPress:
+    case KeyRelease:
+      if (value) { event->xkey.same_screen = c_value; } else { c_value= event->xkey.same_screen; } break;
+    case MotionNotify:
+      if (value) { event->xmotion.same_screen = c_value; } else { c_value= event->xmotion.same_screen; } break;
+    default: croak("Can't access XEvent.same_screen for type=%d", event->type);
+    }
+    PUSHs(value? value : sv_2mortal(newSViv(c_value)));
+
+void
+_selection(event, value=NULL)
+  XEvent *event
+  SV *value
+  INIT:
+    Atom c_value= 0;
+  PPCODE:
+    if (value) { c_value= PerlXlib_sv_to_xid(value); }
+    switch (event->type) {
+    case SelectionNotify:
+      if (value) { event->xselection.selection = c_value; } else { c_value= event->xselection.selection; } break;
+    case SelectionClear:
+      if (value) { event->xselectionclear.selection = c_value; } else { c_value= event->xselectionclear.selection; } break;
+    case SelectionRequest:
+      if (value) { event->xselectionrequest.selection = c_value; } else { c_value= event->xselectionrequest.selection; } break;
+    default: croak("Can't access XEvent.selection for type=%d", event->type);
+    }
+    PUSHs(value? value : sv_2mortal(newSVuv(c_value)));
+
+void
+send_event(event, value=NULL)
+  XEvent *event
+  SV *value
+  PPCODE:
+    if (!event->type) croak("Can't access XEvent.send_event for type=%d", event->type);
+    if (value) {
+      event->xany.send_event= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xany.send_event)));
+    }
+
+void
+serial(event, value=NULL)
+  XEvent *event
+  SV *value
+  PPCODE:
+    if (value) {
+      if (event->type) event->xany.serial= SvUV(value); else event->xerror.serial= SvUV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv((event->type? event->xany.serial : event->xerror.serial))));
+    }
+
+void
+_state(event, value=NULL)
+  XEvent *event
+  SV *value
+  PPCODE:
+    switch (event->type) {
+    case ButtonPress:
+    case ButtonRelease:
+      if (value) { event->xbutton.state= SvUV(value); } else { PUSHs(sv_2mortal(newSVuv(event->xbutton.state))); } break;
+    case ColormapNotify:
+      if (value) { event->xcolormap.state= SvIV(value); } else { PUSHs(sv_2mortal(newSViv(event->xcolormap.state))); } break;
+    case EnterNotify:
+    case LeaveNotify:
+      if (value) { event->xcrossing.state= SvUV(value); } else { PUSHs(sv_2mortal(newSVuv(event->xcrossing.state))); } break;
+    case KeyPress:
+    case KeyRelease:
+      if (value) { event->xkey.state= SvUV(value); } else { PUSHs(sv_2mortal(newSVuv(event->xkey.state))); } break;
+    case MotionNotify:
+      if (value) { event->xmotion.state= SvUV(value); } else { PUSHs(sv_2mortal(newSVuv(event->xmotion.state))); } break;
+    case PropertyNotify:
+      if (value) { event->xproperty.state= SvIV(value); } else { PUSHs(sv_2mortal(newSViv(event->xproperty.state))); } break;
+    case VisibilityNotify:
+      if (value) { event->xvisibility.state= SvIV(value); } else { PUSHs(sv_2mortal(newSViv(event->xvisibility.state))); } break;
+    default: croak("Can't access XEvent.state for type=%d", event->type);
+    }
+
+void
+_subwindow(event, value=NULL)
+  XEvent *event
+  SV *value
+  INIT:
+    Window c_value= 0;
+  PPCODE:
+    if (value) { c_value= PerlXlib_sv_to_xid(value); }
+    switch (event->type) {
+    case ButtonPress:
+    case ButtonRelease:
+      if (value) { event->xbutton.subwindow = c_value; } else { c_value= event->xbutton.subwindow; } break;
+    case EnterNotify:
+    case LeaveNotify:
+      if (value) { event->xcrossing.subwindow = c_value; } else { c_value= event->xcrossing.subwindow; } break;
+    case KeyPress:
+    case KeyRelease:
+      if (value) { event->xkey.subwindow = c_value; } else { c_value= event->xkey.subwindow; } break;
+    case MotionNotify:
+      if (value) { event->xmotion.subwindow = c_value; } else { c_value= event->xmotion.subwindow; } break;
+    default: croak("Can't access XEvent.subwindow for type=%d", event->type);
+    }
+    PUSHs(value? value : sv_2mortal(newSVuv(c_value)));
+
+void
+_target(event, value=NULL)
+  XEvent *event
+  SV *value
+  INIT:
+    Atom c_value= 0;
+  PPCODE:
+    if (value) { c_value= PerlXlib_sv_to_xid(value); }
+    switch (event->type) {
+    case SelectionNotify:
+      if (value) { event->xselection.target = c_value; } else { c_value= event->xselection.target; } break;
+    case SelectionRequest:
+      if (value) { event->xselectionrequest.target = c_value; } else { c_value= event->xselectionrequest.target; } break;
+    default: croak("Can't access XEvent.target for type=%d", event->type);
+    }
+    PUSHs(value? value : sv_2mortal(newSVuv(c_value)));
+
+void
+_time(event, value=NULL)
+  XEvent *event
+  SV *value
+  INIT:
+    Time c_value= 0;
+  PPCODE:
+    if (value) { c_value= SvUV(value); }
+    switch (event->type) {
+    case ButtonPress:
+    case ButtonRelease:
+      if (value) { event->xbutton.time = c_value; } else { c_value= event->xbutton.time; } break;
+    case EnterNotify:
+    case LeaveNotify:
+      if (value) { event->xcrossing.time = c_value; } else { c_value= event->xcrossing.time; } break;
+    case KeyPress:
+    case KeyRelease:
+      if (value) { event->xkey.time = c_value; } else { c_value= event->xkey.time; } break;
+    case MotionNotify:
+      if (value) { event->xmotion.time = c_value; } else { c_value= event->xmotion.time; } break;
+    case PropertyNotify:
+      if (value) { event->xproperty.time = c_value; } else { c_value= event->xproperty.time; } break;
+    case SelectionNotify:
+      if (value) { event->xselection.time = c_value; } else { c_value= event->xselection.time; } break;
+    case SelectionClear:
+      if (value) { event->xselectionclear.time = c_value; } else { c_value= event->xselectionclear.time; } break;
+    case SelectionRequest:
+      if (value) { event->xselectionrequest.time = c_value; } else { c_value= event->xselectionrequest.time; } break;
+    default: croak("Can't access XEvent.time for type=%d", event->type);
+    }
+    PUSHs(value? value : sv_2mortal(newSVuv(c_value)));
+
+void
+type(event, value=NULL)
+  XEvent *event
+  SV *value
+  INIT:
+    const char *oldpkg, *newpkg;
+  PPCODE:
+    if (value) {
+      if (event->type != SvIV(value)) {
+        oldpkg= PerlXlib_xevent_pkg_for_type(event->type);
+        event->type= SvIV(value);
+        newpkg= PerlXlib_xevent_pkg_for_type(event->type);
+        if (oldpkg != newpkg) {
+          /* re-initialize all fields in the area that changed */
+          memset( ((char*)(void*)event) + sizeof(XAnyEvent), 0, sizeof(XEvent)-sizeof(XAnyEvent) );
+          /* re-bless the object if the thing passed to us was actually an object */
+          if (sv_derived_from(ST(0), "X11::Xlib::XEvent"))
+            sv_bless(ST(0), gv_stashpv(newpkg, GV_ADD));
+        }
+      }
+    }
+    PUSHs(sv_2mortal(newSViv(event->type)));
+
+void
+_value_mask(event, value=NULL)
+  XEvent *event
+  SV *value
+  INIT:
+    unsigned long c_value= 0;
+  PPCODE:
+    if (value) { c_value= SvUV(value); }
+    switch (event->type) {
+    case ConfigureRequest:
+      if (value) { event->xconfigurerequest.value_mask = c_value; } else { c_value= event->xconfigurerequest.value_mask; } break;
+    default: croak("Can't access XEvent.value_mask for type=%d", event->type);
+    }
+    PUSHs(value? value : sv_2mortal(newSVuv(c_value)));
+
+void
+_width(event, value=NULL)
+  XEvent *event
+  SV *value
+  INIT:
+    int c_value= 0;
+  PPCODE:
+    if (value) { c_value= SvIV(value); }
+    switch (event->type) {
+    case ConfigureNotify:
+      if (value) { event->xconfigure.width = c_value; } else { c_value= event->xconfigure.width; } break;
+    case ConfigureRequest:
+      if (value) { event->xconfigurerequest.width = c_value; } else { c_value= event->xconfigurerequest.width; } break;
+    case CreateNotify:
+      if (value) { event->xcreatewindow.width = c_value; } else { c_value= event->xcreatewindow.width; } break;
+    case Expose:
+      if (value) { event->xexpose.width = c_value; } else { c_value= event->xexpose.width; } break;
+    case GraphicsExpose:
+      if (value) { event->xgraphicsexpose.width = c_value; } else { c_value= event->xgraphicsexpose.width; } break;
+    case ResizeRequest:
+      if (value) { event->xresizerequest.width = c_value; } else { c_value= event->xresizerequest.width; } break;
+    default: croak("Can't access XEvent.width for type=%d", event->type);
+    }
+    PUSHs(value? value : sv_2mortal(newSViv(c_value)));
+
+void
+_window(event, value=NULL)
+  XEvent *event
+  SV *value
+  INIT:
+    Window c_value= 0;
+  PPCODE:
+    if (value) { c_value= PerlXlib_sv_to_xid(value); }
+    switch (event->type) {
+    case ButtonPress:
+    case ButtonRelease:
+      if (value) { event->xbutton.window = c_value; } else { c_value= event->xbutton.window; } break;
+    case CirculateNotify:
+      if (value) { event->xcirculate.window = c_value; } else { c_value= event->xcirculate.window; } break;
+    case CirculateRequest:
+      if (value) { event->xcirculaterequest.window = c_value; } else { c_value= event->xcirculaterequest.window; } break;
+    case ClientMessage:
+      if (value) { event->xclient.window = c_value; } else { c_value= event->xclient.window; } break;
+    case ColormapNotify:
+      if (value) { event->xcolormap.window = c_value; } else { c_value= event->xcolormap.window; } break;
+    case ConfigureNotify:
+      if (value) { event->xconfigure.window = c_value; } else { c_value= event->xconfigure.window; } break;
+    case ConfigureRequest:
+      if (value) { event->xconfigurerequest.window = c_value; } else { c_value= event->xconfigurerequest.window; } break;
+    case CreateNotify:
+      if (value) { event->xcreatewindow.window = c_value; } else { c_value= event->xcreatewindow.window; } break;
+    case EnterNotify:
+    case LeaveNotify:
+      if (value) { event->xcrossing.window = c_value; } else { c_value= event->xcrossing.window; } break;
+    case DestroyNotify:
+      if (value) { event->xdestroywindow.window = c_value; } else { c_value= event->xdestroywindow.window; } break;
+    case Expose:
+      if (value) { event->xexpose.window = c_value; } else { c_value= event->xexpose.window; } break;
+    case FocusIn:
+    case FocusOut:
+      if (value) { event->xfocus.window = c_value; } else { c_value= event->xfocus.window; } break;
+    case GravityNotify:
+      if (value) { event->xgravity.window = c_value; } else { c_value= event->xgravity.window; } break;
+    case KeyPress:
+    case KeyRelease:
+      if (value) { event->xkey.window = c_value; } else { c_value= event->xkey.window; } break;
+    case KeymapNotify:
+      if (value) { event->xkeymap.window = c_value; } else { c_value= event->xkeymap.window; } break;
+    case MapNotify:
+      if (value) { event->xmap.window = c_value; } else { c_value= event->xmap.window; } break;
+    case MappingNotify:
+      if (value) { event->xmapping.window = c_value; } else { c_value= event->xmapping.window; } break;
+    case MapRequest:
+      if (value) { event->xmaprequest.window = c_value; } else { c_value= event->xmaprequest.window; } break;
+    case MotionNotify:
+      if (value) { event->xmotion.window = c_value; } else { c_value= event->xmotion.window; } break;
+    case PropertyNotify:
+      if (value) { event->xproperty.window = c_value; } else { c_value= event->xproperty.window; } break;
+    case ReparentNotify:
+      if (value) { event->xreparent.window = c_value; } else { c_value= event->xreparent.window; } break;
+    case ResizeRequest:
+      if (value) { event->xresizerequest.window = c_value; } else { c_value= event->xresizerequest.window; } break;
+    case SelectionClear:
+      if (value) { event->xselectionclear.window = c_value; } else { c_value= event->xselectionclear.window; } break;
+    case UnmapNotify:
+      if (value) { event->xunmap.window = c_value; } else { c_value= event->xunmap.window; } break;
+    case VisibilityNotify:
+      if (value) { event->xvisibility.window = c_value; } else { c_value= event->xvisibility.window; } break;
+    default: croak("Can't access XEvent.window for type=%d", event->type);
+    }
+    PUSHs(value? value : sv_2mortal(newSVuv(c_value)));
+
+void
+_x(event, value=NULL)
+  XEvent *event
+  SV *value
+  INIT:
+    int c_value= 0;
+  PPCODE:
+    if (value) { c_value= SvIV(value); }
+    switch (event->type) {
+    case ButtonPress:
+    case ButtonRelease:
+      if (value) { event->xbutton.x = c_value; } else { c_value= event->xbutton.x; } break;
+    case ConfigureNotify:
+      if (value) { event->xconfigure.x = c_value; } else { c_value= event->xconfigure.x; } break;
+    case ConfigureRequest:
+      if (value) { event->xconfigurerequest.x = c_value; } else { c_value= event->xconfigurerequest.x; } break;
+    case CreateNotify:
+      if (value) { event->xcreatewindow.x = c_value; } else { c_value= event->xcreatewindow.x; } break;
+    case EnterNotify:
+    case LeaveNotify:
+      if (value) { event->xcrossing.x = c_value; } else { c_value= event->xcrossing.x; } break;
+    case Expose:
+      if (value) { event->xexpose.x = c_value; } else { c_value= event->xexpose.x; } break;
+    case GraphicsExpose:
+      if (value) { event->xgraphicsexpose.x = c_value; } else { c_value= event->xgraphicsexpose.x; } break;
+    case GravityNotify:
+      if (value) { event->xgravity.x = c_value; } else { c_value= event->xgravity.x; } break;
+    case KeyPress:
+    case KeyRelease:
+      if (value) { event->xkey.x = c_value; } else { c_value= event->xkey.x; } break;
+    case MotionNotify:
+      if (value) { event->xmotion.x = c_value; } else { c_value= event->xmotion.x; } break;
+    case ReparentNotify:
+      if (value) { event->xreparent.x = c_value; } else { c_value= event->xreparent.x; } break;
+    default: croak("Can't access XEvent.x for type=%d", event->type);
+    }
+    PUSHs(value? value : sv_2mortal(newSViv(c_value)));
+
+void
+_x_root(event, value=NULL)
+  XEvent *event
+  SV *value
+  INIT:
+    int c_value= 0;
+  PPCODE:
+    if (value) { c_value= SvIV(value); }
+    switch (event->type) {
+    case ButtonPress:
+    case ButtonRelease:
+      if (value) { event->xbutton.x_root = c_value; } else { c_value= event->xbutton.x_root; } break;
+    case EnterNotify:
+    case LeaveNotify:
+      if (value) { event->xcrossing.x_root = c_value; } else { c_value= event->xcrossing.x_root; } break;
+    case KeyPress:
+    case KeyRelease:
+      if (value) { event->xkey.x_root = c_value; } else { c_value= event->xkey.x_root; } break;
+    case MotionNotify:
+      if (value) { event->xmotion.x_root = c_value; } else { c_value= event->xmotion.x_root; } break;
+    default: croak("Can't access XEvent.x_root for type=%d", event->type);
+    }
+    PUSHs(value? value : sv_2mortal(newSViv(c_value)));
+
+void
+_y(event, value=NULL)
+  XEvent *event
+  SV *value
+  INIT:
+    int c_value= 0;
+  PPCODE:
+    if (value) { c_value= SvIV(value); }
+    switch (event->type) {
+    case ButtonPress:
+    case ButtonRelease:
+      if (value) { event->xbutton.y = c_value; } else { c_value= event->xbutton.y; } break;
+    case ConfigureNotify:
+      if (value) { event->xconfigure.y = c_value; } else { c_value= event->xconfigure.y; } break;
+    case ConfigureRequest:
+      if (value) { event->xconfigurerequest.y = c_value; } else { c_value= event->xconfigurerequest.y; } break;
+    case CreateNotify:
+      if (value) { event->xcreatewindow.y = c_value; } else { c_value= event->xcreatewindow.y; } break;
+    case EnterNotify:
+    case LeaveNotify:
+      if (value) { event->xcrossing.y = c_value; } else { c_value= event->xcrossing.y; } break;
+    case Expose:
+      if (value) { event->xexpose.y = c_value; } else { c_value= event->xexpose.y; } break;
+    case GraphicsExpose:
+      if (value) { event->xgraphicsexpose.y = c_value; } else { c_value= event->xgraphicsexpose.y; } break;
+    case GravityNotify:
+      if (value) { event->xgravity.y = c_value; } else { c_value= event->xgravity.y; } break;
+    case KeyPress:
+    case KeyRelease:
+      if (value) { event->xkey.y = c_value; } else { c_value= event->xkey.y; } break;
+    case MotionNotify:
+      if (value) { event->xmotion.y = c_value; } else { c_value= event->xmotion.y; } break;
+    case ReparentNotify:
+      if (value) { event->xreparent.y = c_value; } else { c_value= event->xreparent.y; } break;
+    default: croak("Can't access XEvent.y for type=%d", event->type);
+    }
+    PUSHs(value? value : sv_2mortal(newSViv(c_value)));
+
+void
+_y_root(event, value=NULL)
+  XEvent *event
+  SV *value
+  INIT:
+    int c_value= 0;
+  PPCODE:
+    if (value) { c_value= SvIV(value); }
+    switch (event->type) {
+    case ButtonPress:
+    case ButtonRelease:
+      if (value) { event->xbutton.y_root = c_value; } else { c_value= event->xbutton.y_root; } break;
+    case EnterNotify:
+    case LeaveNotify:
+      if (value) { event->xcrossing.y_root = c_value; } else { c_value= event->xcrossing.y_root; } break;
+    case KeyPress:
+    case KeyRelease:
+      if (value) { event->xkey.y_root = c_value; } else { c_value= event->xkey.y_root; } break;
+    case MotionNotify:
+      if (value) { event->xmotion.y_root = c_value; } else { c_value= event->xmotion.y_root; } break;
+    default: croak("Can't access XEvent.y_root for type=%d", event->type);
+    }
+    PUSHs(value? value : sv_2mortal(newSViv(c_value)));
+
+
+MODULE = X11::Xlib                PACKAGE = X11::Xlib::XButtonEvent
+
+void
+button(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XButtonEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xbutton.button= SvUV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xbutton.button)));
+    }
+
+void
+root(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XButtonEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xbutton.root= PerlXlib_sv_to_xid(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xbutton.root)));
+    }
+
+void
+same_screen(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XButtonEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xbutton.same_screen= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xbutton.same_screen)));
+    }
+
+void
+state(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XButtonEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xbutton.state= SvUV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xbutton.state)));
+    }
+
+void
+subwindow(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XButtonEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xbutton.subwindow= PerlXlib_sv_to_xid(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xbutton.subwindow)));
+    }
+
+void
+time(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XButtonEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xbutton.time= SvUV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xbutton.time)));
+    }
+
+void
+window(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XButtonEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xbutton.window= PerlXlib_sv_to_xid(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xbutton.window)));
+    }
+
+void
+x(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XButtonEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xbutton.x= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xbutton.x)));
+    }
+
+void
+x_root(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XButtonEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xbutton.x_root= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xbutton.x_root)));
+    }
+
+void
+y(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XButtonEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xbutton.y= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xbutton.y)));
+    }
+
+void
+y_root(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XButtonEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xbutton.y_root= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xbutton.y_root)));
+    }
+
+
+MODULE = X11::Xlib                PACKAGE = X11::Xlib::XCirculateEvent
+
+void
+event(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XCirculateEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xcirculate.event= PerlXlib_sv_to_xid(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xcirculate.event)));
+    }
+
+void
+place(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XCirculateEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xcirculate.place= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xcirculate.place)));
+    }
+
+void
+window(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XCirculateEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xcirculate.window= PerlXlib_sv_to_xid(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xcirculate.window)));
+    }
+
+
+MODULE = X11::Xlib                PACKAGE = X11::Xlib::XCirculateRequestEvent
+
+void
+parent(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XCirculateRequestEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xcirculaterequest.parent= PerlXlib_sv_to_xid(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xcirculaterequest.parent)));
+    }
+
+void
+place(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XCirculateRequestEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xcirculaterequest.place= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xcirculaterequest.place)));
+    }
+
+void
+window(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XCirculateRequestEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xcirculaterequest.window= PerlXlib_sv_to_xid(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xcirculaterequest.window)));
+    }
+
+
+MODULE = X11::Xlib                PACKAGE = X11::Xlib::XClientMessageEvent
+
+void
+b(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XClientMessageEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      { if (!SvPOK(value) || SvCUR(value) != sizeof(char)*20)  croak("Expected scalar of length %ld but got %ld", (long)(sizeof(char)*20), (long) SvCUR(value)); memcpy(event->xclient.data.b, SvPVX(value), sizeof(char)*20);}
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVpvn((void*)event->xclient.data.b, sizeof(char)*20)));
+    }
+
+void
+l(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XClientMessageEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      { if (!SvPOK(value) || SvCUR(value) != sizeof(long)*5)  croak("Expected scalar of length %ld but got %ld", (long)(sizeof(long)*5), (long) SvCUR(value)); memcpy(event->xclient.data.l, SvPVX(value), sizeof(long)*5);}
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVpvn((void*)event->xclient.data.l, sizeof(long)*5)));
+    }
+
+void
+s(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XClientMessageEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      { if (!SvPOK(value) || SvCUR(value) != sizeof(short)*10)  croak("Expected scalar of length %ld but got %ld", (long)(sizeof(short)*10), (long) SvCUR(value)); memcpy(event->xclient.data.s, SvPVX(value), sizeof(short)*10);}
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVpvn((void*)event->xclient.data.s, sizeof(short)*10)));
+    }
+
+void
+format(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XClientMessageEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xclient.format= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xclient.format)));
+    }
+
+void
+message_type(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XClientMessageEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xclient.message_type= PerlXlib_sv_to_xid(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xclient.message_type)));
+    }
+
+void
+window(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XClientMessageEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xclient.window= PerlXlib_sv_to_xid(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xclient.window)));
+    }
+
+
+MODULE = X11::Xlib                PACKAGE = X11::Xlib::XColormapEvent
+
+void
+colormap(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XColormapEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xcolormap.colormap= PerlXlib_sv_to_xid(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xcolormap.colormap)));
+    }
+
+void
+new(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XColormapEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xcolormap.new= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xcolormap.new)));
+    }
+
+void
+state(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XColormapEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xcolormap.state= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xcolormap.state)));
+    }
+
+void
+window(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XColormapEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xcolormap.window= PerlXlib_sv_to_xid(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xcolormap.window)));
+    }
+
+
+MODULE = X11::Xlib                PACKAGE = X11::Xlib::XConfigureEvent
+
+void
+above(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XConfigureEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xconfigure.above= PerlXlib_sv_to_xid(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xconfigure.above)));
+    }
+
+void
+border_width(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XConfigureEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xconfigure.border_width= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xconfigure.border_width)));
+    }
+
+void
+event(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XConfigureEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xconfigure.event= PerlXlib_sv_to_xid(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xconfigure.event)));
+    }
+
+void
+height(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XConfigureEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xconfigure.height= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xconfigure.height)));
+    }
+
+void
+override_redirect(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XConfigureEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xconfigure.override_redirect= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xconfigure.override_redirect)));
+    }
+
+void
+width(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XConfigureEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xconfigure.width= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xconfigure.width)));
+    }
+
+void
+window(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XConfigureEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xconfigure.window= PerlXlib_sv_to_xid(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xconfigure.window)));
+    }
+
+void
+x(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XConfigureEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xconfigure.x= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xconfigure.x)));
+    }
+
+void
+y(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XConfigureEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xconfigure.y= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xconfigure.y)));
+    }
+
+
+MODULE = X11::Xlib                PACKAGE = X11::Xlib::XConfigureRequestEvent
+
+void
+above(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XConfigureRequestEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xconfigurerequest.above= PerlXlib_sv_to_xid(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xconfigurerequest.above)));
+    }
+
+void
+border_width(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XConfigureRequestEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xconfigurerequest.border_width= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xconfigurerequest.border_width)));
+    }
+
+void
+detail(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XConfigureRequestEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xconfigurerequest.detail= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xconfigurerequest.detail)));
+    }
+
+void
+height(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XConfigureRequestEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xconfigurerequest.height= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xconfigurerequest.height)));
+    }
+
+void
+parent(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XConfigureRequestEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xconfigurerequest.parent= PerlXlib_sv_to_xid(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xconfigurerequest.parent)));
+    }
+
+void
+value_mask(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XConfigureRequestEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xconfigurerequest.value_mask= SvUV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xconfigurerequest.value_mask)));
+    }
+
+void
+width(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XConfigureRequestEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xconfigurerequest.width= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xconfigurerequest.width)));
+    }
+
+void
+window(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XConfigureRequestEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xconfigurerequest.window= PerlXlib_sv_to_xid(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xconfigurerequest.window)));
+    }
+
+void
+x(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XConfigureRequestEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xconfigurerequest.x= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xconfigurerequest.x)));
+    }
+
+void
+y(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XConfigureRequestEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xconfigurerequest.y= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xconfigurerequest.y)));
+    }
+
+
+MODULE = X11::Xlib                PACKAGE = X11::Xlib::XCreateWindowEvent
+
+void
+border_width(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XCreateWindowEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xcreatewindow.border_width= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xcreatewindow.border_width)));
+    }
+
+void
+height(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XCreateWindowEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xcreatewindow.height= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xcreatewindow.height)));
+    }
+
+void
+override_redirect(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XCreateWindowEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xcreatewindow.override_redirect= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xcreatewindow.override_redirect)));
+    }
+
+void
+parent(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XCreateWindowEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xcreatewindow.parent= PerlXlib_sv_to_xid(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xcreatewindow.parent)));
+    }
+
+void
+width(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XCreateWindowEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xcreatewindow.width= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xcreatewindow.width)));
+    }
+
+void
+window(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XCreateWindowEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xcreatewindow.window= PerlXlib_sv_to_xid(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xcreatewindow.window)));
+    }
+
+void
+x(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XCreateWindowEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xcreatewindow.x= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xcreatewindow.x)));
+    }
+
+void
+y(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XCreateWindowEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xcreatewindow.y= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xcreatewindow.y)));
+    }
+
+
+MODULE = X11::Xlib                PACKAGE = X11::Xlib::XCrossingEvent
+
+void
+detail(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XCrossingEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xcrossing.detail= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xcrossing.detail)));
+    }
+
+void
+focus(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XCrossingEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xcrossing.focus= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xcrossing.focus)));
+    }
+
+void
+mode(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XCrossingEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xcrossing.mode= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xcrossing.mode)));
+    }
+
+void
+root(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XCrossingEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xcrossing.root= PerlXlib_sv_to_xid(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xcrossing.root)));
+    }
+
+void
+same_screen(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XCrossingEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xcrossing.same_screen= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xcrossing.same_screen)));
+    }
+
+void
+state(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XCrossingEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xcrossing.state= SvUV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xcrossing.state)));
+    }
+
+void
+subwindow(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XCrossingEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xcrossing.subwindow= PerlXlib_sv_to_xid(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xcrossing.subwindow)));
+    }
+
+void
+time(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XCrossingEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xcrossing.time= SvUV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xcrossing.time)));
+    }
+
+void
+window(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XCrossingEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xcrossing.window= PerlXlib_sv_to_xid(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xcrossing.window)));
+    }
+
+void
+x(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XCrossingEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xcrossing.x= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xcrossing.x)));
+    }
+
+void
+x_root(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XCrossingEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xcrossing.x_root= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xcrossing.x_root)));
+    }
+
+void
+y(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XCrossingEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xcrossing.y= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xcrossing.y)));
+    }
+
+void
+y_root(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XCrossingEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xcrossing.y_root= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xcrossing.y_root)));
+    }
+
+
+MODULE = X11::Xlib                PACKAGE = X11::Xlib::XDestroyWindowEvent
+
+void
+event(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XDestroyWindowEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xdestroywindow.event= PerlXlib_sv_to_xid(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xdestroywindow.event)));
+    }
+
+void
+window(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XDestroyWindowEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xdestroywindow.window= PerlXlib_sv_to_xid(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xdestroywindow.window)));
+    }
+
+
+MODULE = X11::Xlib                PACKAGE = X11::Xlib::XErrorEvent
+
+void
+error_code(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XErrorEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xerror.error_code= SvUV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xerror.error_code)));
+    }
+
+void
+minor_code(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XErrorEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xerror.minor_code= SvUV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xerror.minor_code)));
+    }
+
+void
+request_code(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XErrorEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xerror.request_code= SvUV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xerror.request_code)));
+    }
+
+void
+resourceid(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XErrorEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xerror.resourceid= PerlXlib_sv_to_xid(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xerror.resourceid)));
+    }
+
+
+MODULE = X11::Xlib                PACKAGE = X11::Xlib::XExposeEvent
+
+void
+count(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XExposeEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xexpose.count= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xexpose.count)));
+    }
+
+void
+height(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XExposeEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xexpose.height= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xexpose.height)));
+    }
+
+void
+width(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XExposeEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xexpose.width= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xexpose.width)));
+    }
+
+void
+window(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XExposeEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xexpose.window= PerlXlib_sv_to_xid(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xexpose.window)));
+    }
+
+void
+x(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XExposeEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xexpose.x= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xexpose.x)));
+    }
+
+void
+y(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XExposeEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xexpose.y= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xexpose.y)));
+    }
+
+
+MODULE = X11::Xlib                PACKAGE = X11::Xlib::XFocusChangeEvent
+
+void
+detail(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XFocusChangeEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xfocus.detail= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xfocus.detail)));
+    }
+
+void
+mode(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XFocusChangeEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xfocus.mode= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xfocus.mode)));
+    }
+
+void
+window(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XFocusChangeEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xfocus.window= PerlXlib_sv_to_xid(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xfocus.window)));
+    }
+
+
+MODULE = X11::Xlib                PACKAGE = X11::Xlib::XGenericEvent
+
+void
+evtype(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XGenericEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xgeneric.evtype= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xgeneric.evtype)));
+    }
+
+void
+extension(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XGenericEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xgeneric.extension= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xgeneric.extension)));
+    }
+
+
+MODULE = X11::Xlib                PACKAGE = X11::Xlib::XGraphicsExposeEvent
+
+void
+count(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XGraphicsExposeEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xgraphicsexpose.count= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xgraphicsexpose.count)));
+    }
+
+void
+drawable(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XGraphicsExposeEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xgraphicsexpose.drawable= PerlXlib_sv_to_xid(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xgraphicsexpose.drawable)));
+    }
+
+void
+height(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XGraphicsExposeEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xgraphicsexpose.height= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xgraphicsexpose.height)));
+    }
+
+void
+major_code(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XGraphicsExposeEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xgraphicsexpose.major_code= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xgraphicsexpose.major_code)));
+    }
+
+void
+minor_code(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XGraphicsExposeEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xgraphicsexpose.minor_code= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xgraphicsexpose.minor_code)));
+    }
+
+void
+width(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XGraphicsExposeEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xgraphicsexpose.width= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xgraphicsexpose.width)));
+    }
+
+void
+x(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XGraphicsExposeEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xgraphicsexpose.x= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xgraphicsexpose.x)));
+    }
+
+void
+y(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XGraphicsExposeEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xgraphicsexpose.y= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xgraphicsexpose.y)));
+    }
+
+
+MODULE = X11::Xlib                PACKAGE = X11::Xlib::XGravityEvent
+
+void
+event(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XGravityEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xgravity.event= PerlXlib_sv_to_xid(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xgravity.event)));
+    }
+
+void
+window(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XGravityEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xgravity.window= PerlXlib_sv_to_xid(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xgravity.window)));
+    }
+
+void
+x(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XGravityEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xgravity.x= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xgravity.x)));
+    }
+
+void
+y(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XGravityEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xgravity.y= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xgravity.y)));
+    }
+
+
+MODULE = X11::Xlib                PACKAGE = X11::Xlib::XKeyEvent
+
+void
+keycode(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XKeyEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xkey.keycode= SvUV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xkey.keycode)));
+    }
+
+void
+root(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XKeyEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xkey.root= PerlXlib_sv_to_xid(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xkey.root)));
+    }
+
+void
+same_screen(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XKeyEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xkey.same_screen= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xkey.same_screen)));
+    }
+
+void
+state(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XKeyEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xkey.state= SvUV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xkey.state)));
+    }
+
+void
+subwindow(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XKeyEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xkey.subwindow= PerlXlib_sv_to_xid(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xkey.subwindow)));
+    }
+
+void
+time(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XKeyEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xkey.time= SvUV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xkey.time)));
+    }
+
+void
+window(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XKeyEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xkey.window= PerlXlib_sv_to_xid(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xkey.window)));
+    }
+
+void
+x(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XKeyEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xkey.x= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xkey.x)));
+    }
+
+void
+x_root(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XKeyEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xkey.x_root= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xkey.x_root)));
+    }
+
+void
+y(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XKeyEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xkey.y= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xkey.y)));
+    }
+
+void
+y_root(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XKeyEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xkey.y_root= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xkey.y_root)));
+    }
+
+
+MODULE = X11::Xlib                PACKAGE = X11::Xlib::XKeymapEvent
+
+void
+key_vector(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XKeymapEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      { if (!SvPOK(value) || SvCUR(value) != sizeof(char)*32)  croak("Expected scalar of length %ld but got %ld", (long)(sizeof(char)*32), (long) SvCUR(value)); memcpy(event->xkeymap.key_vector, SvPVX(value), sizeof(char)*32);}
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVpvn((void*)event->xkeymap.key_vector, sizeof(char)*32)));
+    }
+
+void
+window(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XKeymapEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xkeymap.window= PerlXlib_sv_to_xid(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xkeymap.window)));
+    }
+
+
+MODULE = X11::Xlib                PACKAGE = X11::Xlib::XMapEvent
+
+void
+event(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XMapEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xmap.event= PerlXlib_sv_to_xid(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xmap.event)));
+    }
+
+void
+override_redirect(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XMapEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xmap.override_redirect= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xmap.override_redirect)));
+    }
+
+void
+window(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XMapEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xmap.window= PerlXlib_sv_to_xid(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xmap.window)));
+    }
+
+
+MODULE = X11::Xlib                PACKAGE = X11::Xlib::XMapRequestEvent
+
+void
+parent(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XMapRequestEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xmaprequest.parent= PerlXlib_sv_to_xid(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xmaprequest.parent)));
+    }
+
+void
+window(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XMapRequestEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xmaprequest.window= PerlXlib_sv_to_xid(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xmaprequest.window)));
+    }
+
+
+MODULE = X11::Xlib                PACKAGE = X11::Xlib::XMappingEvent
+
+void
+count(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XMappingEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xmapping.count= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xmapping.count)));
+    }
+
+void
+first_keycode(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XMappingEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xmapping.first_keycode= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xmapping.first_keycode)));
+    }
+
+void
+request(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XMappingEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xmapping.request= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xmapping.request)));
+    }
+
+void
+window(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XMappingEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xmapping.window= PerlXlib_sv_to_xid(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xmapping.window)));
+    }
+
+
+MODULE = X11::Xlib                PACKAGE = X11::Xlib::XMotionEvent
+
+void
+is_hint(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XMotionEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xmotion.is_hint= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xmotion.is_hint)));
+    }
+
+void
+root(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XMotionEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xmotion.root= PerlXlib_sv_to_xid(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xmotion.root)));
+    }
+
+void
+same_screen(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XMotionEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xmotion.same_screen= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xmotion.same_screen)));
+    }
+
+void
+state(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XMotionEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xmotion.state= SvUV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xmotion.state)));
+    }
+
+void
+subwindow(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XMotionEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xmotion.subwindow= PerlXlib_sv_to_xid(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xmotion.subwindow)));
+    }
+
+void
+time(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XMotionEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xmotion.time= SvUV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xmotion.time)));
+    }
+
+void
+window(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XMotionEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xmotion.window= PerlXlib_sv_to_xid(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xmotion.window)));
+    }
+
+void
+x(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XMotionEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xmotion.x= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xmotion.x)));
+    }
+
+void
+x_root(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XMotionEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xmotion.x_root= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xmotion.x_root)));
+    }
+
+void
+y(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XMotionEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xmotion.y= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xmotion.y)));
+    }
+
+void
+y_root(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XMotionEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xmotion.y_root= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xmotion.y_root)));
+    }
+
+
+MODULE = X11::Xlib                PACKAGE = X11::Xlib::XNoExposeEvent
+
+void
+drawable(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XNoExposeEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xnoexpose.drawable= PerlXlib_sv_to_xid(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xnoexpose.drawable)));
+    }
+
+void
+major_code(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XNoExposeEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
   PPCODE:
-    if (value) { c_value= PerlXlib_sv_to_xid(value); }
-    switch (event->type) {
-    case PropertyNotify:
-      if (value) { event->xproperty.atom = c_value; } else { c_value= event->xproperty.atom; } break;
-    default: croak("Can't access XEvent.atom for type=%d", event->type);
+    if (value) {
+      event->xnoexpose.major_code= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xnoexpose.major_code)));
     }
-    PUSHs(value? value : sv_2mortal(newSVuv(c_value)));
 
 void
-_b(event, value=NULL)
-  XEvent *event
+minor_code(self, value=NULL)
+  SV *self
   SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XNoExposeEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
   PPCODE:
-    switch (event->type) {
-    case ClientMessage:
-      if (value) { { if (!SvPOK(value) || SvCUR(value) != sizeof(char)*20)  croak("Expected scalar of length %ld but got %ld", (long)(sizeof(char)*20), (long) SvCUR(value)); memcpy(event->xclient.data.b, SvPVX(value), sizeof(char)*20);} } else { PUSHs(sv_2mortal(newSVpvn((void*)event->xclient.data.b, sizeof(char)*20))); } break;
-    default: croak("Can't access XEvent.b for type=%d", event->type);
+    if (value) {
+      event->xnoexpose.minor_code= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xnoexpose.minor_code)));
     }
 
+
+MODULE = X11::Xlib                PACKAGE = X11::Xlib::XPropertyEvent
+
 void
-_border_width(event, value=NULL)
-  XEvent *event
+atom(self, value=NULL)
+  SV *self
   SV *value
   INIT:
-    int c_value= 0;
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XPropertyEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
   PPCODE:
-    if (value) { c_value= SvIV(value); }
-    switch (event->type) {
-    case ConfigureNotify:
-      if (value) { event->xconfigure.border_width = c_value; } else { c_value= event->xconfigure.border_width; } break;
-    case ConfigureRequest:
-      if (value) { event->xconfigurerequest.border_width = c_value; } else { c_value= event->xconfigurerequest.border_width; } break;
-    case CreateNotify:
-      if (value) { event->xcreatewindow.border_width = c_value; } else { c_value= event->xcreatewindow.border_width; } break;
-    default: croak("Can't access XEvent.border_width for type=%d", event->type);
+    if (value) {
+      event->xproperty.atom= PerlXlib_sv_to_xid(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xproperty.atom)));
     }
-    PUSHs(value? value : sv_2mortal(newSViv(c_value)));
 
 void
-_button(event, value=NULL)
-  XEvent *event
+state(self, value=NULL)
+  SV *self
   SV *value
   INIT:
-    unsigned int c_value= 0;
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XPropertyEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
   PPCODE:
-    if (value) { c_value= SvUV(value); }
-    switch (event->type) {
-    case ButtonPress:
-    case ButtonRelease:
-      if (value) { event->xbutton.button = c_value; } else { c_value= event->xbutton.button; } break;
-    default: croak("Can't access XEvent.button for type=%d", event->type);
+    if (value) {
+      event->xproperty.state= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xproperty.state)));
     }
-    PUSHs(value? value : sv_2mortal(newSVuv(c_value)));
 
 void
-_colormap(event, value=NULL)
-  XEvent *event
+time(self, value=NULL)
+  SV *self
   SV *value
   INIT:
-    Colormap c_value= 0;
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XPropertyEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
   PPCODE:
-    if (value) { c_value= PerlXlib_sv_to_xid(value); }
-    switch (event->type) {
-    case ColormapNotify:
-      if (value) { event->xcolormap.colormap = c_value; } else { c_value= event->xcolormap.colormap; } break;
-    default: croak("Can't access XEvent.colormap for type=%d", event->type);
+    if (value) {
+      event->xproperty.time= SvUV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xproperty.time)));
     }
-    PUSHs(value? value : sv_2mortal(newSVuv(c_value)));
 
 void
-_cookie(event, value=NULL)
-  XEvent *event
+window(self, value=NULL)
+  SV *self
   SV *value
   INIT:
-    unsigned int c_value= 0;
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XPropertyEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
   PPCODE:
-    if (value) { c_value= SvUV(value); }
-    switch (event->type) {
-    default: croak("Can't access XEvent.cookie for type=%d", event->type);
+    if (value) {
+      event->xproperty.window= PerlXlib_sv_to_xid(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xproperty.window)));
+    }
+
+
+MODULE = X11::Xlib                PACKAGE = X11::Xlib::XReparentEvent
+
+void
+event(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XReparentEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xreparent.event= PerlXlib_sv_to_xid(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xreparent.event)));
+    }
+
+void
+override_redirect(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XReparentEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xreparent.override_redirect= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xreparent.override_redirect)));
+    }
+
+void
+parent(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XReparentEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xreparent.parent= PerlXlib_sv_to_xid(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xreparent.parent)));
+    }
+
+void
+window(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XReparentEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xreparent.window= PerlXlib_sv_to_xid(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xreparent.window)));
+    }
+
+void
+x(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XReparentEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xreparent.x= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xreparent.x)));
+    }
+
+void
+y(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XReparentEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xreparent.y= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xreparent.y)));
+    }
+
+
+MODULE = X11::Xlib                PACKAGE = X11::Xlib::XResizeRequestEvent
+
+void
+height(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XResizeRequestEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xresizerequest.height= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xresizerequest.height)));
+    }
+
+void
+width(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XResizeRequestEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xresizerequest.width= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xresizerequest.width)));
+    }
+
+void
+window(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XResizeRequestEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xresizerequest.window= PerlXlib_sv_to_xid(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xresizerequest.window)));
+    }
+
+
+MODULE = X11::Xlib                PACKAGE = X11::Xlib::XSelectionClearEvent
+
+void
+selection(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XSelectionClearEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xselectionclear.selection= PerlXlib_sv_to_xid(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xselectionclear.selection)));
+    }
+
+void
+time(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XSelectionClearEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xselectionclear.time= SvUV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xselectionclear.time)));
+    }
+
+void
+window(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XSelectionClearEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xselectionclear.window= PerlXlib_sv_to_xid(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xselectionclear.window)));
+    }
+
+
+MODULE = X11::Xlib                PACKAGE = X11::Xlib::XSelectionEvent
+
+void
+property(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XSelectionEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xselection.property= PerlXlib_sv_to_xid(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xselection.property)));
+    }
+
+void
+requestor(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XSelectionEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xselection.requestor= PerlXlib_sv_to_xid(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xselection.requestor)));
+    }
+
+void
+selection(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XSelectionEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xselection.selection= PerlXlib_sv_to_xid(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xselection.selection)));
+    }
+
+void
+target(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XSelectionEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xselection.target= PerlXlib_sv_to_xid(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xselection.target)));
+    }
+
+void
+time(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XSelectionEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xselection.time= SvUV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xselection.time)));
+    }
+
+
+MODULE = X11::Xlib                PACKAGE = X11::Xlib::XSelectionRequestEvent
+
+void
+owner(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XSelectionRequestEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      event->xselectionrequest.owner= PerlXlib_sv_to_xid(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xselectionrequest.owner)));
     }
-    PUSHs(value? value : sv_2mortal(newSVuv(c_value)));
 
 void
-_count(event, value=NULL)
-  XEvent *event
+property(self, value=NULL)
+  SV *self
   SV *value
   INIT:
-    int c_value= 0;
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XSelectionRequestEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
   PPCODE:
-    if (value) { c_value= SvIV(value); }
-    switch (event->type) {
-    case Expose:
-      if (value) { event->xexpose.count = c_value; } else { c_value= event->xexpose.count; } break;
-    case GraphicsExpose:
-      if (value) { event->xgraphicsexpose.count = c_value; } else { c_value= event->xgraphicsexpose.count; } break;
-    case MappingNotify:
-      if (value) { event->xmapping.count = c_value; } else { c_value= event->xmapping.count; } break;
-    default: croak("Can't access XEvent.count for type=%d", event->type);
+    if (value) {
+      event->xselectionrequest.property= PerlXlib_sv_to_xid(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xselectionrequest.property)));
     }
-    PUSHs(value? value : sv_2mortal(newSViv(c_value)));
 
 void
-_detail(event, value=NULL)
-  XEvent *event
+requestor(self, value=NULL)
+  SV *self
   SV *value
   INIT:
-    int c_value= 0;
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XSelectionRequestEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
   PPCODE:
-    if (value) { c_value= SvIV(value); }
-    switch (event->type) {
-    case ConfigureRequest:
-      if (value) { event->xconfigurerequest.detail = c_value; } else { c_value= event->xconfigurerequest.detail; } break;
-    case EnterNotify:
-    case LeaveNotify:
-      if (value) { event->xcrossing.detail = c_value; } else { c_value= event->xcrossing.detail; } break;
-    case FocusIn:
-    case FocusOut:
-      if (value) { event->xfocus.detail = c_value; } else { c_value= event->xfocus.detail; } break;
-    default: croak("Can't access XEvent.detail for type=%d", event->type);
+    if (value) {
+      event->xselectionrequest.requestor= PerlXlib_sv_to_xid(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xselectionrequest.requestor)));
     }
-    PUSHs(value? value : sv_2mortal(newSViv(c_value)));
 
 void
-display(event, value=NULL)
-  XEvent *event
+selection(self, value=NULL)
+  SV *self
   SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XSelectionRequestEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
   PPCODE:
     if (value) {
-      if (event->type) event->xany.display= PerlXlib_display_objref_get_pointer(value, PerlXlib_OR_NULL); else event->xerror.display= PerlXlib_display_objref_get_pointer(value, PerlXlib_OR_NULL);
+      event->xselectionrequest.selection= PerlXlib_sv_to_xid(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSVsv(PerlXlib_get_display_objref((event->type? event->xany.display : event->xerror.display), PerlXlib_AUTOCREATE))));
+      PUSHs(sv_2mortal(newSVuv(event->xselectionrequest.selection)));
     }
 
 void
-_drawable(event, value=NULL)
-  XEvent *event
+target(self, value=NULL)
+  SV *self
   SV *value
   INIT:
-    Drawable c_value= 0;
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XSelectionRequestEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
   PPCODE:
-    if (value) { c_value= PerlXlib_sv_to_xid(value); }
-    switch (event->type) {
-    case GraphicsExpose:
-      if (value) { event->xgraphicsexpose.drawable = c_value; } else { c_value= event->xgraphicsexpose.drawable; } break;
-    case NoExpose:
-      if (value) { event->xnoexpose.drawable = c_value; } else { c_value= event->xnoexpose.drawable; } break;
-    default: croak("Can't access XEvent.drawable for type=%d", event->type);
+    if (value) {
+      event->xselectionrequest.target= PerlXlib_sv_to_xid(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xselectionrequest.target)));
     }
-    PUSHs(value? value : sv_2mortal(newSVuv(c_value)));
 
 void
-_error_code(event, value=NULL)
-  XEvent *event
+time(self, value=NULL)
+  SV *self
   SV *value
   INIT:
-    unsigned char c_value= 0;
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XSelectionRequestEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
   PPCODE:
-    if (value) { c_value= SvUV(value); }
-    switch (event->type) {
-    case 0:
-      if (value) { event->xerror.error_code = c_value; } else { c_value= event->xerror.error_code; } break;
-    default: croak("Can't access XEvent.error_code for type=%d", event->type);
+    if (value) {
+      event->xselectionrequest.time= SvUV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xselectionrequest.time)));
     }
-    PUSHs(value? value : sv_2mortal(newSVuv(c_value)));
+
+
+MODULE = X11::Xlib                PACKAGE = X11::Xlib::XUnmapEvent
 
 void
-_event(event, value=NULL)
-  XEvent *event
+event(self, value=NULL)
+  SV *self
   SV *value
   INIT:
-    Window c_value= 0;
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XUnmapEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
   PPCODE:
-    if (value) { c_value= PerlXlib_sv_to_xid(value); }
-    switch (event->type) {
-    case CirculateNotify:
-      if (value) { event->xcirculate.event = c_value; } else { c_value= event->xcirculate.event; } break;
-    case ConfigureNotify:
-      if (value) { event->xconfigure.event = c_value; } else { c_value= event->xconfigure.event; } break;
-    case DestroyNotify:
-      if (value) { event->xdestroywindow.event = c_value; } else { c_value= event->xdestroywindow.event; } break;
-    case GravityNotify:
-      if (value) { event->xgravity.event = c_value; } else { c_value= event->xgravity.event; } break;
-    case MapNotify:
-      if (value) { event->xmap.event = c_value; } else { c_value= event->xmap.event; } break;
-    case ReparentNotify:
-      if (value) { event->xreparent.event = c_value; } else { c_value= event->xreparent.event; } break;
-    case UnmapNotify:
-      if (value) { event->xunmap.event = c_value; } else { c_value= event->xunmap.event; } break;
-    default: croak("Can't access XEvent.event for type=%d", event->type);
+    if (value) {
+      event->xunmap.event= PerlXlib_sv_to_xid(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xunmap.event)));
     }
-    PUSHs(value? value : sv_2mortal(newSVuv(c_value)));
 
 void
-_evtype(event, value=NULL)
-  XEvent *event
+from_configure(self, value=NULL)
+  SV *self
   SV *value
   INIT:
-    int c_value= 0;
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XUnmapEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
   PPCODE:
-    if (value) { c_value= SvIV(value); }
-    switch (event->type) {
-    case GenericEvent:
-      if (value) { event->xgeneric.evtype = c_value; } else { c_value= event->xgeneric.evtype; } break;
-    default: croak("Can't access XEvent.evtype for type=%d", event->type);
+    if (value) {
+      event->xunmap.from_configure= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xunmap.from_configure)));
     }
-    PUSHs(value? value : sv_2mortal(newSViv(c_value)));
 
 void
-_extension(event, value=NULL)
-  XEvent *event
+window(self, value=NULL)
+  SV *self
   SV *value
   INIT:
-    int c_value= 0;
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XUnmapEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
   PPCODE:
-    if (value) { c_value= SvIV(value); }
-    switch (event->type) {
-    case GenericEvent:
-      if (value) { event->xgeneric.extension = c_value; } else { c_value= event->xgeneric.extension; } break;
-    default: croak("Can't access XEvent.extension for type=%d", event->type);
+    if (value) {
+      event->xunmap.window= PerlXlib_sv_to_xid(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xunmap.window)));
     }
-    PUSHs(value? value : sv_2mortal(newSViv(c_value)));
+
+
+MODULE = X11::Xlib                PACKAGE = X11::Xlib::XVisibilityEvent
 
 void
-_first_keycode(event, value=NULL)
-  XEvent *event
+state(self, value=NULL)
+  SV *self
   SV *value
   INIT:
-    int c_value= 0;
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XVisibilityEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
   PPCODE:
-    if (value) { c_value= SvIV(value); }
-    switch (event->type) {
-    case MappingNotify:
-      if (value) { event->xmapping.first_keycode = c_value; } else { c_value= event->xmapping.first_keycode; } break;
-    default: croak("Can't access XEvent.first_keycode for type=%d", event->type);
+    if (value) {
+      event->xvisibility.state= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(event->xvisibility.state)));
     }
-    PUSHs(value? value : sv_2mortal(newSViv(c_value)));
 
 void
-_focus(event, value=NULL)
-  XEvent *event
+window(self, value=NULL)
+  SV *self
   SV *value
   INIT:
-    Bool c_value= 0;
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XVisibilityEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
   PPCODE:
-    if (value) { c_value= SvIV(value); }
-    switch (event->type) {
-    case EnterNotify:
-    case LeaveNotify:
-      if (value) { event->xcrossing.focus = c_value; } else { c_value= event->xcrossing.focus; } break;
-    default: croak("Can't access XEvent.focus for type=%d", event->type);
+    if (value) {
+      event->xvisibility.window= PerlXlib_sv_to_xid(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(event->xvisibility.window)));
     }
-    PUSHs(value? value : sv_2mortal(newSViv(c_value)));
+
+# END GENERATED X11_Xlib_XEvent
+# ----------------------------------------------------------------------------
+# BEGIN GENERATED X11_Xlib_XVisualInfo
+
+MODULE = X11::Xlib                PACKAGE = X11::Xlib::XVisualInfo
+
+int
+_sizeof(ignored=NULL)
+    SV* ignored;
+    CODE:
+        RETVAL = sizeof(XVisualInfo);
+    OUTPUT:
+        RETVAL
 
 void
-_format(event, value=NULL)
-  XEvent *event
-  SV *value
+_initialize(s)
+    SV *s
+    INIT:
+        void *sptr;
+    PPCODE:
+        sptr= PerlXlib_get_struct_ptr(s, 1, "X11::Xlib::XVisualInfo", sizeof(XVisualInfo),
+            (PerlXlib_struct_pack_fn*) &PerlXlib_XVisualInfo_pack
+        );
+        memset((void*) sptr, 0, sizeof(XVisualInfo));
+
+void
+_pack(s, fields, consume=0)
+    XVisualInfo *s
+    HV *fields
+    Bool consume
+    PPCODE:
+        PerlXlib_XVisualInfo_pack(s, fields, consume);
+
+void
+_unpack(s, fields)
+    XVisualInfo *s
+    HV *fields
+    PPCODE:
+        PerlXlib_XVisualInfo_unpack_obj(s, fields, ST(0));
+
+void
+get(self, ...)
+    SV *self
+  ALIAS:
+    get_list = 1
+  INIT:
+    XVisualInfo *s= ( XVisualInfo * ) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XVisualInfo", sizeof(XVisualInfo),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XVisualInfo_pack);
+    const PerlXlib_struct_fields *f= &PerlXlib_XVisualInfo_fields;
+    SV **names;
+    const char *name;
+    STRLEN len;
+    int i, idx, n= items - 1;
+  PPCODE:
+    if (ix == 1 && n == 0) {
+      EXTEND(SP, f->count * 2);
+      for (i= 0; i < f->count; i++) {
+        PUSHs(sv_2mortal(newSVpv(f->names[i], 0)));
+        PUSHs(sv_2mortal(f->get_field(s, i, self)));
+      }
+    }
+    else if (n > 0) {
+      /* results overwrite the argument list, so save the names first */
+      Newx(names, n, SV*);
+      SAVEFREEPV(names);
+      Copy(&ST(1), names, n, SV*);
+      EXTEND(SP, ix? n * 2 : n);
+      for (i= 0; i < n; i++) {
+        name= SvPV(names[i], len);
+        if ((idx= PerlXlib_struct_field_index(f, name, len)) < 0)
+          croak("No field '%s' in X11::Xlib::XVisualInfo", name);
+        if (ix) PUSHs(names[i]);
+        PUSHs(sv_2mortal(f->get_field(s, idx, self)));
+      }
+    }
+
+void
+set(self, ...)
+    SV *self
   INIT:
-    int c_value= 0;
+    XVisualInfo *s= ( XVisualInfo * ) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XVisualInfo", sizeof(XVisualInfo),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XVisualInfo_pack);
+    const PerlXlib_struct_fields *f= &PerlXlib_XVisualInfo_fields;
+    const char *name;
+    STRLEN len;
+    int i, idx;
   PPCODE:
-    if (value) { c_value= SvIV(value); }
-    switch (event->type) {
-    case ClientMessage:
-      if (value) { event->xclient.format = c_value; } else { c_value= event->xclient.format; } break;
-    default: croak("Can't access XEvent.format for type=%d", event->type);
+    if (!(items & 1)) croak("Odd number of arguments to set()");
+    for (i= 1; i < items; i+= 2) {
+      name= SvPV(ST(i), len);
+      if ((idx= PerlXlib_struct_field_index(f, name, len)) < 0)
+        croak("No field '%s' in X11::Xlib::XVisualInfo", name);
+      f->set_field(s, idx, ST(i+1));
     }
-    PUSHs(value? value : sv_2mortal(newSViv(c_value)));
+    PUSHs(self);
 
 void
-_from_configure(event, value=NULL)
-  XEvent *event
-  SV *value
+bits_per_rgb(self, value=NULL)
+    XVisualInfo *self
+    SV *value
   INIT:
-    Bool c_value= 0;
+    XVisualInfo *s= self;
   PPCODE:
-    if (value) { c_value= SvIV(value); }
-    switch (event->type) {
-    case UnmapNotify:
-      if (value) { event->xunmap.from_configure = c_value; } else { c_value= event->xunmap.from_configure; } break;
-    default: croak("Can't access XEvent.from_configure for type=%d", event->type);
+    if (value) {
+      s->bits_per_rgb= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(s->bits_per_rgb)));
     }
-    PUSHs(value? value : sv_2mortal(newSViv(c_value)));
 
 void
-_height(event, value=NULL)
-  XEvent *event
-  SV *value
+blue_mask(self, value=NULL)
+    XVisualInfo *self
+    SV *value
   INIT:
-    int c_value= 0;
+    XVisualInfo *s= self;
   PPCODE:
-    if (value) { c_value= SvIV(value); }
-    switch (event->type) {
-    case ConfigureNotify:
-      if (value) { event->xconfigure.height = c_value; } else { c_value= event->xconfigure.height; } break;
-    case ConfigureRequest:
-      if (value) { event->xconfigurerequest.height = c_value; } else { c_value= event->xconfigurerequest.height; } break;
-    case CreateNotify:
-      if (value) { event->xcreatewindow.height = c_value; } else { c_value= event->xcreatewindow.height; } break;
-    case Expose:
-      if (value) { event->xexpose.height = c_value; } else { c_value= event->xexpose.height; } break;
-    case GraphicsExpose:
-      if (value) { event->xgraphicsexpose.height = c_value; } else { c_value= event->xgraphicsexpose.height; } break;
-    case ResizeRequest:
-      if (value) { event->xresizerequest.height = c_value; } else { c_value= event->xresizerequest.height; } break;
-    default: croak("Can't access XEvent.height for type=%d", event->type);
+    if (value) {
+      s->blue_mask= SvUV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(s->blue_mask)));
+    }
+
+void
+class(self, value=NULL)
+    XVisualInfo *self
+    SV *value
+  INIT:
+    XVisualInfo *s= self;
+  PPCODE:
+    if (value) {
+      s->class= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(s->class)));
     }
-    PUSHs(value? value : sv_2mortal(newSViv(c_value)));
 
 void
-_is_hint(event, value=NULL)
-  XEvent *event
-  SV *value
+colormap_size(self, value=NULL)
+    XVisualInfo *self
+    SV *value
   INIT:
-    char c_value= 0;
+    XVisualInfo *s= self;
   PPCODE:
-    if (value) { c_value= SvIV(value); }
-    switch (event->type) {
-    case MotionNotify:
-      if (value) { event->xmotion.is_hint = c_value; } else { c_value= event->xmotion.is_hint; } break;
-    default: croak("Can't access XEvent.is_hint for type=%d", event->type);
+    if (value) {
+      s->colormap_size= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(s->colormap_size)));
     }
-    PUSHs(value? value : sv_2mortal(newSViv(c_value)));
 
 void
-_key_vector(event, value=NULL)
-  XEvent *event
-  SV *value
+depth(self, value=NULL)
+    XVisualInfo *self
+    SV *value
+  INIT:
+    XVisualInfo *s= self;
   PPCODE:
-    switch (event->type) {
-    case KeymapNotify:
-      if (value) { { if (!SvPOK(value) || SvCUR(value) != sizeof(char)*32)  croak("Expected scalar of length %ld but got %ld", (long)(sizeof(char)*32), (long) SvCUR(value)); memcpy(event->xkeymap.key_vector, SvPVX(value), sizeof(char)*32);} } else { PUSHs(sv_2mortal(newSVpvn((void*)event->xkeymap.key_vector, sizeof(char)*32))); } break;
-    default: croak("Can't access XEvent.key_vector for type=%d", event->type);
+    if (value) {
+      s->depth= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(s->depth)));
     }
 
 void
-_keycode(event, value=NULL)
-  XEvent *event
-  SV *value
+green_mask(self, value=NULL)
+    XVisualInfo *self
+    SV *value
   INIT:
-    unsigned int c_value= 0;
+    XVisualInfo *s= self;
   PPCODE:
-    if (value) { c_value= SvUV(value); }
-    switch (event->type) {
-    case KeyPress:
-    case KeyRelease:
-      if (value) { event->xkey.keycode = c_value; } else { c_value= event->xkey.keycode; } break;
-    default: croak("Can't access XEvent.keycode for type=%d", event->type);
+    if (value) {
+      s->green_mask= SvUV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(s->green_mask)));
     }
-    PUSHs(value? value : sv_2mortal(newSVuv(c_value)));
 
 void
-_l(event, value=NULL)
-  XEvent *event
-  SV *value
+red_mask(self, value=NULL)
+    XVisualInfo *self
+    SV *value
+  INIT:
+    XVisualInfo *s= self;
   PPCODE:
-    switch (event->type) {
-    case ClientMessage:
-      if (value) { { if (!SvPOK(value) || SvCUR(value) != sizeof(long)*5)  croak("Expected scalar of length %ld but got %ld", (long)(sizeof(long)*5), (long) SvCUR(value)); memcpy(event->xclient.data.l, SvPVX(value), sizeof(long)*5);} } else { PUSHs(sv_2mortal(newSVpvn((void*)event->xclient.data.l, sizeof(long)*5))); } break;
-    default: croak("Can't access XEvent.l for type=%d", event->type);
+    if (value) {
+      s->red_mask= SvUV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(s->red_mask)));
     }
 
 void
-_major_code(event, value=NULL)
-  XEvent *event
-  SV *value
+screen(self, value=NULL)
+    XVisualInfo *self
+    SV *value
   INIT:
-    int c_value= 0;
+    XVisualInfo *s= self;
   PPCODE:
-    if (value) { c_value= SvIV(value); }
-    switch (event->type) {
-    case GraphicsExpose:
-      if (value) { event->xgraphicsexpose.major_code = c_value; } else { c_value= event->xgraphicsexpose.major_code; } break;
-    case NoExpose:
-      if (value) { event->xnoexpose.major_code = c_value; } else { c_value= event->xnoexpose.major_code; } break;
-    default: croak("Can't access XEvent.major_code for type=%d", event->type);
+    if (value) {
+      s->screen= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(s->screen)));
     }
-    PUSHs(value? value : sv_2mortal(newSViv(c_value)));
 
 void
-_message_type(event, value=NULL)
-  XEvent *event
-  SV *value
+visual(self, value=NULL)
+    SV *self
+    SV *value
   INIT:
-    Atom c_value= 0;
+    XVisualInfo *s= ( XVisualInfo * ) PerlXlib_get_struct_ptr(
+           self, 0, "X11::Xlib::XVisualInfo", sizeof(XVisualInfo),
+           (PerlXlib_struct_pack_fn*) &PerlXlib_XVisualInfo_pack
+         );
+         SV *dpy_sv= PerlXlib_objref_get_display(self);
+         Display *dpy= PerlXlib_display_objref_get_pointer(dpy_sv, PerlXlib_OR_NULL);
   PPCODE:
-    if (value) { c_value= PerlXlib_sv_to_xid(value); }
-    switch (event->type) {
-    case ClientMessage:
-      if (value) { event->xclient.message_type = c_value; } else { c_value= event->xclient.message_type; } break;
-    default: croak("Can't access XEvent.message_type for type=%d", event->type);
+    if (value) {
+      s->visual= (Visual *) PerlXlib_objref_get_pointer(value, "Visual", PerlXlib_OR_NULL);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_mortalcopy(PerlXlib_get_objref(s->visual, PerlXlib_AUTOCREATE, "Visual", SVt_PVMG, "X11::Xlib::Visual", dpy)));
     }
-    PUSHs(value? value : sv_2mortal(newSVuv(c_value)));
 
 void
-_minor_code(event, value=NULL)
-  XEvent *event
-  SV *value
+visualid(self, value=NULL)
+    XVisualInfo *self
+    SV *value
+  INIT:
+    XVisualInfo *s= self;
   PPCODE:
-    switch (event->type) {
-    case 0:
-      if (value) { event->xerror.minor_code= SvUV(value); } else { PUSHs(sv_2mortal(newSVuv(event->xerror.minor_code))); } break;
-    case GraphicsExpose:
-      if (value) { event->xgraphicsexpose.minor_code= SvIV(value); } else { PUSHs(sv_2mortal(newSViv(event->xgraphicsexpose.minor_code))); } break;
-    case NoExpose:
-      if (value) { event->xnoexpose.minor_code= SvIV(value); } else { PUSHs(sv_2mortal(newSViv(event->xnoexpose.minor_code))); } break;
-    default: croak("Can't access XEvent.minor_code for type=%d", event->type);
+    if (value) {
+      s->visualid= SvUV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(s->visualid)));
     }
 
+# END GENERATED X11_Xlib_XVisualInfo
+# ----------------------------------------------------------------------------
+# BEGIN GENERATED X11_Xlib_XWindowChanges
+
+MODULE = X11::Xlib                PACKAGE = X11::Xlib::XWindowChanges
+
+int
+_sizeof(ignored=NULL)
+    SV* ignored;
+    CODE:
+        RETVAL = sizeof(XWindowChanges);
+    OUTPUT:
+        RETVAL
+
 void
-_mode(event, value=NULL)
-  XEvent *event
-  SV *value
+_initialize(s)
+    SV *s
+    INIT:
+        void *sptr;
+    PPCODE:
+        sptr= PerlXlib_get_struct_ptr(s, 1, "X11::Xlib::XWindowChanges", sizeof(XWindowChanges),
+            (PerlXlib_struct_pack_fn*) &PerlXlib_XWindowChanges_pack
+        );
+        memset((void*) sptr, 0, sizeof(XWindowChanges));
+
+void
+_pack(s, fields, consume=0)
+    XWindowChanges *s
+    HV *fields
+    Bool consume
+    PPCODE:
+        PerlXlib_XWindowChanges_pack(s, fields, consume);
+
+void
+_unpack(s, fields)
+    XWindowChanges *s
+    HV *fields
+    PPCODE:
+        PerlXlib_XWindowChanges_unpack_obj(s, fields, ST(0));
+
+void
+get(self, ...)
+    SV *self
+  ALIAS:
+    get_list = 1
+  INIT:
+    XWindowChanges *s= ( XWindowChanges * ) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XWindowChanges", sizeof(XWindowChanges),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XWindowChanges_pack);
+    const PerlXlib_struct_fields *f= &PerlXlib_XWindowChanges_fields;
+    SV **names;
+    const char *name;
+    STRLEN len;
+    int i, idx, n= items - 1;
+  PPCODE:
+    if (ix == 1 && n == 0) {
+      EXTEND(SP, f->count * 2);
+      for (i= 0; i < f->count; i++) {
+        PUSHs(sv_2mortal(newSVpv(f->names[i], 0)));
+        PUSHs(sv_2mortal(f->get_field(s, i, self)));
+      }
+    }
+    else if (n > 0) {
+      /* results overwrite the argument list, so save the names first */
+      Newx(names, n, SV*);
+      SAVEFREEPV(names);
+      Copy(&ST(1), names, n, SV*);
+      EXTEND(SP, ix? n * 2 : n);
+      for (i= 0; i < n; i++) {
+        name= SvPV(names[i], len);
+        if ((idx= PerlXlib_struct_field_index(f, name, len)) < 0)
+          croak("No field '%s' in X11::Xlib::XWindowChanges", name);
+        if (ix) PUSHs(names[i]);
+        PUSHs(sv_2mortal(f->get_field(s, idx, self)));
+      }
+    }
+
+void
+set(self, ...)
+    SV *self
   INIT:
-    int c_value= 0;
+    XWindowChanges *s= ( XWindowChanges * ) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XWindowChanges", sizeof(XWindowChanges),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XWindowChanges_pack);
+    const PerlXlib_struct_fields *f= &PerlXlib_XWindowChanges_fields;
+    const char *name;
+    STRLEN len;
+    int i, idx;
   PPCODE:
-    if (value) { c_value= SvIV(value); }
-    switch (event->type) {
-    case EnterNotify:
-    case LeaveNotify:
-      if (value) { event->xcrossing.mode = c_value; } else { c_value= event->xcrossing.mode; } break;
-    case FocusIn:
-    case FocusOut:
-      if (value) { event->xfocus.mode = c_value; } else { c_value= event->xfocus.mode; } break;
-    default: croak("Can't access XEvent.mode for type=%d", event->type);
+    if (!(items & 1)) croak("Odd number of arguments to set()");
+    for (i= 1; i < items; i+= 2) {
+      name= SvPV(ST(i), len);
+      if ((idx= PerlXlib_struct_field_index(f, name, len)) < 0)
+        croak("No field '%s' in X11::Xlib::XWindowChanges", name);
+      f->set_field(s, idx, ST(i+1));
     }
-    PUSHs(value? value : sv_2mortal(newSViv(c_value)));
+    PUSHs(self);
 
 void
-_new(event, value=NULL)
-  XEvent *event
-  SV *value
+border_width(self, value=NULL)
+    XWindowChanges *self
+    SV *value
   INIT:
-    Bool c_value= 0;
+    XWindowChanges *s= self;
   PPCODE:
-    if (value) { c_value= SvIV(value); }
-    switch (event->type) {
-    case ColormapNotify:
-      if (value) { event->xcolormap.new = c_value; } else { c_value= event->xcolormap.new; } break;
-    default: croak("Can't access XEvent.new for type=%d", event->type);
+    if (value) {
+      s->border_width= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(s->border_width)));
     }
-    PUSHs(value? value : sv_2mortal(newSViv(c_value)));
 
 void
-_override_redirect(event, value=NULL)
-  XEvent *event
-  SV *value
+height(self, value=NULL)
+    XWindowChanges *self
+    SV *value
   INIT:
-    Bool c_value= 0;
+    XWindowChanges *s= self;
   PPCODE:
-    if (value) { c_value= SvIV(value); }
-    switch (event->type) {
-    case ConfigureNotify:
-      if (value) { event->xconfigure.override_redirect = c_value; } else { c_value= event->xconfigure.override_redirect; } break;
-    case CreateNotify:
-      if (value) { event->xcreatewindow.override_redirect = c_value; } else { c_value= event->xcreatewindow.override_redirect; } break;
-    case MapNotify:
-      if (value) { event->xmap.override_redirect = c_value; } else { c_value= event->xmap.override_redirect; } break;
-    case ReparentNotify:
-      if (value) { event->xreparent.override_redirect = c_value; } else { c_value= event->xreparent.override_redirect; } break;
-    default: croak("Can't access XEvent.override_redirect for type=%d", event->type);
+    if (value) {
+      s->height= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(s->height)));
+    }
+
+void
+sibling(self, value=NULL)
+    XWindowChanges *self
+    SV *value
+  INIT:
+    XWindowChanges *s= self;
+  PPCODE:
+    if (value) {
+      s->sibling= PerlXlib_sv_to_xid(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(s->sibling)));
     }
-    PUSHs(value? value : sv_2mortal(newSViv(c_value)));
 
 void
-_owner(event, value=NULL)
-  XEvent *event
-  SV *value
+stack_mode(self, value=NULL)
+    XWindowChanges *self
+    SV *value
   INIT:
-    Window c_value= 0;
+    XWindowChanges *s= self;
   PPCODE:
-    if (value) { c_value= PerlXlib_sv_to_xid(value); }
-    switch (event->type) {
-    case SelectionRequest:
-      if (value) { event->xselectionrequest.owner = c_value; } else { c_value= event->xselectionrequest.owner; } break;
-    default: croak("Can't access XEvent.owner for type=%d", event->type);
+    if (value) {
+      s->stack_mode= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(s->stack_mode)));
     }
-    PUSHs(value? value : sv_2mortal(newSVuv(c_value)));
 
 void
-_pad(event, value=NULL)
-  XEvent *event
-  SV *value
+width(self, value=NULL)
+    XWindowChanges *self
+    SV *value
+  INIT:
+    XWindowChanges *s= self;
   PPCODE:
-    switch (event->type) {
-    default: croak("Can't access XEvent.pad for type=%d", event->type);
+    if (value) {
+      s->width= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(s->width)));
     }
 
 void
-_parent(event, value=NULL)
-  XEvent *event
-  SV *value
+x(self, value=NULL)
+    XWindowChanges *self
+    SV *value
   INIT:
-    Window c_value= 0;
+    XWindowChanges *s= self;
   PPCODE:
-    if (value) { c_value= PerlXlib_sv_to_xid(value); }
-    switch (event->type) {
-    case CirculateRequest:
-      if (value) { event->xcirculaterequest.parent = c_value; } else { c_value= event->xcirculaterequest.parent; } break;
-    case ConfigureRequest:
-      if (value) { event->xconfigurerequest.parent = c_value; } else { c_value= event->xconfigurerequest.parent; } break;
-    case CreateNotify:
-      if (value) { event->xcreatewindow.parent = c_value; } else { c_value= event->xcreatewindow.parent; } break;
-    case MapRequest:
-      if (value) { event->xmaprequest.parent = c_value; } else { c_value= event->xmaprequest.parent; } break;
-    case ReparentNotify:
-      if (value) { event->xreparent.parent = c_value; } else { c_value= event->xreparent.parent; } break;
-    default: croak("Can't access XEvent.parent for type=%d", event->type);
+    if (value) {
+      s->x= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(s->x)));
     }
-    PUSHs(value? value : sv_2mortal(newSVuv(c_value)));
 
 void
-_place(event, value=NULL)
-  XEvent *event
-  SV *value
+y(self, value=NULL)
+    XWindowChanges *self
+    SV *value
   INIT:
-    int c_value= 0;
+    XWindowChanges *s= self;
   PPCODE:
-    if (value) { c_value= SvIV(value); }
-    switch (event->type) {
-    case CirculateNotify:
-      if (value) { event->xcirculate.place = c_value; } else { c_value= event->xcirculate.place; } break;
-    case CirculateRequest:
-      if (value) { event->xcirculaterequest.place = c_value; } else { c_value= event->xcirculaterequest.place; } break;
-    default: croak("Can't access XEvent.place for type=%d", event->type);
+    if (value) {
+      s->y= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(s->y)));
     }
-    PUSHs(value? value : sv_2mortal(newSViv(c_value)));
+
+# END GENERATED X11_Xlib_XWindowChanges
+# ----------------------------------------------------------------------------
+# BEGIN GENERATED X11_Xlib_XWindowAttributes
+
+MODULE = X11::Xlib                PACKAGE = X11::Xlib::XWindowAttributes
+
+int
+_sizeof(ignored=NULL)
+    SV* ignored;
+    CODE:
+        RETVAL = sizeof(XWindowAttributes);
+    OUTPUT:
+        RETVAL
 
 void
-_property(event, value=NULL)
-  XEvent *event
-  SV *value
+_initialize(s)
+    SV *s
+    INIT:
+        void *sptr;
+    PPCODE:
+        sptr= PerlXlib_get_struct_ptr(s, 1, "X11::Xlib::XWindowAttributes", sizeof(XWindowAttributes),
+            (PerlXlib_struct_pack_fn*) &PerlXlib_XWindowAttributes_pack
+        );
+        memset((void*) sptr, 0, sizeof(XWindowAttributes));
+
+void
+_pack(s, fields, consume=0)
+    XWindowAttributes *s
+    HV *fields
+    Bool consume
+    PPCODE:
+        PerlXlib_XWindowAttributes_pack(s, fields, consume);
+
+void
+_unpack(s, fields)
+    XWindowAttributes *s
+    HV *fields
+    PPCODE:
+        PerlXlib_XWindowAttributes_unpack_obj(s, fields, ST(0));
+
+void
+get(self, ...)
+    SV *self
+  ALIAS:
+    get_list = 1
+  INIT:
+    XWindowAttributes *s= ( XWindowAttributes * ) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XWindowAttributes", sizeof(XWindowAttributes),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XWindowAttributes_pack);
+    const PerlXlib_struct_fields *f= &PerlXlib_XWindowAttributes_fields;
+    SV **names;
+    const char *name;
+    STRLEN len;
+    int i, idx, n= items - 1;
+  PPCODE:
+    if (ix == 1 && n == 0) {
+      EXTEND(SP, f->count * 2);
+      for (i= 0; i < f->count; i++) {
+        PUSHs(sv_2mortal(newSVpv(f->names[i], 0)));
+        PUSHs(sv_2mortal(f->get_field(s, i, self)));
+      }
+    }
+    else if (n > 0) {
+      /* results overwrite the argument list, so save the names first */
+      Newx(names, n, SV*);
+      SAVEFREEPV(names);
+      Copy(&ST(1), names, n, SV*);
+      EXTEND(SP, ix? n * 2 : n);
+      for (i= 0; i < n; i++) {
+        name= SvPV(names[i], len);
+        if ((idx= PerlXlib_struct_field_index(f, name, len)) < 0)
+          croak("No field '%s' in X11::Xlib::XWindowAttributes", name);
+        if (ix) PUSHs(names[i]);
+        PUSHs(sv_2mortal(f->get_field(s, idx, self)));
+      }
+    }
+
+void
+set(self, ...)
+    SV *self
   INIT:
-    Atom c_value= 0;
+    XWindowAttributes *s= ( XWindowAttributes * ) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XWindowAttributes", sizeof(XWindowAttributes),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XWindowAttributes_pack);
+    const PerlXlib_struct_fields *f= &PerlXlib_XWindowAttributes_fields;
+    const char *name;
+    STRLEN len;
+    int i, idx;
   PPCODE:
-    if (value) { c_value= PerlXlib_sv_to_xid(value); }
-    switch (event->type) {
-    case SelectionNotify:
-      if (value) { event->xselection.property = c_value; } else { c_value= event->xselection.property; } break;
-    case SelectionRequest:
-      if (value) { event->xselectionrequest.property = c_value; } else { c_value= event->xselectionrequest.property; } break;
-    default: croak("Can't access XEvent.property for type=%d", event->type);
+    if (!(items & 1)) croak("Odd number of arguments to set()");
+    for (i= 1; i < items; i+= 2) {
+      name= SvPV(ST(i), len);
+      if ((idx= PerlXlib_struct_field_index(f, name, len)) < 0)
+        croak("No field '%s' in X11::Xlib::XWindowAttributes", name);
+      f->set_field(s, idx, ST(i+1));
     }
-    PUSHs(value? value : sv_2mortal(newSVuv(c_value)));
+    PUSHs(self);
 
 void
-_request(event, value=NULL)
-  XEvent *event
-  SV *value
+all_event_masks(self, value=NULL)
+    XWindowAttributes *self
+    SV *value
   INIT:
-    int c_value= 0;
+    XWindowAttributes *s= self;
   PPCODE:
-    if (value) { c_value= SvIV(value); }
-    switch (event->type) {
-    case MappingNotify:
-      if (value) { event->xmapping.request = c_value; } else { c_value= event->xmapping.request; } break;
-    default: croak("Can't access XEvent.request for type=%d", event->type);
+    if (value) {
+      s->all_event_masks= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(s->all_event_masks)));
     }
-    PUSHs(value? value : sv_2mortal(newSViv(c_value)));
 
 void
-_request_code(event, value=NULL)
-  XEvent *event
-  SV *value
+backing_pixel(self, value=NULL)
+    XWindowAttributes *self
+    SV *value
   INIT:
-    unsigned char c_value= 0;
+    XWindowAttributes *s= self;
   PPCODE:
-    if (value) { c_value= SvUV(value); }
-    switch (event->type) {
-    case 0:
-      if (value) { event->xerror.request_code = c_value; } else { c_value= event->xerror.request_code; } break;
-    default: croak("Can't access XEvent.request_code for type=%d", event->type);
+    if (value) {
+      s->backing_pixel= SvUV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(s->backing_pixel)));
     }
-    PUSHs(value? value : sv_2mortal(newSVuv(c_value)));
 
 void
-_requestor(event, value=NULL)
-  XEvent *event
-  SV *value
+backing_planes(self, value=NULL)
+    XWindowAttributes *self
+    SV *value
   INIT:
-    Window c_value= 0;
+    XWindowAttributes *s= self;
   PPCODE:
-    if (value) { c_value= PerlXlib_sv_to_xid(value); }
-    switch (event->type) {
-    case SelectionNotify:
-      if (value) { event->xselection.requestor = c_value; } else { c_value= event->xselection.requestor; } break;
-    case SelectionRequest:
-      if (value) { event->xselectionrequest.requestor = c_value; } else { c_value= event->xselectionrequest.requestor; } break;
-    default: croak("Can't access XEvent.requestor for type=%d", event->type);
+    if (value) {
+      s->backing_planes= SvUV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(s->backing_planes)));
     }
-    PUSHs(value? value : sv_2mortal(newSVuv(c_value)));
 
 void
-_resourceid(event, value=NULL)
-  XEvent *event
-  SV *value
+backing_store(self, value=NULL)
+    XWindowAttributes *self
+    SV *value
   INIT:
-    XID c_value= 0;
+    XWindowAttributes *s= self;
   PPCODE:
-    if (value) { c_value= PerlXlib_sv_to_xid(value); }
-    switch (event->type) {
-    case 0:
-      if (value) { event->xerror.resourceid = c_value; } else { c_value= event->xerror.resourceid; } break;
-    default: croak("Can't access XEvent.resourceid for type=%d", event->type);
+    if (value) {
+      s->backing_store= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(s->backing_store)));
     }
-    PUSHs(value? value : sv_2mortal(newSVuv(c_value)));
 
 void
-_root(event, value=NULL)
-  XEvent *event
-  SV *value
+bit_gravity(self, value=NULL)
+    XWindowAttributes *self
+    SV *value
   INIT:
-    Window c_value= 0;
+    XWindowAttributes *s= self;
   PPCODE:
-    if (value) { c_value= PerlXlib_sv_to_xid(value); }
-    switch (event->type) {
-    case ButtonPress:
-    case ButtonRelease:
-      if (value) { event->xbutton.root = c_value; } else { c_value= event->xbutton.root; } break;
-    case EnterNotify:
-    case LeaveNotify:
-      if (value) { event->xcrossing.root = c_value; } else { c_value= event->xcrossing.root; } break;
-    case KeyPress:
-    case KeyRelease:
-      if (value) { event->xkey.root = c_value; } else { c_value= event->xkey.root; } break;
-    case MotionNotify:
-      if (value) { event->xmotion.root = c_value; } else { c_value= event->xmotion.root; } break;
-    default: croak("Can't access XEvent.root for type=%d", event->type);
+    if (value) {
+      s->bit_gravity= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(s->bit_gravity)));
     }
-    PUSHs(value? value : sv_2mortal(newSVuv(c_value)));
 
 void
-_s(event, value=NULL)
-  XEvent *event
-  SV *value
+border_width(self, value=NULL)
+    XWindowAttributes *self
+    SV *value
+  INIT:
+    XWindowAttributes *s= self;
   PPCODE:
-    switch (event->type) {
-    case ClientMessage:
-      if (value) { { if (!SvPOK(value) || SvCUR(value) != sizeof(short)*10)  croak("Expected scalar of length %ld but got %ld", (long)(sizeof(short)*10), (long) SvCUR(value)); memcpy(event->xclient.data.s, SvPVX(value), sizeof(short)*10);} } else { PUSHs(sv_2mortal(newSVpvn((void*)event->xclient.data.s, sizeof(short)*10))); } break;
-    default: croak("Can't access XEvent.s for type=%d", event->type);
+    if (value) {
+      s->border_width= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(s->border_width)));
     }
 
 void
-_same_screen(event, value=NULL)
-  XEvent *event
-  SV *value
+class(self, value=NULL)
+    XWindowAttributes *self
+    SV *value
   INIT:
-    Bool c_value= 0;
+    XWindowAttributes *s= self;
   PPCODE:
-    if (value) { c_value= SvIV(value); }
-    switch (event->type) {
-    case ButtonPress:
-    case ButtonRelease:
-      if (value) { event->xbutton.same_screen = c_value; } else { c_value= event->xbutton.same_screen; } break;
-    case EnterNotify:
-    case LeaveNotify:
-      if (value) { event->xcrossing.same_screen = c_value; } else { c_value= event->xcrossing.same_screen; } break;
-    case KeyPress:
-    case KeyRelease:
-      if (value) { event->xkey.same_screen = c_value; } else { c_value= event->xkey.same_screen; } break;
-    case MotionNotify:
-      if (value) { event->xmotion.same_screen = c_value; } else { c_value= event->xmotion.same_screen; } break;
-    default: croak("Can't access XEvent.same_screen for type=%d", event->type);
+    if (value) {
+      s->class= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(s->class)));
     }
-    PUSHs(value? value : sv_2mortal(newSViv(c_value)));
 
 void
-_selection(event, value=NULL)
-  XEvent *event
-  SV *value
+colormap(self, value=NULL)
+    XWindowAttributes *self
+    SV *value
   INIT:
-    Atom c_value= 0;
+    XWindowAttributes *s= self;
   PPCODE:
-    if (value) { c_value= PerlXlib_sv_to_xid(value); }
-    switch (event->type) {
-    case SelectionNotify:
-      if (value) { event->xselection.selection = c_value; } else { c_value= event->xselection.selection; } break;
-    case SelectionClear:
-      if (value) { event->xselectionclear.selection = c_value; } else { c_value= event->xselectionclear.selection; } break;
-    case SelectionRequest:
-      if (value) { event->xselectionrequest.selection = c_value; } else { c_value= event->xselectionrequest.selection; } break;
-    default: croak("Can't access XEvent.selection for type=%d", event->type);
+    if (value) {
+      s->colormap= PerlXlib_sv_to_xid(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(s->colormap)));
     }
-    PUSHs(value? value : sv_2mortal(newSVuv(c_value)));
 
 void
-send_event(event, value=NULL)
-  XEvent *event
-  SV *value
+depth(self, value=NULL)
+    XWindowAttributes *self
+    SV *value
+  INIT:
+    XWindowAttributes *s= self;
   PPCODE:
-    if (!event->type) croak("Can't access XEvent.send_event for type=%d", event->type);
     if (value) {
-      event->xany.send_event= SvIV(value);
+      s->depth= SvIV(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSViv(event->xany.send_event)));
+      PUSHs(sv_2mortal(newSViv(s->depth)));
     }
 
 void
-serial(event, value=NULL)
-  XEvent *event
-  SV *value
+do_not_propagate_mask(self, value=NULL)
+    XWindowAttributes *self
+    SV *value
+  INIT:
+    XWindowAttributes *s= self;
   PPCODE:
     if (value) {
-      if (event->type) event->xany.serial= SvUV(value); else event->xerror.serial= SvUV(value);
+      s->do_not_propagate_mask= SvIV(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSVuv((event->type? event->xany.serial : event->xerror.serial))));
+      PUSHs(sv_2mortal(newSViv(s->do_not_propagate_mask)));
     }
 
 void
-_state(event, value=NULL)
-  XEvent *event
-  SV *value
+height(self, value=NULL)
+    XWindowAttributes *self
+    SV *value
+  INIT:
+    XWindowAttributes *s= self;
   PPCODE:
-    switch (event->type) {
-    case ButtonPress:
-    case ButtonRelease:
-      if (value) { event->xbutton.state= SvUV(value); } else { PUSHs(sv_2mortal(newSVuv(event->xbutton.state))); } break;
-    case ColormapNotify:
-      if (value) { event->xcolormap.state= SvIV(value); } else { PUSHs(sv_2mortal(newSViv(event->xcolormap.state))); } break;
-    case EnterNotify:
-    case LeaveNotify:
-      if (value) { event->xcrossing.state= SvUV(value); } else { PUSHs(sv_2mortal(newSVuv(event->xcrossing.state))); } break;
-    case KeyPress:
-    case KeyRelease:
-      if (value) { event->xkey.state= SvUV(value); } else { PUSHs(sv_2mortal(newSVuv(event->xkey.state))); } break;
-    case MotionNotify:
-      if (value) { event->xmotion.state= SvUV(value); } else { PUSHs(sv_2mortal(newSVuv(event->xmotion.state))); } break;
-    case PropertyNotify:
-      if (value) { event->xproperty.state= SvIV(value); } else { PUSHs(sv_2mortal(newSViv(event->xproperty.state))); } break;
-    case VisibilityNotify:
-      if (value) { event->xvisibility.state= SvIV(value); } else { PUSHs(sv_2mortal(newSViv(event->xvisibility.state))); } break;
-    default: croak("Can't access XEvent.state for type=%d", event->type);
+    if (value) {
+      s->height= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(s->height)));
     }
 
 void
-_subwindow(event, value=NULL)
-  XEvent *event
-  SV *value
+map_installed(self, value=NULL)
+    XWindowAttributes *self
+    SV *value
   INIT:
-    Window c_value= 0;
+    XWindowAttributes *s= self;
   PPCODE:
-    if (value) { c_value= PerlXlib_sv_to_xid(value); }
-    switch (event->type) {
-    case ButtonPress:
-    case ButtonRelease:
-      if (value) { event->xbutton.subwindow = c_value; } else { c_value= event->xbutton.subwindow; } break;
-    case EnterNotify:
-    case LeaveNotify:
-      if (value) { event->xcrossing.subwindow = c_value; } else { c_value= event->xcrossing.subwindow; } break;
-    case KeyPress:
-    case KeyRelease:
-      if (value) { event->xkey.subwindow = c_value; } else { c_value= event->xkey.subwindow; } break;
-    case MotionNotify:
-      if (value) { event->xmotion.subwindow = c_value; } else { c_value= event->xmotion.subwindow; } break;
-    default: croak("Can't access XEvent.subwindow for type=%d", event->type);
+    if (value) {
+      s->map_installed= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(s->map_installed)));
     }
-    PUSHs(value? value : sv_2mortal(newSVuv(c_value)));
 
 void
-_target(event, value=NULL)
-  XEvent *event
-  SV *value
+map_state(self, value=NULL)
+    XWindowAttributes *self
+    SV *value
   INIT:
-    Atom c_value= 0;
+    XWindowAttributes *s= self;
   PPCODE:
-    if (value) { c_value= PerlXlib_sv_to_xid(value); }
-    switch (event->type) {
-    case SelectionNotify:
-      if (value) { event->xselection.target = c_value; } else { c_value= event->xselection.target; } break;
-    case SelectionRequest:
-      if (value) { event->xselectionrequest.target = c_value; } else { c_value= event->xselectionrequest.target; } break;
-    default: croak("Can't access XEvent.target for type=%d", event->type);
+    if (value) {
+      s->map_state= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(s->map_state)));
     }
-    PUSHs(value? value : sv_2mortal(newSVuv(c_value)));
 
 void
-_time(event, value=NULL)
-  XEvent *event
-  SV *value
+override_redirect(self, value=NULL)
+    XWindowAttributes *self
+    SV *value
   INIT:
-    Time c_value= 0;
+    XWindowAttributes *s= self;
   PPCODE:
-    if (value) { c_value= SvUV(value); }
-    switch (event->type) {
-    case ButtonPress:
-    case ButtonRelease:
-      if (value) { event->xbutton.time = c_value; } else { c_value= event->xbutton.time; } break;
-    case EnterNotify:
-    case LeaveNotify:
-      if (value) { event->xcrossing.time = c_value; } else { c_value= event->xcrossing.time; } break;
-    case KeyPress:
-    case KeyRelease:
-      if (value) { event->xkey.time = c_value; } else { c_value= event->xkey.time; } break;
-    case MotionNotify:
-      if (value) { event->xmotion.time = c_value; } else { c_value= event->xmotion.time; } break;
-    case PropertyNotify:
-      if (value) { event->xproperty.time = c_value; } else { c_value= event->xproperty.time; } break;
-    case SelectionNotify:
-      if (value) { event->xselection.time = c_value; } else { c_value= event->xselection.time; } break;
-    case SelectionClear:
-      if (value) { event->xselectionclear.time = c_value; } else { c_value= event->xselectionclear.time; } break;
-    case SelectionRequest:
-      if (value) { event->xselectionrequest.time = c_value; } else { c_value= event->xselectionrequest.time; } break;
-    default: croak("Can't access XEvent.time for type=%d", event->type);
+    if (value) {
+      s->override_redirect= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(s->override_redirect)));
     }
-    PUSHs(value? value : sv_2mortal(newSVuv(c_value)));
 
 void
-type(event, value=NULL)
-  XEvent *event
-  SV *value
+root(self, value=NULL)
+    XWindowAttributes *self
+    SV *value
   INIT:
-    const char *oldpkg, *newpkg;
+    XWindowAttributes *s= self;
   PPCODE:
     if (value) {
-      if (event->type != SvIV(value)) {
-        oldpkg= PerlXlib_xevent_pkg_for_type(event->type);
-        event->type= SvIV(value);
-        newpkg= PerlXlib_xevent_pkg_for_type(event->type);
-        if (oldpkg != newpkg) {
-          /* re-initialize all fields in the area that changed */
-          memset( ((char*)(void*)event) + sizeof(XAnyEvent), 0, sizeof(XEvent)-sizeof(XAnyEvent) );
-          /* re-bless the object if the thing passed to us was actually an object */
-          if (sv_derived_from(ST(0), "X11::Xlib::XEvent"))
-            sv_bless(ST(0), gv_stashpv(newpkg, GV_ADD));
-        }
-      }
+      s->root= PerlXlib_sv_to_xid(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVuv(s->root)));
     }
-    PUSHs(sv_2mortal(newSViv(event->type)));
 
 void
-_value_mask(event, value=NULL)
-  XEvent *event
-  SV *value
+save_under(self, value=NULL)
+    XWindowAttributes *self
+    SV *value
+  INIT:
+    XWindowAttributes *s= self;
+  PPCODE:
+    if (value) {
+      s->save_under= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(s->save_under)));
+    }
+
+void
+screen(self, value=NULL)
+    XWindowAttributes *self
+    SV *value
   INIT:
-    unsigned long c_value= 0;
+    XWindowAttributes *s= self;
   PPCODE:
-    if (value) { c_value= SvUV(value); }
-    switch (event->type) {
-    case ConfigureRequest:
-      if (value) { event->xconfigurerequest.value_mask = c_value; } else { c_value= event->xconfigurerequest.value_mask; } break;
-    default: croak("Can't access XEvent.value_mask for type=%d", event->type);
+    if (value) {
+      s->screen= PerlXlib_screen_objref_get_pointer(value, PerlXlib_OR_NULL);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSVsv(PerlXlib_get_screen_objref(s->screen, PerlXlib_OR_UNDEF))));
     }
-    PUSHs(value? value : sv_2mortal(newSVuv(c_value)));
 
 void
-_width(event, value=NULL)
-  XEvent *event
-  SV *value
+visual(self, value=NULL)
+    SV *self
+    SV *value
   INIT:
-    int c_value= 0;
+    XWindowAttributes *s= ( XWindowAttributes * ) PerlXlib_get_struct_ptr(
+           self, 0, "X11::Xlib::XWindowAttributes", sizeof(XWindowAttributes),
+           (PerlXlib_struct_pack_fn*) &PerlXlib_XWindowAttributes_pack
+         );
+         SV *dpy_sv= PerlXlib_objref_get_display(self);
+         Display *dpy= PerlXlib_display_objref_get_pointer(dpy_sv, PerlXlib_OR_NULL);
   PPCODE:
-    if (value) { c_value= SvIV(value); }
-    switch (event->type) {
-    case ConfigureNotify:
-      if (value) { event->xconfigure.width = c_value; } else { c_value= event->xconfigure.width; } break;
-    case ConfigureRequest:
-      if (value) { event->xconfigurerequest.width = c_value; } else { c_value= event->xconfigurerequest.width; } break;
-    case CreateNotify:
-      if (value) { event->xcreatewindow.width = c_value; } else { c_value= event->xcreatewindow.width; } break;
-    case Expose:
-      if (value) { event->xexpose.width = c_value; } else { c_value= event->xexpose.width; } break;
-    case GraphicsExpose:
-      if (value) { event->xgraphicsexpose.width = c_value; } else { c_value= event->xgraphicsexpose.width; } break;
-    case ResizeRequest:
-      if (value) { event->xresizerequest.width = c_value; } else { c_value= event->xresizerequest.width; } break;
-    default: croak("Can't access XEvent.width for type=%d", event->type);
+    if (value) {
+      s->visual= (Visual *) PerlXlib_objref_get_pointer(value, "Visual", PerlXlib_OR_NULL);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_mortalcopy(PerlXlib_get_objref(s->visual, PerlXlib_AUTOCREATE, "Visual", SVt_PVMG, "X11::Xlib::Visual", dpy)));
     }
-    PUSHs(value? value : sv_2mortal(newSViv(c_value)));
 
 void
-_window(event, value=NULL)
-  XEvent *event
-  SV *value
+width(self, value=NULL)
+    XWindowAttributes *self
+    SV *value
   INIT:
-    Window c_value= 0;
+    XWindowAttributes *s= self;
   PPCODE:
-    if (value) { c_value= PerlXlib_sv_to_xid(value); }
-    switch (event->type) {
-    case ButtonPress:
-    case ButtonRelease:
-      if (value) { event->xbutton.window = c_value; } else { c_value= event->xbutton.window; } break;
-    case CirculateNotify:
-      if (value) { event->xcirculate.window = c_value; } else { c_value= event->xcirculate.window; } break;
-    case CirculateRequest:
-      if (value) { event->xcirculaterequest.window = c_value; } else { c_value= event->xcirculaterequest.window; } break;
-    case ClientMessage:
-      if (value) { event->xclient.window = c_value; } else { c_value= event->xclient.window; } break;
-    case ColormapNotify:
-      if (value) { event->xcolormap.window = c_value; } else { c_value= event->xcolormap.window; } break;
-    case ConfigureNotify:
-      if (value) { event->xconfigure.window = c_value; } else { c_value= event->xconfigure.window; } break;
-    case ConfigureRequest:
-      if (value) { event->xconfigurerequest.window = c_value; } else { c_value= event->xconfigurerequest.window; } break;
-    case CreateNotify:
-      if (value) { event->xcreatewindow.window = c_value; } else { c_value= event->xcreatewindow.window; } break;
-    case EnterNotify:
-    case LeaveNotify:
-      if (value) { event->xcrossing.window = c_value; } else { c_value= event->xcrossing.window; } break;
-    case DestroyNotify:
-      if (value) { event->xdestroywindow.window = c_value; } else { c_value= event->xdestroywindow.window; } break;
-    case Expose:
-      if (value) { event->xexpose.window = c_value; } else { c_value= event->xexpose.window; } break;
-    case FocusIn:
-    case FocusOut:
-      if (value) { event->xfocus.window = c_value; } else { c_value= event->xfocus.window; } break;
-    case GravityNotify:
-      if (value) { event->xgravity.window = c_value; } else { c_value= event->xgravity.window; } break;
-    case KeyPress:
-    case KeyRelease:
-      if (value) { event->xkey.window = c_value; } else { c_value= event->xkey.window; } break;
-    case KeymapNotify:
-      if (value) { event->xkeymap.window = c_value; } else { c_value= event->xkeymap.window; } break;
-    case MapNotify:
-      if (value) { event->xmap.window = c_value; } else { c_value= event->xmap.window; } break;
-    case MappingNotify:
-      if (value) { event->xmapping.window = c_value; } else { c_value= event->xmapping.window; } break;
-    case MapRequest:
-      if (value) { event->xmaprequest.window = c_value; } else { c_value= event->xmaprequest.window; } break;
-    case MotionNotify:
-      if (value) { event->xmotion.window = c_value; } else { c_value= event->xmotion.window; } break;
-    case PropertyNotify:
-      if (value) { event->xproperty.window = c_value; } else { c_value= event->xproperty.window; } break;
-    case ReparentNotify:
-      if (value) { event->xreparent.window = c_value; } else { c_value= event->xreparent.window; } break;
-    case ResizeRequest:
-      if (value) { event->xresizerequest.window = c_value; } else { c_value= event->xresizerequest.window; } break;
-    case SelectionClear:
-      if (value) { event->xselectionclear.window = c_value; } else { c_value= event->xselectionclear.window; } break;
-    case UnmapNotify:
-      if (value) { event->xunmap.window = c_value; } else { c_value= event->xunmap.window; } break;
-    case VisibilityNotify:
-      if (value) { event->xvisibility.window = c_value; } else { c_value= event->xvisibility.window; } break;
-    default: croak("Can't access XEvent.window for type=%d", event->type);
+    if (value) {
+      s->width= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(s->width)));
     }
-    PUSHs(value? value : sv_2mortal(newSVuv(c_value)));
 
 void
-_x(event, value=NULL)
-  XEvent *event
-  SV *value
+win_gravity(self, value=NULL)
+    XWindowAttributes *self
+    SV *value
   INIT:
-    int c_value= 0;
+    XWindowAttributes *s= self;
   PPCODE:
-    if (value) { c_value= SvIV(value); }
-    switch (event->type) {
-    case ButtonPress:
-    case ButtonRelease:
-      if (value) { event->xbutton.x = c_value; } else { c_value= event->xbutton.x; } break;
-    case ConfigureNotify:
-      if (value) { event->xconfigure.x = c_value; } else { c_value= event->xconfigure.x; } break;
-    case ConfigureRequest:
-      if (value) { event->xconfigurerequest.x = c_value; } else { c_value= event->xconfigurerequest.x; } break;
-    case CreateNotify:
-      if (value) { event->xcreatewindow.x = c_value; } else { c_value= event->xcreatewindow.x; } break;
-    case EnterNotify:
-    case LeaveNotify:
-      if (value) { event->xcrossing.x = c_value; } else { c_value= event->xcrossing.x; } break;
-    case Expose:
-      if (value) { event->xexpose.x = c_value; } else { c_value= event->xexpose.x; } break;
-    case GraphicsExpose:
-      if (value) { event->xgraphicsexpose.x = c_value; } else { c_value= event->xgraphicsexpose.x; } break;
-    case GravityNotify:
-      if (value) { event->xgravity.x = c_value; } else { c_value= event->xgravity.x; } break;
-    case KeyPress:
-    case KeyRelease:
-      if (value) { event->xkey.x = c_value; } else { c_value= event->xkey.x; } break;
-    case MotionNotify:
-      if (value) { event->xmotion.x = c_value; } else { c_value= event->xmotion.x; } break;
-    case ReparentNotify:
-      if (value) { event->xreparent.x = c_value; } else { c_value= event->xreparent.x; } break;
-    default: croak("Can't access XEvent.x for type=%d", event->type);
+    if (value) {
+      s->win_gravity= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(s->win_gravity)));
     }
-    PUSHs(value? value : sv_2mortal(newSViv(c_value)));
 
 void
-_x_root(event, value=NULL)
-  XEvent *event
-  SV *value
+x(self, value=NULL)
+    XWindowAttributes *self
+    SV *value
   INIT:
-    int c_value= 0;
+    XWindowAttributes *s= self;
   PPCODE:
-    if (value) { c_value= SvIV(value); }
-    switch (event->type) {
-    case ButtonPress:
-    case ButtonRelease:
-      if (value) { event->xbutton.x_root = c_value; } else { c_value= event->xbutton.x_root; } break;
-    case EnterNotify:
-    case LeaveNotify:
-      if (value) { event->xcrossing.x_root = c_value; } else { c_value= event->xcrossing.x_root; } break;
-    case KeyPress:
-    case KeyRelease:
-      if (value) { event->xkey.x_root = c_value; } else { c_value= event->xkey.x_root; } break;
-    case MotionNotify:
-      if (value) { event->xmotion.x_root = c_value; } else { c_value= event->xmotion.x_root; } break;
-    default: croak("Can't access XEvent.x_root for type=%d", event->type);
+    if (value) {
+      s->x= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(s->x)));
     }
-    PUSHs(value? value : sv_2mortal(newSViv(c_value)));
 
 void
-_y(event, value=NULL)
-  XEvent *event
-  SV *value
+y(self, value=NULL)
+    XWindowAttributes *self
+    SV *value
   INIT:
-    int c_value= 0;
+    XWindowAttributes *s= self;
   PPCODE:
-    if (value) { c_value= SvIV(value); }
-    switch (event->type) {
-    case ButtonPress:
-    case ButtonRelease:
-      if (value) { event->xbutton.y = c_value; } else { c_value= event->xbutton.y; } break;
-    case ConfigureNotify:
-      if (value) { event->xconfigure.y = c_value; } else { c_value= event->xconfigure.y; } break;
-    case ConfigureRequest:
-      if (value) { event->xconfigurerequest.y = c_value; } else { c_value= event->xconfigurerequest.y; } break;
-    case CreateNotify:
-      if (value) { event->xcreatewindow.y = c_value; } else { c_value= event->xcreatewindow.y; } break;
-    case EnterNotify:
-    case LeaveNotify:
-      if (value) { event->xcrossing.y = c_value; } else { c_value= event->xcrossing.y; } break;
-    case Expose:
-      if (value) { event->xexpose.y = c_value; } else { c_value= event->xexpose.y; } break;
-    case GraphicsExpose:
-      if (value) { event->xgraphicsexpose.y = c_value; } else { c_value= event->xgraphicsexpose.y; } break;
-    case GravityNotify:
-      if (value) { event->xgravity.y = c_value; } else { c_value= event->xgravity.y; } break;
-    case KeyPress:
-    case KeyRelease:
-      if (value) { event->xkey.y = c_value; } else { c_value= event->xkey.y; } break;
-    case MotionNotify:
-      if (value) { event->xmotion.y = c_value; } else { c_value= event->xmotion.y; } break;
-    case ReparentNotify:
-      if (value) { event->xreparent.y = c_value; } else { c_value= event->xreparent.y; } break;
-    default: croak("Can't access XEvent.y for type=%d", event->type);
+    if (value) {
+      s->y= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(s->y)));
     }
-    PUSHs(value? value : sv_2mortal(newSViv(c_value)));
 
 void
-_y_root(event, value=NULL)
-  XEvent *event
-  SV *value
+your_event_mask(self, value=NULL)
+    XWindowAttributes *self
+    SV *value
   INIT:
-    int c_value= 0;
+    XWindowAttributes *s= self;
   PPCODE:
-    if (value) { c_value= SvIV(value); }
-    switch (event->type) {
-    case ButtonPress:
-    case ButtonRelease:
-      if (value) { event->xbutton.y_root = c_value; } else { c_value= event->xbutton.y_root; } break;
-    case EnterNotify:
-    case LeaveNotify:
-      if (value) { event->xcrossing.y_root = c_value; } else { c_value= event->xcrossing.y_root; } break;
-    case KeyPress:
-    case KeyRelease:
-      if (value) { event->xkey.y_root = c_value; } else { c_value= event->xkey.y_root; } break;
-    case MotionNotify:
-      if (value) { event->xmotion.y_root = c_value; } else { c_value= event->xmotion.y_root; } break;
-    default: croak("Can't access XEvent.y_root for type=%d", event->type);
+    if (value) {
+      s->your_event_mask= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(s->your_event_mask)));
     }
-    PUSHs(value? value : sv_2mortal(newSViv(c_value)));
 
-# END GENERATED X11_Xlib_XEvent
+# END GENERATED X11_Xlib_XWindowAttributes
 # ----------------------------------------------------------------------------
-# BEGIN GENERATED X11_Xlib_XVisualInfo
+# BEGIN GENERATED X11_Xlib_XSetWindowAttributes
 
-MODULE = X11::Xlib                PACKAGE = X11::Xlib::XVisualInfo
+MODULE = X11::Xlib                PACKAGE = X11::Xlib::XSetWindowAttributes
 
 int
 _sizeof(ignored=NULL)
     SV* ignored;
     CODE:
-        RETVAL = sizeof(XVisualInfo);
+        RETVAL = sizeof(XSetWindowAttributes);
     OUTPUT:
         RETVAL
 
@@ -3299,182 +8735,303 @@ _initialize(s)
     INIT:
         void *sptr;
     PPCODE:
-        sptr= PerlXlib_get_struct_ptr(s, 1, "X11::Xlib::XVisualInfo", sizeof(XVisualInfo),
-            (PerlXlib_struct_pack_fn*) &PerlXlib_XVisualInfo_pack
+        sptr= PerlXlib_get_struct_ptr(s, 1, "X11::Xlib::XSetWindowAttributes", sizeof(XSetWindowAttributes),
+            (PerlXlib_struct_pack_fn*) &PerlXlib_XSetWindowAttributes_pack
         );
-        memset((void*) sptr, 0, sizeof(XVisualInfo));
+        memset((void*) sptr, 0, sizeof(XSetWindowAttributes));
 
 void
 _pack(s, fields, consume=0)
-    XVisualInfo *s
+    XSetWindowAttributes *s
     HV *fields
     Bool consume
     PPCODE:
-        PerlXlib_XVisualInfo_pack(s, fields, consume);
+        PerlXlib_XSetWindowAttributes_pack(s, fields, consume);
 
 void
 _unpack(s, fields)
-    XVisualInfo *s
+    XSetWindowAttributes *s
     HV *fields
     PPCODE:
-        PerlXlib_XVisualInfo_unpack_obj(s, fields, ST(0));
+        PerlXlib_XSetWindowAttributes_unpack_obj(s, fields, ST(0));
 
 void
-bits_per_rgb(self, value=NULL)
-    XVisualInfo *self
+get(self, ...)
+    SV *self
+  ALIAS:
+    get_list = 1
+  INIT:
+    XSetWindowAttributes *s= ( XSetWindowAttributes * ) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XSetWindowAttributes", sizeof(XSetWindowAttributes),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XSetWindowAttributes_pack);
+    const PerlXlib_struct_fields *f= &PerlXlib_XSetWindowAttributes_fields;
+    SV **names;
+    const char *name;
+    STRLEN len;
+    int i, idx, n= items - 1;
+  PPCODE:
+    if (ix == 1 && n == 0) {
+      EXTEND(SP, f->count * 2);
+      for (i= 0; i < f->count; i++) {
+        PUSHs(sv_2mortal(newSVpv(f->names[i], 0)));
+        PUSHs(sv_2mortal(f->get_field(s, i, self)));
+      }
+    }
+    else if (n > 0) {
+      /* results overwrite the argument list, so save the names first */
+      Newx(names, n, SV*);
+      SAVEFREEPV(names);
+      Copy(&ST(1), names, n, SV*);
+      EXTEND(SP, ix? n * 2 : n);
+      for (i= 0; i < n; i++) {
+        name= SvPV(names[i], len);
+        if ((idx= PerlXlib_struct_field_index(f, name, len)) < 0)
+          croak("No field '%s' in X11::Xlib::XSetWindowAttributes", name);
+        if (ix) PUSHs(names[i]);
+        PUSHs(sv_2mortal(f->get_field(s, idx, self)));
+      }
+    }
+
+void
+set(self, ...)
+    SV *self
+  INIT:
+    XSetWindowAttributes *s= ( XSetWindowAttributes * ) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XSetWindowAttributes", sizeof(XSetWindowAttributes),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XSetWindowAttributes_pack);
+    const PerlXlib_struct_fields *f= &PerlXlib_XSetWindowAttributes_fields;
+    const char *name;
+    STRLEN len;
+    int i, idx;
+  PPCODE:
+    if (!(items & 1)) croak("Odd number of arguments to set()");
+    for (i= 1; i < items; i+= 2) {
+      name= SvPV(ST(i), len);
+      if ((idx= PerlXlib_struct_field_index(f, name, len)) < 0)
+        croak("No field '%s' in X11::Xlib::XSetWindowAttributes", name);
+      f->set_field(s, idx, ST(i+1));
+    }
+    PUSHs(self);
+
+void
+background_pixel(self, value=NULL)
+    XSetWindowAttributes *self
     SV *value
   INIT:
-    XVisualInfo *s= self;
+    XSetWindowAttributes *s= self;
   PPCODE:
     if (value) {
-      s->bits_per_rgb= SvIV(value);
+      s->background_pixel= SvUV(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSViv(s->bits_per_rgb)));
+      PUSHs(sv_2mortal(newSVuv(s->background_pixel)));
     }
 
 void
-blue_mask(self, value=NULL)
-    XVisualInfo *self
+background_pixmap(self, value=NULL)
+    XSetWindowAttributes *self
     SV *value
   INIT:
-    XVisualInfo *s= self;
+    XSetWindowAttributes *s= self;
   PPCODE:
     if (value) {
-      s->blue_mask= SvUV(value);
+      s->background_pixmap= PerlXlib_sv_to_xid(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSVuv(s->blue_mask)));
+      PUSHs(sv_2mortal(newSVuv(s->background_pixmap)));
     }
 
 void
-class(self, value=NULL)
-    XVisualInfo *self
+backing_pixel(self, value=NULL)
+    XSetWindowAttributes *self
     SV *value
   INIT:
-    XVisualInfo *s= self;
+    XSetWindowAttributes *s= self;
   PPCODE:
     if (value) {
-      s->class= SvIV(value);
+      s->backing_pixel= SvUV(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSViv(s->class)));
+      PUSHs(sv_2mortal(newSVuv(s->backing_pixel)));
     }
 
 void
-colormap_size(self, value=NULL)
-    XVisualInfo *self
+backing_planes(self, value=NULL)
+    XSetWindowAttributes *self
     SV *value
   INIT:
-    XVisualInfo *s= self;
+    XSetWindowAttributes *s= self;
   PPCODE:
     if (value) {
-      s->colormap_size= SvIV(value);
+      s->backing_planes= SvUV(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSViv(s->colormap_size)));
+      PUSHs(sv_2mortal(newSVuv(s->backing_planes)));
     }
 
 void
-depth(self, value=NULL)
-    XVisualInfo *self
+backing_store(self, value=NULL)
+    XSetWindowAttributes *self
     SV *value
   INIT:
-    XVisualInfo *s= self;
+    XSetWindowAttributes *s= self;
   PPCODE:
     if (value) {
-      s->depth= SvIV(value);
+      s->backing_store= SvIV(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSViv(s->depth)));
+      PUSHs(sv_2mortal(newSViv(s->backing_store)));
     }
 
 void
-green_mask(self, value=NULL)
-    XVisualInfo *self
+bit_gravity(self, value=NULL)
+    XSetWindowAttributes *self
     SV *value
   INIT:
-    XVisualInfo *s= self;
+    XSetWindowAttributes *s= self;
   PPCODE:
     if (value) {
-      s->green_mask= SvUV(value);
+      s->bit_gravity= SvIV(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSVuv(s->green_mask)));
+      PUSHs(sv_2mortal(newSViv(s->bit_gravity)));
     }
 
 void
-red_mask(self, value=NULL)
-    XVisualInfo *self
+border_pixel(self, value=NULL)
+    XSetWindowAttributes *self
     SV *value
   INIT:
-    XVisualInfo *s= self;
+    XSetWindowAttributes *s= self;
   PPCODE:
     if (value) {
-      s->red_mask= SvUV(value);
+      s->border_pixel= SvUV(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSVuv(s->red_mask)));
+      PUSHs(sv_2mortal(newSVuv(s->border_pixel)));
     }
 
 void
-screen(self, value=NULL)
-    XVisualInfo *self
+border_pixmap(self, value=NULL)
+    XSetWindowAttributes *self
     SV *value
   INIT:
-    XVisualInfo *s= self;
+    XSetWindowAttributes *s= self;
   PPCODE:
     if (value) {
-      s->screen= SvIV(value);
+      s->border_pixmap= PerlXlib_sv_to_xid(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSViv(s->screen)));
+      PUSHs(sv_2mortal(newSVuv(s->border_pixmap)));
     }
 
 void
-visual(self, value=NULL)
-    SV *self
+colormap(self, value=NULL)
+    XSetWindowAttributes *self
     SV *value
   INIT:
-    XVisualInfo *s= ( XVisualInfo * ) PerlXlib_get_struct_ptr(
-           self, 0, "X11::Xlib::XVisualInfo", sizeof(XVisualInfo),
-           (PerlXlib_struct_pack_fn*) &PerlXlib_XVisualInfo_pack
-         );
-         SV *dpy_sv= PerlXlib_objref_get_display(self);
-         Display *dpy= PerlXlib_display_objref_get_pointer(dpy_sv, PerlXlib_OR_NULL);
+    XSetWindowAttributes *s= self;
   PPCODE:
     if (value) {
-      s->visual= (Visual *) PerlXlib_objref_get_pointer(value, "Visual", PerlXlib_OR_NULL);
+      s->colormap= PerlXlib_sv_to_xid(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_mortalcopy(PerlXlib_get_objref(s->visual, PerlXlib_AUTOCREATE, "Visual", SVt_PVMG, "X11::Xlib::Visual", dpy)));
+      PUSHs(sv_2mortal(newSVuv(s->colormap)));
     }
 
 void
-visualid(self, value=NULL)
-    XVisualInfo *self
+cursor(self, value=NULL)
+    XSetWindowAttributes *self
     SV *value
   INIT:
-    XVisualInfo *s= self;
+    XSetWindowAttributes *s= self;
   PPCODE:
     if (value) {
-      s->visualid= SvUV(value);
+      s->cursor= PerlXlib_sv_to_xid(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSVuv(s->visualid)));
+      PUSHs(sv_2mortal(newSVuv(s->cursor)));
     }
 
-# END GENERATED X11_Xlib_XVisualInfo
+void
+do_not_propagate_mask(self, value=NULL)
+    XSetWindowAttributes *self
+    SV *value
+  INIT:
+    XSetWindowAttributes *s= self;
+  PPCODE:
+    if (value) {
+      s->do_not_propagate_mask= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(s->do_not_propagate_mask)));
+    }
+
+void
+event_mask(self, value=NULL)
+    XSetWindowAttributes *self
+    SV *value
+  INIT:
+    XSetWindowAttributes *s= self;
+  PPCODE:
+    if (value) {
+      s->event_mask= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(s->event_mask)));
+    }
+
+void
+override_redirect(self, value=NULL)
+    XSetWindowAttributes *self
+    SV *value
+  INIT:
+    XSetWindowAttributes *s= self;
+  PPCODE:
+    if (value) {
+      s->override_redirect= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(s->override_redirect)));
+    }
+
+void
+save_under(self, value=NULL)
+    XSetWindowAttributes *self
+    SV *value
+  INIT:
+    XSetWindowAttributes *s= self;
+  PPCODE:
+    if (value) {
+      s->save_under= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(s->save_under)));
+    }
+
+void
+win_gravity(self, value=NULL)
+    XSetWindowAttributes *self
+    SV *value
+  INIT:
+    XSetWindowAttributes *s= self;
+  PPCODE:
+    if (value) {
+      s->win_gravity= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(s->win_gravity)));
+    }
+
+# END GENERATED X11_Xlib_XSetWindowAttributes
 # ----------------------------------------------------------------------------
-# BEGIN GENERATED X11_Xlib_XWindowChanges
+# BEGIN GENERATED X11_Xlib_XSizeHints
 
-MODULE = X11::Xlib                PACKAGE = X11::Xlib::XWindowChanges
+MODULE = X11::Xlib                PACKAGE = X11::Xlib::XSizeHints
 
 int
 _sizeof(ignored=NULL)
     SV* ignored;
     CODE:
-        RETVAL = sizeof(XWindowChanges);
+        RETVAL = sizeof(XSizeHints);
     OUTPUT:
         RETVAL
 
@@ -3484,46 +9041,130 @@ _initialize(s)
     INIT:
         void *sptr;
     PPCODE:
-        sptr= PerlXlib_get_struct_ptr(s, 1, "X11::Xlib::XWindowChanges", sizeof(XWindowChanges),
-            (PerlXlib_struct_pack_fn*) &PerlXlib_XWindowChanges_pack
+        sptr= PerlXlib_get_struct_ptr(s, 1, "X11::Xlib::XSizeHints", sizeof(XSizeHints),
+            (PerlXlib_struct_pack_fn*) &PerlXlib_XSizeHints_pack
         );
-        memset((void*) sptr, 0, sizeof(XWindowChanges));
+        memset((void*) sptr, 0, sizeof(XSizeHints));
 
 void
 _pack(s, fields, consume=0)
-    XWindowChanges *s
+    XSizeHints *s
     HV *fields
     Bool consume
     PPCODE:
-        PerlXlib_XWindowChanges_pack(s, fields, consume);
+        PerlXlib_XSizeHints_pack(s, fields, consume);
+
+void
+_unpack(s, fields)
+    XSizeHints *s
+    HV *fields
+    PPCODE:
+        PerlXlib_XSizeHints_unpack_obj(s, fields, ST(0));
+
+void
+get(self, ...)
+    SV *self
+  ALIAS:
+    get_list = 1
+  INIT:
+    XSizeHints *s= ( XSizeHints * ) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XSizeHints", sizeof(XSizeHints),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XSizeHints_pack);
+    const PerlXlib_struct_fields *f= &PerlXlib_XSizeHints_fields;
+    SV **names;
+    const char *name;
+    STRLEN len;
+    int i, idx, n= items - 1;
+  PPCODE:
+    if (ix == 1 && n == 0) {
+      EXTEND(SP, f->count * 2);
+      for (i= 0; i < f->count; i++) {
+        PUSHs(sv_2mortal(newSVpv(f->names[i], 0)));
+        PUSHs(sv_2mortal(f->get_field(s, i, self)));
+      }
+    }
+    else if (n > 0) {
+      /* results overwrite the argument list, so save the names first */
+      Newx(names, n, SV*);
+      SAVEFREEPV(names);
+      Copy(&ST(1), names, n, SV*);
+      EXTEND(SP, ix? n * 2 : n);
+      for (i= 0; i < n; i++) {
+        name= SvPV(names[i], len);
+        if ((idx= PerlXlib_struct_field_index(f, name, len)) < 0)
+          croak("No field '%s' in X11::Xlib::XSizeHints", name);
+        if (ix) PUSHs(names[i]);
+        PUSHs(sv_2mortal(f->get_field(s, idx, self)));
+      }
+    }
+
+void
+set(self, ...)
+    SV *self
+  INIT:
+    XSizeHints *s= ( XSizeHints * ) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XSizeHints", sizeof(XSizeHints),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XSizeHints_pack);
+    const PerlXlib_struct_fields *f= &PerlXlib_XSizeHints_fields;
+    const char *name;
+    STRLEN len;
+    int i, idx;
+  PPCODE:
+    if (!(items & 1)) croak("Odd number of arguments to set()");
+    for (i= 1; i < items; i+= 2) {
+      name= SvPV(ST(i), len);
+      if ((idx= PerlXlib_struct_field_index(f, name, len)) < 0)
+        croak("No field '%s' in X11::Xlib::XSizeHints", name);
+      f->set_field(s, idx, ST(i+1));
+    }
+    PUSHs(self);
+
+void
+base_height(self, value=NULL)
+    XSizeHints *self
+    SV *value
+  INIT:
+    XSizeHints *s= self;
+  PPCODE:
+    if (value) {
+      s->base_height= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(s->base_height)));
+    }
 
 void
-_unpack(s, fields)
-    XWindowChanges *s
-    HV *fields
-    PPCODE:
-        PerlXlib_XWindowChanges_unpack_obj(s, fields, ST(0));
+base_width(self, value=NULL)
+    XSizeHints *self
+    SV *value
+  INIT:
+    XSizeHints *s= self;
+  PPCODE:
+    if (value) {
+      s->base_width= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(s->base_width)));
+    }
 
 void
-border_width(self, value=NULL)
-    XWindowChanges *self
+flags(self, value=NULL)
+    XSizeHints *self
     SV *value
   INIT:
-    XWindowChanges *s= self;
+    XSizeHints *s= self;
   PPCODE:
     if (value) {
-      s->border_width= SvIV(value);
+      s->flags= SvIV(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSViv(s->border_width)));
+      PUSHs(sv_2mortal(newSViv(s->flags)));
     }
 
 void
 height(self, value=NULL)
-    XWindowChanges *self
+    XSizeHints *self
     SV *value
   INIT:
-    XWindowChanges *s= self;
+    XSizeHints *s= self;
   PPCODE:
     if (value) {
       s->height= SvIV(value);
@@ -3533,453 +9174,558 @@ height(self, value=NULL)
     }
 
 void
-sibling(self, value=NULL)
-    XWindowChanges *self
+height_inc(self, value=NULL)
+    XSizeHints *self
     SV *value
   INIT:
-    XWindowChanges *s= self;
+    XSizeHints *s= self;
   PPCODE:
     if (value) {
-      s->sibling= PerlXlib_sv_to_xid(value);
+      s->height_inc= SvIV(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSVuv(s->sibling)));
+      PUSHs(sv_2mortal(newSViv(s->height_inc)));
     }
 
 void
-stack_mode(self, value=NULL)
-    XWindowChanges *self
+max_aspect_x(self, value=NULL)
+    XSizeHints *self
     SV *value
   INIT:
-    XWindowChanges *s= self;
+    XSizeHints *s= self;
   PPCODE:
     if (value) {
-      s->stack_mode= SvIV(value);
+      s->max_aspect.x= SvIV(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSViv(s->stack_mode)));
+      PUSHs(sv_2mortal(newSViv(s->max_aspect.x)));
     }
 
 void
-width(self, value=NULL)
-    XWindowChanges *self
+max_aspect_y(self, value=NULL)
+    XSizeHints *self
     SV *value
   INIT:
-    XWindowChanges *s= self;
+    XSizeHints *s= self;
   PPCODE:
     if (value) {
-      s->width= SvIV(value);
+      s->max_aspect.y= SvIV(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSViv(s->width)));
+      PUSHs(sv_2mortal(newSViv(s->max_aspect.y)));
     }
 
 void
-x(self, value=NULL)
-    XWindowChanges *self
+max_height(self, value=NULL)
+    XSizeHints *self
     SV *value
   INIT:
-    XWindowChanges *s= self;
+    XSizeHints *s= self;
   PPCODE:
     if (value) {
-      s->x= SvIV(value);
+      s->max_height= SvIV(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSViv(s->x)));
+      PUSHs(sv_2mortal(newSViv(s->max_height)));
     }
 
 void
-y(self, value=NULL)
-    XWindowChanges *self
+max_width(self, value=NULL)
+    XSizeHints *self
     SV *value
   INIT:
-    XWindowChanges *s= self;
+    XSizeHints *s= self;
   PPCODE:
     if (value) {
-      s->y= SvIV(value);
+      s->max_width= SvIV(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSViv(s->y)));
+      PUSHs(sv_2mortal(newSViv(s->max_width)));
     }
 
-# END GENERATED X11_Xlib_XWindowChanges
-# ----------------------------------------------------------------------------
-# BEGIN GENERATED X11_Xlib_XWindowAttributes
-
-MODULE = X11::Xlib                PACKAGE = X11::Xlib::XWindowAttributes
-
-int
-_sizeof(ignored=NULL)
-    SV* ignored;
-    CODE:
-        RETVAL = sizeof(XWindowAttributes);
-    OUTPUT:
-        RETVAL
-
-void
-_initialize(s)
-    SV *s
-    INIT:
-        void *sptr;
-    PPCODE:
-        sptr= PerlXlib_get_struct_ptr(s, 1, "X11::Xlib::XWindowAttributes", sizeof(XWindowAttributes),
-            (PerlXlib_struct_pack_fn*) &PerlXlib_XWindowAttributes_pack
-        );
-        memset((void*) sptr, 0, sizeof(XWindowAttributes));
-
 void
-_pack(s, fields, consume=0)
-    XWindowAttributes *s
-    HV *fields
-    Bool consume
-    PPCODE:
-        PerlXlib_XWindowAttributes_pack(s, fields, consume);
+min_aspect_x(self, value=NULL)
+    XSizeHints *self
+    SV *value
+  INIT:
+    XSizeHints *s= self;
+  PPCODE:
+    if (value) {
+      s->min_aspect.x= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(s->min_aspect.x)));
+    }
 
 void
-_unpack(s, fields)
-    XWindowAttributes *s
-    HV *fields
-    PPCODE:
-        PerlXlib_XWindowAttributes_unpack_obj(s, fields, ST(0));
+min_aspect_y(self, value=NULL)
+    XSizeHints *self
+    SV *value
+  INIT:
+    XSizeHints *s= self;
+  PPCODE:
+    if (value) {
+      s->min_aspect.y= SvIV(value);
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal(newSViv(s->min_aspect.y)));
+    }
 
 void
-all_event_masks(self, value=NULL)
-    XWindowAttributes *self
+min_height(self, value=NULL)
+    XSizeHints *self
     SV *value
   INIT:
-    XWindowAttributes *s= self;
+    XSizeHints *s= self;
   PPCODE:
     if (value) {
-      s->all_event_masks= SvIV(value);
+      s->min_height= SvIV(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSViv(s->all_event_masks)));
+      PUSHs(sv_2mortal(newSViv(s->min_height)));
     }
 
 void
-backing_pixel(self, value=NULL)
-    XWindowAttributes *self
+min_width(self, value=NULL)
+    XSizeHints *self
     SV *value
   INIT:
-    XWindowAttributes *s= self;
+    XSizeHints *s= self;
   PPCODE:
     if (value) {
-      s->backing_pixel= SvUV(value);
+      s->min_width= SvIV(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSVuv(s->backing_pixel)));
+      PUSHs(sv_2mortal(newSViv(s->min_width)));
     }
 
 void
-backing_planes(self, value=NULL)
-    XWindowAttributes *self
+width(self, value=NULL)
+    XSizeHints *self
     SV *value
   INIT:
-    XWindowAttributes *s= self;
+    XSizeHints *s= self;
   PPCODE:
     if (value) {
-      s->backing_planes= SvUV(value);
+      s->width= SvIV(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSVuv(s->backing_planes)));
+      PUSHs(sv_2mortal(newSViv(s->width)));
     }
 
 void
-backing_store(self, value=NULL)
-    XWindowAttributes *self
+width_inc(self, value=NULL)
+    XSizeHints *self
     SV *value
   INIT:
-    XWindowAttributes *s= self;
+    XSizeHints *s= self;
   PPCODE:
     if (value) {
-      s->backing_store= SvIV(value);
+      s->width_inc= SvIV(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSViv(s->backing_store)));
+      PUSHs(sv_2mortal(newSViv(s->width_inc)));
     }
 
 void
-bit_gravity(self, value=NULL)
-    XWindowAttributes *self
+win_gravity(self, value=NULL)
+    XSizeHints *self
     SV *value
   INIT:
-    XWindowAttributes *s= self;
+    XSizeHints *s= self;
   PPCODE:
     if (value) {
-      s->bit_gravity= SvIV(value);
+      s->win_gravity= SvIV(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSViv(s->bit_gravity)));
+      PUSHs(sv_2mortal(newSViv(s->win_gravity)));
     }
 
 void
-border_width(self, value=NULL)
-    XWindowAttributes *self
+x(self, value=NULL)
+    XSizeHints *self
     SV *value
   INIT:
-    XWindowAttributes *s= self;
+    XSizeHints *s= self;
   PPCODE:
     if (value) {
-      s->border_width= SvIV(value);
+      s->x= SvIV(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSViv(s->border_width)));
+      PUSHs(sv_2mortal(newSViv(s->x)));
     }
 
 void
-class(self, value=NULL)
-    XWindowAttributes *self
+y(self, value=NULL)
+    XSizeHints *self
     SV *value
   INIT:
-    XWindowAttributes *s= self;
+    XSizeHints *s= self;
   PPCODE:
     if (value) {
-      s->class= SvIV(value);
+      s->y= SvIV(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSViv(s->class)));
+      PUSHs(sv_2mortal(newSViv(s->y)));
     }
 
+# END GENERATED X11_Xlib_XSizeHints
+# ----------------------------------------------------------------------------
+# BEGIN GENERATED X11_Xlib_XRectangle
+
+MODULE = X11::Xlib                PACKAGE = X11::Xlib::XRectangle
+
+int
+_sizeof(ignored=NULL)
+    SV* ignored;
+    CODE:
+        RETVAL = sizeof(XRectangle);
+    OUTPUT:
+        RETVAL
+
+void
+_initialize(s)
+    SV *s
+    INIT:
+        void *sptr;
+    PPCODE:
+        sptr= PerlXlib_get_struct_ptr(s, 1, "X11::Xlib::XRectangle", sizeof(XRectangle),
+            (PerlXlib_struct_pack_fn*) &PerlXlib_XRectangle_pack
+        );
+        memset((void*) sptr, 0, sizeof(XRectangle));
+
+void
+_pack(s, fields, consume=0)
+    XRectangle *s
+    HV *fields
+    Bool consume
+    PPCODE:
+        PerlXlib_XRectangle_pack(s, fields, consume);
+
+void
+_unpack(s, fields)
+    XRectangle *s
+    HV *fields
+    PPCODE:
+        PerlXlib_XRectangle_unpack_obj(s, fields, ST(0));
+
 void
-colormap(self, value=NULL)
-    XWindowAttributes *self
-    SV *value
-  INIT:
-    XWindowAttributes *s= self;
-  PPCODE:
-    if (value) {
-      s->colormap= PerlXlib_sv_to_xid(value);
-      PUSHs(value);
-    } else {
-      PUSHs(sv_2mortal(newSVuv(s->colormap)));
+get(self, ...)
+    SV *self
+  ALIAS:
+    get_list = 1
+  INIT:
+    XRectangle *s= ( XRectangle * ) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XRectangle", sizeof(XRectangle),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XRectangle_pack);
+    const PerlXlib_struct_fields *f= &PerlXlib_XRectangle_fields;
+    SV **names;
+    const char *name;
+    STRLEN len;
+    int i, idx, n= items - 1;
+  PPCODE:
+    if (ix == 1 && n == 0) {
+      EXTEND(SP, f->count * 2);
+      for (i= 0; i < f->count; i++) {
+        PUSHs(sv_2mortal(newSVpv(f->names[i], 0)));
+        PUSHs(sv_2mortal(f->get_field(s, i, self)));
+      }
     }
-
-void
-depth(self, value=NULL)
-    XWindowAttributes *self
-    SV *value
-  INIT:
-    XWindowAttributes *s= self;
-  PPCODE:
-    if (value) {
-      s->depth= SvIV(value);
-      PUSHs(value);
-    } else {
-      PUSHs(sv_2mortal(newSViv(s->depth)));
+    else if (n > 0) {
+      /* results overwrite the argument list, so save the names first */
+      Newx(names, n, SV*);
+      SAVEFREEPV(names);
+      Copy(&ST(1), names, n, SV*);
+      EXTEND(SP, ix? n * 2 : n);
+      for (i= 0; i < n; i++) {
+        name= SvPV(names[i], len);
+        if ((idx= PerlXlib_struct_field_index(f, name, len)) < 0)
+          croak("No field '%s' in X11::Xlib::XRectangle", name);
+        if (ix) PUSHs(names[i]);
+        PUSHs(sv_2mortal(f->get_field(s, idx, self)));
+      }
     }
 
 void
-do_not_propagate_mask(self, value=NULL)
-    XWindowAttributes *self
-    SV *value
+set(self, ...)
+    SV *self
   INIT:
-    XWindowAttributes *s= self;
+    XRectangle *s= ( XRectangle * ) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XRectangle", sizeof(XRectangle),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XRectangle_pack);
+    const PerlXlib_struct_fields *f= &PerlXlib_XRectangle_fields;
+    const char *name;
+    STRLEN len;
+    int i, idx;
   PPCODE:
-    if (value) {
-      s->do_not_propagate_mask= SvIV(value);
-      PUSHs(value);
-    } else {
-      PUSHs(sv_2mortal(newSViv(s->do_not_propagate_mask)));
+    if (!(items & 1)) croak("Odd number of arguments to set()");
+    for (i= 1; i < items; i+= 2) {
+      name= SvPV(ST(i), len);
+      if ((idx= PerlXlib_struct_field_index(f, name, len)) < 0)
+        croak("No field '%s' in X11::Xlib::XRectangle", name);
+      f->set_field(s, idx, ST(i+1));
     }
+    PUSHs(self);
 
 void
 height(self, value=NULL)
-    XWindowAttributes *self
+    XRectangle *self
     SV *value
   INIT:
-    XWindowAttributes *s= self;
+    XRectangle *s= self;
   PPCODE:
     if (value) {
-      s->height= SvIV(value);
+      s->height= SvUV(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSViv(s->height)));
+      PUSHs(sv_2mortal(newSVuv(s->height)));
     }
 
 void
-map_installed(self, value=NULL)
-    XWindowAttributes *self
+width(self, value=NULL)
+    XRectangle *self
     SV *value
   INIT:
-    XWindowAttributes *s= self;
+    XRectangle *s= self;
   PPCODE:
     if (value) {
-      s->map_installed= SvIV(value);
+      s->width= SvUV(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSViv(s->map_installed)));
+      PUSHs(sv_2mortal(newSVuv(s->width)));
     }
 
 void
-map_state(self, value=NULL)
-    XWindowAttributes *self
+x(self, value=NULL)
+    XRectangle *self
     SV *value
   INIT:
-    XWindowAttributes *s= self;
+    XRectangle *s= self;
   PPCODE:
     if (value) {
-      s->map_state= SvIV(value);
+      s->x= SvIV(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSViv(s->map_state)));
+      PUSHs(sv_2mortal(newSViv(s->x)));
     }
 
 void
-override_redirect(self, value=NULL)
-    XWindowAttributes *self
+y(self, value=NULL)
+    XRectangle *self
     SV *value
   INIT:
-    XWindowAttributes *s= self;
+    XRectangle *s= self;
   PPCODE:
     if (value) {
-      s->override_redirect= SvIV(value);
+      s->y= SvIV(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSViv(s->override_redirect)));
+      PUSHs(sv_2mortal(newSViv(s->y)));
     }
 
+# END GENERATED X11_Xlib_XRectangle
+# ----------------------------------------------------------------------------
+# BEGIN GENERATED X11_Xlib_XKeyboardState
+
+MODULE = X11::Xlib                PACKAGE = X11::Xlib::XKeyboardState
+
+int
+_sizeof(ignored=NULL)
+    SV* ignored;
+    CODE:
+        RETVAL = sizeof(XKeyboardState);
+    OUTPUT:
+        RETVAL
+
 void
-root(self, value=NULL)
-    XWindowAttributes *self
-    SV *value
-  INIT:
-    XWindowAttributes *s= self;
-  PPCODE:
-    if (value) {
-      s->root= PerlXlib_sv_to_xid(value);
-      PUSHs(value);
-    } else {
-      PUSHs(sv_2mortal(newSVuv(s->root)));
+_initialize(s)
+    SV *s
+    INIT:
+        void *sptr;
+    PPCODE:
+        sptr= PerlXlib_get_struct_ptr(s, 1, "X11::Xlib::XKeyboardState", sizeof(XKeyboardState),
+            (PerlXlib_struct_pack_fn*) &PerlXlib_XKeyboardState_pack
+        );
+        memset((void*) sptr, 0, sizeof(XKeyboardState));
+
+void
+_pack(s, fields, consume=0)
+    XKeyboardState *s
+    HV *fields
+    Bool consume
+    PPCODE:
+        PerlXlib_XKeyboardState_pack(s, fields, consume);
+
+void
+_unpack(s, fields)
+    XKeyboardState *s
+    HV *fields
+    PPCODE:
+        PerlXlib_XKeyboardState_unpack_obj(s, fields, ST(0));
+
+void
+get(self, ...)
+    SV *self
+  ALIAS:
+    get_list = 1
+  INIT:
+    XKeyboardState *s= ( XKeyboardState * ) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XKeyboardState", sizeof(XKeyboardState),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XKeyboardState_pack);
+    const PerlXlib_struct_fields *f= &PerlXlib_XKeyboardState_fields;
+    SV **names;
+    const char *name;
+    STRLEN len;
+    int i, idx, n= items - 1;
+  PPCODE:
+    if (ix == 1 && n == 0) {
+      EXTEND(SP, f->count * 2);
+      for (i= 0; i < f->count; i++) {
+        PUSHs(sv_2mortal(newSVpv(f->names[i], 0)));
+        PUSHs(sv_2mortal(f->get_field(s, i, self)));
+      }
+    }
+    else if (n > 0) {
+      /* results overwrite the argument list, so save the names first */
+      Newx(names, n, SV*);
+      SAVEFREEPV(names);
+      Copy(&ST(1), names, n, SV*);
+      EXTEND(SP, ix? n * 2 : n);
+      for (i= 0; i < n; i++) {
+        name= SvPV(names[i], len);
+        if ((idx= PerlXlib_struct_field_index(f, name, len)) < 0)
+          croak("No field '%s' in X11::Xlib::XKeyboardState", name);
+        if (ix) PUSHs(names[i]);
+        PUSHs(sv_2mortal(f->get_field(s, idx, self)));
+      }
     }
 
 void
-save_under(self, value=NULL)
-    XWindowAttributes *self
-    SV *value
+set(self, ...)
+    SV *self
   INIT:
-    XWindowAttributes *s= self;
+    XKeyboardState *s= ( XKeyboardState * ) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XKeyboardState", sizeof(XKeyboardState),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XKeyboardState_pack);
+    const PerlXlib_struct_fields *f= &PerlXlib_XKeyboardState_fields;
+    const char *name;
+    STRLEN len;
+    int i, idx;
   PPCODE:
-    if (value) {
-      s->save_under= SvIV(value);
-      PUSHs(value);
-    } else {
-      PUSHs(sv_2mortal(newSViv(s->save_under)));
+    if (!(items & 1)) croak("Odd number of arguments to set()");
+    for (i= 1; i < items; i+= 2) {
+      name= SvPV(ST(i), len);
+      if ((idx= PerlXlib_struct_field_index(f, name, len)) < 0)
+        croak("No field '%s' in X11::Xlib::XKeyboardState", name);
+      f->set_field(s, idx, ST(i+1));
     }
+    PUSHs(self);
 
 void
-screen(self, value=NULL)
-    XWindowAttributes *self
+auto_repeats(self, value=NULL)
+    XKeyboardState *self
     SV *value
   INIT:
-    XWindowAttributes *s= self;
+    XKeyboardState *s= self;
   PPCODE:
     if (value) {
-      s->screen= PerlXlib_screen_objref_get_pointer(value, PerlXlib_OR_NULL);
+      { if (!SvPOK(value) || SvCUR(value) != sizeof(char)*32)  croak("Expected scalar of length %ld but got %ld", (long)(sizeof(char)*32), (long)SvCUR(value)); memcpy(s->auto_repeats, SvPVX(value), sizeof(char)*32);}
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSVsv(PerlXlib_get_screen_objref(s->screen, PerlXlib_OR_UNDEF))));
+      PUSHs(sv_2mortal(newSVpvn((void*)s->auto_repeats, sizeof(char)*32)));
     }
 
 void
-visual(self, value=NULL)
-    SV *self
+bell_duration(self, value=NULL)
+    XKeyboardState *self
     SV *value
   INIT:
-    XWindowAttributes *s= ( XWindowAttributes * ) PerlXlib_get_struct_ptr(
-           self, 0, "X11::Xlib::XWindowAttributes", sizeof(XWindowAttributes),
-           (PerlXlib_struct_pack_fn*) &PerlXlib_XWindowAttributes_pack
-         );
-         SV *dpy_sv= PerlXlib_objref_get_display(self);
-         Display *dpy= PerlXlib_display_objref_get_pointer(dpy_sv, PerlXlib_OR_NULL);
+    XKeyboardState *s= self;
   PPCODE:
     if (value) {
-      s->visual= (Visual *) PerlXlib_objref_get_pointer(value, "Visual", PerlXlib_OR_NULL);
+      s->bell_duration= SvUV(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_mortalcopy(PerlXlib_get_objref(s->visual, PerlXlib_AUTOCREATE, "Visual", SVt_PVMG, "X11::Xlib::Visual", dpy)));
+      PUSHs(sv_2mortal(newSVuv(s->bell_duration)));
     }
 
 void
-width(self, value=NULL)
-    XWindowAttributes *self
+bell_percent(self, value=NULL)
+    XKeyboardState *self
     SV *value
   INIT:
-    XWindowAttributes *s= self;
+    XKeyboardState *s= self;
   PPCODE:
     if (value) {
-      s->width= SvIV(value);
+      s->bell_percent= SvIV(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSViv(s->width)));
+      PUSHs(sv_2mortal(newSViv(s->bell_percent)));
     }
 
 void
-win_gravity(self, value=NULL)
-    XWindowAttributes *self
+bell_pitch(self, value=NULL)
+    XKeyboardState *self
     SV *value
   INIT:
-    XWindowAttributes *s= self;
+    XKeyboardState *s= self;
   PPCODE:
     if (value) {
-      s->win_gravity= SvIV(value);
+      s->bell_pitch= SvUV(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSViv(s->win_gravity)));
+      PUSHs(sv_2mortal(newSVuv(s->bell_pitch)));
     }
 
 void
-x(self, value=NULL)
-    XWindowAttributes *self
+global_auto_repeat(self, value=NULL)
+    XKeyboardState *self
     SV *value
   INIT:
-    XWindowAttributes *s= self;
+    XKeyboardState *s= self;
   PPCODE:
     if (value) {
-      s->x= SvIV(value);
+      s->global_auto_repeat= SvIV(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSViv(s->x)));
+      PUSHs(sv_2mortal(newSViv(s->global_auto_repeat)));
     }
 
 void
-y(self, value=NULL)
-    XWindowAttributes *self
+key_click_percent(self, value=NULL)
+    XKeyboardState *self
     SV *value
   INIT:
-    XWindowAttributes *s= self;
+    XKeyboardState *s= self;
   PPCODE:
     if (value) {
-      s->y= SvIV(value);
+      s->key_click_percent= SvIV(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSViv(s->y)));
+      PUSHs(sv_2mortal(newSViv(s->key_click_percent)));
     }
 
 void
-your_event_mask(self, value=NULL)
-    XWindowAttributes *self
+led_mask(self, value=NULL)
+    XKeyboardState *self
     SV *value
   INIT:
-    XWindowAttributes *s= self;
+    XKeyboardState *s= self;
   PPCODE:
     if (value) {
-      s->your_event_mask= SvIV(value);
+      s->led_mask= SvUV(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSViv(s->your_event_mask)));
+      PUSHs(sv_2mortal(newSVuv(s->led_mask)));
     }
 
-# END GENERATED X11_Xlib_XWindowAttributes
+# END GENERATED X11_Xlib_XKeyboardState
 # ----------------------------------------------------------------------------
-# BEGIN GENERATED X11_Xlib_XSetWindowAttributes
+# BEGIN GENERATED X11_Xlib_XRenderPictFormat
 
-MODULE = X11::Xlib                PACKAGE = X11::Xlib::XSetWindowAttributes
+MODULE = X11::Xlib                PACKAGE = X11::Xlib::XRenderPictFormat
 
 int
 _sizeof(ignored=NULL)
     SV* ignored;
     CODE:
-        RETVAL = sizeof(XSetWindowAttributes);
+        RETVAL = sizeof(XRenderPictFormat);
     OUTPUT:
         RETVAL
 
@@ -3989,247 +9735,261 @@ _initialize(s)
     INIT:
         void *sptr;
     PPCODE:
-        sptr= PerlXlib_get_struct_ptr(s, 1, "X11::Xlib::XSetWindowAttributes", sizeof(XSetWindowAttributes),
-            (PerlXlib_struct_pack_fn*) &PerlXlib_XSetWindowAttributes_pack
+        sptr= PerlXlib_get_struct_ptr(s, 1, "X11::Xlib::XRenderPictFormat", sizeof(XRenderPictFormat),
+            (PerlXlib_struct_pack_fn*) &PerlXlib_XRenderPictFormat_pack
         );
-        memset((void*) sptr, 0, sizeof(XSetWindowAttributes));
+        memset((void*) sptr, 0, sizeof(XRenderPictFormat));
 
 void
 _pack(s, fields, consume=0)
-    XSetWindowAttributes *s
+    XRenderPictFormat *s
     HV *fields
     Bool consume
     PPCODE:
-        PerlXlib_XSetWindowAttributes_pack(s, fields, consume);
-
-void
-_unpack(s, fields)
-    XSetWindowAttributes *s
-    HV *fields
-    PPCODE:
-        PerlXlib_XSetWindowAttributes_unpack_obj(s, fields, ST(0));
+        PerlXlib_XRenderPictFormat_pack(s, fields, consume);
 
 void
-background_pixel(self, value=NULL)
-    XSetWindowAttributes *self
-    SV *value
-  INIT:
-    XSetWindowAttributes *s= self;
-  PPCODE:
-    if (value) {
-      s->background_pixel= SvUV(value);
-      PUSHs(value);
-    } else {
-      PUSHs(sv_2mortal(newSVuv(s->background_pixel)));
-    }
+_unpack(s, fields)
+    XRenderPictFormat *s
+    HV *fields
+    PPCODE:
+        PerlXlib_XRenderPictFormat_unpack_obj(s, fields, ST(0));
 
 void
-background_pixmap(self, value=NULL)
-    XSetWindowAttributes *self
-    SV *value
-  INIT:
-    XSetWindowAttributes *s= self;
-  PPCODE:
-    if (value) {
-      s->background_pixmap= PerlXlib_sv_to_xid(value);
-      PUSHs(value);
-    } else {
-      PUSHs(sv_2mortal(newSVuv(s->background_pixmap)));
+get(self, ...)
+    SV *self
+  ALIAS:
+    get_list = 1
+  INIT:
+    XRenderPictFormat *s= ( XRenderPictFormat * ) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XRenderPictFormat", sizeof(XRenderPictFormat),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XRenderPictFormat_pack);
+    const PerlXlib_struct_fields *f= &PerlXlib_XRenderPictFormat_fields;
+    SV **names;
+    const char *name;
+    STRLEN len;
+    int i, idx, n= items - 1;
+  PPCODE:
+    if (ix == 1 && n == 0) {
+      EXTEND(SP, f->count * 2);
+      for (i= 0; i < f->count; i++) {
+        PUSHs(sv_2mortal(newSVpv(f->names[i], 0)));
+        PUSHs(sv_2mortal(f->get_field(s, i, self)));
+      }
+    }
+    else if (n > 0) {
+      /* results overwrite the argument list, so save the names first */
+      Newx(names, n, SV*);
+      SAVEFREEPV(names);
+      Copy(&ST(1), names, n, SV*);
+      EXTEND(SP, ix? n * 2 : n);
+      for (i= 0; i < n; i++) {
+        name= SvPV(names[i], len);
+        if ((idx= PerlXlib_struct_field_index(f, name, len)) < 0)
+          croak("No field '%s' in X11::Xlib::XRenderPictFormat", name);
+        if (ix) PUSHs(names[i]);
+        PUSHs(sv_2mortal(f->get_field(s, idx, self)));
+      }
     }
 
 void
-backing_pixel(self, value=NULL)
-    XSetWindowAttributes *self
-    SV *value
+set(self, ...)
+    SV *self
   INIT:
-    XSetWindowAttributes *s= self;
+    XRenderPictFormat *s= ( XRenderPictFormat * ) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XRenderPictFormat", sizeof(XRenderPictFormat),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XRenderPictFormat_pack);
+    const PerlXlib_struct_fields *f= &PerlXlib_XRenderPictFormat_fields;
+    const char *name;
+    STRLEN len;
+    int i, idx;
   PPCODE:
-    if (value) {
-      s->backing_pixel= SvUV(value);
-      PUSHs(value);
-    } else {
-      PUSHs(sv_2mortal(newSVuv(s->backing_pixel)));
+    if (!(items & 1)) croak("Odd number of arguments to set()");
+    for (i= 1; i < items; i+= 2) {
+      name= SvPV(ST(i), len);
+      if ((idx= PerlXlib_struct_field_index(f, name, len)) < 0)
+        croak("No field '%s' in X11::Xlib::XRenderPictFormat", name);
+      f->set_field(s, idx, ST(i+1));
     }
+    PUSHs(self);
 
 void
-backing_planes(self, value=NULL)
-    XSetWindowAttributes *self
+colormap(self, value=NULL)
+    XRenderPictFormat *self
     SV *value
   INIT:
-    XSetWindowAttributes *s= self;
+    XRenderPictFormat *s= self;
   PPCODE:
     if (value) {
-      s->backing_planes= SvUV(value);
+      s->colormap= PerlXlib_sv_to_xid(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSVuv(s->backing_planes)));
+      PUSHs(sv_2mortal(newSVuv(s->colormap)));
     }
 
 void
-backing_store(self, value=NULL)
-    XSetWindowAttributes *self
+depth(self, value=NULL)
+    XRenderPictFormat *self
     SV *value
   INIT:
-    XSetWindowAttributes *s= self;
+    XRenderPictFormat *s= self;
   PPCODE:
     if (value) {
-      s->backing_store= SvIV(value);
+      s->depth= SvIV(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSViv(s->backing_store)));
+      PUSHs(sv_2mortal(newSViv(s->depth)));
     }
 
 void
-bit_gravity(self, value=NULL)
-    XSetWindowAttributes *self
+direct_alpha(self, value=NULL)
+    XRenderPictFormat *self
     SV *value
   INIT:
-    XSetWindowAttributes *s= self;
+    XRenderPictFormat *s= self;
   PPCODE:
     if (value) {
-      s->bit_gravity= SvIV(value);
+      s->direct.alpha= SvIV(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSViv(s->bit_gravity)));
+      PUSHs(sv_2mortal(newSViv(s->direct.alpha)));
     }
 
 void
-border_pixel(self, value=NULL)
-    XSetWindowAttributes *self
+direct_alphaMask(self, value=NULL)
+    XRenderPictFormat *self
     SV *value
   INIT:
-    XSetWindowAttributes *s= self;
+    XRenderPictFormat *s= self;
   PPCODE:
     if (value) {
-      s->border_pixel= SvUV(value);
+      s->direct.alphaMask= SvIV(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSVuv(s->border_pixel)));
+      PUSHs(sv_2mortal(newSViv(s->direct.alphaMask)));
     }
 
 void
-border_pixmap(self, value=NULL)
-    XSetWindowAttributes *self
+direct_blue(self, value=NULL)
+    XRenderPictFormat *self
     SV *value
   INIT:
-    XSetWindowAttributes *s= self;
+    XRenderPictFormat *s= self;
   PPCODE:
     if (value) {
-      s->border_pixmap= PerlXlib_sv_to_xid(value);
+      s->direct.blue= SvIV(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSVuv(s->border_pixmap)));
+      PUSHs(sv_2mortal(newSViv(s->direct.blue)));
     }
 
 void
-colormap(self, value=NULL)
-    XSetWindowAttributes *self
+direct_blueMask(self, value=NULL)
+    XRenderPictFormat *self
     SV *value
   INIT:
-    XSetWindowAttributes *s= self;
+    XRenderPictFormat *s= self;
   PPCODE:
     if (value) {
-      s->colormap= PerlXlib_sv_to_xid(value);
+      s->direct.blueMask= SvIV(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSVuv(s->colormap)));
+      PUSHs(sv_2mortal(newSViv(s->direct.blueMask)));
     }
 
 void
-cursor(self, value=NULL)
-    XSetWindowAttributes *self
+direct_green(self, value=NULL)
+    XRenderPictFormat *self
     SV *value
   INIT:
-    XSetWindowAttributes *s= self;
+    XRenderPictFormat *s= self;
   PPCODE:
     if (value) {
-      s->cursor= PerlXlib_sv_to_xid(value);
+      s->direct.green= SvIV(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSVuv(s->cursor)));
+      PUSHs(sv_2mortal(newSViv(s->direct.green)));
     }
 
 void
-do_not_propagate_mask(self, value=NULL)
-    XSetWindowAttributes *self
+direct_greenMask(self, value=NULL)
+    XRenderPictFormat *self
     SV *value
   INIT:
-    XSetWindowAttributes *s= self;
+    XRenderPictFormat *s= self;
   PPCODE:
     if (value) {
-      s->do_not_propagate_mask= SvIV(value);
+      s->direct.greenMask= SvIV(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSViv(s->do_not_propagate_mask)));
+      PUSHs(sv_2mortal(newSViv(s->direct.greenMask)));
     }
 
 void
-event_mask(self, value=NULL)
-    XSetWindowAttributes *self
+direct_red(self, value=NULL)
+    XRenderPictFormat *self
     SV *value
   INIT:
-    XSetWindowAttributes *s= self;
+    XRenderPictFormat *s= self;
   PPCODE:
     if (value) {
-      s->event_mask= SvIV(value);
+      s->direct.red= SvIV(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSViv(s->event_mask)));
+      PUSHs(sv_2mortal(newSViv(s->direct.red)));
     }
 
 void
-override_redirect(self, value=NULL)
-    XSetWindowAttributes *self
+direct_redMask(self, value=NULL)
+    XRenderPictFormat *self
     SV *value
   INIT:
-    XSetWindowAttributes *s= self;
+    XRenderPictFormat *s= self;
   PPCODE:
     if (value) {
-      s->override_redirect= SvIV(value);
+      s->direct.redMask= SvIV(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSViv(s->override_redirect)));
+      PUSHs(sv_2mortal(newSViv(s->direct.redMask)));
     }
 
 void
-save_under(self, value=NULL)
-    XSetWindowAttributes *self
+id(self, value=NULL)
+    XRenderPictFormat *self
     SV *value
   INIT:
-    XSetWindowAttributes *s= self;
+    XRenderPictFormat *s= self;
   PPCODE:
     if (value) {
-      s->save_under= SvIV(value);
+      s->id= PerlXlib_sv_to_xid(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSViv(s->save_under)));
+      PUSHs(sv_2mortal(newSVuv(s->id)));
     }
 
 void
-win_gravity(self, value=NULL)
-    XSetWindowAttributes *self
+type(self, value=NULL)
+    XRenderPictFormat *self
     SV *value
   INIT:
-    XSetWindowAttributes *s= self;
+    XRenderPictFormat *s= self;
   PPCODE:
     if (value) {
-      s->win_gravity= SvIV(value);
+      s->type= SvIV(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSViv(s->win_gravity)));
+      PUSHs(sv_2mortal(newSViv(s->type)));
     }
 
-# END GENERATED X11_Xlib_XSetWindowAttributes
+# END GENERATED X11_Xlib_XRenderPictFormat
 # ----------------------------------------------------------------------------
-# BEGIN GENERATED X11_Xlib_XSizeHints
+# BEGIN GENERATED X11_Xlib_XRenderPictureAttributes
 
-MODULE = X11::Xlib                PACKAGE = X11::Xlib::XSizeHints
+MODULE = X11::Xlib                PACKAGE = X11::Xlib::XRenderPictureAttributes
 
 int
 _sizeof(ignored=NULL)
     SV* ignored;
     CODE:
-        RETVAL = sizeof(XSizeHints);
+        RETVAL = sizeof(XRenderPictureAttributes);
     OUTPUT:
         RETVAL
 
@@ -4239,289 +9999,275 @@ _initialize(s)
     INIT:
         void *sptr;
     PPCODE:
-        sptr= PerlXlib_get_struct_ptr(s, 1, "X11::Xlib::XSizeHints", sizeof(XSizeHints),
-            (PerlXlib_struct_pack_fn*) &PerlXlib_XSizeHints_pack
+        sptr= PerlXlib_get_struct_ptr(s, 1, "X11::Xlib::XRenderPictureAttributes", sizeof(XRenderPictureAttributes),
+            (PerlXlib_struct_pack_fn*) &PerlXlib_XRenderPictureAttributes_pack
         );
-        memset((void*) sptr, 0, sizeof(XSizeHints));
+        memset((void*) sptr, 0, sizeof(XRenderPictureAttributes));
 
 void
 _pack(s, fields, consume=0)
-    XSizeHints *s
+    XRenderPictureAttributes *s
     HV *fields
     Bool consume
     PPCODE:
-        PerlXlib_XSizeHints_pack(s, fields, consume);
+        PerlXlib_XRenderPictureAttributes_pack(s, fields, consume);
 
 void
 _unpack(s, fields)
-    XSizeHints *s
+    XRenderPictureAttributes *s
     HV *fields
     PPCODE:
-        PerlXlib_XSizeHints_unpack_obj(s, fields, ST(0));
-
-void
-base_height(self, value=NULL)
-    XSizeHints *self
-    SV *value
-  INIT:
-    XSizeHints *s= self;
-  PPCODE:
-    if (value) {
-      s->base_height= SvIV(value);
-      PUSHs(value);
-    } else {
-      PUSHs(sv_2mortal(newSViv(s->base_height)));
-    }
+        PerlXlib_XRenderPictureAttributes_unpack_obj(s, fields, ST(0));
 
 void
-base_width(self, value=NULL)
-    XSizeHints *self
-    SV *value
-  INIT:
-    XSizeHints *s= self;
-  PPCODE:
-    if (value) {
-      s->base_width= SvIV(value);
-      PUSHs(value);
-    } else {
-      PUSHs(sv_2mortal(newSViv(s->base_width)));
-    }
-
-void
-flags(self, value=NULL)
-    XSizeHints *self
-    SV *value
-  INIT:
-    XSizeHints *s= self;
-  PPCODE:
-    if (value) {
-      s->flags= SvIV(value);
-      PUSHs(value);
-    } else {
-      PUSHs(sv_2mortal(newSViv(s->flags)));
+get(self, ...)
+    SV *self
+  ALIAS:
+    get_list = 1
+  INIT:
+    XRenderPictureAttributes *s= ( XRenderPictureAttributes * ) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XRenderPictureAttributes", sizeof(XRenderPictureAttributes),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XRenderPictureAttributes_pack);
+    const PerlXlib_struct_fields *f= &PerlXlib_XRenderPictureAttributes_fields;
+    SV **names;
+    const char *name;
+    STRLEN len;
+    int i, idx, n= items - 1;
+  PPCODE:
+    if (ix == 1 && n == 0) {
+      EXTEND(SP, f->count * 2);
+      for (i= 0; i < f->count; i++) {
+        PUSHs(sv_2mortal(newSVpv(f->names[i], 0)));
+        PUSHs(sv_2mortal(f->get_field(s, i, self)));
+      }
     }
-
-void
-height(self, value=NULL)
-    XSizeHints *self
-    SV *value
-  INIT:
-    XSizeHints *s= self;
-  PPCODE:
-    if (value) {
-      s->height= SvIV(value);
-      PUSHs(value);
-    } else {
-      PUSHs(sv_2mortal(newSViv(s->height)));
+    else if (n > 0) {
+      /* results overwrite the argument list, so save the names first */
+      Newx(names, n, SV*);
+      SAVEFREEPV(names);
+      Copy(&ST(1), names, n, SV*);
+      EXTEND(SP, ix? n * 2 : n);
+      for (i= 0; i < n; i++) {
+        name= SvPV(names[i], len);
+        if ((idx= PerlXlib_struct_field_index(f, name, len)) < 0)
+          croak("No field '%s' in X11::Xlib::XRenderPictureAttributes", name);
+        if (ix) PUSHs(names[i]);
+        PUSHs(sv_2mortal(f->get_field(s, idx, self)));
+      }
     }
 
 void
-height_inc(self, value=NULL)
-    XSizeHints *self
-    SV *value
+set(self, ...)
+    SV *self
   INIT:
-    XSizeHints *s= self;
+    XRenderPictureAttributes *s= ( XRenderPictureAttributes * ) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XRenderPictureAttributes", sizeof(XRenderPictureAttributes),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XRenderPictureAttributes_pack);
+    const PerlXlib_struct_fields *f= &PerlXlib_XRenderPictureAttributes_fields;
+    const char *name;
+    STRLEN len;
+    int i, idx;
   PPCODE:
-    if (value) {
-      s->height_inc= SvIV(value);
-      PUSHs(value);
-    } else {
-      PUSHs(sv_2mortal(newSViv(s->height_inc)));
+    if (!(items & 1)) croak("Odd number of arguments to set()");
+    for (i= 1; i < items; i+= 2) {
+      name= SvPV(ST(i), len);
+      if ((idx= PerlXlib_struct_field_index(f, name, len)) < 0)
+        croak("No field '%s' in X11::Xlib::XRenderPictureAttributes", name);
+      f->set_field(s, idx, ST(i+1));
     }
+    PUSHs(self);
 
 void
-max_aspect_x(self, value=NULL)
-    XSizeHints *self
+alpha_map(self, value=NULL)
+    XRenderPictureAttributes *self
     SV *value
   INIT:
-    XSizeHints *s= self;
+    XRenderPictureAttributes *s= self;
   PPCODE:
     if (value) {
-      s->max_aspect.x= SvIV(value);
+      s->alpha_map= PerlXlib_sv_to_xid(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSViv(s->max_aspect.x)));
+      PUSHs(sv_2mortal(newSVuv(s->alpha_map)));
     }
 
 void
-max_aspect_y(self, value=NULL)
-    XSizeHints *self
+alpha_x_origin(self, value=NULL)
+    XRenderPictureAttributes *self
     SV *value
   INIT:
-    XSizeHints *s= self;
+    XRenderPictureAttributes *s= self;
   PPCODE:
     if (value) {
-      s->max_aspect.y= SvIV(value);
+      s->alpha_x_origin= SvIV(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSViv(s->max_aspect.y)));
+      PUSHs(sv_2mortal(newSViv(s->alpha_x_origin)));
     }
 
 void
-max_height(self, value=NULL)
-    XSizeHints *self
+alpha_y_origin(self, value=NULL)
+    XRenderPictureAttributes *self
     SV *value
   INIT:
-    XSizeHints *s= self;
+    XRenderPictureAttributes *s= self;
   PPCODE:
     if (value) {
-      s->max_height= SvIV(value);
+      s->alpha_y_origin= SvIV(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSViv(s->max_height)));
+      PUSHs(sv_2mortal(newSViv(s->alpha_y_origin)));
     }
 
 void
-max_width(self, value=NULL)
-    XSizeHints *self
+clip_mask(self, value=NULL)
+    XRenderPictureAttributes *self
     SV *value
   INIT:
-    XSizeHints *s= self;
+    XRenderPictureAttributes *s= self;
   PPCODE:
     if (value) {
-      s->max_width= SvIV(value);
+      s->clip_mask= PerlXlib_sv_to_xid(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSViv(s->max_width)));
+      PUSHs(sv_2mortal(newSVuv(s->clip_mask)));
     }
 
 void
-min_aspect_x(self, value=NULL)
-    XSizeHints *self
+clip_x_origin(self, value=NULL)
+    XRenderPictureAttributes *self
     SV *value
   INIT:
-    XSizeHints *s= self;
+    XRenderPictureAttributes *s= self;
   PPCODE:
     if (value) {
-      s->min_aspect.x= SvIV(value);
+      s->clip_x_origin= SvIV(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSViv(s->min_aspect.x)));
+      PUSHs(sv_2mortal(newSViv(s->clip_x_origin)));
     }
 
 void
-min_aspect_y(self, value=NULL)
-    XSizeHints *self
+clip_y_origin(self, value=NULL)
+    XRenderPictureAttributes *self
     SV *value
   INIT:
-    XSizeHints *s= self;
+    XRenderPictureAttributes *s= self;
   PPCODE:
     if (value) {
-      s->min_aspect.y= SvIV(value);
+      s->clip_y_origin= SvIV(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSViv(s->min_aspect.y)));
+      PUSHs(sv_2mortal(newSViv(s->clip_y_origin)));
     }
 
 void
-min_height(self, value=NULL)
-    XSizeHints *self
+component_alpha(self, value=NULL)
+    XRenderPictureAttributes *self
     SV *value
   INIT:
-    XSizeHints *s= self;
+    XRenderPictureAttributes *s= self;
   PPCODE:
     if (value) {
-      s->min_height= SvIV(value);
+      s->component_alpha= SvIV(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSViv(s->min_height)));
+      PUSHs(sv_2mortal(newSViv(s->component_alpha)));
     }
 
 void
-min_width(self, value=NULL)
-    XSizeHints *self
+dither(self, value=NULL)
+    XRenderPictureAttributes *self
     SV *value
   INIT:
-    XSizeHints *s= self;
+    XRenderPictureAttributes *s= self;
   PPCODE:
     if (value) {
-      s->min_width= SvIV(value);
+      s->dither= SvUV(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSViv(s->min_width)));
+      PUSHs(sv_2mortal(newSVuv(s->dither)));
     }
 
 void
-width(self, value=NULL)
-    XSizeHints *self
+graphics_exposures(self, value=NULL)
+    XRenderPictureAttributes *self
     SV *value
   INIT:
-    XSizeHints *s= self;
+    XRenderPictureAttributes *s= self;
   PPCODE:
     if (value) {
-      s->width= SvIV(value);
+      s->graphics_exposures= SvIV(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSViv(s->width)));
+      PUSHs(sv_2mortal(newSViv(s->graphics_exposures)));
     }
 
 void
-width_inc(self, value=NULL)
-    XSizeHints *self
+poly_edge(self, value=NULL)
+    XRenderPictureAttributes *self
     SV *value
   INIT:
-    XSizeHints *s= self;
+    XRenderPictureAttributes *s= self;
   PPCODE:
     if (value) {
-      s->width_inc= SvIV(value);
+      s->poly_edge= SvIV(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSViv(s->width_inc)));
+      PUSHs(sv_2mortal(newSViv(s->poly_edge)));
     }
 
 void
-win_gravity(self, value=NULL)
-    XSizeHints *self
+poly_mode(self, value=NULL)
+    XRenderPictureAttributes *self
     SV *value
   INIT:
-    XSizeHints *s= self;
+    XRenderPictureAttributes *s= self;
   PPCODE:
     if (value) {
-      s->win_gravity= SvIV(value);
+      s->poly_mode= SvIV(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSViv(s->win_gravity)));
+      PUSHs(sv_2mortal(newSViv(s->poly_mode)));
     }
 
 void
-x(self, value=NULL)
-    XSizeHints *self
+repeat(self, value=NULL)
+    XRenderPictureAttributes *self
     SV *value
   INIT:
-    XSizeHints *s= self;
+    XRenderPictureAttributes *s= self;
   PPCODE:
     if (value) {
-      s->x= SvIV(value);
+      s->repeat= SvIV(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSViv(s->x)));
+      PUSHs(sv_2mortal(newSViv(s->repeat)));
     }
 
 void
-y(self, value=NULL)
-    XSizeHints *self
+subwindow_mode(self, value=NULL)
+    XRenderPictureAttributes *self
     SV *value
   INIT:
-    XSizeHints *s= self;
+    XRenderPictureAttributes *s= self;
   PPCODE:
     if (value) {
-      s->y= SvIV(value);
+      s->subwindow_mode= SvIV(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSViv(s->y)));
+      PUSHs(sv_2mortal(newSViv(s->subwindow_mode)));
     }
 
-# END GENERATED X11_Xlib_XSizeHints
+# END GENERATED X11_Xlib_XRenderPictureAttributes
 # ----------------------------------------------------------------------------
-# BEGIN GENERATED X11_Xlib_XRectangle
+# BEGIN GENERATED X11_Xlib_XGCValues
 
-MODULE = X11::Xlib                PACKAGE = X11::Xlib::XRectangle
+MODULE = X11::Xlib                PACKAGE = X11::Xlib::XGCValues
 
 int
 _sizeof(ignored=NULL)
     SV* ignored;
     CODE:
-        RETVAL = sizeof(XRectangle);
+        RETVAL = sizeof(XGCValues);
     OUTPUT:
         RETVAL
 
@@ -4531,429 +10277,405 @@ _initialize(s)
     INIT:
         void *sptr;
     PPCODE:
-        sptr= PerlXlib_get_struct_ptr(s, 1, "X11::Xlib::XRectangle", sizeof(XRectangle),
-            (PerlXlib_struct_pack_fn*) &PerlXlib_XRectangle_pack
+        sptr= PerlXlib_get_struct_ptr(s, 1, "X11::Xlib::XGCValues", sizeof(XGCValues),
+            (PerlXlib_struct_pack_fn*) &PerlXlib_XGCValues_pack
         );
-        memset((void*) sptr, 0, sizeof(XRectangle));
+        memset((void*) sptr, 0, sizeof(XGCValues));
 
 void
 _pack(s, fields, consume=0)
-    XRectangle *s
+    XGCValues *s
     HV *fields
     Bool consume
     PPCODE:
-        PerlXlib_XRectangle_pack(s, fields, consume);
+        PerlXlib_XGCValues_pack(s, fields, consume);
 
 void
 _unpack(s, fields)
-    XRectangle *s
+    XGCValues *s
     HV *fields
     PPCODE:
-        PerlXlib_XRectangle_unpack_obj(s, fields, ST(0));
+        PerlXlib_XGCValues_unpack_obj(s, fields, ST(0));
 
 void
-height(self, value=NULL)
-    XRectangle *self
+get(self, ...)
+    SV *self
+  ALIAS:
+    get_list = 1
+  INIT:
+    XGCValues *s= ( XGCValues * ) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XGCValues", sizeof(XGCValues),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XGCValues_pack);
+    const PerlXlib_struct_fields *f= &PerlXlib_XGCValues_fields;
+    SV **names;
+    const char *name;
+    STRLEN len;
+    int i, idx, n= items - 1;
+  PPCODE:
+    if (ix == 1 && n == 0) {
+      EXTEND(SP, f->count * 2);
+      for (i= 0; i < f->count; i++) {
+        PUSHs(sv_2mortal(newSVpv(f->names[i], 0)));
+        PUSHs(sv_2mortal(f->get_field(s, i, self)));
+      }
+    }
+    else if (n > 0) {
+      /* results overwrite the argument list, so save the names first */
+      Newx(names, n, SV*);
+      SAVEFREEPV(names);
+      Copy(&ST(1), names, n, SV*);
+      EXTEND(SP, ix? n * 2 : n);
+      for (i= 0; i < n; i++) {
+        name= SvPV(names[i], len);
+        if ((idx= PerlXlib_struct_field_index(f, name, len)) < 0)
+          croak("No field '%s' in X11::Xlib::XGCValues", name);
+        if (ix) PUSHs(names[i]);
+        PUSHs(sv_2mortal(f->get_field(s, idx, self)));
+      }
+    }
+
+void
+set(self, ...)
+    SV *self
+  INIT:
+    XGCValues *s= ( XGCValues * ) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XGCValues", sizeof(XGCValues),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XGCValues_pack);
+    const PerlXlib_struct_fields *f= &PerlXlib_XGCValues_fields;
+    const char *name;
+    STRLEN len;
+    int i, idx;
+  PPCODE:
+    if (!(items & 1)) croak("Odd number of arguments to set()");
+    for (i= 1; i < items; i+= 2) {
+      name= SvPV(ST(i), len);
+      if ((idx= PerlXlib_struct_field_index(f, name, len)) < 0)
+        croak("No field '%s' in X11::Xlib::XGCValues", name);
+      f->set_field(s, idx, ST(i+1));
+    }
+    PUSHs(self);
+
+void
+arc_mode(self, value=NULL)
+    XGCValues *self
     SV *value
   INIT:
-    XRectangle *s= self;
+    XGCValues *s= self;
   PPCODE:
     if (value) {
-      s->height= SvUV(value);
+      s->arc_mode= SvIV(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSVuv(s->height)));
+      PUSHs(sv_2mortal(newSViv(s->arc_mode)));
     }
 
 void
-width(self, value=NULL)
-    XRectangle *self
+background(self, value=NULL)
+    XGCValues *self
     SV *value
   INIT:
-    XRectangle *s= self;
+    XGCValues *s= self;
   PPCODE:
     if (value) {
-      s->width= SvUV(value);
+      s->background= SvUV(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSVuv(s->width)));
+      PUSHs(sv_2mortal(newSVuv(s->background)));
     }
 
 void
-x(self, value=NULL)
-    XRectangle *self
+cap_style(self, value=NULL)
+    XGCValues *self
     SV *value
   INIT:
-    XRectangle *s= self;
+    XGCValues *s= self;
   PPCODE:
     if (value) {
-      s->x= SvIV(value);
+      s->cap_style= SvIV(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSViv(s->x)));
+      PUSHs(sv_2mortal(newSViv(s->cap_style)));
     }
 
 void
-y(self, value=NULL)
-    XRectangle *self
+clip_mask(self, value=NULL)
+    XGCValues *self
     SV *value
   INIT:
-    XRectangle *s= self;
+    XGCValues *s= self;
   PPCODE:
     if (value) {
-      s->y= SvIV(value);
+      s->clip_mask= PerlXlib_sv_to_xid(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSViv(s->y)));
+      PUSHs(sv_2mortal(newSVuv(s->clip_mask)));
     }
 
-# END GENERATED X11_Xlib_XRectangle
-# ----------------------------------------------------------------------------
-# BEGIN GENERATED X11_Xlib_XKeyboardState
-
-MODULE = X11::Xlib                PACKAGE = X11::Xlib::XKeyboardState
-
-int
-_sizeof(ignored=NULL)
-    SV* ignored;
-    CODE:
-        RETVAL = sizeof(XKeyboardState);
-    OUTPUT:
-        RETVAL
-
-void
-_initialize(s)
-    SV *s
-    INIT:
-        void *sptr;
-    PPCODE:
-        sptr= PerlXlib_get_struct_ptr(s, 1, "X11::Xlib::XKeyboardState", sizeof(XKeyboardState),
-            (PerlXlib_struct_pack_fn*) &PerlXlib_XKeyboardState_pack
-        );
-        memset((void*) sptr, 0, sizeof(XKeyboardState));
-
-void
-_pack(s, fields, consume=0)
-    XKeyboardState *s
-    HV *fields
-    Bool consume
-    PPCODE:
-        PerlXlib_XKeyboardState_pack(s, fields, consume);
-
-void
-_unpack(s, fields)
-    XKeyboardState *s
-    HV *fields
-    PPCODE:
-        PerlXlib_XKeyboardState_unpack_obj(s, fields, ST(0));
-
 void
-auto_repeats(self, value=NULL)
-    XKeyboardState *self
+clip_x_origin(self, value=NULL)
+    XGCValues *self
     SV *value
   INIT:
-    XKeyboardState *s= self;
+    XGCValues *s= self;
   PPCODE:
     if (value) {
-      { if (!SvPOK(value) || SvCUR(value) != sizeof(char)*32)  croak("Expected scalar of length %ld but got %ld", (long)(sizeof(char)*32), (long)SvCUR(value)); memcpy(s->auto_repeats, SvPVX(value), sizeof(char)*32);}
+      s->clip_x_origin= SvIV(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSVpvn((void*)s->auto_repeats, sizeof(char)*32)));
+      PUSHs(sv_2mortal(newSViv(s->clip_x_origin)));
     }
 
 void
-bell_duration(self, value=NULL)
-    XKeyboardState *self
+clip_y_origin(self, value=NULL)
+    XGCValues *self
     SV *value
   INIT:
-    XKeyboardState *s= self;
+    XGCValues *s= self;
   PPCODE:
     if (value) {
-      s->bell_duration= SvUV(value);
+      s->clip_y_origin= SvIV(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSVuv(s->bell_duration)));
+      PUSHs(sv_2mortal(newSViv(s->clip_y_origin)));
     }
 
 void
-bell_percent(self, value=NULL)
-    XKeyboardState *self
+dash_offset(self, value=NULL)
+    XGCValues *self
     SV *value
   INIT:
-    XKeyboardState *s= self;
+    XGCValues *s= self;
   PPCODE:
     if (value) {
-      s->bell_percent= SvIV(value);
+      s->dash_offset= SvIV(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSViv(s->bell_percent)));
+      PUSHs(sv_2mortal(newSViv(s->dash_offset)));
     }
 
 void
-bell_pitch(self, value=NULL)
-    XKeyboardState *self
+dashes(self, value=NULL)
+    XGCValues *self
     SV *value
   INIT:
-    XKeyboardState *s= self;
+    XGCValues *s= self;
   PPCODE:
     if (value) {
-      s->bell_pitch= SvUV(value);
+      s->dashes= SvIV(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSVuv(s->bell_pitch)));
+      PUSHs(sv_2mortal(newSViv(s->dashes)));
     }
 
 void
-global_auto_repeat(self, value=NULL)
-    XKeyboardState *self
+fill_rule(self, value=NULL)
+    XGCValues *self
     SV *value
   INIT:
-    XKeyboardState *s= self;
+    XGCValues *s= self;
   PPCODE:
     if (value) {
-      s->global_auto_repeat= SvIV(value);
+      s->fill_rule= SvIV(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSViv(s->global_auto_repeat)));
+      PUSHs(sv_2mortal(newSViv(s->fill_rule)));
     }
 
 void
-key_click_percent(self, value=NULL)
-    XKeyboardState *self
+fill_style(self, value=NULL)
+    XGCValues *self
     SV *value
   INIT:
-    XKeyboardState *s= self;
+    XGCValues *s= self;
   PPCODE:
     if (value) {
-      s->key_click_percent= SvIV(value);
+      s->fill_style= SvIV(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSViv(s->key_click_percent)));
+      PUSHs(sv_2mortal(newSViv(s->fill_style)));
     }
 
 void
-led_mask(self, value=NULL)
-    XKeyboardState *self
+font(self, value=NULL)
+    XGCValues *self
     SV *value
   INIT:
-    XKeyboardState *s= self;
+    XGCValues *s= self;
   PPCODE:
     if (value) {
-      s->led_mask= SvUV(value);
+      s->font= PerlXlib_sv_to_xid(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSVuv(s->led_mask)));
+      PUSHs(sv_2mortal(newSVuv(s->font)));
     }
 
-# END GENERATED X11_Xlib_XKeyboardState
-# ----------------------------------------------------------------------------
-# BEGIN GENERATED X11_Xlib_XRenderPictFormat
-
-MODULE = X11::Xlib                PACKAGE = X11::Xlib::XRenderPictFormat
-
-int
-_sizeof(ignored=NULL)
-    SV* ignored;
-    CODE:
-        RETVAL = sizeof(XRenderPictFormat);
-    OUTPUT:
-        RETVAL
-
-void
-_initialize(s)
-    SV *s
-    INIT:
-        void *sptr;
-    PPCODE:
-        sptr= PerlXlib_get_struct_ptr(s, 1, "X11::Xlib::XRenderPictFormat", sizeof(XRenderPictFormat),
-            (PerlXlib_struct_pack_fn*) &PerlXlib_XRenderPictFormat_pack
-        );
-        memset((void*) sptr, 0, sizeof(XRenderPictFormat));
-
-void
-_pack(s, fields, consume=0)
-    XRenderPictFormat *s
-    HV *fields
-    Bool consume
-    PPCODE:
-        PerlXlib_XRenderPictFormat_pack(s, fields, consume);
-
-void
-_unpack(s, fields)
-    XRenderPictFormat *s
-    HV *fields
-    PPCODE:
-        PerlXlib_XRenderPictFormat_unpack_obj(s, fields, ST(0));
-
 void
-colormap(self, value=NULL)
-    XRenderPictFormat *self
+foreground(self, value=NULL)
+    XGCValues *self
     SV *value
   INIT:
-    XRenderPictFormat *s= self;
+    XGCValues *s= self;
   PPCODE:
     if (value) {
-      s->colormap= PerlXlib_sv_to_xid(value);
+      s->foreground= SvUV(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSVuv(s->colormap)));
+      PUSHs(sv_2mortal(newSVuv(s->foreground)));
     }
 
 void
-depth(self, value=NULL)
-    XRenderPictFormat *self
+function(self, value=NULL)
+    XGCValues *self
     SV *value
   INIT:
-    XRenderPictFormat *s= self;
+    XGCValues *s= self;
   PPCODE:
     if (value) {
-      s->depth= SvIV(value);
+      s->function= SvIV(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSViv(s->depth)));
+      PUSHs(sv_2mortal(newSViv(s->function)));
     }
 
 void
-direct_alpha(self, value=NULL)
-    XRenderPictFormat *self
+graphics_exposures(self, value=NULL)
+    XGCValues *self
     SV *value
   INIT:
-    XRenderPictFormat *s= self;
+    XGCValues *s= self;
   PPCODE:
     if (value) {
-      s->direct.alpha= SvIV(value);
+      s->graphics_exposures= SvIV(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSViv(s->direct.alpha)));
+      PUSHs(sv_2mortal(newSViv(s->graphics_exposures)));
     }
 
 void
-direct_alphaMask(self, value=NULL)
-    XRenderPictFormat *self
+join_style(self, value=NULL)
+    XGCValues *self
     SV *value
   INIT:
-    XRenderPictFormat *s= self;
+    XGCValues *s= self;
   PPCODE:
     if (value) {
-      s->direct.alphaMask= SvIV(value);
+      s->join_style= SvIV(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSViv(s->direct.alphaMask)));
+      PUSHs(sv_2mortal(newSViv(s->join_style)));
     }
 
 void
-direct_blue(self, value=NULL)
-    XRenderPictFormat *self
+line_style(self, value=NULL)
+    XGCValues *self
     SV *value
   INIT:
-    XRenderPictFormat *s= self;
+    XGCValues *s= self;
   PPCODE:
     if (value) {
-      s->direct.blue= SvIV(value);
+      s->line_style= SvIV(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSViv(s->direct.blue)));
+      PUSHs(sv_2mortal(newSViv(s->line_style)));
     }
 
 void
-direct_blueMask(self, value=NULL)
-    XRenderPictFormat *self
+line_width(self, value=NULL)
+    XGCValues *self
     SV *value
   INIT:
-    XRenderPictFormat *s= self;
+    XGCValues *s= self;
   PPCODE:
     if (value) {
-      s->direct.blueMask= SvIV(value);
+      s->line_width= SvIV(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSViv(s->direct.blueMask)));
+      PUSHs(sv_2mortal(newSViv(s->line_width)));
     }
 
 void
-direct_green(self, value=NULL)
-    XRenderPictFormat *self
+plane_mask(self, value=NULL)
+    XGCValues *self
     SV *value
   INIT:
-    XRenderPictFormat *s= self;
+    XGCValues *s= self;
   PPCODE:
     if (value) {
-      s->direct.green= SvIV(value);
+      s->plane_mask= SvUV(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSViv(s->direct.green)));
+      PUSHs(sv_2mortal(newSVuv(s->plane_mask)));
     }
 
 void
-direct_greenMask(self, value=NULL)
-    XRenderPictFormat *self
+stipple(self, value=NULL)
+    XGCValues *self
     SV *value
   INIT:
-    XRenderPictFormat *s= self;
+    XGCValues *s= self;
   PPCODE:
     if (value) {
-      s->direct.greenMask= SvIV(value);
+      s->stipple= PerlXlib_sv_to_xid(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSViv(s->direct.greenMask)));
+      PUSHs(sv_2mortal(newSVuv(s->stipple)));
     }
 
 void
-direct_red(self, value=NULL)
-    XRenderPictFormat *self
+subwindow_mode(self, value=NULL)
+    XGCValues *self
     SV *value
   INIT:
-    XRenderPictFormat *s= self;
+    XGCValues *s= self;
   PPCODE:
     if (value) {
-      s->direct.red= SvIV(value);
+      s->subwindow_mode= SvIV(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSViv(s->direct.red)));
+      PUSHs(sv_2mortal(newSViv(s->subwindow_mode)));
     }
 
 void
-direct_redMask(self, value=NULL)
-    XRenderPictFormat *self
+tile(self, value=NULL)
+    XGCValues *self
     SV *value
   INIT:
-    XRenderPictFormat *s= self;
+    XGCValues *s= self;
   PPCODE:
     if (value) {
-      s->direct.redMask= SvIV(value);
+      s->tile= PerlXlib_sv_to_xid(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSViv(s->direct.redMask)));
+      PUSHs(sv_2mortal(newSVuv(s->tile)));
     }
 
 void
-id(self, value=NULL)
-    XRenderPictFormat *self
+ts_x_origin(self, value=NULL)
+    XGCValues *self
     SV *value
   INIT:
-    XRenderPictFormat *s= self;
+    XGCValues *s= self;
   PPCODE:
     if (value) {
-      s->id= PerlXlib_sv_to_xid(value);
+      s->ts_x_origin= SvIV(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSVuv(s->id)));
+      PUSHs(sv_2mortal(newSViv(s->ts_x_origin)));
     }
 
 void
-type(self, value=NULL)
-    XRenderPictFormat *self
+ts_y_origin(self, value=NULL)
+    XGCValues *self
     SV *value
   INIT:
-    XRenderPictFormat *s= self;
+    XGCValues *s= self;
   PPCODE:
     if (value) {
-      s->type= SvIV(value);
+      s->ts_y_origin= SvIV(value);
       PUSHs(value);
     } else {
-      PUSHs(sv_2mortal(newSViv(s->type)));
+      PUSHs(sv_2mortal(newSViv(s->ts_y_origin)));
     }
 
-# END GENERATED X11_Xlib_XRenderPictFormat
+# END GENERATED X11_Xlib_XGCValues
 # ----------------------------------------------------------------------------
 
 BOOT:
@@ -4964,7 +10686,9 @@ BOOT:
   newCONSTSUB(stash, "ButtonRelease", newSViv(ButtonRelease));
   newCONSTSUB(stash, "CirculateNotify", newSViv(CirculateNotify));
   newCONSTSUB(stash, "ClientMessage", newSViv(ClientMessage));
+  newCONSTSUB(stash, "ColormapInstalled", newSViv(ColormapInstalled));
   newCONSTSUB(stash, "ColormapNotify", newSViv(ColormapNotify));
+  newCONSTSUB(stash, "ColormapUninstalled", newSViv(ColormapUninstalled));
   newCONSTSUB(stash, "ConfigureNotify", newSViv(ConfigureNotify));
   newCONSTSUB(stash, "CreateNotify", newSViv(CreateNotify));
   newCONSTSUB(stash, "DestroyNotify", newSViv(DestroyNotify));
@@ -4983,6 +10707,8 @@ BOOT:
   newCONSTSUB(stash, "MapRequest", newSViv(MapRequest));
   newCONSTSUB(stash, "MotionNotify", newSViv(MotionNotify));
   newCONSTSUB(stash, "NoExpose", newSViv(NoExpose));
+  newCONSTSUB(stash, "PlaceOnBottom", newSViv(PlaceOnBottom));
+  newCONSTSUB(stash, "PlaceOnTop", newSViv(PlaceOnTop));
   newCONSTSUB(stash, "PropertyNotify", newSViv(PropertyNotify));
   newCONSTSUB(stash, "ReparentNotify", newSViv(ReparentNotify));
   newCONSTSUB(stash, "ResizeRequest", newSViv(ResizeRequest));
@@ -4990,7 +10716,10 @@ BOOT:
   newCONSTSUB(stash, "SelectionNotify", newSViv(SelectionNotify));
   newCONSTSUB(stash, "SelectionRequest", newSViv(SelectionRequest));
   newCONSTSUB(stash, "UnmapNotify", newSViv(UnmapNotify));
+  newCONSTSUB(stash, "VisibilityFullyObscured", newSViv(VisibilityFullyObscured));
   newCONSTSUB(stash, "VisibilityNotify", newSViv(VisibilityNotify));
+  newCONSTSUB(stash, "VisibilityPartiallyObscured", newSViv(VisibilityPartiallyObscured));
+  newCONSTSUB(stash, "VisibilityUnobscured", newSViv(VisibilityUnobscured));
   newCONSTSUB(stash, "NoEventMask", newSViv(NoEventMask));
   newCONSTSUB(stash, "KeyPressMask", newSViv(KeyPressMask));
   newCONSTSUB(stash, "KeyReleaseMask", newSViv(KeyReleaseMask));
@@ -5078,6 +10807,73 @@ BOOT:
   newCONSTSUB(stash, "VisualAllMask", newSViv(VisualAllMask));
   newCONSTSUB(stash, "AllocAll", newSViv(AllocAll));
   newCONSTSUB(stash, "AllocNone", newSViv(AllocNone));
+  newCONSTSUB(stash, "AllPlanes", newSVuv(AllPlanes));
+  newCONSTSUB(stash, "LSBFirst", newSViv(LSBFirst));
+  newCONSTSUB(stash, "MSBFirst", newSViv(MSBFirst));
+  newCONSTSUB(stash, "XYBitmap", newSViv(XYBitmap));
+  newCONSTSUB(stash, "XYPixmap", newSViv(XYPixmap));
+  newCONSTSUB(stash, "ZPixmap", newSViv(ZPixmap));
+  newCONSTSUB(stash, "ArcChord", newSViv(ArcChord));
+  newCONSTSUB(stash, "ArcPieSlice", newSViv(ArcPieSlice));
+  newCONSTSUB(stash, "CapButt", newSViv(CapButt));
+  newCONSTSUB(stash, "CapNotLast", newSViv(CapNotLast));
+  newCONSTSUB(stash, "CapProjecting", newSViv(CapProjecting));
+  newCONSTSUB(stash, "CapRound", newSViv(CapRound));
+  newCONSTSUB(stash, "ClipByChildren", newSViv(ClipByChildren));
+  newCONSTSUB(stash, "CoordModeOrigin", newSViv(CoordModeOrigin));
+  newCONSTSUB(stash, "CoordModePrevious", newSViv(CoordModePrevious));
+  newCONSTSUB(stash, "EvenOddRule", newSViv(EvenOddRule));
+  newCONSTSUB(stash, "FillOpaqueStippled", newSViv(FillOpaqueStippled));
+  newCONSTSUB(stash, "FillSolid", newSViv(FillSolid));
+  newCONSTSUB(stash, "FillStippled", newSViv(FillStippled));
+  newCONSTSUB(stash, "FillTiled", newSViv(FillTiled));
+  newCONSTSUB(stash, "GCArcMode", newSViv(GCArcMode));
+  newCONSTSUB(stash, "GCBackground", newSViv(GCBackground));
+  newCONSTSUB(stash, "GCCapStyle", newSViv(GCCapStyle));
+  newCONSTSUB(stash, "GCClipMask", newSViv(GCClipMask));
+  newCONSTSUB(stash, "GCClipXOrigin", newSViv(GCClipXOrigin));
+  newCONSTSUB(stash, "GCClipYOrigin", newSViv(GCClipYOrigin));
+  newCONSTSUB(stash, "GCDashList", newSViv(GCDashList));
+  newCONSTSUB(stash, "GCDashOffset", newSViv(GCDashOffset));
+  newCONSTSUB(stash, "GCFillRule", newSViv(GCFillRule));
+  newCONSTSUB(stash, "GCFillStyle", newSViv(GCFillStyle));
+  newCONSTSUB(stash, "GCFont", newSViv(GCFont));
+  newCONSTSUB(stash, "GCForeground", newSViv(GCForeground));
+  newCONSTSUB(stash, "GCFunction", newSViv(GCFunction));
+  newCONSTSUB(stash, "GCGraphicsExposures", newSViv(GCGraphicsExposures));
+  newCONSTSUB(stash, "GCJoinStyle", newSViv(GCJoinStyle));
+  newCONSTSUB(stash, "GCLineStyle", newSViv(GCLineStyle));
+  newCONSTSUB(stash, "GCLineWidth", newSViv(GCLineWidth));
+  newCONSTSUB(stash, "GCPlaneMask", newSViv(GCPlaneMask));
+  newCONSTSUB(stash, "GCStipple", newSViv(GCStipple));
+  newCONSTSUB(stash, "GCSubwindowMode", newSViv(GCSubwindowMode));
+  newCONSTSUB(stash, "GCTile", newSViv(GCTile));
+  newCONSTSUB(stash, "GCTileStipXOrigin", newSViv(GCTileStipXOrigin));
+  newCONSTSUB(stash, "GCTileStipYOrigin", newSViv(GCTileStipYOrigin));
+  newCONSTSUB(stash, "GXand", newSViv(GXand));
+  newCONSTSUB(stash, "GXandInverted", newSViv(GXandInverted));
+  newCONSTSUB(stash, "GXandReverse", newSViv(GXandReverse));
+  newCONSTSUB(stash, "GXclear", newSViv(GXclear));
+  newCONSTSUB(stash, "GXcopy", newSViv(GXcopy));
+  newCONSTSUB(stash, "GXcopyInverted", newSViv(GXcopyInverted));
+  newCONSTSUB(stash, "GXequiv", newSViv(GXequiv));
+  newCONSTSUB(stash, "GXinvert", newSViv(GXinvert));
+  newCONSTSUB(stash, "GXnand", newSViv(GXnand));
+  newCONSTSUB(stash, "GXnoop", newSViv(GXnoop));
+  newCONSTSUB(stash, "GXnor", newSViv(GXnor));
+  newCONSTSUB(stash, "GXor", newSViv(GXor));
+  newCONSTSUB(stash, "GXorInverted", newSViv(GXorInverted));
+  newCONSTSUB(stash, "GXorReverse", newSViv(GXorReverse));
+  newCONSTSUB(stash, "GXset", newSViv(GXset));
+  newCONSTSUB(stash, "GXxor", newSViv(GXxor));
+  newCONSTSUB(stash, "IncludeInferiors", newSViv(IncludeInferiors));
+  newCONSTSUB(stash, "JoinBevel", newSViv(JoinBevel));
+  newCONSTSUB(stash, "JoinMiter", newSViv(JoinMiter));
+  newCONSTSUB(stash, "JoinRound", newSViv(JoinRound));
+  newCONSTSUB(stash, "LineDoubleDash", newSViv(LineDoubleDash));
+  newCONSTSUB(stash, "LineOnOffDash", newSViv(LineOnOffDash));
+  newCONSTSUB(stash, "LineSolid", newSViv(LineSolid));
+  newCONSTSUB(stash, "WindingRule", newSViv(WindingRule));
   newCONSTSUB(stash, "AnyPropertyType", newSViv(AnyPropertyType));
   newCONSTSUB(stash, "PropModeReplace", newSViv(PropModeReplace));
   newCONSTSUB(stash, "PropModeAppend", newSViv(PropModeAppend));
@@ -5144,6 +10940,8 @@ BOOT:
   newCONSTSUB(stash, "PWinGravity", newSViv(PWinGravity));
   newCONSTSUB(stash, "CompositeRedirectAutomatic", newSViv(CompositeRedirectAutomatic));
   newCONSTSUB(stash, "CompositeRedirectManual", newSViv(CompositeRedirectManual));
+  newCONSTSUB(stash, "XFixesDisplayCursorNotify", newSViv(XFixesDisplayCursorNotify));
+  newCONSTSUB(stash, "XFixesDisplayCursorNotifyMask", newSViv(XFixesDisplayCursorNotifyMask));
   newCONSTSUB(stash, "ShapeSet", newSViv(ShapeSet));
   newCONSTSUB(stash, "ShapeUnion", newSViv(ShapeUnion));
   newCONSTSUB(stash, "ShapeIntersect", newSViv(ShapeIntersect));
@@ -5152,5 +10950,49 @@ BOOT:
   newCONSTSUB(stash, "ShapeBounding", newSViv(ShapeBounding));
   newCONSTSUB(stash, "ShapeClip", newSViv(ShapeClip));
   newCONSTSUB(stash, "ShapeInput", newSViv(ShapeInput));
+  newCONSTSUB(stash, "XDamageReportRawRectangles", newSViv(XDamageReportRawRectangles));
+  newCONSTSUB(stash, "XDamageReportDeltaRectangles", newSViv(XDamageReportDeltaRectangles));
+  newCONSTSUB(stash, "XDamageReportBoundingBox", newSViv(XDamageReportBoundingBox));
+  newCONSTSUB(stash, "XDamageReportNonEmpty", newSViv(XDamageReportNonEmpty));
+  newCONSTSUB(stash, "PictStandardARGB32", newSViv(PictStandardARGB32));
+  newCONSTSUB(stash, "PictStandardRGB24", newSViv(PictStandardRGB24));
+  newCONSTSUB(stash, "PictStandardA8", newSViv(PictStandardA8));
+  newCONSTSUB(stash, "PictStandardA4", newSViv(PictStandardA4));
+  newCONSTSUB(stash, "PictStandardA1", newSViv(PictStandardA1));
+  newCONSTSUB(stash, "PictOpClear", newSViv(PictOpClear));
+  newCONSTSUB(stash, "PictOpSrc", newSViv(PictOpSrc));
+  newCONSTSUB(stash, "PictOpDst", newSViv(PictOpDst));
+  newCONSTSUB(stash, "PictOpOver", newSViv(PictOpOver));
+  newCONSTSUB(stash, "PictOpOverReverse", newSViv(PictOpOverReverse));
+  newCONSTSUB(stash, "PictOpIn", newSViv(PictOpIn));
+  newCONSTSUB(stash, "PictOpInReverse", newSViv(PictOpInReverse));
+  newCONSTSUB(stash, "PictOpOut", newSViv(PictOpOut));
+  newCONSTSUB(stash, "PictOpOutReverse", newSViv(PictOpOutReverse));
+  newCONSTSUB(stash, "PictOpAtop", newSViv(PictOpAtop));
+  newCONSTSUB(stash, "PictOpAtopReverse", newSViv(PictOpAtopReverse));
+  newCONSTSUB(stash, "PictOpXor", newSViv(PictOpXor));
+  newCONSTSUB(stash, "PictOpAdd", newSViv(PictOpAdd));
+  newCONSTSUB(stash, "PictOpSaturate", newSViv(PictOpSaturate));
+  newCONSTSUB(stash, "PolyEdgeSharp", newSViv(PolyEdgeSharp));
+  newCONSTSUB(stash, "PolyEdgeSmooth", newSViv(PolyEdgeSmooth));
+  newCONSTSUB(stash, "PolyModePrecise", newSViv(PolyModePrecise));
+  newCONSTSUB(stash, "PolyModeImprecise", newSViv(PolyModeImprecise));
+  newCONSTSUB(stash, "RepeatNone", newSViv(RepeatNone));
+  newCONSTSUB(stash, "RepeatNormal", newSViv(RepeatNormal));
+  newCONSTSUB(stash, "RepeatPad", newSViv(RepeatPad));
+  newCONSTSUB(stash, "RepeatReflect", newSViv(RepeatReflect));
+  newCONSTSUB(stash, "CPRepeat", newSViv(CPRepeat));
+  newCONSTSUB(stash, "CPAlphaMap", newSViv(CPAlphaMap));
+  newCONSTSUB(stash, "CPAlphaXOrigin", newSViv(CPAlphaXOrigin));
+  newCONSTSUB(stash, "CPAlphaYOrigin", newSViv(CPAlphaYOrigin));
+  newCONSTSUB(stash, "CPClipXOrigin", newSViv(CPClipXOrigin));
+  newCONSTSUB(stash, "CPClipYOrigin", newSViv(CPClipYOrigin));
+  newCONSTSUB(stash, "CPClipMask", newSViv(CPClipMask));
+  newCONSTSUB(stash, "CPGraphicsExposure", newSViv(CPGraphicsExposure));
+  newCONSTSUB(stash, "CPSubwindowMode", newSViv(CPSubwindowMode));
+  newCONSTSUB(stash, "CPPolyEdge", newSViv(CPPolyEdge));
+  newCONSTSUB(stash, "CPPolyMode", newSViv(CPPolyMode));
+  newCONSTSUB(stash, "CPDither", newSViv(CPDither));
+  newCONSTSUB(stash, "CPComponentAlpha", newSViv(CPComponentAlpha));
 # END GENERATED BOOT CONSTANTS
 #
@@ -16,6 +16,7 @@ bootstrap X11::Xlib;
 
 require X11::Xlib::Struct;
 require X11::Xlib::Opaque;
+require X11::Xlib::XImage;
 
 my %_constants= (
 # BEGIN GENERATED XS CONSTANT LIST
@@ -24,11 +25,13 @@ my %_constants= (
     BadFont BadGC BadIDChoice BadImplementation BadLength BadMatch BadName
     BadPixmap BadRequest BadValue BadWindow Success )],
   const_event => [qw( ButtonPress ButtonRelease CirculateNotify ClientMessage
-    ColormapNotify ConfigureNotify CreateNotify DestroyNotify EnterNotify
-    Expose FocusIn FocusOut GraphicsExpose GravityNotify KeyPress KeyRelease
-    KeymapNotify LeaveNotify MapNotify MapRequest MappingNotify MotionNotify
-    NoExpose PropertyNotify ReparentNotify ResizeRequest SelectionClear
-    SelectionNotify SelectionRequest UnmapNotify VisibilityNotify )],
+    ColormapInstalled ColormapNotify ColormapUninstalled ConfigureNotify
+    CreateNotify DestroyNotify EnterNotify Expose FocusIn FocusOut
+    GraphicsExpose GravityNotify KeyPress KeyRelease KeymapNotify LeaveNotify
+    MapNotify MapRequest MappingNotify MotionNotify NoExpose PlaceOnBottom
+    PlaceOnTop PropertyNotify ReparentNotify ResizeRequest SelectionClear
+    SelectionNotify SelectionRequest UnmapNotify VisibilityFullyObscured
+    VisibilityNotify VisibilityPartiallyObscured VisibilityUnobscured )],
   const_event_mask => [qw( Button1MotionMask Button2MotionMask
     Button3MotionMask Button4MotionMask Button5MotionMask ButtonMotionMask
     ButtonPressMask ButtonReleaseMask ColormapChangeMask EnterWindowMask
@@ -39,8 +42,34 @@ my %_constants= (
     VisibilityChangeMask )],
   const_ext_composite => [qw( CompositeRedirectAutomatic
     CompositeRedirectManual )],
+  const_ext_damage => [qw( XDamageReportBoundingBox
+    XDamageReportDeltaRectangles XDamageReportNonEmpty
+    XDamageReportRawRectangles )],
+  const_ext_render => [qw( CPAlphaMap CPAlphaXOrigin CPAlphaYOrigin CPClipMask
+    CPClipXOrigin CPClipYOrigin CPComponentAlpha CPDither CPGraphicsExposure
+    CPPolyEdge CPPolyMode CPRepeat CPSubwindowMode PictOpAdd PictOpAtop
+    PictOpAtopReverse PictOpClear PictOpDst PictOpIn PictOpInReverse PictOpOut
+    PictOpOutReverse PictOpOver PictOpOverReverse PictOpSaturate PictOpSrc
+    PictOpXor PictStandardA1 PictStandardA4 PictStandardA8 PictStandardARGB32
+    PictStandardRGB24 PolyEdgeSharp PolyEdgeSmooth PolyModeImprecise
+    PolyModePrecise RepeatNone RepeatNormal RepeatPad RepeatReflect )],
   const_ext_shape => [qw( ShapeBounding ShapeClip ShapeInput ShapeIntersect
     ShapeInvert ShapeSet ShapeSubtract ShapeUnion )],
+  const_ext_xfixes => [qw( XFixesDisplayCursorNotify
+    XFixesDisplayCursorNotifyMask )],
+  const_gc => [qw( ArcChord ArcPieSlice CapButt CapNotLast CapProjecting
+    CapRound ClipByChildren CoordModeOrigin CoordModePrevious EvenOddRule
+    FillOpaqueStippled FillSolid FillStippled FillTiled GCArcMode GCBackground
+    GCCapStyle GCClipMask GCClipXOrigin GCClipYOrigin GCDashList GCDashOffset
+    GCFillRule GCFillStyle GCFont GCForeground GCFunction GCGraphicsExposures
+    GCJoinStyle GCLineStyle GCLineWidth GCPlaneMask GCStipple GCSubwindowMode
+    GCTile GCTileStipXOrigin GCTileStipYOrigin GXand GXandInverted
+    GXandReverse GXclear GXcopy GXcopyInverted GXequiv GXinvert GXnand GXnoop
+    GXnor GXor GXorInverted GXorReverse GXset GXxor IncludeInferiors JoinBevel
+    JoinMiter JoinRound LineDoubleDash LineOnOffDash LineSolid WindingRule
+    )],
+  const_image => [qw( AllPlanes LSBFirst MSBFirst XYBitmap XYPixmap ZPixmap
+    )],
   const_input => [qw( AnyKey AnyModifier AsyncBoth AsyncKeyboard AsyncPointer
     Button1Mask Button2Mask Button3Mask Button4Mask Button5Mask ControlMask
     GrabModeAsync GrabModeSync LockMask Mod1Mask Mod2Mask Mod3Mask Mod4Mask
@@ -69,12 +98,19 @@ my %_constants= (
 my %_functions= (
 # BEGIN GENERATED XS FUNCTION LIST
   fn_atom => [qw( XGetAtomName XGetAtomNames XInternAtom XInternAtoms )],
-  fn_conn => [qw( ConnectionNumber XCloseDisplay XDisplayName XOpenDisplay
-    XServerVendor XSetCloseDownMode XVendorRelease )],
+  fn_conn => [qw( ConnectionNumber LastKnownRequestProcessed XCloseDisplay
+    XDisplayName XNextRequest XOpenDisplay XServerVendor XSetCloseDownMode
+    XVendorRelease )],
   fn_event => [qw( XCheckMaskEvent XCheckTypedEvent XCheckTypedWindowEvent
     XCheckWindowEvent XEventsQueued XFlush XGetErrorDatabaseText XGetErrorText
     XNextEvent XPending XPutBackEvent XQLength XSelectInput XSendEvent XSync
     )],
+  fn_gc => [qw( XChangeGC XCopyArea XCreateGC XDrawArcs XDrawLines XDrawPoints
+    XDrawRectangles XDrawSegments XFillArcs XFillRectangles XFreeGC
+    XGetGCValues XSetBackground XSetForeground XSetFunction XSetLineAttributes
+    )],
+  fn_image => [qw( XCreateImage XDestroyImage XGetImage XGetPixel XGetSubImage
+    XPutImage XPutPixel )],
   fn_input => [qw( XAllowEvents XBell XGetKeyboardControl XGrabButton XGrabKey
     XGrabKeyboard XGrabPointer XQueryKeymap XQueryPointer XSetInputFocus
     XUngrabButton XUngrabKey XUngrabKeyboard XUngrabPointer XWarpPointer
@@ -94,15 +130,15 @@ my %_functions= (
   fn_vis => [qw( XCreateColormap XFreeColormap XGetVisualInfo XMatchVisualInfo
     XVisualIDFromVisual )],
   fn_win => [qw( XChangeProperty XChangeWindowAttributes XCirculateSubwindows
-    XConfigureWindow XCreateSimpleWindow XCreateWindow XDefineCursor
-    XDeleteProperty XDestroyWindow XGetGeometry XGetWMNormalHints
-    XGetWMProtocols XGetWMSizeHints XGetWindowAttributes XGetWindowProperty
-    XListProperties XLowerWindow XMapWindow XMoveResizeWindow XMoveWindow
-    XQueryTree XRaiseWindow XReparentWindow XResizeWindow XRestackWindows
-    XSetWMNormalHints XSetWMProtocols XSetWMSizeHints XSetWindowBackground
-    XSetWindowBackgroundPixmap XSetWindowBorder XSetWindowBorderPixmap
-    XSetWindowBorderWidth XSetWindowColormap XTranslateCoordinates
-    XUndefineCursor XUnmapWindow )],
+    XConfigureWindow XCreateFontCursor XCreateSimpleWindow XCreateWindow
+    XDefineCursor XDeleteProperty XDestroyWindow XFreeCursor XGetGeometry
+    XGetWMNormalHints XGetWMProtocols XGetWMSizeHints XGetWindowAttributes
+    XGetWindowProperty XListProperties XLowerWindow XMapWindow
+    XMoveResizeWindow XMoveWindow XQueryTree XRaiseWindow XReparentWindow
+    XResizeWindow XRestackWindows XSetWMNormalHints XSetWMProtocols
+    XSetWMSizeHints XSetWindowBackground XSetWindowBackgroundPixmap
+    XSetWindowBorder XSetWindowBorderPixmap XSetWindowBorderWidth
+    XSetWindowColormap XTranslateCoordinates XUndefineCursor XUnmapWindow )],
   fn_xtest => [qw( XTestFakeButtonEvent XTestFakeKeyEvent XTestFakeMotionEvent
     )],
 # END GENERATED XS FUNCTION LIST
@@ -173,6 +209,8 @@ sub on_error {
 sub _error_nonfatal {
     my $event= shift;
     my $dpy= $event->display;
+    # Freeing an XID that was already gone, from $display->collect
+    return if $dpy && $dpy->{_free_serials} && $dpy->_is_free_error($event->serial);
     if ($on_error) {
         try { $on_error->($dpy, $event); }
         catch { warn $_; };
@@ -396,6 +434,22 @@ Return the file descriptor (integer) of the socket connected to the server.
 This is useful for select/poll designs.
 (See also: L<X11::Xlib::Display/wait_event>)
 
+=head3 XNextRequest
+
+  my $serial= XNextRequest($display);
+
+The serial number which the next request will have.  Error events carry the
+serial of the request that caused them, so recording this before and after a
+group of requests identifies the errors which belong to that group.
+
+=head3 LastKnownRequestProcessed
+
+  my $serial= LastKnownRequestProcessed($display);
+
+The serial of the last request for which Xlib has read a reply, event or error
+from the server.  Any error for a request up to this serial has already been
+delivered to the error handler.
+
 =head3 XServerVendor
 
   $name= XServerVendor($display);
@@ -768,6 +822,167 @@ This function uses a bitmap (1 bit per pixel) and a foreground and background
 color to build a pixmap of those two colors.  It's basically upscaling color
 from monochrome to C<$depth>.
 
+=head2 IMAGE FUNCTIONS
+
+These functions use L<X11::Xlib::XImage> objects, whose pixel data is stored in
+a perl scalar.  Wherever a C<$data> variable is accepted, that variable becomes
+the image's buffer (it is not copied) so it can be reused for later calls.
+
+=head3 XCreateImage
+
+  my $image= XCreateImage($display, $visual, $depth, $format, $offset, $data,
+    $width, $height, $bitmap_pad, $bytes_per_line);
+
+Create a client-side image.  C<$data> may be a variable holding existing pixels,
+or an undefined variable, and is extended with zeroes if it is shorter than the
+image.  C<$bytes_per_line> may be 0 (or omitted) to let Xlib calculate it from
+C<$bitmap_pad>.
+
+=head3 XGetImage
+
+  my $image= XGetImage($display, $drawable, $x, $y, $width, $height,
+    $plane_mask, $format, $data);
+
+Read pixels from the server.  The reply is read directly into C<$data> (if
+given) or a new scalar, which becomes the image's buffer.  Returns undef if
+the request fails.  C<$plane_mask> is usually C<AllPlanes> and C<$format> is
+usually C<ZPixmap>.
+
+=head3 XGetSubImage
+
+  XGetSubImage($display, $drawable, $x, $y, $width, $height,
+    $plane_mask, $format, $dest_image, $dest_x, $dest_y)
+    or die "failed";
+
+Read pixels from the server into an existing image, returning the image, or
+undef on failure.  When the area is the same size as a C<ZPixmap> image, the
+reply is read straight into the image's buffer, which makes this the cheapest
+way to capture the same area repeatedly.
+
+=head3 XPutImage
+
+  XPutImage($display, $drawable, $gc, $image, $src_x, $src_y,
+    $dest_x, $dest_y, $width, $height);
+
+Send pixels of the image to the server.
+
+=head3 XGetPixel
+
+  my $pixel= XGetPixel($image, $x, $y);
+
+=head3 XPutPixel
+
+  XPutPixel($image, $x, $y, $pixel);
+
+These are convenient, but slow.  For bulk access, work on the image's buffer
+directly using L<X11::Xlib::XImage/bytes_per_line> and
+L<X11::Xlib::XImage/bits_per_pixel>.
+
+=head3 XDestroyImage
+
+  XDestroyImage($image);
+
+Free the C<XImage> struct.  This happens automatically when the object goes
+out of scope, so there is rarely any need to call it.  The perl buffer is not
+affected.
+
+=head2 GC FUNCTIONS
+
+A Graphics Context holds the drawing state (colors, line style, clipping, and so on)
+used by the core drawing requests.  It is an L<X11::Xlib::GC> object.
+
+=head3 XCreateGC
+
+  my $gc= XCreateGC($display, $drawable);
+  my $gc= XCreateGC($display, $drawable, GCForeground|GCLineWidth,
+    { foreground => $pixel, line_width => 2 });
+
+Create a GC usable on drawables of the same screen and depth as C<$drawable>.
+The last argument is an L<X11::Xlib::XGCValues> or hashref of its fields, and the
+mask says which of them to use; the rest get the protocol defaults.  If the mask
+is zero, the values may be omitted.  The GC must be released with L</XFreeGC>.
+
+=head3 XChangeGC
+
+  XChangeGC($display, $gc, $valuemask, \%XGCValues);
+
+Change the fields of the GC named by C<$valuemask>.
+
+=head3 XGetGCValues
+
+  XGetGCValues($display, $gc, $valuemask, my $values) or die;
+
+Read back fields of a GC into an L<X11::Xlib::XGCValues>.  C<GCClipMask> and
+C<GCDashList> cannot be read.  This is answered from Xlib's cache, not by the server.
+
+=head3 XFreeGC
+
+  XFreeGC($display, $gc);
+
+Free the GC.  The C<$gc> object can't be used afterward.
+
+=head3 XSetForeground
+
+=head3 XSetBackground
+
+  XSetForeground($display, $gc, $pixel);
+
+=head3 XSetFunction
+
+  XSetFunction($display, $gc, GXxor);
+
+=head3 XSetLineAttributes
+
+  XSetLineAttributes($display, $gc, $line_width, $line_style, $cap_style, $join_style);
+
+=head3 XDrawPoints
+
+=head3 XDrawLines
+
+  XDrawPoints($display, $drawable, $gc, pack('s*', @xy), $mode);
+
+Draw points, or a connected line through them.  The points are a string of packed
+16-bit C<x,y> pairs.  C<$mode> is C<CoordModeOrigin> (the default), or
+C<CoordModePrevious> to make each point relative to the one before.
+
+=head3 XDrawSegments
+
+  XDrawSegments($display, $drawable, $gc, pack('s*', $x1,$y1,$x2,$y2, ...));
+
+Draw unconnected lines, packed as 16-bit C<x1,y1,x2,y2>.
+
+=head3 XDrawRectangles
+
+=head3 XFillRectangles
+
+  XFillRectangles($display, $drawable, $gc, \@rects);
+  XFillRectangles($display, $drawable, $gc, pack('(s s S S)*', ...));
+
+The rectangles are an arrayref of L<X11::Xlib::XRectangle> (or hashrefs), or a
+string of packed XRectangle.
+
+=head3 XDrawArcs
+
+=head3 XFillArcs
+
+  XFillArcs($display, $drawable, $gc, pack('(s s S S s s)*', $x, $y, $w, $h, $angle1, $angle2, ...));
+
+Arcs are packed as C<x, y, width, height> of the bounding box followed by the start
+angle and extent, in 64ths of a degree.  A full circle is C<0, 360*64>.
+
+All of the drawing functions above take the whole list in one call.  Xlib sends it
+as one request (or as few as the maximum request size allows), and merges it with
+the previous request if that was the same kind with the same GC and drawable, so
+drawing tens of thousands of shapes costs about the same as packing them.
+
+=head3 XCopyArea
+
+  XCopyArea($display, $src, $dst, $gc, $src_x, $src_y, $width, $height, $dst_x, $dst_y);
+
+Copy a rectangle between drawables of the same screen and depth.  The protocol has
+no form of this for many rectangles; see L<X11::Xlib::Display/copy_areas> to issue
+many of them in one call.
+
 =head2 WINDOW FUNCTIONS
 
 =head3 XCreateWindow
@@ -897,6 +1112,18 @@ Set the background pixel color (integer) for the window.
 
   XUndefineCursor($display, $window)
 
+=head3 XCreateFontCursor
+
+  my $cursor= XCreateFontCursor($display, $shape);
+
+Create one of the standard cursors, where C<$shape> is one of the even numbers
+defined in F<X11/cursorfont.h> (for instance 68 for C<XC_left_ptr>, or 150 for
+C<XC_watch>).  Free it with L</XFreeCursor>.
+
+=head3 XFreeCursor
+
+  XFreeCursor($display, $cursor)
+
 =head3 XReparentWindow
 
   XReparentWindow($display, $wnd, $new_parent, $x, $y);
@@ -1088,6 +1315,9 @@ always available.
 Don't forget to call L</XFlush> after these methods, if you want the events to
 happen immediately.
 
+To send many events, see L<X11::Xlib::Display/fake_input_script>, which replays
+a packed list of them in one call.
+
 =head3 XTestFakeMotionEvent
 
   XTestFakeMotionEvent($display, $screen, $x, $y, $EventSendDelay)
@@ -1506,6 +1736,10 @@ None of these functions are exportable.
 
   my $pixmap= $display->XCompositeNameWindowPixmap($window);
 
+The pixmap holds the whole window even where it is covered.  The server replaces
+it whenever the window is mapped or resized, so name it again then.  See
+L<X11::Xlib::CompositeCapture> for capturing windows this way.
+
 =head3 XCompositeGetOverlayWindow
 
   my $window= $display->XCompositeGetOverlayWindow($window);
@@ -1535,14 +1769,74 @@ the following functions will be available:
 
 The local client library version, independent of the server.
 
+=head3 XFixesSelectCursorInput
+
+  $display->XFixesSelectCursorInput($root_window, XFixesDisplayCursorNotifyMask);
+
+Ask for an L<XFixesCursorNotifyEvent|X11::Xlib::XEvent/XFixesCursorNotifyEvent>
+each time the cursor image changes.  Pass a mask of 0 to stop.
+
+=head3 XFixesGetCursorImage
+
+  my $cursor= $display->XFixesGetCursorImage;
+  # {
+  #   x => $pointer_x, y => $pointer_y,
+  #   width => $w, height => $h, xhot => $hot_x, yhot => $hot_y,
+  #   cursor_serial => $serial,
+  #   pixels => $argb,
+  #   atom => $name_atom, name => $name,   # XFixes 2
+  # }
+
+Fetch the image of the current cursor.  C<pixels> is C<width * height>
+premultiplied ARGB pixels, packed as native 32-bit integers with no row padding
+(ready for L<blend_over|X11::Xlib::Pixels/blend_over>).  C<cursor_serial>
+identifies the image, and matches the one in cursor notify events, so the image
+only needs to be fetched again when a new serial is seen.  See
+L<X11::Xlib::CursorCapture>, which does that.
+
 =head3 XFixesCreateRegion
 
   $region_xid= XFixesCreateRegion($display, \@rects);
+  $region_xid= XFixesCreateRegion($display, $packed_rects);
 
-Given an arrayref of L<XRectangle|X11::Xlib::XRectangle>, returns the union of all those rects
+Given an arrayref of L<XRectangle|X11::Xlib::XRectangle>, or a string of packed XRectangle
+(such as from L<X11::Xlib::Region/packed_rects>), returns the union of all those rects
 as an XserverRegion (server-side XID).  If you want an L<XserverRegion|X11::Xlib::XserverRegion>
 object, use the method of the Display object.
 
+=head3 XFixesSetRegion
+
+  XFixesSetRegion($display, $region, \@rects_or_packed);
+
+Replace the contents of a region with the union of the rectangles.
+
+=head3 XFixesCopyRegion
+
+  XFixesCopyRegion($display, $dst, $src);
+
+=head3 XFixesUnionRegion
+
+=head3 XFixesIntersectRegion
+
+=head3 XFixesSubtractRegion
+
+  XFixesUnionRegion($display, $dst, $src1, $src2);
+
+Store the combination of C<$src1> and C<$src2> in C<$dst>, which may be one of the sources.
+These are single requests with no reply, so when the regions already live on the server
+this is cheaper than fetching them; when they are built up from many rectangles in the
+client, combine them with L<X11::Xlib::Region> and send only the result.
+
+=head3 XFixesTranslateRegion
+
+  XFixesTranslateRegion($display, $region, $dx, $dy);
+
+=head3 XFixesRegionExtents
+
+  XFixesRegionExtents($display, $dst, $src);
+
+Set C<$dst> to the bounding rectangle of C<$src>.
+
 =head3 XFixesDestroyRegion
 
   XFixesDestroyRegion($display, $region);
@@ -1556,6 +1850,66 @@ region at an offset.  The shape is a copy of the region, and does not hold a ref
 By setting the input shape to an empty region, and using a Visual with alpha channel, you can
 make a top-level transparent window that does not intercept input events.
 
+=head3 XFixesFetchRegion
+
+  my @rects= XFixesFetchRegion($display, $region);
+
+Returns the rectangles of a region as a list of L<XRectangle|X11::Xlib::XRectangle>.
+
+=head2 EXTENSION XDAMAGE
+
+This is an optional extension.  If you have Xdamage available when this
+module was installed, then the following functions will be available.
+None of these functions are exportable.  DAMAGE uses the regions of XFixes.
+
+  sudo apt-get install libxdamage-dev   # Debian/Mint/Ubuntu
+  sudo yum install libXdamage-devel     # Fedora/RHEL
+
+See L<X11::Xlib::DamageCapture> for incremental capture of windows built on
+these.
+
+=head3 XDamageQueryExtension
+
+  my ($event_base, $error_base)= $display->XDamageQueryExtension()
+    if $display->can('XDamageQueryExtension');
+
+Besides returning the event base, this registers the event code of
+C<DamageNotify> so that those events become
+L<XDamageNotifyEvent|X11::Xlib::XEvent/XDamageNotifyEvent> objects.  Call it
+before reading events.
+
+=head3 XDamageQueryVersion
+
+  my ($major, $minor)= $display->XDamageQueryVersion();
+
+=head3 XDamageCreate
+
+  my $damage= $display->XDamageCreate($drawable, $level);
+
+Start tracking changes to C<$drawable>.  C<$level> is one of
+C<XDamageReportRawRectangles>, C<XDamageReportDeltaRectangles>,
+C<XDamageReportBoundingBox>, or C<XDamageReportNonEmpty>, which controls how
+many C<DamageNotify> events are sent.  When called as a method of
+L<X11::Xlib::Display>, this returns an L<X11::Xlib::Damage> object.
+
+=head3 XDamageDestroy
+
+  $display->XDamageDestroy($damage);
+
+=head3 XDamageSubtract
+
+  $display->XDamageSubtract($damage, $repair, $parts);
+
+If C<$repair> is C<None> (0), copy all accumulated damage into the region
+C<$parts> (if not C<None>) and clear it.  Otherwise, copy the intersection of
+the damage and C<$repair> into C<$parts>, and remove C<$repair> from the damage.
+
+=head3 XDamageAdd
+
+  $display->XDamageAdd($drawable, $region);
+
+Report damage to a drawable which the server wouldn't otherwise know about.
+
 =head2 EXTENSION XRENDER
 
 This is an optional extension.  If you have Xrender available when this
@@ -1581,6 +1935,213 @@ None of these functions are exportable.
 
 Takes a L<X11::Xlib::Visual>, and returns a L<X11::Xlib::XRenderPictFormat>.
 
+=head3 XRenderFindStandardFormat
+
+  my $pfmt= $display->XRenderFindStandardFormat( PictStandardA8 );
+
+Returns the L<X11::Xlib::XRenderPictFormat> for one of C<PictStandardARGB32>,
+C<PictStandardRGB24>, C<PictStandardA8>, C<PictStandardA4>, or C<PictStandardA1>.
+
+=head3 XRenderCreatePicture
+
+  my $picture= $display->XRenderCreatePicture($drawable, $pfmt, $valuemask, $attrs);
+
+Create a Picture for a window or pixmap, given the
+L<X11::Xlib::XRenderPictFormat> matching its visual or depth.  C<$valuemask>
+(C<CPRepeat>, etc.) and C<$attrs> (an L<X11::Xlib::XRenderPictureAttributes> or
+hashref of its fields) are optional.  Called as a method of a Display object, this
+returns an L<X11::Xlib::Picture> which is freed when it goes out of scope.
+
+=head3 XRenderChangePicture
+
+  $display->XRenderChangePicture($picture, $valuemask, $attrs);
+
+=head3 XRenderFreePicture
+
+  $display->XRenderFreePicture($picture);
+
+=head3 XRenderComposite
+
+  $display->XRenderComposite($op, $src, $mask, $dst, $src_x, $src_y,
+    $mask_x, $mask_y, $dst_x, $dst_y, $width, $height);
+
+Combine C<$src> (through the alpha of C<$mask>, or C<None>) into C<$dst> using one
+of the C<PictOp*> operators.
+
+=head3 XRenderFillRectangle
+
+  $display->XRenderFillRectangle($op, $dst, $color, $x, $y, $width, $height);
+
+Like L</XRenderFillRectangles> with a single rectangle.
+
+=head3 XRenderFillRectangles
+
+  $display->XRenderFillRectangles($op, $dst, $color, \@rects);
+  $display->XRenderFillRectangles($op, $dst, $color, $packed_rects);
+
+Fill any number of rectangles with one color, in as few requests as the maximum
+request size allows (usually one).  The rectangles are either an arrayref of
+L<X11::Xlib::XRectangle> (or hashrefs of their fields), or, to avoid creating an
+object per rectangle, a string of them packed with C<pack('s s S S', $x, $y,
+$w, $h)>.
+
+C<$color> is an arrayref of C<[ $red, $green, $blue, $alpha ]> with 16 bits per
+channel (alpha defaults to C<0xFFFF>), or a string of the four packed with
+C<pack('S4', ...)>.  The color channels are premultiplied by alpha, so a
+half-transparent white is C<[ 0x7FFF, 0x7FFF, 0x7FFF, 0x7FFF ]>.
+
+=head3 XRenderCompositeTrapezoids
+
+  $display->XRenderCompositeTrapezoids($op, $src, $dst, $mask_pfmt, $src_x, $src_y, $packed_traps);
+
+Rasterize trapezoids into a mask with the format C<$mask_pfmt> (usually the
+C<PictStandardA8> format, or undef to composite each one separately), then
+composite C<$src> through it into C<$dst>.  C<$packed_traps> is a string of
+trapezoids, each packed as ten 16.16 fixed-point numbers:
+
+  pack('l10', map int($_ * 65536),
+    $top, $bottom,
+    $left_x1, $left_y1, $left_x2, $left_y2,     # left edge line
+    $right_x1, $right_y1, $right_x2, $right_y2  # right edge line
+  );
+
+=head3 XRenderCompositeTriangles
+
+  $display->XRenderCompositeTriangles($op, $src, $dst, $mask_pfmt, $src_x, $src_y, $packed_tris);
+
+Like L</XRenderCompositeTrapezoids>, for triangles packed as six 16.16
+fixed-point numbers C<< $x1, $y1, $x2, $y2, $x3, $y3 >> each.
+
+=head3 XRenderCreateGlyphSet
+
+  my $glyphset= $display->XRenderCreateGlyphSet($pfmt);
+
+Create a set of glyph images on the server, all in the format C<$pfmt> (usually
+C<PictStandardA8>).  See L<X11::Xlib::GlyphCache> for an object which manages one.
+
+=head3 XRenderFreeGlyphSet
+
+  $display->XRenderFreeGlyphSet($glyphset);
+
+=head3 XRenderAddGlyphs
+
+  $display->XRenderAddGlyphs($glyphset, \@glyph_ids, $packed_infos, $images);
+
+Upload any number of glyphs in one request.  The glyph ids are an arrayref of
+integers or a string of them packed with C<pack('L*', ...)>.  The infos are a
+string with one C<XGlyphInfo> per glyph,
+
+  pack('S S s s s s', $width, $height, $x, $y, $x_off, $y_off)
+
+where C<$x,$y> is the glyph origin relative to the top-left of its image and
+C<$x_off,$y_off> is the advance to the next glyph.  C<$images> is every glyph's
+image one after the other, in the format of the GlyphSet, with each row padded
+to a multiple of 4 bytes.
+
+=head3 XRenderFreeGlyphs
+
+  $display->XRenderFreeGlyphs($glyphset, \@glyph_ids);
+
+=head3 XRenderCompositeString32
+
+  $display->XRenderCompositeString32($op, $src, $dst, $mask_pfmt, $glyphset,
+    $src_x, $src_y, $dst_x, $dst_y, $glyph_ids);
+
+Draw a run of glyphs, with the origin of the first one at C<$dst_x,$dst_y>,
+using their images as the mask to composite C<$src> into C<$dst>.  As with
+L</XRenderCompositeTrapezoids>, C<$mask_pfmt> may be undef.  C<$glyph_ids> is
+an arrayref of integers, or a string of them packed with C<pack('L*', ...)>
+which is sent without being copied.
+
+=head3 XRenderCompositeString16
+
+=head3 XRenderCompositeString8
+
+Like L</XRenderCompositeString32>, for glyph ids packed with C<pack('S*', ...)>
+or as a plain byte string.
+
+=head2 EXTENSION XSHM
+
+The MIT-SHM extension is part of libXext.  If its header and SysV shared memory
+were available when this module was installed, the following functions will be
+available.  None of these functions are exportable.  Shared memory only works
+when the client runs on the same host as the server.
+
+See L<X11::Xlib::XShmSegmentInfo> for the object which manages the segment.
+
+=head3 XShmQueryExtension
+
+  my $bool= $display->XShmQueryExtension
+    if $display->can('XShmQueryExtension');
+
+=head3 XShmQueryVersion
+
+  my ($major, $minor, $shared_pixmaps)= $display->XShmQueryVersion;
+
+=head3 XShmPixmapFormat
+
+  my $format= $display->XShmPixmapFormat;
+
+The format (C<ZPixmap>) of shared pixmaps, or 0 if they are not supported.
+
+=head3 XShmGetEventBase
+
+  my $completion_type= $display->XShmGetEventBase;
+
+The event type of C<XShmCompletionEvent>, which the server sends when it has
+finished reading an L</XShmPutImage> with C<$send_event> set.
+
+=head3 XShmAttach
+
+  $display->XShmAttach($shminfo) or die;
+
+Ask the server to attach an L<X11::Xlib::XShmSegmentInfo>.  This waits for the
+server to process the request, and then removes the id of the segment so that
+it will be freed even if the program is killed.
+
+Returns false if the server could not attach the segment, such as when it runs
+on another machine (where C<XShmQueryExtension> can still succeed).  The
+C<BadAccess> error for that is not passed to L</on_error> or Xlib's default
+handler, which would exit the program.
+
+=head3 XShmDetach
+
+  $display->XShmDetach($shminfo);
+
+This happens automatically when the segment object is destroyed.
+
+=head3 XShmCreateImage
+
+  my $image= $display->XShmCreateImage($visual, $depth, $format, $shminfo, $width, $height);
+
+Like L</XCreateImage>, but the image's data is the start of the shared memory
+segment (and is the same scalar as C<< $shminfo->{data} >>).  Dies if the segment
+is too small.
+
+=head3 XShmGetImage
+
+  $display->XShmGetImage($drawable, $image, $x, $y, $plane_mask) or die;
+
+Have the server write the area of the drawable at C<$x>,C<$y> (the size of the
+image) into the image's shared memory.  The pixels are in place when this returns.
+
+=head3 XShmPutImage
+
+  $display->XShmPutImage($drawable, $gc, $image, $src_x, $src_y,
+    $dest_x, $dest_y, $width, $height, $send_event);
+
+Have the server read pixels from the image's shared memory.  The server reads
+them I<later>, so don't modify the memory until you receive the completion
+event (if C<$send_event> is true) or call C<XSync>.
+
+=head3 XShmCreatePixmap
+
+  my $pixmap= $display->XShmCreatePixmap($drawable, $shminfo, $width, $height, $depth);
+
+Create a pixmap whose pixels are the shared memory segment, in the format given by
+L</XShmPixmapFormat>.  Check the third value of L</XShmQueryVersion> first, as not
+all servers support this.
+
 =head1 CONSTANTS
 
 XLib has a massive number of symbolic constants.  This module has an incomplete
@@ -1617,20 +2178,25 @@ C<Success>
 =item C<:const_event>
 
 C<ButtonPress> C<ButtonRelease> C<CirculateNotify> C<ClientMessage>
-C<ColormapNotify> C<ConfigureNotify> C<CreateNotify> C<DestroyNotify>
-C<EnterNotify> C<Expose> C<FocusIn> C<FocusOut> C<GraphicsExpose>
-C<GravityNotify> C<KeyPress> C<KeyRelease> C<KeymapNotify> C<LeaveNotify>
-C<MapNotify> C<MapRequest> C<MappingNotify> C<MotionNotify> C<NoExpose>
+C<ColormapInstalled> C<ColormapNotify> C<ColormapUninstalled>
+C<ConfigureNotify> C<CreateNotify> C<DestroyNotify> C<EnterNotify> C<Expose>
+C<FocusIn> C<FocusOut> C<GraphicsExpose> C<GravityNotify> C<KeyPress>
+C<KeyRelease> C<KeymapNotify> C<LeaveNotify> C<MapNotify> C<MapRequest>
+C<MappingNotify> C<MotionNotify> C<NoExpose> C<PlaceOnBottom> C<PlaceOnTop>
 C<PropertyNotify> C<ReparentNotify> C<ResizeRequest> C<SelectionClear>
-C<SelectionNotify> C<SelectionRequest> C<UnmapNotify> C<VisibilityNotify>
+C<SelectionNotify> C<SelectionRequest> C<UnmapNotify>
+C<VisibilityFullyObscured> C<VisibilityNotify> C<VisibilityPartiallyObscured>
+C<VisibilityUnobscured>
 
-=for Pod::Coverage ButtonPress ButtonRelease CirculateNotify ClientMessage ColormapNotify ConfigureNotify CreateNotify DestroyNotify
+=for Pod::Coverage ButtonPress ButtonRelease CirculateNotify ClientMessage ColormapInstalled ColormapNotify ColormapUninstalled
 
-=for Pod::Coverage EnterNotify Expose FocusIn FocusOut GraphicsExpose GravityNotify KeyPress KeyRelease KeymapNotify LeaveNotify MapNotify
+=for Pod::Coverage ConfigureNotify CreateNotify DestroyNotify EnterNotify Expose FocusIn FocusOut GraphicsExpose GravityNotify KeyPress
 
-=for Pod::Coverage MapRequest MappingNotify MotionNotify NoExpose PropertyNotify ReparentNotify ResizeRequest SelectionClear
+=for Pod::Coverage KeyRelease KeymapNotify LeaveNotify MapNotify MapRequest MappingNotify MotionNotify NoExpose PlaceOnBottom PlaceOnTop
 
-=for Pod::Coverage SelectionNotify SelectionRequest UnmapNotify VisibilityNotify
+=for Pod::Coverage PropertyNotify ReparentNotify ResizeRequest SelectionClear SelectionNotify SelectionRequest UnmapNotify
+
+=for Pod::Coverage VisibilityFullyObscured VisibilityNotify VisibilityPartiallyObscured VisibilityUnobscured
 
 =item C<:const_event_mask>
 
@@ -1659,6 +2225,36 @@ C<CompositeRedirectAutomatic> C<CompositeRedirectManual>
 
 =for Pod::Coverage CompositeRedirectAutomatic CompositeRedirectManual
 
+=item C<:const_ext_damage>
+
+C<XDamageReportBoundingBox> C<XDamageReportDeltaRectangles>
+C<XDamageReportNonEmpty> C<XDamageReportRawRectangles>
+
+=for Pod::Coverage XDamageReportBoundingBox XDamageReportDeltaRectangles XDamageReportNonEmpty XDamageReportRawRectangles
+
+=item C<:const_ext_render>
+
+C<CPAlphaMap> C<CPAlphaXOrigin> C<CPAlphaYOrigin> C<CPClipMask>
+C<CPClipXOrigin> C<CPClipYOrigin> C<CPComponentAlpha> C<CPDither>
+C<CPGraphicsExposure> C<CPPolyEdge> C<CPPolyMode> C<CPRepeat>
+C<CPSubwindowMode> C<PictOpAdd> C<PictOpAtop> C<PictOpAtopReverse>
+C<PictOpClear> C<PictOpDst> C<PictOpIn> C<PictOpInReverse> C<PictOpOut>
+C<PictOpOutReverse> C<PictOpOver> C<PictOpOverReverse> C<PictOpSaturate>
+C<PictOpSrc> C<PictOpXor> C<PictStandardA1> C<PictStandardA4>
+C<PictStandardA8> C<PictStandardARGB32> C<PictStandardRGB24> C<PolyEdgeSharp>
+C<PolyEdgeSmooth> C<PolyModeImprecise> C<PolyModePrecise> C<RepeatNone>
+C<RepeatNormal> C<RepeatPad> C<RepeatReflect>
+
+=for Pod::Coverage CPAlphaMap CPAlphaXOrigin CPAlphaYOrigin CPClipMask CPClipXOrigin CPClipYOrigin CPComponentAlpha CPDither
+
+=for Pod::Coverage CPGraphicsExposure CPPolyEdge CPPolyMode CPRepeat CPSubwindowMode PictOpAdd PictOpAtop PictOpAtopReverse PictOpClear
+
+=for Pod::Coverage PictOpDst PictOpIn PictOpInReverse PictOpOut PictOpOutReverse PictOpOver PictOpOverReverse PictOpSaturate PictOpSrc
+
+=for Pod::Coverage PictOpXor PictStandardA1 PictStandardA4 PictStandardA8 PictStandardARGB32 PictStandardRGB24 PolyEdgeSharp
+
+=for Pod::Coverage PolyEdgeSmooth PolyModeImprecise PolyModePrecise RepeatNone RepeatNormal RepeatPad RepeatReflect
+
 =item C<:const_ext_shape>
 
 C<ShapeBounding> C<ShapeClip> C<ShapeInput> C<ShapeIntersect> C<ShapeInvert>
@@ -1666,6 +2262,47 @@ C<ShapeSet> C<ShapeSubtract> C<ShapeUnion>
 
 =for Pod::Coverage ShapeBounding ShapeClip ShapeInput ShapeIntersect ShapeInvert ShapeSet ShapeSubtract ShapeUnion
 
+=item C<:const_ext_xfixes>
+
+C<XFixesDisplayCursorNotify> C<XFixesDisplayCursorNotifyMask>
+
+=for Pod::Coverage XFixesDisplayCursorNotify XFixesDisplayCursorNotifyMask
+
+=item C<:const_gc>
+
+C<ArcChord> C<ArcPieSlice> C<CapButt> C<CapNotLast> C<CapProjecting>
+C<CapRound> C<ClipByChildren> C<CoordModeOrigin> C<CoordModePrevious>
+C<EvenOddRule> C<FillOpaqueStippled> C<FillSolid> C<FillStippled> C<FillTiled>
+C<GCArcMode> C<GCBackground> C<GCCapStyle> C<GCClipMask> C<GCClipXOrigin>
+C<GCClipYOrigin> C<GCDashList> C<GCDashOffset> C<GCFillRule> C<GCFillStyle>
+C<GCFont> C<GCForeground> C<GCFunction> C<GCGraphicsExposures> C<GCJoinStyle>
+C<GCLineStyle> C<GCLineWidth> C<GCPlaneMask> C<GCStipple> C<GCSubwindowMode>
+C<GCTile> C<GCTileStipXOrigin> C<GCTileStipYOrigin> C<GXand> C<GXandInverted>
+C<GXandReverse> C<GXclear> C<GXcopy> C<GXcopyInverted> C<GXequiv> C<GXinvert>
+C<GXnand> C<GXnoop> C<GXnor> C<GXor> C<GXorInverted> C<GXorReverse> C<GXset>
+C<GXxor> C<IncludeInferiors> C<JoinBevel> C<JoinMiter> C<JoinRound>
+C<LineDoubleDash> C<LineOnOffDash> C<LineSolid> C<WindingRule>
+
+=for Pod::Coverage ArcChord ArcPieSlice CapButt CapNotLast CapProjecting CapRound ClipByChildren CoordModeOrigin CoordModePrevious
+
+=for Pod::Coverage EvenOddRule FillOpaqueStippled FillSolid FillStippled FillTiled GCArcMode GCBackground GCCapStyle GCClipMask
+
+=for Pod::Coverage GCClipXOrigin GCClipYOrigin GCDashList GCDashOffset GCFillRule GCFillStyle GCFont GCForeground GCFunction
+
+=for Pod::Coverage GCGraphicsExposures GCJoinStyle GCLineStyle GCLineWidth GCPlaneMask GCStipple GCSubwindowMode GCTile GCTileStipXOrigin
+
+=for Pod::Coverage GCTileStipYOrigin GXand GXandInverted GXandReverse GXclear GXcopy GXcopyInverted GXequiv GXinvert GXnand GXnoop GXnor
+
+=for Pod::Coverage GXor GXorInverted GXorReverse GXset GXxor IncludeInferiors JoinBevel JoinMiter JoinRound LineDoubleDash LineOnOffDash
+
+=for Pod::Coverage LineSolid WindingRule
+
+=item C<:const_image>
+
+C<AllPlanes> C<LSBFirst> C<MSBFirst> C<XYBitmap> C<XYPixmap> C<ZPixmap>
+
+=for Pod::Coverage AllPlanes LSBFirst MSBFirst XYBitmap XYPixmap ZPixmap
+
 =item C<:const_input>
 
 C<AnyKey> C<AnyModifier> C<AsyncBoth> C<AsyncKeyboard> C<AsyncPointer>
@@ -1719,17 +2356,18 @@ C<StaticGravity> C<TopIf> C<UnmapGravity> C<WestGravity>
 
 =item C<:const_winattr>
 
-C<CWBackPixel> C<CWBackPixmap> C<CWBackingPixel> C<CWBackingPlanes>
+C<Always> C<CWBackPixel> C<CWBackPixmap> C<CWBackingPixel> C<CWBackingPlanes>
 C<CWBackingStore> C<CWBitGravity> C<CWBorderPixel> C<CWBorderPixmap>
 C<CWBorderWidth> C<CWColormap> C<CWCursor> C<CWDontPropagate> C<CWEventMask>
 C<CWHeight> C<CWOverrideRedirect> C<CWSaveUnder> C<CWSibling> C<CWStackMode>
-C<CWWidth> C<CWWinGravity> C<CWX> C<CWY>
+C<CWWidth> C<CWWinGravity> C<CWX> C<CWY> C<IsUnmapped> C<IsUnviewable>
+C<IsViewable> C<NotUseful> C<WhenMapped>
 
-=for Pod::Coverage CWBackPixel CWBackPixmap CWBackingPixel CWBackingPlanes CWBackingStore CWBitGravity CWBorderPixel CWBorderPixmap
+=for Pod::Coverage Always CWBackPixel CWBackPixmap CWBackingPixel CWBackingPlanes CWBackingStore CWBitGravity CWBorderPixel CWBorderPixmap
 
 =for Pod::Coverage CWBorderWidth CWColormap CWCursor CWDontPropagate CWEventMask CWHeight CWOverrideRedirect CWSaveUnder CWSibling
 
-=for Pod::Coverage CWStackMode CWWidth CWWinGravity CWX CWY
+=for Pod::Coverage CWStackMode CWWidth CWWinGravity CWX CWY IsUnmapped IsUnviewable IsViewable NotUseful WhenMapped
 
 =item C<:const_x>
 
@@ -1813,6 +2451,11 @@ An B<XID> referencing a rectangular pixel buffer.  Has dimensions and color
 depth and is bound to a L</Screen>.  Can be used for copying images, or tiling.
 When using the object-oriented C<Display>, these are wrapped by L<X11::Xlib::Pixmap>.
 
+=head2 XImage
+
+A B<struct> describing a block of pixels in client memory, which can be sent to
+or read from a Drawable.  See L<X11::Xlib::XImage>.
+
 =head2 Window
 
 An B<XID> referencing a Window.  Used for painting, event/input delivery, and
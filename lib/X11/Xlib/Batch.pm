@@ -0,0 +1,363 @@
+package X11::Xlib::Batch;
+use strict;
+use warnings;
+use Carp;
+use X11::Xlib;
+use Scalar::Util 'weaken';
+
+# All modules in dist share a version
+our $VERSION = '0.25';
+
+=head1 NAME
+
+X11::Xlib::Batch - Collect window changes and send them all at once
+
+=head1 SYNOPSIS
+
+  my $batch= $display->begin_batch;
+  for (@layout) {
+    $batch->move_resize($_->{window}, @{$_}{qw( x y w h )});
+    $batch->change_attributes($_->{window}, border_pixel => $_->{color});
+  }
+  $batch->restack(@top_to_bottom);
+  $batch->commit;
+
+=head1 DESCRIPTION
+
+Laying out many windows with individual calls to C<XConfigureWindow>,
+C<XMoveResizeWindow>, C<XChangeWindowAttributes> and so on produces a stream of
+requests that the server applies (and repaints) one at a time, often with the
+same window being changed several times along the way.  This object records the
+changes instead, and L</commit> then emits the smallest request stream that
+produces the same end state, and flushes it once.
+
+=over
+
+=item *
+
+All geometry changes to a window are merged into one C<XConfigureWindow>.
+
+=item *
+
+All attribute changes to a window are merged into one C<XChangeWindowAttributes>.
+
+=item *
+
+Mapping and unmapping a window only sends the final state.  Unmaps are sent first
+and maps are sent last, so that windows never appear at an intermediate position.
+
+=item *
+
+Stacking changes are sent after all geometry changes, in the order they were
+requested.  Consecutive calls to L</restack> are sent as one C<XRestackWindows>
+where possible, and a C<stack_mode> given to L</configure> is dropped if a later
+L</restack> repositions the same window.
+
+=back
+
+Nothing is sent until L</commit>.  If the object is destroyed without committing,
+the changes are discarded.
+
+=head1 CONSTRUCTOR
+
+=head2 new
+
+  my $batch= X11::Xlib::Batch->new(display => $display);
+
+Usually called as L<< $display->begin_batch|X11::Xlib::Display/begin_batch >>.
+
+=cut
+
+sub new {
+    my $class= shift;
+    my %args= (@_ == 1 and ref($_[0]) eq 'HASH')? %{ $_[0] }
+        : ((@_ & 1) == 0)? @_
+        : croak "Expected hashref or even-length list";
+    defined $args{display} or croak "display is required";
+    my $self= bless \%args, $class;
+    weaken( $self->{display} );
+    $self->discard;
+    return $self;
+}
+
+=head1 ATTRIBUTES
+
+=head2 display
+
+Weak reference to the L<X11::Xlib> connection.
+
+=head2 pending
+
+Number of windows with changes waiting to be committed.
+
+=cut
+
+sub display { $_[0]{display} }
+
+sub pending {
+    my $self= shift;
+    my %w;
+    $w{$_}= 1 for keys %{ $self->{configure} }, keys %{ $self->{attributes} }, keys %{ $self->{mapped} };
+    $w{$_}= 1 for map @{ $_->[1] }, grep $_->[0] eq 'restack', @{ $self->{stacking} };
+    return scalar keys %w;
+}
+
+=head1 METHODS
+
+Each method that records a change returns the batch object, so calls can be
+chained.  Windows can be given as L<X11::Xlib::Window> objects or plain XIDs.
+
+=head2 configure
+
+  $batch->configure($window,
+    x => $x, y => $y, width => $w, height => $h, border_width => $n,
+    sibling => $window, stack_mode => $mode,
+  );
+
+Record any of the fields of L<X11::Xlib::XWindowChanges>.  Later values for the
+same field of the same window replace earlier ones.
+
+=head2 move
+
+  $batch->move($window, $x, $y);
+
+=head2 resize
+
+  $batch->resize($window, $width, $height);
+
+=head2 move_resize
+
+  $batch->move_resize($window, $x, $y, $width, $height);
+
+Shorthand for L</configure>.
+
+=cut
+
+my %configure_flags= (
+    x            => X11::Xlib::CWX,
+    y            => X11::Xlib::CWY,
+    width        => X11::Xlib::CWWidth,
+    height       => X11::Xlib::CWHeight,
+    border_width => X11::Xlib::CWBorderWidth,
+    sibling      => X11::Xlib::CWSibling,
+    stack_mode   => X11::Xlib::CWStackMode,
+);
+
+sub configure {
+    my ($self, $wnd, %changes)= @_;
+    my $xid= _xid($wnd);
+    my $cfg= $self->{configure}{$xid} ||= {};
+    for (keys %changes) {
+        defined $configure_flags{$_} or croak "Unknown XWindowChanges field '$_'";
+        $cfg->{$_}= $changes{$_};
+    }
+    if (defined $changes{stack_mode}) {
+        # stacking is ordered with respect to restack(), so it is tracked separately
+        @{ $self->{stacking} }= grep !($_->[0] eq 'configure' && $_->[1] == $xid), @{ $self->{stacking} };
+        push @{ $self->{stacking} }, [ configure => $xid ];
+    }
+    return $self;
+}
+
+sub move        { $_[0]->configure($_[1], x => $_[2], y => $_[3]) }
+sub resize      { $_[0]->configure($_[1], width => $_[2], height => $_[3]) }
+sub move_resize { $_[0]->configure($_[1], x => $_[2], y => $_[3], width => $_[4], height => $_[5]) }
+
+=head2 change_attributes
+
+  $batch->change_attributes($window, border_pixel => $color, ...);
+
+Record any of the fields of L<X11::Xlib::XSetWindowAttributes>.  Later values for
+the same field of the same window replace earlier ones.
+
+=cut
+
+my %attr_flags= (
+    background_pixmap     => X11::Xlib::CWBackPixmap,
+    background_pixel      => X11::Xlib::CWBackPixel,
+    border_pixmap         => X11::Xlib::CWBorderPixmap,
+    border_pixel          => X11::Xlib::CWBorderPixel,
+    bit_gravity           => X11::Xlib::CWBitGravity,
+    win_gravity           => X11::Xlib::CWWinGravity,
+    backing_store         => X11::Xlib::CWBackingStore,
+    backing_planes        => X11::Xlib::CWBackingPlanes,
+    backing_pixel         => X11::Xlib::CWBackingPixel,
+    save_under            => X11::Xlib::CWSaveUnder,
+    event_mask            => X11::Xlib::CWEventMask,
+    do_not_propagate_mask => X11::Xlib::CWDontPropagate,
+    override_redirect     => X11::Xlib::CWOverrideRedirect,
+    colormap              => X11::Xlib::CWColormap,
+    cursor                => X11::Xlib::CWCursor,
+);
+
+sub change_attributes {
+    my ($self, $wnd, %changes)= @_;
+    my $attrs= $self->{attributes}{_xid($wnd)} ||= {};
+    for (keys %changes) {
+        defined $attr_flags{$_} or croak "Unknown XSetWindowAttributes field '$_'";
+        $attrs->{$_}= $changes{$_};
+    }
+    return $self;
+}
+
+=head2 show
+
+  $batch->show($window);
+  $batch->show($window, $visible);
+
+Record that the window should end up mapped, or unmapped if C<$visible> is false.
+
+=head2 hide
+
+  $batch->hide($window);
+
+Record that the window should end up unmapped.
+
+=cut
+
+sub show { $_[0]{mapped}{_xid($_[1])}= (@_ < 3 || $_[2])? 1 : 0; $_[0] }
+sub hide { $_[0]->show($_[1], 0) }
+
+=head2 restack
+
+  $batch->restack(@windows_top_to_bottom);
+
+Record that the windows (which must be siblings) should be stacked in this order,
+as with L<XRestackWindows|X11::Xlib/XRestackWindows>.  The first window keeps its
+position relative to other windows not in the list.
+
+=cut
+
+sub restack {
+    my ($self, @windows)= @_;
+    my @xids= map _xid($_), @windows;
+    if (@xids) {
+        my %seen= map +($_ => 1), @xids;
+        # a stack_mode from an earlier configure() is overridden
+        @{ $self->{stacking} }= grep !($_->[0] eq 'configure' && $seen{$_->[1]}), @{ $self->{stacking} };
+        push @{ $self->{stacking} }, [ restack => \@xids ];
+    }
+    return $self;
+}
+
+=head2 commit
+
+  $batch->commit;
+
+Send all recorded changes and flush the connection, then reset the batch so it
+can be reused.  Returns the number of requests sent.
+
+=head2 discard
+
+Forget all recorded changes.
+
+=cut
+
+sub discard {
+    my $self= shift;
+    $self->{configure}= {};
+    $self->{attributes}= {};
+    $self->{mapped}= {};
+    $self->{stacking}= [];
+    return $self;
+}
+
+sub commit {
+    my $self= shift;
+    my $dpy= $self->{display} or croak "Display was released";
+    my %stack_cfg= map +($_->[1] => 1), grep $_->[0] eq 'configure', @{ $self->{stacking} };
+    my $n= 0;
+
+    for my $xid (grep !$self->{mapped}{$_}, _keys($self->{mapped})) {
+        $dpy->XUnmapWindow($xid);
+        ++$n;
+    }
+    for my $xid (_keys($self->{attributes})) {
+        my $attrs= $self->{attributes}{$xid};
+        my $mask= 0;
+        $mask |= $attr_flags{$_} for keys %$attrs;
+        next unless $mask;
+        $dpy->XChangeWindowAttributes($xid, $mask, $attrs);
+        ++$n;
+    }
+    # Geometry of windows whose stacking doesn't need to be ordered against others
+    for my $xid (grep !$stack_cfg{$_}, _keys($self->{configure})) {
+        $n += $self->_send_configure($xid, 0);
+    }
+    # Stacking operations, in the order requested.  Adjacent restacks are
+    # joined when the second one continues from the bottom of the first.
+    my @restack;
+    for my $op (@{ $self->{stacking} }) {
+        if ($op->[0] eq 'restack') {
+            if (@restack && $restack[-1] == $op->[1][0]) {
+                push @restack, @{ $op->[1] }[1..$#{ $op->[1] }];
+                next;
+            }
+            $n += $self->_send_restack(\@restack);
+            @restack= @{ $op->[1] };
+        }
+        else {
+            $n += $self->_send_restack(\@restack);
+            $n += $self->_send_configure($op->[1], 1);
+        }
+    }
+    $n += $self->_send_restack(\@restack);
+    for my $xid (grep $self->{mapped}{$_}, _keys($self->{mapped})) {
+        $dpy->XMapWindow($xid);
+        ++$n;
+    }
+    $dpy->XFlush;
+    $self->discard;
+    return $n;
+}
+
+sub _send_configure {
+    my ($self, $xid, $with_stacking)= @_;
+    my %cfg= %{ $self->{configure}{$xid} };
+    delete @cfg{qw( sibling stack_mode )} unless $with_stacking;
+    my $mask= 0;
+    $mask |= $configure_flags{$_} for keys %cfg;
+    return 0 unless $mask;
+    $self->{display}->XConfigureWindow($xid, $mask, \%cfg);
+    return 1;
+}
+
+sub _send_restack {
+    my ($self, $list)= @_;
+    return 0 unless @$list;
+    my $ret= 0;
+    # a list of one window doesn't change anything
+    if (@$list > 1) {
+        $self->{display}->XRestackWindows([ @$list ]);
+        $ret= 1;
+    }
+    @$list= ();
+    return $ret;
+}
+
+sub _xid { ref $_[0]? $_[0]->xid : 0+$_[0] }
+
+# Hash keys are strings, but XS functions need XIDs to be numbers
+sub _keys { map 0+$_, keys %{$_[0]} }
+
+1;
+
+__END__
+
+=head1 AUTHOR
+
+Olivier Thauvin, E<lt>nanardon@nanardon.zarb.orgE<gt>
+
+Michael Conrad, E<lt>mike@nrdvana.netE<gt>
+
+=head1 COPYRIGHT AND LICENSE
+
+Copyright (C) 2009-2010 by Olivier Thauvin
+
+Copyright (C) 2017-2023 by Michael Conrad
+
+This library is free software; you can redistribute it and/or modify
+it under the same terms as Perl itself, either Perl version 5.10.0 or,
+at your option, any later version of Perl 5 you may have available.
+
+=cut
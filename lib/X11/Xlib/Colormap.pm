@@ -8,7 +8,7 @@ our $VERSION = '0.25';
 
 sub DESTROY {
     my $self= shift;
-    $self->display->XFreeColormap($self->xid)
+    $self->display->_release_xid(XFreeColormap => $self->xid)
         if $self->autofree;
 }
 
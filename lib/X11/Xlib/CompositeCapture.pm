@@ -0,0 +1,352 @@
+package X11::Xlib::CompositeCapture;
+use strict;
+use warnings;
+use Carp;
+use Scalar::Util 'weaken', 'refaddr';
+use X11::Xlib;
+require X11::Xlib::Pixels;
+
+# All modules in dist share a version
+our $VERSION = '0.25';
+
+=head1 NAME
+
+X11::Xlib::CompositeCapture - Capture windows from their offscreen Composite pixmaps
+
+=head1 SYNOPSIS
+
+  use X11::Xlib::CompositeCapture;
+  my $cap= X11::Xlib::CompositeCapture->new(display => $display);
+  $cap->watch($_) for @client_windows;
+  while (1) {
+    $display->wait_event(timeout => 0) while $display->XPending; # feeds $cap
+    for my $wnd ($cap->windows) {
+      my ($rgba, $w, $h)= $cap->thumbnail($wnd, 160, 120) or next;
+      show_thumbnail($wnd, $rgba, $w, $h);
+    }
+    sleep .2;
+  }
+
+=head1 DESCRIPTION
+
+C<XGetImage> of a window only returns what is visible on screen; obscured parts
+are undefined and unmapped windows can't be read at all.  The Composite extension
+fixes this by redirecting a window to an offscreen pixmap, which always holds the
+whole window no matter what covers it.  This object redirects each watched window
+with C<CompositeRedirectAutomatic> (so the server keeps drawing it on screen as
+usual), names its pixmap with C<XCompositeNameWindowPixmap>, and reads the pixels
+from that pixmap.
+
+The server allocates a new pixmap each time the window is mapped or changes
+size, and a named pixmap keeps showing the old contents.  The capture object
+watches C<ConfigureNotify> and C<MapNotify> (via
+L<track_attributes|X11::Xlib::Window/track_attributes>) and names the new
+pixmap straight away.  When the window is unmapped its last pixmap is kept, so
+L</capture> still returns the contents it had when it was last shown.  A window
+which has never been mapped since it was watched has no pixmap and can't be
+captured.
+
+If the server supports MIT-SHM and is on the same machine, the pixels are read
+with C<XShmGetImage> into one shared memory segment, which is grown to fit the
+largest window and reused for all of them.  This avoids copying the pixels
+through the socket, which is most of the cost of capturing many windows
+several times a second.  Otherwise C<XGetSubImage> is used, into a buffer kept
+for each window.
+
+=head1 CONSTRUCTOR
+
+=head2 new
+
+  my $cap= X11::Xlib::CompositeCapture->new(display => $display, use_shm => $bool);
+
+Dies if the server does not support Composite 0.2 or later.  C<use_shm>
+defaults to true, and is turned off if the server lacks MIT-SHM or can't attach
+the segment.  L<wait_event|X11::Xlib::Display/wait_event> of the display
+passes every event to L</apply_event> of each capture object.
+
+=cut
+
+sub new {
+    my $class= shift;
+    my %args= (@_ == 1 and ref($_[0]) eq 'HASH')? %{ $_[0] }
+        : ((@_ & 1) == 0)? @_
+        : croak "Expected hashref or even-length list";
+    my $display= $args{display} or croak "display is required";
+    $display->can('XCompositeQueryExtension')
+        or croak "X11::Xlib was built without Composite support";
+    # Composite has no events or errors, so the bases it returns are both 0
+    (() = $display->XCompositeQueryExtension) or croak "Server lacks the Composite extension";
+    my ($major, $minor)= $display->XCompositeQueryVersion;
+    ($major || 0) > 0 || ($minor || 0) >= 2
+        or croak "Server lacks Composite 0.2, needed for XCompositeNameWindowPixmap";
+    my $use_shm= defined $args{use_shm}? $args{use_shm} : 1;
+    $use_shm &&= $display->can('XShmQueryExtension') && $display->XShmQueryExtension;
+    my $self= bless {
+        display => $display,
+        use_shm => $use_shm? 1 : 0,
+        windows => {},
+    }, $class;
+    weaken( $display->{composite_captures}{refaddr $self}= $self );
+    return $self;
+}
+
+sub DESTROY {
+    my $self= shift;
+    delete $self->{display}{composite_captures}{refaddr $self} if $self->{display};
+}
+
+=head1 ATTRIBUTES
+
+=head2 display
+
+=head2 use_shm
+
+True if pixels are read through MIT-SHM.  Setting it to a true value has no
+effect unless the server supports it.
+
+=cut
+
+sub display { $_[0]{display} }
+
+sub use_shm {
+    my $self= shift;
+    if (@_) {
+        my $display= $self->{display};
+        $self->{use_shm}= shift && $display->can('XShmQueryExtension')
+            && $display->XShmQueryExtension? 1 : 0;
+        delete @{$self}{qw( shm shm_image shm_geometry )} unless $self->{use_shm};
+    }
+    $self->{use_shm};
+}
+
+=head1 METHODS
+
+=head2 watch
+
+  $cap->watch($window);
+
+Redirect a window (object or XID) and start tracking it.  This turns on
+L<track_attributes|X11::Xlib::Window/track_attributes>.  If the window is
+viewable, its pixmap is named right away.
+
+Redirecting only works on children of the root window, which under a window
+manager are usually the frames rather than the client windows.  It is harmless
+to watch a window which a compositing manager has already redirected.
+
+=cut
+
+sub watch {
+    my ($self, $window)= @_;
+    my $display= $self->{display};
+    my $wnd= $display->get_cached_window($window);
+    my $xid= $wnd->xid;
+    return $self if $self->{windows}{$xid};
+    $wnd->track_attributes(1);
+    $display->XCompositeRedirectWindow($wnd, X11::Xlib::CompositeRedirectAutomatic());
+    my $st= $self->{windows}{$xid}= { window => $wnd, data => '' };
+    $self->_name_pixmap($st);
+    $self;
+}
+
+=head2 unwatch
+
+  $cap->unwatch($window);
+
+Undo the redirection of a window, and free its pixmap and buffers.
+
+=cut
+
+sub unwatch {
+    my ($self, $window)= @_;
+    my $xid= ref $window? $window->xid : $window;
+    my $st= delete $self->{windows}{$xid} or return $self;
+    $self->{display}->XCompositeUnredirectWindow($xid, X11::Xlib::CompositeRedirectAutomatic())
+        unless $st->{destroyed};
+    $self;
+}
+
+=head2 windows
+
+List of watched L<X11::Xlib::Window> objects.
+
+=cut
+
+sub windows { map $_->{window}, values %{ $_[0]{windows} } }
+
+=head2 apply_event
+
+  $cap->apply_event($event);
+
+Name a new pixmap on C<MapNotify> or on a C<ConfigureNotify> which changed the
+size, and stop watching a window on C<DestroyNotify>.  This is called by
+C<wait_event> after the window's attributes are updated; call it yourself
+(after L<X11::Xlib::Window/apply_event>) if you read events another way.
+Returns true if the event was relevant.
+
+=cut
+
+sub apply_event {
+    my ($self, $e)= @_;
+    my $type= $e->type;
+    return 0 unless $type == X11::Xlib::ConfigureNotify() || $type == X11::Xlib::MapNotify()
+        || $type == X11::Xlib::DestroyNotify();
+    my $st= $self->{windows}{$e->window} or return 0;
+    if ($type == X11::Xlib::DestroyNotify()) {
+        # The redirection ends with the window, but the named pixmap stays valid
+        $st->{destroyed}= 1;
+        $self->unwatch($e->window);
+    }
+    elsif ($type == X11::Xlib::MapNotify() or !$st->{pixmap}
+        or $e->width + 2 * $e->border_width != $st->{pixmap_width}
+        or $e->height + 2 * $e->border_width != $st->{pixmap_height}
+    ) {
+        $self->_name_pixmap($st);
+    }
+    return 1;
+}
+
+# The server only has a pixmap for the window while it is viewable.  If it isn't,
+# keep the old one, which still holds the last contents of the window.
+sub _name_pixmap {
+    my ($self, $st)= @_;
+    my $attrs= $st->{window}->attributes;
+    return 0 unless $attrs->map_state == X11::Xlib::IsViewable();
+    my $bw= $attrs->border_width;
+    $st->{pixmap}= $self->{display}->XCompositeNameWindowPixmap($st->{window});
+    $st->{pixmap_width}= $attrs->width + 2 * $bw;
+    $st->{pixmap_height}= $attrs->height + 2 * $bw;
+    $st->{border_width}= $bw;
+    $st->{depth}= $attrs->depth;
+    $st->{visual}= $attrs->visual;
+    return 1;
+}
+
+=head2 capture
+
+  my $ximage= $cap->capture($window);
+
+Read the current contents of the window, without its border, and return them as
+an L<X11::Xlib::XImage> in C<ZPixmap> format.  Returns undef if the window has
+not been mapped since it was watched.  This works whether or not the window is
+covered, and returns the last contents of a window which has since been
+unmapped.
+
+The image is reused by the next call: with MIT-SHM, all windows share the same
+image, so the next capture of I<any> window overwrites it.  Copy what you need
+(or convert it with L<X11::Xlib::Pixels>) before capturing again.
+
+=cut
+
+sub capture {
+    my ($self, $window)= @_;
+    my $xid= ref $window? $window->xid : $window;
+    my $st= $self->{windows}{$xid} or croak "Window $xid is not watched";
+    my $pixmap= $st->{pixmap} or return undef;
+    my $display= $self->{display};
+    my $bw= $st->{border_width};
+    my ($w, $h)= ($st->{pixmap_width} - 2 * $bw, $st->{pixmap_height} - 2 * $bw);
+    if ($self->{use_shm}) {
+        if (my $img= $self->_shm_image($st->{visual}, $st->{depth}, $w, $h)) {
+            $display->XShmGetImage($pixmap, $img, $bw, $bw, X11::Xlib::AllPlanes())
+                or croak "XShmGetImage failed";
+            return $img;
+        }
+    }
+    my $img= $st->{image};
+    if (!$img or $img->width != $w or $img->height != $h or $img->depth != $st->{depth}) {
+        $img= $st->{image}= X11::Xlib::XCreateImage($display, $st->{visual}, $st->{depth},
+            X11::Xlib::ZPixmap(), 0, $st->{data}, $w, $h, 32, 0);
+    }
+    X11::Xlib::XGetSubImage($display, $pixmap, $bw, $bw, $w, $h,
+        X11::Xlib::AllPlanes(), X11::Xlib::ZPixmap(), $img, 0, 0);
+    return $img;
+}
+
+# Return the shared image, re-created for this geometry if needed, on a segment
+# big enough for it.  Returns undef and turns off use_shm if the segment can't
+# be attached (such as when the server is on another machine).
+sub _shm_image {
+    my ($self, $visual, $depth, $w, $h)= @_;
+    my $geometry= join ' ', $visual->id, $depth, $w, $h;
+    return $self->{shm_image}
+        if $self->{shm_image} && $self->{shm_geometry} eq $geometry;
+    delete $self->{shm_image};
+    my $need= $w * $h * 4;
+    if (!$self->{shm} or $self->{shm}->size < $need) {
+        # Grow in whole megabytes, so that a few slightly larger windows don't
+        # each cause a new segment
+        delete $self->{shm};
+        require X11::Xlib::XShmSegmentInfo;
+        my $shm= X11::Xlib::XShmSegmentInfo->new(size => (($need >> 20) + 1) << 20);
+        if (!$self->{display}->XShmAttach($shm)) {
+            $self->{use_shm}= 0;
+            return undef;
+        }
+        $self->{shm}= $shm;
+    }
+    $self->{shm_geometry}= $geometry;
+    $self->{shm_image}= $self->{display}->XShmCreateImage($visual, $depth,
+        X11::Xlib::ZPixmap(), $self->{shm}, $w, $h);
+}
+
+=head2 thumbnail
+
+  my ($rgba, $width, $height)= $cap->thumbnail($window, $max_width, $max_height);
+
+L</capture> the window and shrink it by halves (averaging each 2x2 block) until
+it fits in C<$max_width> by C<$max_height> (which defaults to C<$max_width>).
+Returns the pixels as C<RGBA> bytes, and the size, or an empty list if the window
+can't be captured.  The first halving reads straight from the captured image, so
+the full-size pixels are never copied.
+
+=cut
+
+sub thumbnail {
+    my ($self, $window, $max_w, $max_h)= @_;
+    $max_w > 0 or croak "Invalid max_width";
+    $max_h= $max_w unless defined $max_h;
+    my $img= $self->capture($window) or return;
+    my ($w, $h)= ($img->width, $img->height);
+    my ($src, $stride, $is_rgba)= (\$img->{data}, $img->bytes_per_line, 0);
+    if ($img->bits_per_pixel != 32) {
+        # downsample_2x needs 4-byte pixels
+        $src= \X11::Xlib::Pixels::to_rgba($img);
+        ($stride, $is_rgba)= (0, 1);
+    }
+    else {
+        $img->data; # make sure the buffer is the full size of the image
+    }
+    while (($w > $max_w or $h > $max_h) and $w > 1 and $h > 1) {
+        X11::Xlib::Pixels::downsample_2x($$src, $w, $h, $stride, my $out);
+        ($src, $stride, $w, $h)= (\$out, 0, $w >> 1, $h >> 1);
+    }
+    return ($$src, $w, $h) if $is_rgba;
+    my $rgba= X11::Xlib::Pixels::to_rgba({
+        data => $$src, width => $w, height => $h, bits_per_pixel => 32,
+        bytes_per_line => $stride || $w * 4,
+        map +($_ => $img->$_), qw( byte_order red_mask green_mask blue_mask )
+    });
+    return ($rgba, $w, $h);
+}
+
+1;
+
+__END__
+
+=head1 AUTHOR
+
+Olivier Thauvin, E<lt>nanardon@nanardon.zarb.orgE<gt>
+
+Michael Conrad, E<lt>mike@nrdvana.netE<gt>
+
+=head1 COPYRIGHT AND LICENSE
+
+Copyright (C) 2009-2010 by Olivier Thauvin
+
+Copyright (C) 2017-2023 by Michael Conrad
+
+This library is free software; you can redistribute it and/or modify
+it under the same terms as Perl itself, either Perl version 5.10.0 or,
+at your option, any later version of Perl 5 you may have available.
+
+=cut
@@ -0,0 +1,258 @@
+package X11::Xlib::CursorCapture;
+use strict;
+use warnings;
+use Carp;
+use Scalar::Util 'blessed', 'weaken', 'refaddr';
+use X11::Xlib;
+require X11::Xlib::Pixels;
+
+# All modules in dist share a version
+our $VERSION = '0.25';
+
+=head1 NAME
+
+X11::Xlib::CursorCapture - Track the cursor image with XFixes, fetching it only when it changes
+
+=head1 SYNOPSIS
+
+  use X11::Xlib::CursorCapture;
+  my $cursor= X11::Xlib::CursorCapture->new(display => $display);
+  while (1) {
+    $display->wait_event(timeout => 0) while $display->XPending; # feeds $cursor
+    my $img= XGetImage($display, $root, 0, 0, $w, $h, AllPlanes, ZPixmap);
+    $cursor->draw_onto($img, $cursor->pointer_position);
+    record_frame($img);
+  }
+
+=head1 DESCRIPTION
+
+Screen captures do not include the cursor, since the server draws it separately.
+C<XFixesGetCursorImage> returns the current cursor image, but it is a round trip
+carrying the whole bitmap, which is too much to do for every frame of a
+recording.
+
+This object asks the server for a C<XFixesCursorNotify> event whenever the cursor
+image changes, and keeps the images it has fetched keyed by their
+C<cursor_serial>.  L</cursor> only calls C<XFixesGetCursorImage> when an event
+names a serial it hasn't seen.  Since applications switch among a handful of
+cursors (arrow, text beam, resize arrows), after a short while no images are
+fetched at all.
+
+The events only reach this object if the program dispatches them with
+L<wait_event|X11::Xlib::Display/wait_event>.
+
+=head1 CONSTRUCTOR
+
+=head2 new
+
+  my $cursor= X11::Xlib::CursorCapture->new(display => $display, max_cached => 16);
+
+Dies if the server does not support XFixes.  Selects cursor notify events on the
+root window of the default screen.
+
+=cut
+
+sub new {
+    my $class= shift;
+    my %args= (@_ == 1 and ref($_[0]) eq 'HASH')? %{ $_[0] }
+        : ((@_ & 1) == 0)? @_
+        : croak "Expected hashref or even-length list";
+    my $display= $args{display} or croak "display is required";
+    $display->can('XFixesGetCursorImage')
+        or croak "X11::Xlib was built without XFixes support";
+    (() = $display->XFixesQueryExtension) or croak "Server lacks the XFixes extension";
+    my $self= bless {
+        display     => $display,
+        root        => $display->root_window->xid,
+        max_cached  => $args{max_cached} || 16,
+        cache       => {},
+        used        => {},
+        serial      => undef,
+        clock       => 0,
+        changes     => 0,
+        hits        => 0,
+        fetches     => 0,
+    }, $class;
+    $display->XFixesSelectCursorInput($self->{root}, X11::Xlib::XFixesDisplayCursorNotifyMask());
+    weaken( $display->{cursor_captures}{refaddr $self}= $self );
+    return $self;
+}
+
+sub DESTROY {
+    my $self= shift;
+    my $display= $self->{display} or return;
+    delete $display->{cursor_captures}{refaddr $self};
+    # The selection belongs to the connection, so leave it if another capture uses it
+    $display->XFixesSelectCursorInput($self->{root}, 0)
+        unless grep defined, values %{ $display->{cursor_captures} };
+}
+
+=head1 ATTRIBUTES
+
+=head2 display
+
+=head2 max_cached
+
+Number of cursor images to keep.  When another is fetched, the one least recently
+returned by L</cursor> is forgotten.  Default 16.
+
+=head2 serial
+
+The C<cursor_serial> of the current cursor, according to the last event seen or
+image fetched.  Undef until then.
+
+=head2 changes
+
+=head2 hits
+
+=head2 fetches
+
+Statistics: the number of cursor notify events seen, the number of calls to
+L</cursor> answered from the cache, and the number of C<XFixesGetCursorImage>
+round trips.
+
+=cut
+
+sub display    { $_[0]{display} }
+sub max_cached { $_[0]{max_cached}= $_[1] if @_ > 1; $_[0]{max_cached} }
+sub serial     { $_[0]{serial} }
+sub changes    { $_[0]{changes} }
+sub hits       { $_[0]{hits} }
+sub fetches    { $_[0]{fetches} }
+
+=head1 METHODS
+
+=head2 cursor
+
+  my $img= $cursor->cursor;
+
+Return the image of the current cursor, as returned by
+L<XFixesGetCursorImage|X11::Xlib/XFixesGetCursorImage>: a hashref of C<width>,
+C<height>, C<xhot>, C<yhot>, C<cursor_serial>, and C<pixels>.  It is fetched from
+the server only if the serial is not in the cache.  The C<x> and C<y> of the
+hashref are where the pointer was when the image was fetched, which is most
+likely not where it is now; see L</pointer_position>.
+
+Treat the hashref as read-only, since it is shared by later calls.
+
+=cut
+
+sub cursor {
+    my $self= shift;
+    my $img= defined $self->{serial}? $self->{cache}{$self->{serial}} : undef;
+    if ($img) {
+        ++$self->{hits};
+    }
+    else {
+        $img= $self->{display}->XFixesGetCursorImage or return undef;
+        ++$self->{fetches};
+        # The cursor may have changed again since the last event; trust the image
+        $self->{serial}= $img->{cursor_serial};
+        $self->{cache}{$img->{cursor_serial}}= $img;
+        $self->_trim;
+    }
+    $self->{used}{$img->{cursor_serial}}= ++$self->{clock};
+    return $img;
+}
+
+sub _trim {
+    my $self= shift;
+    my ($cache, $used)= @{$self}{qw( cache used )};
+    my $excess= keys(%$cache) - $self->{max_cached};
+    return unless $excess > 0;
+    my @old= (sort { ($used->{$a}||0) <=> ($used->{$b}||0) } keys %$cache)[0 .. $excess-1];
+    delete @{$cache}{@old};
+    delete @{$used}{@old};
+}
+
+=head2 pointer_position
+
+  my ($x, $y)= $cursor->pointer_position;
+
+Position of the pointer on the root window, from C<XQueryPointer>.  This is a
+(small) round trip; if the program already tracks the pointer from motion
+events, use that instead.
+
+=cut
+
+sub pointer_position {
+    my $self= shift;
+    my (undef, undef, $x, $y)= $self->{display}->XQueryPointer($self->{root});
+    return ($x, $y);
+}
+
+=head2 draw_onto
+
+  $cursor->draw_onto($image, $pointer_x, $pointer_y);
+
+Blend the current cursor (from L</cursor>) over an image, with its hot spot at
+C<$pointer_x,$pointer_y> relative to the top-left corner of the image.  The image
+is modified in place.  It is an L<X11::Xlib::XImage> or a hashref of C<data>,
+C<width>, C<height>, and optionally C<bytes_per_line>, in either case with 32 bits
+per pixel and 8 bits each of red, green and blue in native byte order (the usual
+24 and 32 bit visuals on the local host).  Returns false if there was no cursor.
+
+=cut
+
+sub draw_onto {
+    my ($self, $dst, $x, $y)= @_;
+    my ($w, $h, $stride, $data);
+    if (blessed($dst) && $dst->isa('X11::Xlib::XImage')) {
+        $dst->format == X11::Xlib::ZPixmap() && $dst->bits_per_pixel == 32
+            or croak "Only 32-bit ZPixmap images are supported";
+        ($w, $h, $stride)= ($dst->width, $dst->height, $dst->bytes_per_line);
+        $dst->data; # make sure the buffer is the full size of the image
+        $data= \$dst->{data};
+    }
+    elsif (ref $dst eq 'HASH') {
+        defined $dst->{$_} or croak "$_ is required" for qw( data width height );
+        ($w, $h)= @{$dst}{qw( width height )};
+        $stride= $dst->{bytes_per_line} || $w * 4;
+        $data= \$dst->{data};
+    }
+    else {
+        croak "Expected X11::Xlib::XImage or hashref";
+    }
+    my $img= $self->cursor or return 0;
+    X11::Xlib::Pixels::blend_over($$data, $w, $h, $stride,
+        $img->{pixels}, $img->{width}, $img->{height}, $x - $img->{xhot}, $y - $img->{yhot});
+    return 1;
+}
+
+=head2 apply_event
+
+  $cursor->apply_event($event);
+
+Note the serial of an C<XFixesCursorNotify> event.  Other events are ignored.
+This is called by L<wait_event|X11::Xlib::Display/wait_event>.
+
+=cut
+
+sub apply_event {
+    my ($self, $event)= @_;
+    return unless $event->isa('X11::Xlib::XFixesCursorNotifyEvent');
+    $self->{serial}= $event->cursor_serial;
+    ++$self->{changes};
+}
+
+1;
+
+__END__
+
+=head1 AUTHOR
+
+Olivier Thauvin, E<lt>nanardon@nanardon.zarb.orgE<gt>
+
+Michael Conrad, E<lt>mike@nrdvana.netE<gt>
+
+=head1 COPYRIGHT AND LICENSE
+
+Copyright (C) 2009-2010 by Olivier Thauvin
+
+Copyright (C) 2017-2023 by Michael Conrad
+
+This library is free software; you can redistribute it and/or modify
+it under the same terms as Perl itself, either Perl version 5.10.0 or,
+at your option, any later version of Perl 5 you may have available.
+
+=cut
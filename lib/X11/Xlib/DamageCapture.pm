@@ -0,0 +1,279 @@
+package X11::Xlib::DamageCapture;
+use strict;
+use warnings;
+use Carp;
+use Scalar::Util 'weaken', 'refaddr';
+use X11::Xlib;
+require X11::Xlib::XRectangle;
+
+# All modules in dist share a version
+our $VERSION = '0.25';
+
+=head1 NAME
+
+X11::Xlib::DamageCapture - Incremental window capture driven by the DAMAGE extension
+
+=head1 SYNOPSIS
+
+  use X11::Xlib::DamageCapture;
+  my $cap= X11::Xlib::DamageCapture->new(display => $display);
+  $cap->watch($window);
+  while (1) {
+    $display->wait_event(timeout => 1/30);   # feeds DamageNotify to $cap
+    for my $wnd ($cap->dirty_windows) {
+      my @rects= $cap->capture($wnd);         # fetches only what changed
+      send_update($wnd, $cap->image($wnd), \@rects);
+    }
+  }
+
+=head1 DESCRIPTION
+
+Copying whole windows every frame is wasteful when only a cursor blinked.  The
+DAMAGE extension lets the server keep track of which parts of a drawable have
+been drawn on; this object uses it to keep a client-side copy of each watched
+window up to date by fetching only the changed areas.
+
+For each watched window it creates a C<Damage> object at level
+C<XDamageReportNonEmpty>, so the server sends a single C<DamageNotify> once
+something changes and then accumulates all further changes without more events.
+It also creates an XFixes region per window.  On L</capture>, the accumulated
+damage is moved into that region with C<XDamageSubtract> (which also clears it
+for the next frame), the rectangles are fetched with C<XFixesFetchRegion>, and
+each of them is read with C<XGetSubImage> into the window's L<X11::Xlib::XImage>.
+
+Anything drawn between the C<XDamageSubtract> and the C<XGetSubImage> is
+reported again on the next frame, so the copy may be read twice but is never
+missed.
+
+The window must be viewable and on-screen for C<XGetImage> to work, as always.
+
+=head1 CONSTRUCTOR
+
+=head2 new
+
+  my $cap= X11::Xlib::DamageCapture->new(display => $display, max_rects => 32);
+
+Dies if the server does not support DAMAGE and XFixes 2.0.
+L<wait_event|X11::Xlib::Display/wait_event> of the display passes every event to
+L</apply_event> of each capture object.
+
+=cut
+
+sub new {
+    my $class= shift;
+    my %args= (@_ == 1 and ref($_[0]) eq 'HASH')? %{ $_[0] }
+        : ((@_ & 1) == 0)? @_
+        : croak "Expected hashref or even-length list";
+    my $display= $args{display} or croak "display is required";
+    $display->can('XDamageQueryExtension')
+        or croak "X11::Xlib was built without DAMAGE support";
+    $display->XDamageQueryExtension or croak "Server lacks the DAMAGE extension";
+    my ($fixes)= $display->XFixesQueryVersion;
+    ($fixes || 0) >= 2 or croak "Server lacks XFixes 2.0, needed for regions";
+    my $self= bless {
+        display   => $display,
+        max_rects => $args{max_rects} || 32,
+        windows   => {},
+        by_damage => {},
+    }, $class;
+    weaken( $display->{damage_captures}{refaddr $self}= $self );
+    return $self;
+}
+
+sub DESTROY {
+    my $self= shift;
+    delete $self->{display}{damage_captures}{refaddr $self} if $self->{display};
+}
+
+=head1 ATTRIBUTES
+
+=head2 display
+
+=head2 max_rects
+
+If the damage of a window consists of more than this many rectangles, its
+bounding box is fetched instead, because each rectangle costs a round trip.
+
+=cut
+
+sub display   { $_[0]{display} }
+sub max_rects { my $self= shift; $self->{max_rects}= shift if @_; $self->{max_rects} }
+
+=head1 METHODS
+
+=head2 watch
+
+  $cap->watch($window);
+
+Start tracking a window (object or XID).  This turns on
+L<track_attributes|X11::Xlib::Window/track_attributes> so that the size is known
+without a round trip.  The first L</capture> reads the whole window.
+
+=cut
+
+sub watch {
+    my ($self, $window)= @_;
+    my $display= $self->{display};
+    my $wnd= $display->get_cached_window($window);
+    my $xid= $wnd->xid;
+    return $self if $self->{windows}{$xid};
+    $wnd->track_attributes(1);
+    my $damage= $display->XDamageCreate($wnd, X11::Xlib::XDamageReportNonEmpty());
+    $self->{windows}{$xid}= {
+        window => $wnd,
+        damage => $damage,
+        region => $display->XFixesCreateRegion([]),
+        data   => '',
+        image  => undef,
+        dirty  => 1,
+    };
+    $self->{by_damage}{$damage->xid}= $xid;
+    $self;
+}
+
+=head2 unwatch
+
+  $cap->unwatch($window);
+
+Stop tracking a window, and free its Damage, region, and image.
+
+=cut
+
+sub unwatch {
+    my ($self, $window)= @_;
+    my $xid= ref $window? $window->xid : $window;
+    my $st= delete $self->{windows}{$xid} or return $self;
+    delete $self->{by_damage}{$st->{damage}->xid};
+    $self;
+}
+
+=head2 windows
+
+List of watched L<X11::Xlib::Window> objects.
+
+=head2 dirty_windows
+
+List of watched windows which have changed since their last L</capture>.
+
+=cut
+
+sub windows       { map $_->{window}, values %{ $_[0]{windows} } }
+sub dirty_windows { map $_->{window}, grep $_->{dirty}, values %{ $_[0]{windows} } }
+
+=head2 apply_event
+
+  $cap->apply_event($event);
+
+Mark a window dirty on C<DamageNotify>, and stop watching it on
+C<DestroyNotify>.  This is called by C<wait_event>; call it yourself if you read
+events another way.  Returns true if the event was relevant.
+
+=cut
+
+sub apply_event {
+    my ($self, $e)= @_;
+    if ($e->isa('X11::Xlib::XDamageNotifyEvent')) {
+        my $xid= $self->{by_damage}{$e->damage} or return 0;
+        $self->{windows}{$xid}{dirty}= 1;
+        return 1;
+    }
+    if ($e->type == X11::Xlib::DestroyNotify()) {
+        my $st= $self->{windows}{$e->window} or return 0;
+        # The server frees the Damage along with the window
+        $st->{damage}->autofree(0);
+        $self->unwatch($e->window);
+        return 1;
+    }
+    return 0;
+}
+
+=head2 capture
+
+  my @rects= $cap->capture($window);
+
+Bring the client-side copy of the window up to date, and return the list of
+L<X11::Xlib::XRectangle> which were read (empty if nothing changed).  If the
+window changed size, or this is the first capture, the whole window is read and
+returned as a single rectangle.
+
+=cut
+
+sub capture {
+    my ($self, $window)= @_;
+    my $xid= ref $window? $window->xid : $window;
+    my $st= $self->{windows}{$xid} or croak "Window $xid is not watched";
+    my $display= $self->{display};
+    my $attrs= $st->{window}->attributes;
+    my ($w, $h)= ($attrs->width, $attrs->height);
+    $st->{dirty}= 0;
+    my $img= $st->{image};
+    if (!$img or $img->width != $w or $img->height != $h) {
+        # Read everything; whatever is already accumulated is included
+        $display->XDamageSubtract($st->{damage}, 0, 0);
+        $st->{image}= X11::Xlib::XGetImage($display, $xid, 0, 0, $w, $h,
+            X11::Xlib::AllPlanes(), X11::Xlib::ZPixmap(), $st->{data});
+        return X11::Xlib::XRectangle->new(x => 0, y => 0, width => $w, height => $h);
+    }
+    $display->XDamageSubtract($st->{damage}, 0, $st->{region});
+    my @rects= $display->XFixesFetchRegion($st->{region});
+    if (@rects > $self->{max_rects}) {
+        my ($x0, $y0, $x1, $y1)= ($w, $h, 0, 0);
+        for (@rects) {
+            $x0= $_->x if $_->x < $x0;
+            $y0= $_->y if $_->y < $y0;
+            $x1= $_->x + $_->width if $_->x + $_->width > $x1;
+            $y1= $_->y + $_->height if $_->y + $_->height > $y1;
+        }
+        @rects= ( X11::Xlib::XRectangle->new(x => $x0, y => $y0, width => $x1-$x0, height => $y1-$y0) );
+    }
+    my @done;
+    for my $r (@rects) {
+        # Damage can extend past the window's current size if it shrank
+        my ($x, $y)= ($r->x < 0? 0 : $r->x, $r->y < 0? 0 : $r->y);
+        my $rw= ($r->x + $r->width > $w? $w : $r->x + $r->width) - $x;
+        my $rh= ($r->y + $r->height > $h? $h : $r->y + $r->height) - $y;
+        next unless $rw > 0 && $rh > 0;
+        X11::Xlib::XGetSubImage($display, $xid, $x, $y, $rw, $rh,
+            X11::Xlib::AllPlanes(), X11::Xlib::ZPixmap(), $img, $x, $y);
+        push @done, X11::Xlib::XRectangle->new(x => $x, y => $y, width => $rw, height => $rh);
+    }
+    return @done;
+}
+
+=head2 image
+
+  my $ximage= $cap->image($window);
+
+The L<X11::Xlib::XImage> holding the copy of the window, or undef before the
+first capture.  The same image (and pixel buffer) is reused from frame to frame
+until the window changes size.
+
+=cut
+
+sub image {
+    my ($self, $window)= @_;
+    my $st= $self->{windows}{ ref $window? $window->xid : $window } or return undef;
+    $st->{image};
+}
+
+1;
+
+__END__
+
+=head1 AUTHOR
+
+Olivier Thauvin, E<lt>nanardon@nanardon.zarb.orgE<gt>
+
+Michael Conrad, E<lt>mike@nrdvana.netE<gt>
+
+=head1 COPYRIGHT AND LICENSE
+
+Copyright (C) 2009-2010 by Olivier Thauvin
+
+Copyright (C) 2017-2023 by Michael Conrad
+
+This library is free software; you can redistribute it and/or modify
+it under the same terms as Perl itself, either Perl version 5.10.0 or,
+at your option, any later version of Perl 5 you may have available.
+
+=cut
@@ -13,6 +13,10 @@ require X11::Xlib::Colormap;
 require X11::Xlib::Window;
 require X11::Xlib::Pixmap;
 require X11::Xlib::XserverRegion;
+require X11::Xlib::Damage;
+require X11::Xlib::Picture;
+require X11::Xlib::GC;
+require X11::Xlib::XGCValues;
 
 =head1 NAME
 
@@ -87,6 +91,45 @@ sub screen {
 
 See L<X11::Xlib/on_error>.
 
+=head2 defer_free
+
+  $display->defer_free(1);
+
+If true, the XID objects which free their resource when they go out of scope
+(L<Window|X11::Xlib::Window>, L<Pixmap|X11::Xlib::Pixmap>,
+L<Colormap|X11::Xlib::Colormap> and L<XserverRegion|X11::Xlib::XserverRegion>
+with L<autofree|X11::Xlib::XID/autofree>) add their XID to a queue instead, and
+the queue is sent in one pass by L</collect>, which is called by L</flush>,
+L</flush_sync> and the C<XFlush> and C<XSync> methods.  Dropping a large
+structure then costs a string append per object instead of a call into Xlib, and
+the free requests go out together instead of being interleaved with whatever the
+program does next.
+
+Freeing something that is already gone (such as a child of a window destroyed
+earlier in the same batch) is an error on the server.  Errors for the serial
+numbers of the requests sent by L</collect> are not passed to L</on_error>.
+Enabling this option installs the module's error handler (see
+L<X11::Xlib/on_error>) so that those errors don't reach Xlib's default handler,
+which would exit the program.
+
+Turning the option off collects anything still queued.  If the connection is
+closed with XIDs still queued, the server frees them anyway.
+
+=cut
+
+sub defer_free {
+    my $self= shift;
+    if (@_) {
+        $self->{defer_free}= shift;
+        if ($self->{defer_free}) {
+            X11::Xlib::_install_error_handlers(1,1);
+        } else {
+            $self->collect;
+        }
+    }
+    $self->{defer_free};
+}
+
 =head1 METHODS
 
 =head2 new
@@ -160,6 +203,11 @@ timeout before returning false.
 
 Returns an L<X11::Xlib::XEvent> on success, or undef on timeout or interruption.
 
+If L</window_tree> has been loaded, each returned event is also applied to it,
+and likewise for windows using L<X11::Xlib::Window/track_attributes> and for
+each L<X11::Xlib::DamageCapture>, L<X11::Xlib::CompositeCapture>, and
+L<X11::Xlib::CursorCapture>.
+
 =cut
 
 sub wait_event {
@@ -175,11 +223,25 @@ sub wait_event {
             $args{event_mask}||0x7FFFFFFF,
             $event,
             $timeout
-        ) and return $event;
+        ) and do {
+            $self->{window_tree}->apply_event($event) if $self->{window_tree};
+            $self->_apply_tracked_attributes($event) if $self->{tracked_windows};
+            $_ && $_->apply_event($event) for values %{ $self->{damage_captures} || {} };
+            $_ && $_->apply_event($event) for values %{ $self->{composite_captures} || {} };
+            $_ && $_->apply_event($event) for values %{ $self->{cursor_captures} || {} };
+            return $event;
+        };
     } while ($args{loop} and (Time::HiRes::time() - $start)*1000 < $timeout);
     return undef;
 }
 
+sub _apply_tracked_attributes {
+    my ($self, $event)= @_;
+    return unless $X11::Xlib::Window::_attr_event_types{$event->type};
+    my $wnd= $self->{tracked_windows}{$event->window} or return;
+    $wnd->apply_event($event);
+}
+
 =head3 send_event
 
   $display->send_event( $xevent,
@@ -215,7 +277,7 @@ sub putback_event {
 
 =head3 flush
 
-Push any queued messages to the X server.
+Push any queued messages to the X server (after L</collect>).
 
 =head3 flush_sync
 
@@ -226,12 +288,92 @@ Push any queued messages to the X server and wait for all replies.
 Push any queued messages to the server, wait for replies, and then delete the
 entire input event queue.
 
+=head3 collect
+
+  my $n= $display->collect;
+
+Send the free requests for the XIDs queued by L</defer_free>, with one C loop
+per type of resource, and return how many there were.  This only queues the
+requests in Xlib's buffer; they are sent by the flush that usually follows.
+
+=head3 pending_frees
+
+Number of XIDs waiting for L</collect>.
+
 =cut
 
 sub flush              { shift->XFlush }
 sub flush_sync         { shift->XSync }
 sub flush_sync_discard { shift->XSync(1) }
 
+sub XFlush { $_[0]->collect if $_[0]{_free_queue}; &X11::Xlib::XFlush }
+sub XSync  { $_[0]->collect if $_[0]{_free_queue}; &X11::Xlib::XSync }
+
+# Argument to _free_xids for each free function
+our %_free_kind= ( XDestroyWindow => 0, XFreePixmap => 1, XFreeColormap => 2, XFixesDestroyRegion => 3 );
+my $xid_size= length pack 'L!', 0;
+
+# Called by DESTROY of the XID classes
+sub _release_xid {
+    my ($self, $free_fn, $xid)= @_;
+    return $self->$free_fn($xid) unless $self->{defer_free};
+    $self->{_free_queue}{ $_free_kind{$free_fn} } .= pack 'L!', $xid;
+}
+
+sub pending_frees {
+    my $n= 0;
+    $n += length for values %{ $_[0]{_free_queue} || {} };
+    return $n / $xid_size;
+}
+
+sub collect {
+    my $self= shift;
+    my $queue= delete $self->{_free_queue} or return 0;
+    my $serials= $self->{_free_serials} ||= [];
+    # Errors for ranges older than the last response read have all arrived by now
+    my $done= $self->LastKnownRequestProcessed;
+    shift @$serials while @$serials && $serials->[0][1] <= $done;
+    my $n= 0;
+    for my $kind (sort keys %$queue) {
+        my ($first, $last)= $self->_free_xids($kind, $queue->{$kind});
+        if (@$serials && $serials->[-1][1] + 1 == $first) {
+            $serials->[-1][1]= $last;
+        } else {
+            push @$serials, [ $first, $last ];
+        }
+        $n += length($queue->{$kind}) / $xid_size;
+    }
+    return $n;
+}
+
+# Called by X11::Xlib::_error_nonfatal
+sub _is_free_error {
+    my ($self, $serial)= @_;
+    for (@{ $self->{_free_serials} }) {
+        return 1 if $serial >= $_->[0] && $serial <= $_->[1];
+    }
+    return 0;
+}
+
+=head3 begin_batch
+
+  my $batch= $display->begin_batch;
+  $batch->move_resize($wnd, $x, $y, $w, $h);
+  ...
+  $batch->commit;
+
+Return a new L<X11::Xlib::Batch>, which records window configuration, attribute,
+stacking and mapping changes, and sends them as a minimal set of requests with
+one flush when you call C<commit>.
+
+=cut
+
+sub begin_batch {
+    my $self= shift;
+    require X11::Xlib::Batch;
+    return X11::Xlib::Batch->new(display => $self, @_);
+}
+
 =head3 warp_pointer
 
   $display->warp_pointer($dest_win, $dest_x, $dest_y);
@@ -282,6 +424,93 @@ sub fake_motion { shift->XTestFakeMotionEvent(@_) }
 sub fake_button { shift->XTestFakeButtonEvent(@_) }
 sub fake_key    { shift->XTestFakeKeyEvent(@_) }
 
+=head3 fake_input_script
+
+  use X11::Xlib qw( KeyPress KeyRelease ButtonPress ButtonRelease MotionNotify );
+  my $script= X11::Xlib::Display->pack_input_script(
+    [ MotionNotify,  -1, 100, 200 ],     # type, detail, x, y, delay_ms
+    [ ButtonPress,    1, 0, 0, 5 ],
+    [ ButtonRelease,  1, 0, 0, 20 ],
+    (map { ([ KeyPress, $_ ], [ KeyRelease, $_ ]) } @keycodes),
+  );
+  my $n= $display->fake_input_script($script, timing => 'client', flush_every => 100);
+
+Replay a sequence of fake input events in one call.  The loop runs in C, calling
+the same XTest functions as L</fake_key>, L</fake_button> and L</fake_motion>, so
+a long script costs about as much as the requests themselves.  Returns the number
+of events sent.
+
+C<$script> is a string of packed C<(S S s s L)> records (see
+L</pack_input_script>), or an arrayref of records as given to
+L</pack_input_script>.  Each record is:
+
+=over
+
+=item type
+
+C<KeyPress>, C<KeyRelease>, C<ButtonPress>, C<ButtonRelease> or C<MotionNotify>.
+
+=item detail
+
+The key code or button number.  For motion, the screen number, where C<-1> (or
+C<0xFFFF>) means the screen the pointer is on.
+
+=item x, y
+
+The pointer position, for motion.  Ignored otherwise.
+
+=item delay_ms
+
+How long to wait before this event, in milliseconds.
+
+=back
+
+The whole script is checked before anything is sent, so an invalid record can't
+leave a key or button held down.  The options are:
+
+=over
+
+=item timing
+
+C<'server'> (the default) passes each delay as the XTest C<EventSendDelay>, so the
+whole script can be sent at once and the X server spaces out the events.
+C<'client'> waits locally instead, flushing before each wait so the events reach
+the server at the scheduled times.  The waits are scheduled relative to the start
+of the script, so time spent sending doesn't accumulate.
+
+=item flush_every
+
+Flush after this many events.  The default C<0> leaves flushing to Xlib, which
+sends its buffer when it fills up, and to the end of the script, which always
+flushes.  Smaller values get the first events to the server sooner at the cost
+of more writes.
+
+=back
+
+=head3 pack_input_script
+
+  my $script= X11::Xlib::Display->pack_input_script(\@record, ...);
+
+Pack records of C<[ $type, $detail, $x, $y, $delay_ms ]> for
+L</fake_input_script>.  Missing fields are zero.
+
+=cut
+
+sub pack_input_script {
+    my $class= shift;
+    return pack '(S S s s L)*', map { ($_->[0], $_->[1] || 0, $_->[2] || 0, $_->[3] || 0, $_->[4] || 0) } @_;
+}
+
+sub fake_input_script {
+    my ($self, $script, %opt)= @_;
+    $script= $self->pack_input_script(@$script)
+        if ref $script eq 'ARRAY';
+    my $timing= $opt{timing} || 'server';
+    $timing eq 'server' || $timing eq 'client'
+        or croak "timing must be 'server' or 'client'";
+    return X11::Xlib::_fake_input_script($self, $script, $timing eq 'client'? 1 : 0, $opt{flush_every} || 0);
+}
+
 =head2 ATOM
 
 =head3 atom
@@ -463,6 +692,9 @@ C<$drawable>'s only purpose is to determine which screen to use, and so it
 may also be a L<Screen|X11::Xlib::Screen> object.
 C<$width> C<$height> and C<$color_depth> should be self-explanatory.
 
+To reuse scratch pixmaps of the same size instead of creating and freeing them
+over and over, see L<X11::Xlib::PixmapPool>.
+
 =cut
 
 sub new_pixmap {
@@ -473,6 +705,39 @@ sub new_pixmap {
     return $self->XCreatePixmap($drawable, $width, $height, $depth);
 }
 
+=head3 new_gc
+
+  my $gc= $display->new_gc($drawable, foreground => $pixel, line_width => 2, ...);
+
+Create a L<GC|X11::Xlib::GC> for drawing on drawables like C<$drawable> (default
+the root window), with any of the fields of L<X11::Xlib::XGCValues>.  This saves
+calculating the value mask.  The GC is freed when the object goes out of scope.
+
+=cut
+
+sub new_gc {
+    my ($self, $drawable, %values)= @_;
+    $drawable ||= $self->screen->root_window;
+    my $gc= $self->XCreateGC($drawable, X11::Xlib::XGCValues->field_mask(keys %values), \%values);
+    $gc->autofree(1);
+    return $gc;
+}
+
+=head3 copy_areas
+
+  $display->copy_areas($src, $dst, $gc, pack('(s s S S s s)*',
+    $src_x, $src_y, $width, $height, $dst_x, $dst_y, ...
+  ));
+
+Call L<XCopyArea|X11::Xlib/XCopyArea> for each packed record, from C.  Each copy is
+still its own request, but they are all written to the output buffer in one call
+with no perl overhead per rectangle, such as for blitting a list of damaged tiles
+from a back buffer.
+
+=cut
+
+*copy_areas= \&X11::Xlib::_copy_areas;
+
 =head3 new_window
 
   my $win= $display->new_window(
@@ -577,6 +842,76 @@ sub new_window {
     return $wnd;
 }
 
+=head2 WINDOW TREE
+
+=head3 snapshot_tree
+
+  my $table= $display->snapshot_tree($root, fields => [qw( width height map_state )]);
+  my $n= length($table) / 40;
+  for (0 .. $n-1) {
+    my ($parent_idx, $xid, $x, $y, $w, $h, $border, $depth, $map_state, $override_redirect)
+      = unpack('l L l l L L L L l l', substr($table, $_*40, 40));
+    ...
+  }
+
+Fetch the window hierarchy below C<$root> (default is L</root_window>), along
+with the geometry and attributes of every window in it.  Instead of a round trip
+for every C<XQueryTree>, C<XGetWindowAttributes> and C<XGetGeometry>, the requests
+for each level of the tree are all sent before reading any of the replies, so the
+whole walk costs one round trip per level of the tree.
+
+The result is a packed string of fixed-size rows, in breadth-first order.  The
+first row is C<$root>, whose parent index is C<-1>.  Every other row refers to its
+parent by row index, and siblings are listed in stacking order from bottom to top.
+Windows that were destroyed while the walk was in progress have their XID set to
+C<0>.
+
+The C<fields> option limits which columns are fetched, and unrequested columns are
+zero.  C<x>, C<y>, C<width>, C<height>, C<border_width> and C<depth> come from
+C<XGetGeometry>, and C<map_state> and C<override_redirect> come from
+C<XGetWindowAttributes>.  The default is all of them.
+
+=cut
+
+my %_snapshot_tree_field_flag= (
+    (map { $_ => 1 } qw( x y width height border_width depth )),
+    (map { $_ => 2 } qw( map_state override_redirect )),
+);
+sub snapshot_tree {
+    my ($self, $root, %opts)= @_;
+    $root= $self->root_window unless defined $root;
+    my $flags= 0;
+    for (@{ $opts{fields} || [ keys %_snapshot_tree_field_flag ] }) {
+        my $flag= $_snapshot_tree_field_flag{$_}
+            or croak "Unknown snapshot_tree field '$_'";
+        $flags |= $flag;
+    }
+    return $self->_snapshot_tree($root, $flags);
+}
+
+=head3 window_tree
+
+  my $tree= $display->window_tree; # lazy-loaded instance of X11::Xlib::WindowTree
+
+A mirror of the window hierarchy below L</root_window>, which is kept up to date
+from the events returned by L</wait_event>.  See L<X11::Xlib::WindowTree>.
+
+=cut
+
+sub window_tree {
+    my $self= shift;
+    if (@_) { $self->{window_tree}= shift; }
+    $self->{window_tree} ||= $self->_build_window_tree if defined wantarray;
+}
+
+sub _build_window_tree {
+    my $self= shift;
+    require X11::Xlib::WindowTree;
+    return X11::Xlib::WindowTree->new(
+        display => $self,
+    );
+}
+
 =head2 INPUT
 
 =head3 keymap
@@ -838,6 +1173,44 @@ sub get_cached_region {
     $_[0]->get_cached_region( $xid, autofree => 1 );
 } if X11::Xlib->can('XFixesCreateRegion');
 
+=head3 get_cached_damage
+
+  my $damage= $display->get_cached_damage($xid, @new_args);
+
+Shortcut for L</get_cached_xobj> that implies a class of L<X11::Xlib::Damage>.
+L<XDamageCreate|X11::Xlib/XDamageCreate> returns one of these (with C<autofree>)
+when called as a method of a Display object.
+
+=cut
+
+sub get_cached_damage {
+    shift->get_cached_xobj(shift, 'X11::Xlib::Damage', @_);
+}
+
+*X11::Xlib::Display::XDamageCreate= sub {
+    my $xid= &X11::Xlib::XDamageCreate;
+    $_[0]->get_cached_damage( $xid, autofree => 1 );
+} if X11::Xlib->can('XDamageCreate');
+
+=head3 get_cached_picture
+
+  my $picture= $display->get_cached_picture($xid, @new_args);
+
+Shortcut for L</get_cached_xobj> that implies a class of L<X11::Xlib::Picture>.
+L<XRenderCreatePicture|X11::Xlib/XRenderCreatePicture> returns one of these (with
+C<autofree>) when called as a method of a Display object.
+
+=cut
+
+sub get_cached_picture {
+    shift->get_cached_xobj(shift, 'X11::Xlib::Picture', @_);
+}
+
+*X11::Xlib::Display::XRenderCreatePicture= sub {
+    my $xid= &X11::Xlib::XRenderCreatePicture;
+    $_[0]->get_cached_picture( $xid, autofree => 1 );
+} if X11::Xlib->can('XRenderCreatePicture');
+
 
 1;
 
@@ -0,0 +1,131 @@
+package X11::Xlib::FrameDecoder;
+use strict;
+use warnings;
+use Carp;
+use X11::Xlib;
+require X11::Xlib::FrameEncoder;
+
+# All modules in dist share a version
+our $VERSION = '0.25';
+
+=head1 NAME
+
+X11::Xlib::FrameDecoder - Read a stream written by X11::Xlib::FrameEncoder
+
+=head1 SYNOPSIS
+
+  open my $in, '<:raw', 'session.xqf' or die;
+  my $dec= X11::Xlib::FrameDecoder->new(fh => $in);
+  while (my $frame= $dec->read_frame) {
+    printf "%.3f: %dx%d\n", $frame->{timestamp}, $frame->{width}, $frame->{height};
+  }
+
+=head1 DESCRIPTION
+
+Reads the records described in L<X11::Xlib::FrameEncoder/Stream Format>,
+decodes the QOI images in C, and applies delta frames to the previous frame.
+
+=head1 CONSTRUCTOR
+
+=head2 new
+
+  my $dec= X11::Xlib::FrameDecoder->new(fh => $fh);
+
+=cut
+
+sub new {
+    my $class= shift;
+    my %args= (@_ == 1 and ref($_[0]) eq 'HASH')? %{ $_[0] }
+        : ((@_ & 1) == 0)? @_
+        : croak "Expected hashref or even-length list";
+    defined $args{fh} or croak "fh is required";
+    bless { fh => $args{fh}, prev => undef }, $class;
+}
+
+=head1 ATTRIBUTES
+
+=head2 fh
+
+The file handle frames are read from.  It should be in C<:raw> mode.
+
+=cut
+
+sub fh { $_[0]{fh} }
+
+=head1 METHODS
+
+=head2 read_frame
+
+  my $frame= $dec->read_frame;
+
+Returns a hashref of C<width>, C<height>, C<channels>, C<data> (the pixels, as
+RGB8 or RGBA8 with no row padding), C<keyframe> (boolean), and C<timestamp>, or
+undef at end of file.  Dies on a malformed stream, or on a delta frame before
+any key frame.
+
+=head2 skip_to_keyframe
+
+Read and discard frames up to the next key frame, which is returned (decoded)
+like L</read_frame>.  Use this to start reading part-way through a stream.
+
+=cut
+
+sub read_frame {
+    my $self= shift;
+    my ($type, $qoi, $timestamp)= $self->_read_record or return undef;
+    my $prev;
+    if ($type eq 'D') {
+        defined $self->{prev} or croak "Delta frame without a previous key frame";
+        $prev= $self->{prev};
+    }
+    my ($w, $h, $ch, $pixels)= X11::Xlib::FrameEncoder::qoi_decode($qoi, $prev);
+    $self->{prev}= $pixels;
+    return { width => $w, height => $h, channels => $ch, data => $pixels,
+        keyframe => $type eq 'I', timestamp => $timestamp };
+}
+
+sub skip_to_keyframe {
+    my $self= shift;
+    while (1) {
+        my ($type, $qoi, $timestamp)= $self->_read_record or return undef;
+        next unless $type eq 'I';
+        my ($w, $h, $ch, $pixels)= X11::Xlib::FrameEncoder::qoi_decode($qoi);
+        $self->{prev}= $pixels;
+        return { width => $w, height => $h, channels => $ch, data => $pixels,
+            keyframe => 1, timestamp => $timestamp };
+    }
+}
+
+sub _read_record {
+    my $self= shift;
+    my $got= read($self->{fh}, my $hdr, 16);
+    defined $got or croak "read: $!";
+    return unless $got;
+    $got == 16 or croak "Truncated frame header";
+    my ($magic, $type, $len, $sec, $usec)= unpack 'a3 a N N N', $hdr;
+    $magic eq 'XQF' && ($type eq 'I' || $type eq 'D') or croak "Not a frame record";
+    (read($self->{fh}, my $qoi, $len) || 0) == $len or croak "Truncated frame";
+    return ($type, $qoi, $sec + $usec / 1_000_000);
+}
+
+1;
+
+__END__
+
+=head1 AUTHOR
+
+Olivier Thauvin, E<lt>nanardon@nanardon.zarb.orgE<gt>
+
+Michael Conrad, E<lt>mike@nrdvana.netE<gt>
+
+=head1 COPYRIGHT AND LICENSE
+
+Copyright (C) 2009-2010 by Olivier Thauvin
+
+Copyright (C) 2017-2023 by Michael Conrad
+
+This library is free software; you can redistribute it and/or modify
+it under the same terms as Perl itself, either Perl version 5.10.0 or,
+at your option, any later version of Perl 5 you may have available.
+
+=cut
@@ -0,0 +1,164 @@
+package X11::Xlib::FrameDiff;
+use strict;
+use warnings;
+use Carp;
+use Scalar::Util 'blessed';
+use X11::Xlib;
+require X11::Xlib::XRectangle;
+
+# All modules in dist share a version
+our $VERSION = '0.25';
+
+=head1 NAME
+
+X11::Xlib::FrameDiff - Find which tiles of an image changed since the last frame
+
+=head1 SYNOPSIS
+
+  use X11::Xlib::FrameDiff;
+  my $diff= X11::Xlib::FrameDiff->new(tile_width => 64, tile_height => 64);
+  while (1) {
+    my $img= XGetImage($display, $window, 0, 0, $w, $h, AllPlanes, ZPixmap, $buf);
+    my @rects= $diff->diff($img);
+    next unless @rects;
+    my $region= $display->XFixesCreateRegion(\@rects);
+    ...
+  }
+
+=head1 DESCRIPTION
+
+This object remembers a 64-bit hash of every tile of the previous frame.  Each
+call to L</diff> hashes the tiles of the new frame, compares them to the old
+ones, and returns the rectangles of the tiles that differ, ready to pass to
+C<XFixesCreateRegion> or to read again with C<XGetSubImage>.  Changed tiles that
+are next to each other in the same row of tiles are merged into one rectangle.
+
+All of the work is done in C directly on the pixel buffer.  The hash reads 32
+bytes at a time with SSE2 or AVX2 when the CPU has them (selected the same way,
+and with the same L<simd_level|X11::Xlib::Pixels/simd_level>, as
+L<X11::Xlib::Pixels>), and is fast enough to diff a 1920x1080 32-bit image in a
+small fraction of a 60 Hz frame on one core.  Rows of tiles are spread across
+L<threads|X11::Xlib::Pixels/threads> if more than one is configured.
+
+Hashes can collide, so a change has a 1 in 2**64 chance of going unnoticed.
+
+=head1 CONSTRUCTOR
+
+=head2 new
+
+  my $diff= X11::Xlib::FrameDiff->new(%attrs);
+
+=cut
+
+sub new {
+    my $class= shift;
+    my %args= (@_ == 1 and ref($_[0]) eq 'HASH')? %{ $_[0] }
+        : ((@_ & 1) == 0)? @_
+        : croak "Expected hashref or even-length list";
+    my $self= bless {
+        tile_width  => $args{tile_width} || 64,
+        tile_height => $args{tile_height} || 64,
+        hashes      => '',
+        geometry    => '',
+    }, $class;
+    $self->{$_} > 0 && $self->{$_} < 0x8000 or croak "Invalid $_"
+        for qw( tile_width tile_height );
+    return $self;
+}
+
+=head1 ATTRIBUTES
+
+=head2 tile_width
+
+=head2 tile_height
+
+Size of the tiles, default 64x64.  Smaller tiles find changes more precisely
+but produce more rectangles.  Tiles on the right and bottom edge are cut off at
+the edge of the image.
+
+=cut
+
+sub tile_width  { $_[0]{tile_width} }
+sub tile_height { $_[0]{tile_height} }
+
+=head1 METHODS
+
+=head2 diff
+
+  my @rects= $diff->diff($image);
+
+Compare the image to the one given to the previous call, and return a list of
+L<X11::Xlib::XRectangle> covering the tiles that changed.  The first frame, and
+any frame whose size or pixel format differs from the previous one, returns
+rectangles covering the whole image.
+
+C<$image> is an L<X11::Xlib::XImage> in C<ZPixmap> format, or a hashref of
+C<data>, C<width>, C<height>, and optionally C<bits_per_pixel> (default 32) and
+C<bytes_per_line>.  Only whole bytes per pixel are supported.
+
+=cut
+
+sub diff {
+    my ($self, $src)= @_;
+    my ($w, $h, $bpp, $stride, $data);
+    if (blessed($src) && $src->isa('X11::Xlib::XImage')) {
+        $src->format == X11::Xlib::ZPixmap()
+            or croak "Only ZPixmap images can be compared";
+        ($w, $h, $bpp, $stride)= ($src->width, $src->height, $src->bits_per_pixel, $src->bytes_per_line);
+        $src->data; # make sure the buffer is the full size of the image
+        $data= \$src->{data};
+    }
+    elsif (ref $src eq 'HASH') {
+        defined $src->{$_} or croak "$_ is required" for qw( data width height );
+        ($w, $h)= @{$src}{qw( width height )};
+        $bpp= $src->{bits_per_pixel} || 32;
+        $stride= $src->{bytes_per_line} || $w * ($bpp >> 3);
+        $data= \$src->{data};
+    }
+    else {
+        croak "Expected X11::Xlib::XImage or hashref";
+    }
+    $bpp & 7 and croak "Unsupported bits_per_pixel $bpp";
+    my $geometry= "$w x $h x $bpp";
+    if ($geometry ne $self->{geometry}) {
+        $self->{hashes}= '';
+        $self->{geometry}= $geometry;
+    }
+    return _diff($$data, $stride, $w, $h, $bpp >> 3,
+        $self->{tile_width}, $self->{tile_height}, $self->{hashes});
+}
+
+=head2 reset
+
+Forget the previous frame, so that the next L</diff> reports everything.
+
+=cut
+
+sub reset {
+    my $self= shift;
+    $self->{hashes}= '';
+    $self->{geometry}= '';
+    $self;
+}
+
+1;
+
+__END__
+
+=head1 AUTHOR
+
+Olivier Thauvin, E<lt>nanardon@nanardon.zarb.orgE<gt>
+
+Michael Conrad, E<lt>mike@nrdvana.netE<gt>
+
+=head1 COPYRIGHT AND LICENSE
+
+Copyright (C) 2009-2010 by Olivier Thauvin
+
+Copyright (C) 2017-2023 by Michael Conrad
+
+This library is free software; you can redistribute it and/or modify
+it under the same terms as Perl itself, either Perl version 5.10.0 or,
+at your option, any later version of Perl 5 you may have available.
+
+=cut
@@ -1,7 +1,119 @@
 package X11::Xlib::GC;
+use strict;
+use warnings;
+use Carp;
 require X11::Xlib::Opaque;
-# parent class "Opaque" and XS handle all methods.
-# No need to load this package.
+require X11::Xlib::XGCValues;
+# parent class "Opaque" and XS handle the pointer; the rest is the state cache.
+
+sub autofree { my $self= shift; $self->{autofree}= shift if @_; $self->{autofree} }
+
+sub DESTROY {
+    my $self= shift;
+    X11::Xlib::XFreeGC($self->display, $self)
+        if $self->{autofree} && $self->pointer_int;
+}
+
+# Xlib can report every field but these
+my $readable_mask= ~(X11::Xlib::GCClipMask() | X11::Xlib::GCDashList()) & ((1 << 23) - 1);
+my %xid_field= map +($_ => 1), qw( tile stipple font clip_mask );
+my %all_fields= X11::Xlib::XGCValues->new->get_list;
+
+for my $field (keys %all_fields) {
+    no strict 'refs';
+    *$field= sub { @_ > 1? $_[0]->set($field => $_[1]) : $_[0]->get($field) };
+}
+
+sub changes    { $_[0]{changes} || 0 }
+sub suppressed { $_[0]{suppressed} || 0 }
+sub flushes    { $_[0]{flushes} || 0 }
+
+# Values as of the last XChangeGC, loaded from Xlib's copy (no round trip) on first use
+sub _sent {
+    my $self= shift;
+    $self->{sent} ||= do {
+        my %v;
+        if (X11::Xlib::XGetGCValues($self->display, $self, $readable_mask, my $vals)) {
+            %v= $vals->get_list;
+            delete @v{qw( clip_mask dashes )};
+        }
+        \%v;
+    };
+}
+
+sub get {
+    my ($self, $field)= @_;
+    exists $all_fields{$field} or croak "No field '$field' in X11::Xlib::XGCValues";
+    my $pending= $self->{pending};
+    return $pending && exists $pending->{$field}? $pending->{$field} : $self->_sent->{$field};
+}
+
+sub set {
+    my $self= shift;
+    croak "Odd number of arguments to set()" if @_ & 1;
+    my $sent= $self->_sent;
+    my $pending= $self->{pending} ||= {};
+    while (my ($field, $value)= splice(@_, 0, 2)) {
+        exists $all_fields{$field} or croak "No field '$field' in X11::Xlib::XGCValues";
+        $value= $value->xid if $xid_field{$field} && ref $value;
+        $value= 0 unless defined $value;
+        my $current= exists $pending->{$field}? $pending->{$field} : $sent->{$field};
+        if (defined $current && $current == $value) {
+            ++$self->{suppressed};
+        }
+        elsif (defined $sent->{$field} && $sent->{$field} == $value) {
+            # changed back before it was sent
+            delete $pending->{$field};
+            ++$self->{suppressed};
+        }
+        else {
+            $pending->{$field}= $value;
+        }
+    }
+    return $self;
+}
+
+sub flush {
+    my $self= shift;
+    my $pending= $self->{pending};
+    return 0 unless $pending && %$pending;
+    X11::Xlib::XChangeGC($self->display, $self,
+        X11::Xlib::XGCValues->field_mask(keys %$pending), $pending);
+    my $sent= $self->_sent;
+    @{$sent}{keys %$pending}= values %$pending;
+    $self->{changes} += keys %$pending;
+    ++$self->{flushes};
+    $self->{pending}= {};
+    return 1;
+}
+
+sub invalidate {
+    my $self= shift;
+    $self->flush;
+    delete $self->{sent};
+}
+
+# Drawing, with pending changes applied first
+sub draw_points     { my ($self, $d, @args)= @_; $self->flush; X11::Xlib::XDrawPoints($self->display, $d, $self, @args) }
+sub draw_lines      { my ($self, $d, @args)= @_; $self->flush; X11::Xlib::XDrawLines($self->display, $d, $self, @args) }
+sub draw_segments   { my ($self, $d, @args)= @_; $self->flush; X11::Xlib::XDrawSegments($self->display, $d, $self, @args) }
+sub draw_rectangles { my ($self, $d, @args)= @_; $self->flush; X11::Xlib::XDrawRectangles($self->display, $d, $self, @args) }
+sub fill_rectangles { my ($self, $d, @args)= @_; $self->flush; X11::Xlib::XFillRectangles($self->display, $d, $self, @args) }
+sub draw_arcs       { my ($self, $d, @args)= @_; $self->flush; X11::Xlib::XDrawArcs($self->display, $d, $self, @args) }
+sub fill_arcs       { my ($self, $d, @args)= @_; $self->flush; X11::Xlib::XFillArcs($self->display, $d, $self, @args) }
+sub put_image       { my ($self, $d, @args)= @_; $self->flush; X11::Xlib::XPutImage($self->display, $d, $self, @args) }
+sub copy_area {
+    my ($self, $src, $dst, @args)= @_;
+    $self->flush;
+    X11::Xlib::XCopyArea($self->display, $src, $dst, $self, @args);
+}
+sub copy_areas {
+    my ($self, $src, $dst, $areas)= @_;
+    $self->flush;
+    $self->display->copy_areas($src, $dst, $self, $areas);
+}
+
+1;
 
 __END__
 
@@ -11,23 +123,130 @@ X11::Xlib::GC - Wrapper for GC* pointers
 
 =head1 DESCRIPTION
 
-This is an opaque structure describing a X11 Graphic Context.
-None of the GC API has been implemented yet, so this just allows you to
-pass around references to a GC such as the DefaultGC of a Screen.
+This is an opaque structure describing a X11 Graphic Context.  Create one with
+L<XCreateGC|X11::Xlib/XCreateGC> or L<new_gc|X11::Xlib::Display/new_gc>, change it
+with L<XChangeGC|X11::Xlib/XChangeGC>, and pass it to the drawing functions listed
+under L<X11::Xlib/GC FUNCTIONS>, such as L<XFillRectangles|X11::Xlib/XFillRectangles>.
+
+=head2 State cache
+
+Immediate-mode drawing code tends to set the color and line style before every
+shape, whether or not they changed.  The methods below keep a copy of the GC's
+values in the perl object, compare each setting against it, and collect the
+fields that really changed until the next drawing method of this object, which
+first sends them all in one C<XChangeGC>.  Settings equal to the current value
+(or changed and changed back before drawing) cost only a hash lookup.
+
+  $gc->foreground($red);
+  $gc->line_width(2);
+  $gc->draw_segments($window, $segments);   # one XChangeGC, then the drawing
+  $gc->foreground($red);                    # suppressed
+  $gc->fill_rectangles($window, $rects);    # nothing to send first
+
+Xlib itself also skips unchanged values and delays the change until the GC is
+used, so the gain is mainly the perl-to-C calls avoided; the L</suppressed>
+counter shows how many.  Calling Xlib functions such as
+L<XChangeGC|X11::Xlib/XChangeGC> directly on the GC bypasses this cache, so call
+L</invalidate> afterward, and call L</flush> before passing the GC to Xlib
+drawing functions other than the methods below.
 
 =head1 ATTRIBUTES
 
 =head2 display
 
-See L<X1::Xlib::Opaque/display>
+See L<X11::Xlib::Opaque/display>
+
+=head2 autofree
+
+If true, the GC is freed with L<XFreeGC|X11::Xlib/XFreeGC> when the object is
+garbage collected.  This is set for GCs made by
+L<new_gc|X11::Xlib::Display/new_gc>, but not by C<XCreateGC>, and must not be set
+on the L<DefaultGC|X11::Xlib/DefaultGC>.
+
+=head2 changes
+
+=head2 suppressed
+
+=head2 flushes
+
+Statistics of the state cache: the number of fields sent to Xlib, the number of
+settings which did not need to be, and the number of C<XChangeGC> calls.
 
 =head2 pointer_bytes
 
-See L<X1::Xlib::Opaque/pointer_bytes>
+See L<X11::Xlib::Opaque/pointer_bytes>
 
 =head2 pointer_int
 
-See L<X1::Xlib::Opaque/pointer_int>
+See L<X11::Xlib::Opaque/pointer_int>
+
+=head1 METHODS
+
+=head2 Field accessors
+
+  my $pixel= $gc->foreground;
+  $gc->foreground($pixel);
+
+One for each field of L<X11::Xlib::XGCValues>: C<function>, C<plane_mask>,
+C<foreground>, C<background>, C<line_width>, C<line_style>, C<cap_style>,
+C<join_style>, C<fill_style>, C<fill_rule>, C<arc_mode>, C<tile>, C<stipple>,
+C<ts_x_origin>, C<ts_y_origin>, C<font>, C<subwindow_mode>,
+C<graphics_exposures>, C<clip_x_origin>, C<clip_y_origin>, C<clip_mask>,
+C<dash_offset>, C<dashes>.  Setters queue the change as described above.
+Getters return the value including pending changes.  C<clip_mask> and C<dashes>
+can't be read from Xlib, so they return undef until set, and the first setting is
+always sent.
+
+=head2 get
+
+  my $value= $gc->get($field);
+
+=head2 set
+
+  $gc->set(foreground => $pixel, line_width => 3);
+
+Queue several changes.  Pixmap and Font fields accept objects or XIDs.
+
+=head2 flush
+
+Send pending changes with one C<XChangeGC>.  Returns true if there were any.
+
+=head2 invalidate
+
+Flush, then forget the cached values so they are read from Xlib again on next
+use.  Call this after changing the GC by other means.
+
+=head2 draw_points
+
+=head2 draw_lines
+
+=head2 draw_segments
+
+=head2 draw_rectangles
+
+=head2 fill_rectangles
+
+=head2 draw_arcs
+
+=head2 fill_arcs
+
+=head2 put_image
+
+  $gc->fill_rectangles($drawable, $rects);
+
+Flush, then call the Xlib function of the same name with this GC, for example
+C<XFillRectangles($display, $drawable, $gc, $rects)>.  See
+L<X11::Xlib/GC FUNCTIONS> for the arguments.
+
+=head2 copy_area
+
+  $gc->copy_area($src, $dst, $src_x, $src_y, $width, $height, $dst_x, $dst_y);
+
+=head2 copy_areas
+
+  $gc->copy_areas($src, $dst, $packed_areas);
+
+See L<X11::Xlib::Display/copy_areas>.
 
 =head1 AUTHOR
 
@@ -0,0 +1,311 @@
+package X11::Xlib::GlyphCache;
+use strict;
+use warnings;
+use Carp;
+use Scalar::Util 'blessed';
+use X11::Xlib;
+
+# All modules in dist share a version
+our $VERSION = '0.25';
+
+=head1 NAME
+
+X11::Xlib::GlyphCache - Keep rasterized glyphs in an XRender GlyphSet on the server
+
+=head1 SYNOPSIS
+
+  use X11::Xlib::GlyphCache;
+  my $glyphs= X11::Xlib::GlyphCache->new(
+    display   => $display,
+    rasterize => sub { my $codepoint= shift; ...; return { width => ..., data => ... } },
+    max_bytes => 2 * 1024 * 1024,
+  );
+  # every frame:
+  $glyphs->draw($color_picture, $window_picture, 10, 20, "FPS: $fps");
+
+=head1 DESCRIPTION
+
+Drawing text with XRender takes a GlyphSet on the server which holds the bitmap
+of every glyph, after which a whole string is drawn with one small
+C<XRenderCompositeString32> request naming the glyphs.  This object manages
+that GlyphSet: it calls your L</rasterize> function the first time a character
+is drawn, uploads all of the new glyphs of a string with one
+C<XRenderAddGlyphs>, and after that only sends the character codes.  Redrawing
+the same text every frame costs a few bytes instead of the bitmaps.
+
+The glyph id of each character is its Unicode codepoint, so a string can be
+drawn with C<XRenderCompositeString32> and the string's codepoints directly.
+
+The bitmaps held by the server are limited to L</max_bytes>.  When a new glyph
+would go over the limit, the glyphs that were least recently drawn are removed
+from the GlyphSet (with one C<XRenderFreeGlyphs>) until it fits.  Glyphs of the
+string being drawn are never removed, so one string with more glyphs than the
+budget can hold still draws correctly, and the cache is trimmed on a later call.
+
+=head1 CONSTRUCTOR
+
+=head2 new
+
+  my $glyphs= X11::Xlib::GlyphCache->new(display => $display, rasterize => $coderef, %attrs);
+
+Creates the GlyphSet.  Dies if the server lacks the RENDER extension.
+
+=cut
+
+sub new {
+    my $class= shift;
+    my %args= (@_ == 1 and ref($_[0]) eq 'HASH')? %{ $_[0] }
+        : ((@_ & 1) == 0)? @_
+        : croak "Expected hashref or even-length list";
+    my $display= $args{display} or croak "display is required";
+    ref $args{rasterize} eq 'CODE' or croak "rasterize must be a coderef";
+    $display->can('XRenderCreateGlyphSet')
+        or croak "X11::Xlib was built without XRender support";
+    # RENDER has no events, so the event base it returns is 0
+    (() = $display->XRenderQueryExtension) or croak "Server lacks the RENDER extension";
+    my $format= defined $args{format}? $args{format} : X11::Xlib::PictStandardA8();
+    $format= $display->XRenderFindStandardFormat($format)
+        || croak "No picture format for PictStandard $format"
+        unless blessed($format);
+    my $depth= $format->depth;
+    my $bpp= $depth <= 1? 1 : $depth <= 4? 4 : $depth <= 8? 8 : 32;
+    my $self= bless {
+        display     => $display,
+        rasterize   => $args{rasterize},
+        format      => $format,
+        bpp         => $bpp,
+        max_bytes   => defined $args{max_bytes}? $args{max_bytes} : 4 * 1024 * 1024,
+        glyphset    => $display->XRenderCreateGlyphSet($format),
+        glyphs      => {},
+        bytes       => 0,
+        clock       => 0,
+        hits        => 0,
+        misses      => 0,
+        uploads     => 0,
+        evictions   => 0,
+    }, $class;
+    return $self;
+}
+
+sub DESTROY {
+    my $self= shift;
+    $self->{display}->XRenderFreeGlyphSet($self->{glyphset})
+        if $self->{display} && $self->{glyphset};
+}
+
+=head1 ATTRIBUTES
+
+=head2 display
+
+=head2 glyphset
+
+The GlyphSet XID, for use with the C<XRenderCompositeString> functions directly.
+
+=head2 format
+
+The L<X11::Xlib::XRenderPictFormat> of the glyph images.  The constructor
+accepts this object, or one of the C<PictStandard> constants.  The default is
+C<PictStandardA8>, one byte of coverage per pixel.  C<PictStandardA1> takes one
+bit per pixel, and C<PictStandardARGB32> takes a 32-bit pixel with separate
+coverage per color channel (for sub-pixel rendering; the destination picture
+then needs C<component_alpha>).
+
+=head2 rasterize
+
+  rasterize => sub {
+    my ($codepoint, $cache)= @_;
+    return {
+      width => $w, height => $h,   # size of the bitmap
+      x => $x, y => $y,            # position of the glyph origin within the bitmap
+      x_off => $advance, y_off => 0,  # where the next glyph's origin goes
+      data => $bitmap,             # rows of pixels in the format above
+      bytes_per_line => $stride,   # optional, defaults to rows without padding
+    };
+  }
+
+Called once for each character the first time it is drawn (and again after it
+was evicted).  Returning C<undef> or an empty hashref gives the character an
+empty glyph which doesn't advance, so it is skipped.  The rows are padded to 4
+bytes before uploading, as the server requires.
+
+=head2 max_bytes
+
+Limit on the total size of the padded glyph images held in the GlyphSet.
+Default 4MiB.  Can be changed at any time; it takes effect at the next miss.
+
+=head2 bytes
+
+Size of the glyph images currently held in the GlyphSet.
+
+=head2 count
+
+Number of glyphs currently held in the GlyphSet.
+
+=head2 hits
+
+=head2 misses
+
+=head2 uploads
+
+=head2 evictions
+
+Statistics: each distinct character of a drawn string counts as a hit if its
+glyph was already on the server, or a miss if it had to be rasterized.
+C<uploads> is the number of C<XRenderAddGlyphs> requests, and C<evictions> the
+number of glyphs removed to stay under L</max_bytes>.
+
+=cut
+
+sub display   { $_[0]{display} }
+sub glyphset  { $_[0]{glyphset} }
+sub format    { $_[0]{format} }
+sub rasterize { $_[0]{rasterize} }
+sub max_bytes { $_[0]{max_bytes}= $_[1] if @_ > 1; $_[0]{max_bytes} }
+sub bytes     { $_[0]{bytes} }
+sub count     { scalar keys %{ $_[0]{glyphs} } }
+sub hits      { $_[0]{hits} }
+sub misses    { $_[0]{misses} }
+sub uploads   { $_[0]{uploads} }
+sub evictions { $_[0]{evictions} }
+
+=head1 METHODS
+
+=head2 load
+
+  $glyphs->load($string);
+
+Make sure every character of the string has a glyph in the GlyphSet, and mark
+them as recently used.  All missing glyphs are uploaded in one request.
+
+=cut
+
+sub load {
+    my ($self, $text)= @_;
+    my $glyphs= $self->{glyphs};
+    my $clock= ++$self->{clock};
+    my (%seen, @ids, $info, $images, $bytes);
+    for my $cp (unpack 'W*', $text) {
+        next if $seen{$cp}++;
+        if (my $g= $glyphs->{$cp}) {
+            $g->[1]= $clock;
+            ++$self->{hits};
+            next;
+        }
+        ++$self->{misses};
+        my ($glyph_info, $image)= $self->_rasterize_glyph($cp);
+        push @ids, $cp;
+        $info .= $glyph_info;
+        $images .= $image;
+        $bytes += length $image;
+        $glyphs->{$cp}= [ length $image, $clock ];
+    }
+    if (@ids) {
+        $self->{bytes} += $bytes;
+        $self->_evict($clock) if $self->{bytes} > $self->{max_bytes};
+        $self->{display}->XRenderAddGlyphs($self->{glyphset}, \@ids, $info, $images);
+        ++$self->{uploads};
+    }
+    $self;
+}
+
+sub _rasterize_glyph {
+    my ($self, $cp)= @_;
+    my $g= $self->{rasterize}->($cp, $self) || {};
+    my ($w, $h)= ($g->{width} || 0, $g->{height} || 0);
+    my $info= pack 'S S s s s s', $w, $h, map $_ || 0, @{$g}{qw( x y x_off y_off )};
+    return ($info, '') unless $w && $h;
+    my $row= ($w * $self->{bpp} + 7) >> 3;
+    my $stride= (($w * $self->{bpp} + 31) >> 5) << 2;
+    my $src_stride= $g->{bytes_per_line} || $row;
+    my $data= defined $g->{data}? $g->{data} : '';
+    length($data) >= $src_stride * ($h-1) + $row
+        or croak sprintf "Glyph image for U+%04X is too short (%d bytes for %dx%d)", $cp, length $data, $w, $h;
+    return ($info, substr($data, 0, $stride * $h)) if $src_stride == $stride;
+    my $pad= "\0" x ($stride - $row);
+    return ($info, join '', map substr($data, $_ * $src_stride, $row) . $pad, 0 .. $h-1);
+}
+
+sub _evict {
+    my ($self, $clock)= @_;
+    my $glyphs= $self->{glyphs};
+    my @ids;
+    for my $cp (sort { $glyphs->{$a}[1] <=> $glyphs->{$b}[1] } keys %$glyphs) {
+        last if $self->{bytes} <= $self->{max_bytes} or $glyphs->{$cp}[1] == $clock;
+        $self->{bytes} -= $glyphs->{$cp}[0];
+        delete $glyphs->{$cp};
+        push @ids, $cp;
+    }
+    if (@ids) {
+        $self->{display}->XRenderFreeGlyphs($self->{glyphset}, \@ids);
+        $self->{evictions} += @ids;
+    }
+}
+
+=head2 draw
+
+  $glyphs->draw($src_picture, $dst_picture, $x, $y, $string, %opts);
+
+Load the glyphs of C<$string> and draw it with its first origin at C<$x,$y>.
+The coverage of the glyphs is used as a mask for C<$src_picture>, which is
+usually a solid color (a 1x1 picture with C<RepeatNormal>).  Options:
+
+=over
+
+=item op
+
+The compositing operator, default C<PictOpOver>.
+
+=item src_x, src_y
+
+Position in the source picture which lines up with the origin of the first
+glyph, default 0,0.
+
+=back
+
+=cut
+
+sub draw {
+    my ($self, $src, $dst, $x, $y, $text, %opts)= @_;
+    $self->load($text);
+    $self->{display}->XRenderCompositeString32(
+        defined $opts{op}? $opts{op} : X11::Xlib::PictOpOver(),
+        $src, $dst, ($self->{bpp} == 32? undef : $self->{format}), $self->{glyphset},
+        $opts{src_x} || 0, $opts{src_y} || 0, $x, $y, pack('L*', unpack 'W*', $text));
+}
+
+=head2 clear
+
+Remove all glyphs from the GlyphSet.  The statistics are not reset.
+
+=cut
+
+sub clear {
+    my $self= shift;
+    my @ids= keys %{ $self->{glyphs} };
+    $self->{display}->XRenderFreeGlyphs($self->{glyphset}, \@ids) if @ids;
+    $self->{glyphs}= {};
+    $self->{bytes}= 0;
+    $self;
+}
+
+1;
+
+__END__
+
+=head1 AUTHOR
+
+Olivier Thauvin, E<lt>nanardon@nanardon.zarb.orgE<gt>
+
+Michael Conrad, E<lt>mike@nrdvana.netE<gt>
+
+=head1 COPYRIGHT AND LICENSE
+
+Copyright (C) 2009-2010 by Olivier Thauvin
+
+Copyright (C) 2017-2023 by Michael Conrad
+
+This library is free software; you can redistribute it and/or modify
+it under the same terms as Perl itself, either Perl version 5.10.0 or,
+at your option, any later version of Perl 5 you may have available.
+
+=cut
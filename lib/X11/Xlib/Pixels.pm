@@ -0,0 +1,256 @@
+package X11::Xlib::Pixels;
+use strict;
+use warnings;
+use Carp;
+use Scalar::Util 'blessed';
+use X11::Xlib;
+
+# All modules in dist share a version
+our $VERSION = '0.25';
+
+=head1 NAME
+
+X11::Xlib::Pixels - Convert captured pixels to RGBA8 or RGB8
+
+=head1 SYNOPSIS
+
+  use X11::Xlib::Pixels;
+  my $img= XGetImage($display, $window, 0, 0, $w, $h, AllPlanes, ZPixmap);
+  my $rgba= X11::Xlib::Pixels::to_rgba($img);
+
+  # Pixmaps have no visual, so say where the masks come from, and reuse
+  # the output buffer from one frame to the next
+  my ($vinfo)= $display->XGetVisualInfo(VisualIDMask, { visualid => $visual->id });
+  X11::Xlib::Pixels::to_rgb($img, my $rgb, visual_info => $vinfo);
+
+  # Half-size thumbnail with premultiplied alpha
+  X11::Xlib::Pixels::premultiply($rgba, $w, $h);
+  X11::Xlib::Pixels::downsample_2x($rgba, $w, $h, 0, my $thumb);
+
+=head1 DESCRIPTION
+
+Pixels captured from the server are in the layout of the visual: some number of
+bits per pixel, in the server's byte order, with red, green and blue at the bit
+positions given by the visual's masks.  This module converts them to the byte
+sequences that image libraries and encoders expect, and provides a few
+operations on the result.
+
+The common layouts (32-bit C<BGRX> with masks C<0xFF0000>, C<0xFF00>, C<0xFF> in
+C<LSBFirst> order, and 16-bit C<RGB565>), premultiplication, and downsampling
+have SSE2 and AVX2 implementations which are chosen when the module is first
+used according to what the CPU supports.  The vector code gives exactly the same
+result as the plain C code.  Any other layout with 8, 16, 24, or 32 bits per
+pixel is converted by a generic loop driven by the masks.
+
+Channels narrower than 8 bits are expanded by repeating their bits, so the
+maximum value becomes 255.
+
+=head1 FUNCTIONS
+
+=head2 to_rgba
+
+  my $rgba= to_rgba($source, %options);
+  to_rgba($source, $dest, %options);
+
+Convert to 4 bytes per pixel in the order R, G, B, A, with no padding between
+rows.  If C<$dest> is given the result is written to that scalar (reusing its
+memory), otherwise it is returned.
+
+C<$source> is either an L<X11::Xlib::XImage> in C<ZPixmap> format or a hashref of:
+
+=over
+
+=item data
+
+The pixel buffer (required)
+
+=item width, height
+
+(required)
+
+=item bits_per_pixel
+
+Default 32
+
+=item bytes_per_line
+
+Default C<width * bits_per_pixel / 8>
+
+=item byte_order
+
+C<LSBFirst> (the default) or C<MSBFirst>
+
+=item red_mask, green_mask, blue_mask
+
+=back
+
+Options are:
+
+=over
+
+=item red_mask, green_mask, blue_mask
+
+Override the masks of the source.
+
+=item visual_info
+
+An L<X11::Xlib::XVisualInfo> whose masks to use.  Images read from a Pixmap have
+no visual, and therefore no masks, so one of these options is needed for them.
+
+=item alpha
+
+The alpha value to store, default 255.  Use -1 to take alpha from the bits of the
+pixel which are not in any mask, such as for the 32-bit ARGB visual used by
+compositing managers.
+
+=back
+
+=head2 to_rgb
+
+Like L</to_rgba>, but 3 bytes per pixel.
+
+=cut
+
+sub to_rgba { _convert(4, @_) }
+sub to_rgb  { _convert(3, @_) }
+
+sub _convert {
+    my ($channels, $src)= splice(@_, 0, 2);
+    my $dst= (@_ & 1)? \$_[0] : \my $buf;
+    my %opt= (@_ & 1)? @_[1..$#_] : @_;
+    my $s= _describe($src, %opt);
+    _to_rgb(${$s->{data}}, @{$s}{qw( bytes_per_line width height bits_per_pixel byte_order
+        red_mask green_mask blue_mask )}, defined $opt{alpha}? $opt{alpha} : 255,
+        $channels, $$dst);
+    return (@_ & 1)? 1 : $buf;
+}
+
+# Returns a hashref of the layout of an XImage or hashref source (with the options
+# above applied), and a reference to its pixel buffer in {data}.
+sub _describe {
+    my ($src, %opt)= @_;
+    my %s;
+    if (blessed($src) && $src->isa('X11::Xlib::XImage')) {
+        $src->format == X11::Xlib::ZPixmap()
+            or croak "Only ZPixmap images can be converted";
+        $s{$_}= $src->$_ for qw( width height bits_per_pixel bytes_per_line byte_order
+            red_mask green_mask blue_mask );
+        $s{data}= \$src->{data};
+        $src->data; # make sure the buffer is the full size of the image
+    }
+    elsif (ref $src eq 'HASH') {
+        %s= %$src;
+        defined $s{$_} or croak "$_ is required" for qw( data width height );
+        $s{data}= \$src->{data};
+        $s{bits_per_pixel} ||= 32;
+        $s{bytes_per_line} ||= $s{width} * (($s{bits_per_pixel}+7) >> 3);
+        $s{byte_order} ||= X11::Xlib::LSBFirst();
+        $s{$_} ||= 0 for qw( red_mask green_mask blue_mask );
+    }
+    else {
+        croak "Expected X11::Xlib::XImage or hashref";
+    }
+    if (my $vinfo= $opt{visual_info}) {
+        $s{$_}= $vinfo->$_ for qw( red_mask green_mask blue_mask );
+    }
+    defined $opt{$_} and $s{$_}= $opt{$_} for qw( red_mask green_mask blue_mask );
+    ($s{red_mask} || $s{green_mask} || $s{blue_mask})
+        or croak "Source has no color masks; pass visual_info or red_mask/green_mask/blue_mask";
+    return \%s;
+}
+
+=head2 premultiply
+
+  premultiply($rgba, $width, $height, $bytes_per_line);
+
+Multiply the color channels of an RGBA8 buffer by alpha, in place.  Each channel
+becomes C<round(c * a / 255)>.  C<$bytes_per_line> defaults to C<$width * 4>.
+
+=head2 unpremultiply
+
+  unpremultiply($rgba, $width, $height, $bytes_per_line);
+
+Reverse L</premultiply>, in place.  Colors of pixels with alpha 0 become 0.
+This cannot restore the precision lost by premultiplying; each channel is within
+1 of C<c * 255 / a>.
+
+=head2 downsample_2x
+
+  downsample_2x($src, $width, $height, $bytes_per_line, $dest);
+
+Average each 2x2 block of 4-byte pixels of C<$src>, writing an image of
+C<int($width/2)> by C<int($height/2)> with no row padding into C<$dest>.  An odd
+last column or row is ignored.  The channels are averaged independently, so this
+works for any 4-byte pixel format, though blending is only correct for
+premultiplied alpha.  Pass 0 for C<$bytes_per_line> to mean C<$width * 4>.
+
+=head2 blend_over
+
+  blend_over($dest, $width, $height, $bytes_per_line, $argb, $argb_width, $argb_height, $x, $y);
+
+Composite an image of premultiplied 32-bit ARGB pixels (native byte order, with
+no row padding) over C<$dest> with its top-left corner at C<$x,$y>, in place.
+C<$dest> is 32-bit pixels of the same layout, such as the data of a 24 or 32 bit
+ZPixmap L<X11::Xlib::XImage>.  Parts outside of C<$dest> are ignored.  This is
+for small images like the cursor of L<X11::Xlib::CursorCapture>, and does not use
+SIMD or threads.
+
+=head2 simd_level
+
+  my $level= simd_level();   # 0 = plain C, 1 = SSE2, 2 = AVX2
+  simd_level(0);             # use plain C only
+  simd_level(undef);         # back to the best available
+
+Get or set which implementation is used.  Setting a level higher than the CPU
+supports selects the highest that it does.  Returns the level in effect.  This
+is mostly useful for testing and benchmarking.
+
+=head2 max_simd_level
+
+The highest level the CPU supports.
+
+=head2 threads
+
+  X11::Xlib::Pixels::threads(8);   # use 8 threads (the caller plus 7 workers)
+  X11::Xlib::Pixels::threads(0);   # one per CPU
+  my $n= X11::Xlib::Pixels::threads();
+
+Get or set how many threads large images are processed with.  The default is 1,
+meaning everything runs on the calling thread.  With more, the functions of this
+module, L<X11::Xlib::FrameDiff>, and the pixel conversion of
+L<X11::Xlib::FrameEncoder> split the image into bands of rows and process them on
+a pool of C threads, returning once all bands are done.  The results are exactly
+the same as with one thread.
+
+The threads are plain C threads which never touch perl, so this works with or
+without a threaded perl.  They are started on first use, and again in a child
+process after a C<fork>.  If the module was built without pthreads, this always
+returns 1.
+
+=head2 max_threads
+
+The number of CPUs, which is what C<threads(0)> selects.
+
+=cut
+
+1;
+
+__END__
+
+=head1 AUTHOR
+
+Olivier Thauvin, E<lt>nanardon@nanardon.zarb.orgE<gt>
+
+Michael Conrad, E<lt>mike@nrdvana.netE<gt>
+
+=head1 COPYRIGHT AND LICENSE
+
+Copyright (C) 2009-2010 by Olivier Thauvin
+
+Copyright (C) 2017-2023 by Michael Conrad
+
+This library is free software; you can redistribute it and/or modify
+it under the same terms as Perl itself, either Perl version 5.10.0 or,
+at your option, any later version of Perl 5 you may have available.
+
+=cut
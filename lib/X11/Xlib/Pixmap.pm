@@ -10,12 +10,15 @@ our $VERSION = '0.25';
 sub width  { croak "read-only" if @_ > 1; $_[0]{width} }
 sub height { croak "read-only" if @_ > 1; $_[0]{height} }
 sub depth  { croak "read-only" if @_ > 1; $_[0]{depth} }
+sub pool   { croak "read-only" if @_ > 1; $_[0]{pool} }
 
 sub get_w_h { croak "read-only" if @_ > 1; $_[0]{width}, $_[0]{height} }
 
 sub DESTROY {
     my $self= shift;
-    $self->display->XFreePixmap($self->xid)
+    return $self->{pool}->_reclaim($self->xid)
+        if $self->{pool};
+    $self->display->_release_xid(XFreePixmap => $self->xid)
         if $self->autofree && $self->xid;
 }
 
@@ -50,6 +53,11 @@ Height, in pixels
 
 Color depth, in bits.
 
+=head2 pool
+
+The L<X11::Xlib::PixmapPool> this pixmap was acquired from, if any.  Instead of
+being freed, it returns to the pool when the object is destroyed.
+
 =head1 METHODS
 
 =head2 get_w_h
@@ -0,0 +1,343 @@
+package X11::Xlib::PixmapPool;
+use strict;
+use warnings;
+use Carp;
+use Scalar::Util 'blessed', 'weaken';
+use Time::HiRes ();
+use X11::Xlib;
+use X11::Xlib::Pixmap;
+
+# All modules in dist share a version
+our $VERSION = '0.25';
+
+=head1 NAME
+
+X11::Xlib::PixmapPool - Recycle offscreen pixmaps of the same size
+
+=head1 SYNOPSIS
+
+  use X11::Xlib::PixmapPool;
+  my $pool= X11::Xlib::PixmapPool->new(display => $display, max_bytes => 32 * 1024 * 1024);
+  # every frame:
+  {
+    my $scratch= $pool->acquire($window, $w, $h, $depth);
+    ... draw into $scratch, copy it to the window ...
+  } # $scratch goes back to the pool here instead of being freed
+  printf "%d of %d pixmaps reused\n", $pool->hits, $pool->hits + $pool->allocations;
+
+=head1 DESCRIPTION
+
+Creating and freeing a pixmap are cheap requests for the client, but the server
+has to allocate and release (and often clear) the memory each time, and a render
+loop which makes a few scratch buffers per frame repeats that work every frame.
+This pool keeps the pixmaps that are released, and hands one of them out again
+the next time a pixmap of the same screen, width, height and depth is requested.
+
+L</acquire> returns an ordinary L<X11::Xlib::Pixmap>.  When the last reference to
+it goes away, its C<DESTROY> returns it to the pool instead of calling
+C<XFreePixmap>, so code which creates and drops pixmaps only needs to call
+L</acquire> instead of L<new_pixmap|X11::Xlib::Display/new_pixmap>.  If the pool
+itself is gone by then, the pixmap is freed as usual.
+
+A recycled pixmap still holds whatever was drawn into it last, so clear it
+first unless you are going to overwrite every pixel anyway.
+
+The idle pixmaps are limited to L</max_bytes> of (estimated) server memory, and
+the ones that were released least recently are freed first to stay under it.
+Idle pixmaps are also freed once they have not been used for L</max_idle>
+seconds, so a burst of unusual sizes doesn't stay on the server.  That check
+happens during L</acquire> and L</release>, or when you call L</expire>.
+
+=head1 CONSTRUCTOR
+
+=head2 new
+
+  my $pool= X11::Xlib::PixmapPool->new(display => $display, %attrs);
+
+=cut
+
+sub new {
+    my $class= shift;
+    my %args= (@_ == 1 and ref($_[0]) eq 'HASH')? %{ $_[0] }
+        : ((@_ & 1) == 0)? @_
+        : croak "Expected hashref or even-length list";
+    my $display= $args{display} or croak "display is required";
+    return bless {
+        display     => $display,
+        max_bytes   => defined $args{max_bytes}? $args{max_bytes} : 64 * 1024 * 1024,
+        max_idle    => defined $args{max_idle}? $args{max_idle} : 10,
+        idle        => {}, # "screen,w,h,depth" => [ [ xid, bytes, release_time ], ... ]
+        active      => {}, # xid => [ key, bytes ]
+        idle_bytes  => 0,
+        idle_count  => 0,
+        hits        => 0,
+        allocations => 0,
+        releases    => 0,
+        evictions   => 0,
+        expirations => 0,
+    }, $class;
+}
+
+sub DESTROY {
+    my $self= shift;
+    my $display= $self->{display} or return;
+    for my $list (values %{ $self->{idle} }) {
+        $display->XFreePixmap($_->[0]) for @$list;
+    }
+}
+
+=head1 ATTRIBUTES
+
+=head2 display
+
+=head2 max_bytes
+
+Limit on the estimated server memory of the idle pixmaps held by the pool.
+Default 64MiB.  Pixmaps handed out by L</acquire> don't count, since the pool
+doesn't control their lifespan.  A released pixmap which is larger than the limit
+by itself is freed immediately.  Changes take effect on the next release.
+
+=head2 max_idle
+
+Number of seconds an idle pixmap is kept before it is freed.  Default 10.
+C<0> means idle pixmaps are only freed to stay under L</max_bytes>.
+
+=head2 idle_bytes
+
+=head2 idle_count
+
+The estimated server memory and number of pixmaps currently idle in the pool.
+
+=head2 active_count
+
+Number of pixmaps handed out by L</acquire> which have not been released yet.
+
+=head2 hits
+
+=head2 allocations
+
+=head2 releases
+
+=head2 evictions
+
+=head2 expirations
+
+Statistics: each L</acquire> is either a hit, which reused an idle pixmap, or
+an allocation of a new one with C<XCreatePixmap>.  C<releases> counts the
+pixmaps returned to the pool, C<evictions> the idle ones freed to stay under
+L</max_bytes> (including released pixmaps which didn't fit at all), and
+C<expirations> the idle ones freed after L</max_idle>.
+
+=cut
+
+sub display      { $_[0]{display} }
+sub max_bytes    { $_[0]{max_bytes}= $_[1] if @_ > 1; $_[0]{max_bytes} }
+sub max_idle     { $_[0]{max_idle}= $_[1] if @_ > 1; $_[0]{max_idle} }
+sub idle_bytes   { $_[0]{idle_bytes} }
+sub idle_count   { $_[0]{idle_count} }
+sub active_count { scalar keys %{ $_[0]{active} } }
+sub hits         { $_[0]{hits} }
+sub allocations  { $_[0]{allocations} }
+sub releases     { $_[0]{releases} }
+sub evictions    { $_[0]{evictions} }
+sub expirations  { $_[0]{expirations} }
+
+=head1 METHODS
+
+=head2 acquire
+
+  my $pixmap= $pool->acquire($drawable, $width, $height, $depth);
+
+Return an L<X11::Xlib::Pixmap> of this size and depth, on the screen of
+C<$drawable>, which may also be a L<X11::Xlib::Screen> object or C<undef> for
+the default screen, like for L<new_pixmap|X11::Xlib::Display/new_pixmap>.  The
+most recently released idle pixmap of that size is reused if there is one.
+C<$depth> defaults to the depth of the screen.
+
+When the display has more than one screen, finding the screen of a drawable
+takes one C<XGetGeometry> round trip per drawable.  The answer is remembered, so
+pass the same few windows or screens.
+
+=cut
+
+sub acquire {
+    my ($self, $drawable, $width, $height, $depth)= @_;
+    $width > 0 && $height > 0 or croak "width and height must be positive";
+    my $display= $self->{display};
+    my $screen= $self->_screen_of($drawable);
+    $depth ||= $screen->visual_info->depth;
+    my $key= join ',', $screen->screen_number, $width, $height, $depth;
+    my $now= Time::HiRes::time();
+    $self->_expire($now) if $self->{idle_count};
+    my ($xid, $bytes);
+    if (my $list= $self->{idle}{$key}) {
+        ($xid, $bytes)= @{ pop @$list };
+        delete $self->{idle}{$key} unless @$list;
+        --$self->{idle_count};
+        $self->{idle_bytes} -= $bytes;
+        ++$self->{hits};
+    } else {
+        $xid= X11::Xlib::XCreatePixmap($display, $screen->root_window_xid, $width, $height, $depth);
+        $bytes= $width * $height * ($depth <= 1? 1 : $depth <= 8? 8 : $depth <= 16? 16 : 32) / 8;
+        ++$self->{allocations};
+    }
+    $self->{active}{$xid}= [ $key, $bytes ];
+    my $pixmap= $display->get_cached_pixmap($xid,
+        width    => $width,
+        height   => $height,
+        depth    => $depth,
+        autofree => 1,
+        pool     => $self,
+    );
+    weaken($pixmap->{pool});
+    return $pixmap;
+}
+
+=head2 release
+
+  $pool->release($pixmap);
+
+Return a pixmap to the pool right away, instead of waiting for the object to be
+destroyed.  You must not draw to it afterward, since it may be handed out again;
+the object no longer refers to the pool, so destroying it later does nothing.
+Returns false if the pixmap did not come from this pool or was already
+released.
+
+=cut
+
+sub release {
+    my ($self, $pixmap)= @_;
+    return 0 unless blessed($pixmap) && $pixmap->{pool} && $pixmap->{pool} == $self;
+    my $xid= $pixmap->xid;
+    delete $pixmap->{pool};
+    $pixmap->autofree(0);
+    # so that the next acquire of this XID gets a fresh object
+    my $cache= $self->{display}->_xid_cache;
+    delete $cache->{$xid} if $cache->{$xid} && $cache->{$xid} == $pixmap;
+    return $self->_reclaim($xid);
+}
+
+# Called by X11::Xlib::Pixmap::DESTROY
+sub _reclaim {
+    my ($self, $xid)= @_;
+    my ($key, $bytes)= @{ delete $self->{active}{$xid} || return 0 };
+    ++$self->{releases};
+    my $now= Time::HiRes::time();
+    $self->_expire($now) if $self->{idle_count};
+    if ($bytes > $self->{max_bytes}) {
+        $self->{display}->XFreePixmap($xid);
+        ++$self->{evictions};
+        return 1;
+    }
+    $self->_evict($self->{max_bytes} - $bytes);
+    push @{ $self->{idle}{$key} }, [ $xid, $bytes, $now ];
+    ++$self->{idle_count};
+    $self->{idle_bytes} += $bytes;
+    return 1;
+}
+
+=head2 expire
+
+  $pool->expire;
+
+Free the idle pixmaps which were released more than L</max_idle> seconds ago.
+Returns the number freed.
+
+=cut
+
+sub expire {
+    my $self= shift;
+    return $self->_expire(Time::HiRes::time());
+}
+
+sub _expire {
+    my ($self, $now)= @_;
+    return 0 unless $self->{max_idle};
+    my $limit= $now - $self->{max_idle};
+    my $n= 0;
+    # Each list is in order of release, oldest first
+    for my $key (keys %{ $self->{idle} }) {
+        my $list= $self->{idle}{$key};
+        while (@$list && $list->[0][2] < $limit) {
+            $self->_free_idle(shift @$list);
+            ++$n;
+        }
+        delete $self->{idle}{$key} unless @$list;
+    }
+    $self->{expirations} += $n;
+    return $n;
+}
+
+=head2 trim
+
+  $pool->trim($max_bytes);
+  $pool->trim; # free everything idle
+
+Free idle pixmaps, least recently released first, until they take no more than
+C<$max_bytes> (default 0).  Returns the number freed.
+
+=cut
+
+sub trim {
+    my ($self, $max_bytes)= @_;
+    return $self->_evict($max_bytes || 0);
+}
+
+sub _evict {
+    my ($self, $max_bytes)= @_;
+    my $idle= $self->{idle};
+    my $n= 0;
+    while ($self->{idle_bytes} > $max_bytes) {
+        # There are only a few distinct sizes, so a scan for the oldest is cheap
+        my ($oldest)= sort { $idle->{$a}[0][2] <=> $idle->{$b}[0][2] } keys %$idle;
+        $self->_free_idle(shift @{ $idle->{$oldest} });
+        delete $idle->{$oldest} unless @{ $idle->{$oldest} };
+        ++$n;
+    }
+    $self->{evictions} += $n;
+    return $n;
+}
+
+sub _free_idle {
+    my ($self, $entry)= @_;
+    $self->{display}->XFreePixmap($entry->[0]);
+    --$self->{idle_count};
+    $self->{idle_bytes} -= $entry->[1];
+}
+
+sub _screen_of {
+    my ($self, $drawable)= @_;
+    my $display= $self->{display};
+    return $display->default_screen unless defined $drawable;
+    return $drawable if blessed($drawable) && $drawable->isa('X11::Xlib::Screen');
+    return $display->screen(0) if $display->screen_count == 1;
+    my $xid= ref $drawable? $drawable->xid : $drawable;
+    my $root= $self->{roots}{$xid} ||= (X11::Xlib::XGetGeometry($display, $xid))[0]
+        or croak "Can't determine the screen of drawable $xid";
+    for (0 .. $display->screen_count - 1) {
+        return $display->screen($_) if $display->screen($_)->root_window_xid == $root;
+    }
+    croak "Can't determine the screen of drawable $xid";
+}
+
+1;
+
+__END__
+
+=head1 AUTHOR
+
+Olivier Thauvin, E<lt>nanardon@nanardon.zarb.orgE<gt>
+
+Michael Conrad, E<lt>mike@nrdvana.netE<gt>
+
+=head1 COPYRIGHT AND LICENSE
+
+Copyright (C) 2009-2010 by Olivier Thauvin
+
+Copyright (C) 2017-2023 by Michael Conrad
+
+This library is free software; you can redistribute it and/or modify
+it under the same terms as Perl itself, either Perl version 5.10.0 or,
+at your option, any later version of Perl 5 you may have available.
+
+=cut
@@ -0,0 +1,239 @@
+package X11::Xlib::Region;
+use strict;
+use warnings;
+use Carp;
+use Scalar::Util 'blessed';
+use X11::Xlib;
+
+# All modules in dist share a version
+our $VERSION = '0.25';
+
+# Methods are implemented in Xlib.xs, except these
+
+sub from_mask {
+    my ($class, $src, %opt)= @_;
+    my ($data, $w, $h, $depth, $stride, $msb);
+    if (blessed($src) && $src->isa('X11::Xlib::XImage')) {
+        ($w, $h, $depth, $stride)= ($src->width, $src->height, $src->bits_per_pixel, $src->bytes_per_line);
+        if ($src->format != X11::Xlib::ZPixmap() || $depth == 1) {
+            $src->depth == 1 or croak "Only depth 1 bitmaps or 8 bit ZPixmap images can be used as masks";
+            $depth= 1;
+            $msb= $src->bitmap_bit_order == X11::Xlib::MSBFirst();
+            $src->bitmap_unit == 8 or $src->byte_order == $src->bitmap_bit_order
+                or croak "Bitmaps whose byte order differs from their bit order are not supported";
+            !$src->xoffset or croak "Bitmaps with an xoffset are not supported";
+        }
+        $src->data; # make sure the buffer is the full size of the image
+        $data= \$src->{data};
+    }
+    elsif (ref $src eq 'HASH') {
+        defined $src->{$_} or croak "$_ is required" for qw( data width height );
+        ($w, $h)= @{$src}{qw( width height )};
+        $depth= $src->{depth} || 1;
+        $stride= $src->{bytes_per_line} || ($depth == 1? ($w + 7) >> 3 : $w);
+        $msb= ($src->{bit_order} || 0) == X11::Xlib::MSBFirst();
+        $data= \$src->{data};
+    }
+    else {
+        croak "Expected X11::Xlib::XImage or hashref";
+    }
+    return $class->_from_mask($$data, $w, $h, $depth, $stride, $msb ? 1 : 0,
+        defined $opt{threshold}? $opt{threshold} : 1);
+}
+
+sub to_server {
+    my ($self, $display)= @_;
+    $display->can('XFixesCreateRegion')
+        or croak "X11::Xlib was built without XFixes support";
+    return $display->XFixesCreateRegion($self->packed_rects);
+}
+
+1;
+
+__END__
+
+=head1 NAME
+
+X11::Xlib::Region - Client-side regions of rectangles
+
+=head1 SYNOPSIS
+
+  use X11::Xlib::Region;
+  my $dirty= X11::Xlib::Region->new([ $rect, { x => 50, y => 10, width => 200, height => 40 } ]);
+  $dirty= $dirty->union([ $damage_rect ]);
+  my $visible= $dirty->intersect($window_region)->subtract($occluded);
+  for my $rect ($visible->rects) { ... }
+
+  # Send it to the server once it is final
+  $window->set_input_region($visible->to_server($display));
+
+=head1 DESCRIPTION
+
+A region is a set of pixels, described by a list of non-overlapping rectangles.
+This is the same thing as an L<XserverRegion|X11::Xlib::XserverRegion>, but kept
+in the client, so that building one up from many damage rectangles or window
+geometries doesn't cost a request per step, and the result can be inspected
+without a round trip.
+
+The rectangles are kept in the "y-x banded" form used by the X server: sorted by
+top edge then left edge, grouped into horizontal bands where all rectangles have
+the same top and bottom, with no two adjacent bands alike.  So every region has
+exactly one list of rectangles, L</equals> is a memory comparison, and the list
+returned by L</rects> is the minimal one in that form.  Union, intersection and
+subtraction are implemented in C as a single pass down both regions.
+
+Objects are immutable; the operations return new regions.  Coordinates are 32-bit
+internally, so translating far away and back doesn't lose anything, but
+L</rects> and L</packed_rects> clip to the 16-bit range of L<X11::Xlib::XRectangle>.
+
+Wherever a region is expected, a list of rectangles may be given instead: an
+arrayref of L<XRectangle|X11::Xlib::XRectangle> objects or hashrefs of their
+fields, or a string of packed C<XRectangle> (as from
+C<pack('(s s S S)*', ...)>).
+
+=head1 CONSTRUCTORS
+
+=head2 new
+
+  my $region= X11::Xlib::Region->new(\@rects);
+  my $empty=  X11::Xlib::Region->new;
+
+The union of the rectangles, which may overlap and be in any order.  Empty
+rectangles are ignored.
+
+=head2 from_server
+
+  my $region= X11::Xlib::Region->from_server($display, $xserverregion);
+
+Fetch the rectangles of a server-side region with C<XFixesFetchRegion>.  Only
+available if the module was built with XFixes.
+
+=head2 from_mask
+
+  my $region= X11::Xlib::Region->from_mask($ximage, %options);
+  my $region= X11::Xlib::Region->from_mask({
+    data => $bits, width => $w, height => $h, depth => 1, bit_order => MSBFirst,
+  });
+  $window->set_bounding_region($region);
+
+The region of the pixels which are set in a mask, which is either an
+L<X11::Xlib::XImage> of depth 1 or an 8-bit C<ZPixmap>, or a hashref of C<data>,
+C<width>, C<height>, and optionally:
+
+=over
+
+=item depth
+
+1 (the default) for one bit per pixel, or 8 for one byte per pixel, such as an
+alpha channel.
+
+=item bytes_per_line
+
+Defaults to no padding between rows.
+
+=item bit_order
+
+For depth 1, whether the first pixel of each byte is its lowest bit (C<LSBFirst>,
+the default, as used by XBM files and by Xlib on the usual hosts) or its highest
+(C<MSBFirst>, as in PBM files).
+
+=back
+
+The only option is C<threshold>: 8-bit pixels are set if they are at least this
+value.  The default of 1 includes any pixel which is not fully transparent.
+
+This runs in C, reading 64 pixels at a time for 1-bit masks and skipping runs of
+8 fully clear or fully set pixels for 8-bit masks, and produces the rectangles in
+banded form directly, with identical rows merged.  A 1920x1080 mask of a simple
+shape takes well under a millisecond, so a shaped window can follow an animated
+mask every frame.
+
+=head1 METHODS
+
+=head2 union
+
+=head2 intersect
+
+=head2 subtract
+
+  my $r3= $r1->union($r2);
+  my $r3= $r1->intersect(\@rects);
+  my $r3= $r1->subtract($r2);
+
+Return a new region combining this one with another region or list of rectangles.
+
+=head2 translate
+
+  my $moved= $region->translate($dx, $dy);
+
+=head2 extents
+
+  my ($x, $y, $w, $h)= $region->extents;
+
+Bounding box, or all zeros if the region is empty.
+
+=head2 count
+
+Number of rectangles.
+
+=head2 is_empty
+
+=head2 equals
+
+  $r1->equals($r2)
+
+True if both contain exactly the same pixels.
+
+=head2 contains
+
+  $region->contains($x, $y);
+  $region->contains($x, $y, $w, $h);
+
+True if the point (or every pixel of the rectangle) is in the region.  A point is
+found by binary search.
+
+=head2 overlaps
+
+  $region->overlaps($x, $y, $w, $h);
+
+True if any pixel of the rectangle is in the region.
+
+=head2 rects
+
+List of L<X11::Xlib::XRectangle>.
+
+=head2 packed_rects
+
+The rectangles as a string of packed C<XRectangle>, which can be passed to
+L<XFixesCreateRegion|X11::Xlib/XFixesCreateRegion> or
+L<XFixesSetRegion|X11::Xlib/XFixesSetRegion> without creating an object per
+rectangle.
+
+=head2 boxes
+
+The internal representation: a string of 32-bit native C<(x1, y1, x2, y2)>
+quadruples (C<unpack('l*')>), with C<x2> and C<y2> exclusive.
+
+=head2 to_server
+
+  my $xserverregion= $region->to_server($display);
+
+Create an L<X11::Xlib::XserverRegion> with the same rectangles.
+
+=head1 AUTHOR
+
+Olivier Thauvin, E<lt>nanardon@nanardon.zarb.orgE<gt>
+
+Michael Conrad, E<lt>mike@nrdvana.netE<gt>
+
+=head1 COPYRIGHT AND LICENSE
+
+Copyright (C) 2009-2010 by Olivier Thauvin
+
+Copyright (C) 2017-2023 by Michael Conrad
+
+This library is free software; you can redistribute it and/or modify
+it under the same terms as Perl itself, either Perl version 5.10.0 or,
+at your option, any later version of Perl 5 you may have available.
+
+=cut
@@ -128,6 +128,32 @@ sub unpack {
     $ret;
 }
 
+=head2 get
+
+  my ($x, $y, $w, $h)= $struct->get(qw( x y width height ));
+
+Return the value of each named field, in order, using a single XS call.
+Field names are resolved by a binary search of a table generated at compile
+time, so this is cheaper than calling the accessors one at a time.
+Values are the same as the accessors would return.  Dies on unknown names.
+
+=head2 get_list
+
+  my %fields= $struct->get_list;
+  my %some=   $struct->get_list(qw( x y ));
+
+Like L</get>, but returns name/value pairs.  With no arguments, it returns
+every field of the struct, which is a quick alternative to L</unpack> when you
+want a flat list instead of a hashref.
+
+=head2 set
+
+  $struct->set( x => 0, y => 0, width => 100 );
+
+Assign a list of field/value pairs in a single XS call, and return the struct.
+Dies on unknown names.  Structs with a bit mask of which fields are defined
+(like L<X11::Xlib::XSizeHints>) get the bits set the same way as by L</pack>.
+
 =head2 bytes
 
 Access the scalar holding the bytes of the struct.
@@ -157,8 +183,12 @@ $X11::Xlib::XSizeHints::VERSION= $VERSION;
 $X11::Xlib::XRectangle::VERSION= $VERSION;
 @X11::Xlib::XRenderPictFormat::ISA= ( __PACKAGE__ );
 $X11::Xlib::XRenderPictFormat::VERSION= $VERSION;
+@X11::Xlib::XRenderPictureAttributes::ISA= ( __PACKAGE__ );
+$X11::Xlib::XRenderPictureAttributes::VERSION= $VERSION;
 @X11::Xlib::XKeyboardState::ISA= ( __PACKAGE__ );
 $X11::Xlib::XKeyboardState::VERSION= $VERSION;
+@X11::Xlib::XGCValues::ISA= ( __PACKAGE__ );
+$X11::Xlib::XGCValues::VERSION= $VERSION;
 
 1;
 
@@ -2,6 +2,7 @@ package X11::Xlib::Window;
 use strict;
 use warnings;
 use parent 'X11::Xlib::XID';
+use Scalar::Util ();
 
 # All modules in dist share a version
 our $VERSION = '0.25';
@@ -86,11 +87,129 @@ from the server.
 =cut
 
 sub clear_cache {
-    delete @{$_[0]}{qw( attributes )};
+    delete @{$_[0]}{qw( attributes visibility )};
     $_[0]; # for chaining
 }
 *clear_all= *clear_cache;
 
+=head2 track_attributes
+
+  $window->track_attributes(1);
+  if ($window->is_viewable) { ... } # no round trip
+
+Normally L</attributes> are loaded once and then go stale.  When this is enabled,
+the window selects C<StructureNotifyMask> and C<VisibilityChangeMask> (in addition
+to its current event mask), loads its attributes, and from then on
+L<wait_event|X11::Xlib::Display/wait_event> updates the cached attributes in place
+from each C<ConfigureNotify>, C<GravityNotify>, C<ReparentNotify>, C<MapNotify>,
+C<UnmapNotify>, C<VisibilityNotify>, C<ColormapNotify> and C<DestroyNotify> for
+this window.
+You can also feed it events yourself with L</apply_event>.
+
+A C<MapNotify> can't tell whether an ancestor of the window is unmapped, so the
+C<map_state> becomes C<IsViewable> unless the display's
+L<window_tree|X11::Xlib::Display/window_tree> knows better.  This is always correct
+for top-level windows.
+
+Pass a false value to stop tracking.  The event mask is left as it is.
+
+=head2 refresh
+
+Re-load the L</attributes> from the server, discarding the cached copy.
+
+=head2 apply_event
+
+  $window->apply_event($xevent);
+
+Update the cached attributes from an event about this window.  Returns true if
+the event was relevant.  Does nothing if no attributes are cached yet.
+
+=head2 visibility
+
+The C<state> of the last C<VisibilityNotify> seen by L</apply_event>, one of
+C<VisibilityUnobscured>, C<VisibilityPartiallyObscured>, or
+C<VisibilityFullyObscured>.  Undef if not known.
+
+=cut
+
+our %_attr_event_types= map +($_ => 1), X11::Xlib::ConfigureNotify(), X11::Xlib::GravityNotify(),
+    X11::Xlib::ReparentNotify(), X11::Xlib::MapNotify(), X11::Xlib::UnmapNotify(), X11::Xlib::VisibilityNotify(),
+    X11::Xlib::ColormapNotify(), X11::Xlib::DestroyNotify();
+
+sub track_attributes {
+    my $self= shift;
+    return $self->{track_attributes} unless @_;
+    my $display= $self->display;
+    my $xid= $self->xid;
+    if ($self->{track_attributes}= shift) {
+        # Select input first, so that no change after the attributes are loaded goes
+        # unreported.
+        my $mask= X11::Xlib::StructureNotifyMask() | X11::Xlib::VisibilityChangeMask();
+        $self->event_mask_include($mask);
+        $self->refresh;
+        $self->{attributes}->your_event_mask($self->{attributes}->your_event_mask | $mask);
+        Scalar::Util::weaken( $display->{tracked_windows}{$xid}= $self );
+    }
+    elsif ($display->{tracked_windows}) {
+        delete $display->{tracked_windows}{$xid};
+    }
+    $self;
+}
+
+sub refresh {
+    my $self= shift;
+    delete $self->{attributes};
+    $self->attributes;
+    $self;
+}
+
+sub apply_event {
+    my ($self, $e)= @_;
+    my $attrs= $self->{attributes} or return 0;
+    my $type= $e->type;
+    return 0 unless $_attr_event_types{$type} && $e->window == $self->xid;
+    if ($type == X11::Xlib::ConfigureNotify()) {
+        $attrs->$_($e->$_) for qw( x y width height border_width override_redirect );
+    }
+    elsif ($type == X11::Xlib::GravityNotify()) {
+        $attrs->x($e->x);
+        $attrs->y($e->y);
+    }
+    elsif ($type == X11::Xlib::ReparentNotify()) {
+        # x,y are relative to the new parent
+        $attrs->x($e->x);
+        $attrs->y($e->y);
+        $attrs->override_redirect($e->override_redirect);
+    }
+    elsif ($type == X11::Xlib::MapNotify()) {
+        my $tree= $self->display->{window_tree};
+        $attrs->map_state($tree && $tree->contains($self->xid)? $tree->map_state($self->xid)
+            : X11::Xlib::IsViewable());
+        $attrs->override_redirect($e->override_redirect);
+    }
+    elsif ($type == X11::Xlib::UnmapNotify()) {
+        $attrs->map_state(X11::Xlib::IsUnmapped());
+        delete $self->{visibility};
+    }
+    elsif ($type == X11::Xlib::VisibilityNotify()) {
+        # Only viewable windows get visibility events
+        $attrs->map_state(X11::Xlib::IsViewable());
+        $self->{visibility}= $e->state;
+    }
+    elsif ($type == X11::Xlib::ColormapNotify()) {
+        $attrs->colormap($e->colormap) if $e->new;
+        $attrs->map_installed($e->state == X11::Xlib::ColormapInstalled());
+    }
+    elsif ($type == X11::Xlib::DestroyNotify()) {
+        $attrs->map_state(X11::Xlib::IsUnmapped());
+        delete $self->display->{tracked_windows}{$self->xid}
+            if $self->display->{tracked_windows};
+    }
+    return 1;
+}
+
+sub visibility { $_[0]{visibility} }
+
 =head2 get_property_list
 
   for ($window->get_property_list) { ... }
@@ -453,6 +572,8 @@ sub event_mask_exclude {
 
 Set the L<region|X11::Xlib::XserverRegion> for the boundary of the window, optionally
 offset by an (x,y) coordinate.  C<$region> may be undef or 0 to unset the region.
+It may also be a client-side L<X11::Xlib::Region>, such as from
+L<from_mask|X11::Xlib::Region/from_mask>, which is sent as a temporary server region.
 
 =head2 set_input_region
 
@@ -460,27 +581,34 @@ offset by an (x,y) coordinate.  C<$region> may be undef or 0 to unset the region
   $window->set_input_region($region, $x_ofs, $y_ofs);
 
 Set the input "hit" L<region|X11::Xlib::XserverRegion> of the window, optionally
-offset by an (x,y) coordinate. C<$region> may be undef or 0 to unset the region.
+offset by an (x,y) coordinate. C<$region> may be undef or 0 to unset the region,
+or an L<X11::Xlib::Region> as for L</set_bounding_region>.
 
 =cut
 
 sub set_bounding_region {
     my ($self, $region, $ofs_x, $ofs_y)= @_;
-    $self->display->XFixesSetWindowShapeRegion(
-        $self, &X11::Xlib::ShapeBounding, $ofs_x||0, $ofs_y||0, $region||0
-    );
+    $self->_set_shape_region(&X11::Xlib::ShapeBounding, $region, $ofs_x, $ofs_y);
 }
 
 sub set_input_region {
     my ($self, $region, $ofs_x, $ofs_y)= @_;
+    $self->_set_shape_region(&X11::Xlib::ShapeInput, $region, $ofs_x, $ofs_y);
+}
+
+sub _set_shape_region {
+    my ($self, $kind, $region, $ofs_x, $ofs_y)= @_;
+    # The shape is a copy, so a client-side region only needs a temporary server region
+    $region= $region->to_server($self->display)
+        if ref $region && ref($region)->isa('X11::Xlib::Region');
     $self->display->XFixesSetWindowShapeRegion(
-        $self, &X11::Xlib::ShapeInput, $ofs_x||0, $ofs_y||0, $region||0
+        $self, $kind, $ofs_x||0, $ofs_y||0, $region||0
     );
 }
 
 sub DESTROY {
     my $self= shift;
-    $self->display->XDestroyWindow($self->xid)
+    $self->display->_release_xid(XDestroyWindow => $self->xid)
         if $self->autofree;
 }
 
@@ -0,0 +1,214 @@
+package X11::Xlib::WindowTree;
+use strict;
+use warnings;
+use Carp;
+use X11::Xlib;
+use Scalar::Util 'weaken';
+
+# All modules in dist share a version
+our $VERSION = '0.25';
+
+=head1 NAME
+
+X11::Xlib::WindowTree - Client-side mirror of the window hierarchy
+
+=head1 SYNOPSIS
+
+  my $tree= $display->window_tree;   # or X11::Xlib::WindowTree->new(display => $display)
+  while (1) {
+    my $e= $display->wait_event(loop => 1) or next;
+    # wait_event feeds the display's own window_tree, so this is only
+    # needed for trees you constructed yourself:
+    # $tree->apply_event($e);
+    ...
+    my @top_level= $tree->children($display->root_window);
+    my ($x, $y, $w, $h, $border)= $tree->geometry($top_level[-1]);
+  }
+
+=head1 DESCRIPTION
+
+Window managers, pagers, and screen capture tools need to know the layout of
+the windows on the screen, but asking the server with C<XQueryTree> and
+C<XGetGeometry> costs a round trip per window.  This object loads the hierarchy
+once (see L<X11::Xlib::Display/snapshot_tree>) into a tree stored in C, selects
+C<SubstructureNotifyMask> on every window in it (and C<StructureNotifyMask> on
+the root, for its own size and map state), and then updates itself from
+C<CreateNotify>, C<DestroyNotify>, C<ReparentNotify>, C<ConfigureNotify>,
+C<GravityNotify>, C<MapNotify>, C<UnmapNotify> and C<CirculateNotify> events.
+After that, the parent, children, stacking order, geometry, and map state of
+any window can be answered without contacting the server.
+
+When it selects input on a window, the tree keeps any event mask that this
+client had already selected on it.  Note that C<XSelectInput> replaces the mask,
+so if you later call C<XSelectInput> on one of these windows yourself, include
+C<SubstructureNotifyMask> or the tree will stop receiving updates below it.
+
+The tree is only as current as the last event you gave it.  If events might have
+been lost (for instance, you discarded the event queue) call L</refresh>.
+
+=head1 CONSTRUCTOR
+
+=head2 new
+
+  my $tree= X11::Xlib::WindowTree->new(
+    display      => $display,
+    root         => $window,   # default is $display->root_window
+    select_input => $bool,     # default is true
+  );
+
+Load the tree below C<root>.  If C<select_input> is false, the tree will not
+change the event mask of any window, and it is up to you to make sure the
+relevant events get delivered.
+
+=cut
+
+sub new {
+    my $class= shift;
+    my %args= (@_ == 1 and ref($_[0]) eq 'HASH')? %{ $_[0] }
+        : ((@_ & 1) == 0)? @_
+        : croak "Expected hashref or even-length list";
+    defined $args{display} or croak "display is required";
+    $args{root}= $args{display}->root_window unless defined $args{root};
+    $args{select_input}= 1 unless defined $args{select_input};
+    my $self= bless \%args, $class;
+    weaken( $self->{display} );
+    $self->refresh;
+    return $self;
+}
+
+=head1 ATTRIBUTES
+
+=head2 display
+
+Weak reference to the L<X11::Xlib> connection.
+
+=head2 root
+
+The root of the mirrored tree, as an L<X11::Xlib::Window>.
+
+=head2 select_input
+
+Whether the tree selects C<SubstructureNotifyMask> on the windows it mirrors.
+
+=head2 window_count
+
+Number of windows in the tree, including the root.
+
+=cut
+
+sub display      { $_[0]{display} }
+sub root         { $_[0]{root} }
+sub select_input { $_[0]{select_input} }
+
+=head1 METHODS
+
+All methods that take a window accept either an L<X11::Xlib::Window> or a plain
+XID, and windows are returned as plain XIDs.  Windows that are not in the tree
+return an empty list (or undef).
+
+=head2 refresh
+
+Discard the tree and load it again from the server.
+
+=cut
+
+sub refresh {
+    my $self= shift;
+    my $display= $self->{display} or croak "Display was released";
+    $self->_init($display, $self->{root}, $self->{select_input});
+    return $self;
+}
+
+=head2 apply_event
+
+  $tree->apply_event($xevent);
+
+Update the tree from an event.  Returns true if the event changed the tree.
+Events about unknown windows, and events of unrelated types are ignored, so you
+can pass every event you receive.  Applying the same event more than once is
+harmless.
+
+A window reparented into the tree from outside is loaded from the server, along
+with its children.  A window reparented out of the tree is removed.
+
+=head2 contains
+
+  my $bool= $tree->contains($window);
+
+Whether the window is part of the tree.
+
+=head2 parent
+
+  my $parent_xid= $tree->parent($window);
+
+Returns undef for the root of the tree.
+
+=head2 children
+
+  my @xids= $tree->children($window);
+
+The children of a window in stacking order, from bottom to top.
+
+=head2 geometry
+
+  my ($x, $y, $width, $height, $border_width)= $tree->geometry($window);
+
+Position relative to the parent, and size, as reported by the most recent
+event.
+
+=head2 map_state
+
+Returns one of C<IsUnmapped>, C<IsUnviewable>, or C<IsViewable>, computed the
+same way as the server would for L<X11::Xlib::XWindowAttributes/map_state>.
+
+=head2 override_redirect
+
+Whether the window has the override-redirect flag.
+
+=head2 window_at
+
+  my $xid= $tree->window_at($x, $y);
+
+Return the top-most mapped child of L</root> whose outer rectangle (including
+border) contains the point, or undef if there is none.  Coordinates are relative
+to the root.  This answers the same question as C<XTranslateCoordinates> for
+top-level windows, without the round trip.
+
+The mapped children of the root are kept in a uniform grid over the area of the
+root, updated by L</apply_event>, so the cost of a lookup depends only on how many
+windows overlap that area of the screen.
+
+=head2 windows_in_rect
+
+  my @xids= $tree->windows_in_rect($x, $y, $width, $height);
+
+Return the mapped children of L</root> which overlap a rectangle, in stacking
+order from bottom to top.
+
+=cut
+
+sub DESTROY {
+    shift->_free;
+}
+
+1;
+
+__END__
+
+=head1 AUTHOR
+
+Olivier Thauvin, E<lt>nanardon@nanardon.zarb.orgE<gt>
+
+Michael Conrad, E<lt>mike@nrdvana.netE<gt>
+
+=head1 COPYRIGHT AND LICENSE
+
+Copyright (C) 2009-2010 by Olivier Thauvin
+
+Copyright (C) 2017-2023 by Michael Conrad
+
+This library is free software; you can redistribute it and/or modify
+it under the same terms as Perl itself, either Perl version 5.10.0 or,
+at your option, any later version of Perl 5 you may have available.
+
+=cut
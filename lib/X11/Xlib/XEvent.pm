@@ -24,11 +24,14 @@ the current C<type>, so as you change the value of C<type> the object will
 automatically re-bless itself into the appropriate subclass, giving you access
 to new struct fields.
 
-Most of the "magic" occurs from Perl code, not XS, so it is possible to define
-new event types if this module lacks any in your local copy of Xlib.  You can
-also access the L</bytes> directly any time you want.  And, you don't even have
-to use this object at all; any scalar or scalarref of the correct length can be
-passed to the L<X11::Xlib> methods that expect an XEvent pointer.
+Each subclass has its own XS accessors which read the member of the union
+directly, so there is no run-time check of C<type> when reading a field of an
+event that was already blessed into the correct class.  The class hierarchy is
+still declared from Perl, so it is possible to define new event types if this
+module lacks any in your local copy of Xlib.  You can also access the L</bytes>
+directly any time you want.  And, you don't even have to use this object at all;
+any scalar or scalarref of the correct length can be passed to the L<X11::Xlib>
+methods that expect an XEvent pointer.
 
 =head1 METHODS
 
@@ -70,6 +73,29 @@ applying the rest of the supplied fields.
 Unpack the fields of an XEvent into a hashref.  The Display field gets
 inflated to an X11::Xlib object.
 
+=head2 get
+
+  my ($x, $y, $state)= $xevent->get(qw( x y state ));
+
+Return the values of the named fields using a single XS call.  Dies if a field
+does not exist for the current L</type>.
+
+=head2 get_list
+
+  my %fields= $xevent->get_list;
+
+Like L</get>, but returns name/value pairs.  With no arguments, it returns
+all fields which are valid for the current L</type>.
+
+=head2 set
+
+  $xevent->set( type => ButtonPress, x => 10, y => 10 );
+
+Assign a list of field/value pairs using a single XS call, and return the
+event.  If C<type> is among the pairs it is applied first (with the same
+re-blessing and zeroing as L</pack>) regardless of its position, so the
+remaining fields are checked against the new type.
+
 =head2 summarize
 
 Return a human-readable string describing the Event.  The format is intended
@@ -153,262 +179,37 @@ sub X11::Xlib::XErrorEvent::summarize {
 # BEGIN GENERATED X11_Xlib_XEvent
 
 
-
 @X11::Xlib::XButtonEvent::ISA= ( __PACKAGE__ );
-*X11::Xlib::XButtonEvent::button= *_button;
-*X11::Xlib::XButtonEvent::root= *_root;
-*X11::Xlib::XButtonEvent::same_screen= *_same_screen;
-*X11::Xlib::XButtonEvent::state= *_state;
-*X11::Xlib::XButtonEvent::subwindow= *_subwindow;
-*X11::Xlib::XButtonEvent::time= *_time;
-*X11::Xlib::XButtonEvent::window= *_window;
-*X11::Xlib::XButtonEvent::x= *_x;
-*X11::Xlib::XButtonEvent::x_root= *_x_root;
-*X11::Xlib::XButtonEvent::y= *_y;
-*X11::Xlib::XButtonEvent::y_root= *_y_root;
-
-
 @X11::Xlib::XCirculateEvent::ISA= ( __PACKAGE__ );
-*X11::Xlib::XCirculateEvent::event= *_event;
-*X11::Xlib::XCirculateEvent::place= *_place;
-*X11::Xlib::XCirculateEvent::window= *_window;
-
-
 @X11::Xlib::XCirculateRequestEvent::ISA= ( __PACKAGE__ );
-*X11::Xlib::XCirculateRequestEvent::parent= *_parent;
-*X11::Xlib::XCirculateRequestEvent::place= *_place;
-*X11::Xlib::XCirculateRequestEvent::window= *_window;
-
-
 @X11::Xlib::XClientMessageEvent::ISA= ( __PACKAGE__ );
-*X11::Xlib::XClientMessageEvent::b= *_b;
-*X11::Xlib::XClientMessageEvent::l= *_l;
-*X11::Xlib::XClientMessageEvent::s= *_s;
-*X11::Xlib::XClientMessageEvent::format= *_format;
-*X11::Xlib::XClientMessageEvent::message_type= *_message_type;
-*X11::Xlib::XClientMessageEvent::window= *_window;
-
-
 @X11::Xlib::XColormapEvent::ISA= ( __PACKAGE__ );
-*X11::Xlib::XColormapEvent::colormap= *_colormap;
-*X11::Xlib::XColormapEvent::new= *_new;
-*X11::Xlib::XColormapEvent::state= *_state;
-*X11::Xlib::XColormapEvent::window= *_window;
-
-
 @X11::Xlib::XConfigureEvent::ISA= ( __PACKAGE__ );
-*X11::Xlib::XConfigureEvent::above= *_above;
-*X11::Xlib::XConfigureEvent::border_width= *_border_width;
-*X11::Xlib::XConfigureEvent::event= *_event;
-*X11::Xlib::XConfigureEvent::height= *_height;
-*X11::Xlib::XConfigureEvent::override_redirect= *_override_redirect;
-*X11::Xlib::XConfigureEvent::width= *_width;
-*X11::Xlib::XConfigureEvent::window= *_window;
-*X11::Xlib::XConfigureEvent::x= *_x;
-*X11::Xlib::XConfigureEvent::y= *_y;
-
-
 @X11::Xlib::XConfigureRequestEvent::ISA= ( __PACKAGE__ );
-*X11::Xlib::XConfigureRequestEvent::above= *_above;
-*X11::Xlib::XConfigureRequestEvent::border_width= *_border_width;
-*X11::Xlib::XConfigureRequestEvent::detail= *_detail;
-*X11::Xlib::XConfigureRequestEvent::height= *_height;
-*X11::Xlib::XConfigureRequestEvent::parent= *_parent;
-*X11::Xlib::XConfigureRequestEvent::value_mask= *_value_mask;
-*X11::Xlib::XConfigureRequestEvent::width= *_width;
-*X11::Xlib::XConfigureRequestEvent::window= *_window;
-*X11::Xlib::XConfigureRequestEvent::x= *_x;
-*X11::Xlib::XConfigureRequestEvent::y= *_y;
-
-
 @X11::Xlib::XCreateWindowEvent::ISA= ( __PACKAGE__ );
-*X11::Xlib::XCreateWindowEvent::border_width= *_border_width;
-*X11::Xlib::XCreateWindowEvent::height= *_height;
-*X11::Xlib::XCreateWindowEvent::override_redirect= *_override_redirect;
-*X11::Xlib::XCreateWindowEvent::parent= *_parent;
-*X11::Xlib::XCreateWindowEvent::width= *_width;
-*X11::Xlib::XCreateWindowEvent::window= *_window;
-*X11::Xlib::XCreateWindowEvent::x= *_x;
-*X11::Xlib::XCreateWindowEvent::y= *_y;
-
-
 @X11::Xlib::XCrossingEvent::ISA= ( __PACKAGE__ );
-*X11::Xlib::XCrossingEvent::detail= *_detail;
-*X11::Xlib::XCrossingEvent::focus= *_focus;
-*X11::Xlib::XCrossingEvent::mode= *_mode;
-*X11::Xlib::XCrossingEvent::root= *_root;
-*X11::Xlib::XCrossingEvent::same_screen= *_same_screen;
-*X11::Xlib::XCrossingEvent::state= *_state;
-*X11::Xlib::XCrossingEvent::subwindow= *_subwindow;
-*X11::Xlib::XCrossingEvent::time= *_time;
-*X11::Xlib::XCrossingEvent::window= *_window;
-*X11::Xlib::XCrossingEvent::x= *_x;
-*X11::Xlib::XCrossingEvent::x_root= *_x_root;
-*X11::Xlib::XCrossingEvent::y= *_y;
-*X11::Xlib::XCrossingEvent::y_root= *_y_root;
-
-
 @X11::Xlib::XDestroyWindowEvent::ISA= ( __PACKAGE__ );
-*X11::Xlib::XDestroyWindowEvent::event= *_event;
-*X11::Xlib::XDestroyWindowEvent::window= *_window;
-
-
 @X11::Xlib::XErrorEvent::ISA= ( __PACKAGE__ );
-*X11::Xlib::XErrorEvent::error_code= *_error_code;
-*X11::Xlib::XErrorEvent::minor_code= *_minor_code;
-*X11::Xlib::XErrorEvent::request_code= *_request_code;
-*X11::Xlib::XErrorEvent::resourceid= *_resourceid;
-
-
 @X11::Xlib::XExposeEvent::ISA= ( __PACKAGE__ );
-*X11::Xlib::XExposeEvent::count= *_count;
-*X11::Xlib::XExposeEvent::height= *_height;
-*X11::Xlib::XExposeEvent::width= *_width;
-*X11::Xlib::XExposeEvent::window= *_window;
-*X11::Xlib::XExposeEvent::x= *_x;
-*X11::Xlib::XExposeEvent::y= *_y;
-
-
 @X11::Xlib::XFocusChangeEvent::ISA= ( __PACKAGE__ );
-*X11::Xlib::XFocusChangeEvent::detail= *_detail;
-*X11::Xlib::XFocusChangeEvent::mode= *_mode;
-*X11::Xlib::XFocusChangeEvent::window= *_window;
-
-
 @X11::Xlib::XGenericEvent::ISA= ( __PACKAGE__ );
-*X11::Xlib::XGenericEvent::evtype= *_evtype;
-*X11::Xlib::XGenericEvent::extension= *_extension;
-
-
 @X11::Xlib::XGraphicsExposeEvent::ISA= ( __PACKAGE__ );
-*X11::Xlib::XGraphicsExposeEvent::count= *_count;
-*X11::Xlib::XGraphicsExposeEvent::drawable= *_drawable;
-*X11::Xlib::XGraphicsExposeEvent::height= *_height;
-*X11::Xlib::XGraphicsExposeEvent::major_code= *_major_code;
-*X11::Xlib::XGraphicsExposeEvent::minor_code= *_minor_code;
-*X11::Xlib::XGraphicsExposeEvent::width= *_width;
-*X11::Xlib::XGraphicsExposeEvent::x= *_x;
-*X11::Xlib::XGraphicsExposeEvent::y= *_y;
-
-
 @X11::Xlib::XGravityEvent::ISA= ( __PACKAGE__ );
-*X11::Xlib::XGravityEvent::event= *_event;
-*X11::Xlib::XGravityEvent::window= *_window;
-*X11::Xlib::XGravityEvent::x= *_x;
-*X11::Xlib::XGravityEvent::y= *_y;
-
-
 @X11::Xlib::XKeyEvent::ISA= ( __PACKAGE__ );
-*X11::Xlib::XKeyEvent::keycode= *_keycode;
-*X11::Xlib::XKeyEvent::root= *_root;
-*X11::Xlib::XKeyEvent::same_screen= *_same_screen;
-*X11::Xlib::XKeyEvent::state= *_state;
-*X11::Xlib::XKeyEvent::subwindow= *_subwindow;
-*X11::Xlib::XKeyEvent::time= *_time;
-*X11::Xlib::XKeyEvent::window= *_window;
-*X11::Xlib::XKeyEvent::x= *_x;
-*X11::Xlib::XKeyEvent::x_root= *_x_root;
-*X11::Xlib::XKeyEvent::y= *_y;
-*X11::Xlib::XKeyEvent::y_root= *_y_root;
-
-
 @X11::Xlib::XKeymapEvent::ISA= ( __PACKAGE__ );
-*X11::Xlib::XKeymapEvent::key_vector= *_key_vector;
-*X11::Xlib::XKeymapEvent::window= *_window;
-
-
 @X11::Xlib::XMapEvent::ISA= ( __PACKAGE__ );
-*X11::Xlib::XMapEvent::event= *_event;
-*X11::Xlib::XMapEvent::override_redirect= *_override_redirect;
-*X11::Xlib::XMapEvent::window= *_window;
-
-
 @X11::Xlib::XMapRequestEvent::ISA= ( __PACKAGE__ );
-*X11::Xlib::XMapRequestEvent::parent= *_parent;
-*X11::Xlib::XMapRequestEvent::window= *_window;
-
-
 @X11::Xlib::XMappingEvent::ISA= ( __PACKAGE__ );
-*X11::Xlib::XMappingEvent::count= *_count;
-*X11::Xlib::XMappingEvent::first_keycode= *_first_keycode;
-*X11::Xlib::XMappingEvent::request= *_request;
-*X11::Xlib::XMappingEvent::window= *_window;
-
-
 @X11::Xlib::XMotionEvent::ISA= ( __PACKAGE__ );
-*X11::Xlib::XMotionEvent::is_hint= *_is_hint;
-*X11::Xlib::XMotionEvent::root= *_root;
-*X11::Xlib::XMotionEvent::same_screen= *_same_screen;
-*X11::Xlib::XMotionEvent::state= *_state;
-*X11::Xlib::XMotionEvent::subwindow= *_subwindow;
-*X11::Xlib::XMotionEvent::time= *_time;
-*X11::Xlib::XMotionEvent::window= *_window;
-*X11::Xlib::XMotionEvent::x= *_x;
-*X11::Xlib::XMotionEvent::x_root= *_x_root;
-*X11::Xlib::XMotionEvent::y= *_y;
-*X11::Xlib::XMotionEvent::y_root= *_y_root;
-
-
 @X11::Xlib::XNoExposeEvent::ISA= ( __PACKAGE__ );
-*X11::Xlib::XNoExposeEvent::drawable= *_drawable;
-*X11::Xlib::XNoExposeEvent::major_code= *_major_code;
-*X11::Xlib::XNoExposeEvent::minor_code= *_minor_code;
-
-
 @X11::Xlib::XPropertyEvent::ISA= ( __PACKAGE__ );
-*X11::Xlib::XPropertyEvent::atom= *_atom;
-*X11::Xlib::XPropertyEvent::state= *_state;
-*X11::Xlib::XPropertyEvent::time= *_time;
-*X11::Xlib::XPropertyEvent::window= *_window;
-
-
 @X11::Xlib::XReparentEvent::ISA= ( __PACKAGE__ );
-*X11::Xlib::XReparentEvent::event= *_event;
-*X11::Xlib::XReparentEvent::override_redirect= *_override_redirect;
-*X11::Xlib::XReparentEvent::parent= *_parent;
-*X11::Xlib::XReparentEvent::window= *_window;
-*X11::Xlib::XReparentEvent::x= *_x;
-*X11::Xlib::XReparentEvent::y= *_y;
-
-
 @X11::Xlib::XResizeRequestEvent::ISA= ( __PACKAGE__ );
-*X11::Xlib::XResizeRequestEvent::height= *_height;
-*X11::Xlib::XResizeRequestEvent::width= *_width;
-*X11::Xlib::XResizeRequestEvent::window= *_window;
-
-
 @X11::Xlib::XSelectionClearEvent::ISA= ( __PACKAGE__ );
-*X11::Xlib::XSelectionClearEvent::selection= *_selection;
-*X11::Xlib::XSelectionClearEvent::time= *_time;
-*X11::Xlib::XSelectionClearEvent::window= *_window;
-
-
 @X11::Xlib::XSelectionEvent::ISA= ( __PACKAGE__ );
-*X11::Xlib::XSelectionEvent::property= *_property;
-*X11::Xlib::XSelectionEvent::requestor= *_requestor;
-*X11::Xlib::XSelectionEvent::selection= *_selection;
-*X11::Xlib::XSelectionEvent::target= *_target;
-*X11::Xlib::XSelectionEvent::time= *_time;
-
-
 @X11::Xlib::XSelectionRequestEvent::ISA= ( __PACKAGE__ );
-*X11::Xlib::XSelectionRequestEvent::owner= *_owner;
-*X11::Xlib::XSelectionRequestEvent::property= *_property;
-*X11::Xlib::XSelectionRequestEvent::requestor= *_requestor;
-*X11::Xlib::XSelectionRequestEvent::selection= *_selection;
-*X11::Xlib::XSelectionRequestEvent::target= *_target;
-*X11::Xlib::XSelectionRequestEvent::time= *_time;
-
-
 @X11::Xlib::XUnmapEvent::ISA= ( __PACKAGE__ );
-*X11::Xlib::XUnmapEvent::event= *_event;
-*X11::Xlib::XUnmapEvent::from_configure= *_from_configure;
-*X11::Xlib::XUnmapEvent::window= *_window;
-
-
 @X11::Xlib::XVisibilityEvent::ISA= ( __PACKAGE__ );
-*X11::Xlib::XVisibilityEvent::state= *_state;
-*X11::Xlib::XVisibilityEvent::window= *_window;
 
 =head2 XButtonEvent
 
@@ -734,6 +535,47 @@ Used for event type: VisibilityNotify
 # END GENERATED X11_Xlib_XEvent
 # ----------------------------------------------------------------------------
 
+=head1 EXTENSION EVENTS
+
+Extension events have type codes chosen by the server.  Calling the
+extension's C<QueryExtension> function registers the code, after which events
+of that type are blessed into the class below.  Their fields are read-only, and
+are not included in L</unpack>.
+
+=head2 XDamageNotifyEvent
+
+Used for event type: C<< $event_base + 0 >>, where C<$event_base> is the first
+value returned by L<XDamageQueryExtension|X11::Xlib/XDamageQueryExtension>.
+
+  area              - XRectangle
+  damage            - Damage
+  drawable          - Drawable
+  geometry          - XRectangle
+  level             - int
+  more              - Bool
+  timestamp         - Time
+
+=cut
+
+@X11::Xlib::XDamageNotifyEvent::ISA= ( __PACKAGE__ );
+
+=head2 XFixesCursorNotifyEvent
+
+Used for event type: C<< $event_base + 1 >>, where
+C<$event_base> is the first value returned by
+L<XFixesQueryExtension|X11::Xlib/XFixesQueryExtension>.  Selected with
+L<XFixesSelectCursorInput|X11::Xlib/XFixesSelectCursorInput>.
+
+  cursor_name       - Atom
+  cursor_serial     - unsigned long
+  subtype           - int
+  timestamp         - Time
+  window            - Window
+
+=cut
+
+@X11::Xlib::XFixesCursorNotifyEvent::ISA= ( __PACKAGE__ );
+
 1;
 
 __END__
@@ -0,0 +1,167 @@
+package X11::Xlib::XGCValues;
+require X11::Xlib::Struct;
+use Carp;
+
+# The GC* flag for each field, for building a valuemask from a hash of fields
+my %field_mask= (
+    function           => X11::Xlib::GCFunction(),
+    plane_mask         => X11::Xlib::GCPlaneMask(),
+    foreground         => X11::Xlib::GCForeground(),
+    background         => X11::Xlib::GCBackground(),
+    line_width         => X11::Xlib::GCLineWidth(),
+    line_style         => X11::Xlib::GCLineStyle(),
+    cap_style          => X11::Xlib::GCCapStyle(),
+    join_style         => X11::Xlib::GCJoinStyle(),
+    fill_style         => X11::Xlib::GCFillStyle(),
+    fill_rule          => X11::Xlib::GCFillRule(),
+    tile               => X11::Xlib::GCTile(),
+    stipple            => X11::Xlib::GCStipple(),
+    ts_x_origin        => X11::Xlib::GCTileStipXOrigin(),
+    ts_y_origin        => X11::Xlib::GCTileStipYOrigin(),
+    font               => X11::Xlib::GCFont(),
+    subwindow_mode     => X11::Xlib::GCSubwindowMode(),
+    graphics_exposures => X11::Xlib::GCGraphicsExposures(),
+    clip_x_origin      => X11::Xlib::GCClipXOrigin(),
+    clip_y_origin      => X11::Xlib::GCClipYOrigin(),
+    clip_mask          => X11::Xlib::GCClipMask(),
+    dash_offset        => X11::Xlib::GCDashOffset(),
+    dashes             => X11::Xlib::GCDashList(),
+    arc_mode           => X11::Xlib::GCArcMode(),
+);
+
+sub field_mask {
+    my $class= shift;
+    my $mask= 0;
+    for (@_) {
+        defined $field_mask{$_} or croak "No field '$_' in X11::Xlib::XGCValues";
+        $mask |= $field_mask{$_};
+    }
+    return $mask;
+}
+
+1;
+
+__END__
+
+=head1 NAME
+
+X11::Xlib::XGCValues - Struct holding the fields of a Graphics Context
+
+=head1 DESCRIPTION
+
+This struct holds values to apply to a L<GC|X11::Xlib::GC> with
+L<XCreateGC|X11::Xlib/XCreateGC> or L<XChangeGC|X11::Xlib/XChangeGC>, or read from
+one with L<XGetGCValues|X11::Xlib/XGetGCValues>.
+
+=head1 ATTRIBUTES
+
+Listed below is the C struct definition, and the constant that you include in
+the valuemask to indicate that the field is initialized.
+
+  int function;            /* GCFunction:   GXcopy, GXxor, ... */
+  unsigned long plane_mask;/* GCPlaneMask */
+  unsigned long foreground;/* GCForeground */
+  unsigned long background;/* GCBackground */
+  int line_width;          /* GCLineWidth */
+  int line_style;          /* GCLineStyle:  LineSolid, LineOnOffDash, LineDoubleDash */
+  int cap_style;           /* GCCapStyle:   CapNotLast, CapButt, CapRound, CapProjecting */
+  int join_style;          /* GCJoinStyle:  JoinMiter, JoinRound, JoinBevel */
+  int fill_style;          /* GCFillStyle:  FillSolid, FillTiled, FillStippled, FillOpaqueStippled */
+  int fill_rule;           /* GCFillRule:   EvenOddRule, WindingRule */
+  int arc_mode;            /* GCArcMode:    ArcChord, ArcPieSlice */
+  Pixmap tile;             /* GCTile */
+  Pixmap stipple;          /* GCStipple */
+  int ts_x_origin;         /* GCTileStipXOrigin */
+  int ts_y_origin;         /* GCTileStipYOrigin */
+  Font font;               /* GCFont */
+  int subwindow_mode;      /* GCSubwindowMode: ClipByChildren, IncludeInferiors */
+  Bool graphics_exposures; /* GCGraphicsExposures */
+  int clip_x_origin;       /* GCClipXOrigin */
+  int clip_y_origin;       /* GCClipYOrigin */
+  Pixmap clip_mask;        /* GCClipMask */
+  int dash_offset;         /* GCDashOffset */
+  char dashes;             /* GCDashList */
+
+The constants can be exported with
+
+  use X11::Xlib ':const_gc';
+
+=head1 METHODS
+
+See parent class L<X11::Xlib::Struct>
+
+=head2 field_mask
+
+  my $mask= X11::Xlib::XGCValues->field_mask(keys %values);
+
+The valuemask that covers the named fields.  Dies on unknown names.
+
+=for Pod::Coverage get get_list set
+
+=over 2
+
+=item arc_mode
+
+=item background
+
+=item cap_style
+
+=item clip_mask
+
+=item clip_x_origin
+
+=item clip_y_origin
+
+=item dash_offset
+
+=item dashes
+
+=item fill_rule
+
+=item fill_style
+
+=item font
+
+=item foreground
+
+=item function
+
+=item graphics_exposures
+
+=item join_style
+
+=item line_style
+
+=item line_width
+
+=item plane_mask
+
+=item stipple
+
+=item subwindow_mode
+
+=item tile
+
+=item ts_x_origin
+
+=item ts_y_origin
+
+=back
+
+=head1 AUTHOR
+
+Olivier Thauvin, E<lt>nanardon@nanardon.zarb.orgE<gt>
+
+Michael Conrad, E<lt>mike@nrdvana.netE<gt>
+
+=head1 COPYRIGHT AND LICENSE
+
+Copyright (C) 2009-2010 by Olivier Thauvin
+
+Copyright (C) 2017-2023 by Michael Conrad
+
+This library is free software; you can redistribute it and/or modify
+it under the same terms as Perl itself, either Perl version 5.10.0 or,
+at your option, any later version of Perl 5 you may have available.
+
+=cut
@@ -0,0 +1,133 @@
+package X11::Xlib::XImage;
+use strict;
+use warnings;
+require X11::Xlib::Opaque;
+our @ISA= ( 'X11::Xlib::Opaque' );
+
+# All modules in dist share a version
+our $VERSION = '0.25';
+
+sub DESTROY {
+    X11::Xlib::XDestroyImage(shift);
+}
+
+1;
+
+__END__
+
+=head1 NAME
+
+X11::Xlib::XImage - Client-side image whose pixels live in a perl scalar
+
+=head1 SYNOPSIS
+
+  use X11::Xlib qw( :fn_image :const_image );
+  my $buf;
+  my $img= XGetImage($display, $window, 0, 0, 640, 480, AllPlanes, ZPixmap, $buf);
+  # $buf now holds 480 rows of $img->bytes_per_line bytes each
+
+  # Capture again into the same buffer, without allocating anything
+  XGetSubImage($display, $window, 0, 0, 640, 480, AllPlanes, ZPixmap, $img, 0, 0);
+
+  # Paint your own pixels
+  my $out= XCreateImage($display, $display->DefaultVisual, 24, ZPixmap, 0,
+    my $pixels, $w, $h, 32, 0);
+  substr($pixels, $out->bytes_per_line * $y + $x * 4, 4, pack('V', 0xFF0000));
+  XPutImage($display, $window, $display->DefaultGC, $out, 0, 0, 0, 0, $w, $h);
+
+=head1 DESCRIPTION
+
+An C<XImage> is Xlib's description of a block of pixels in client memory.  In
+this module, the pixel memory is always a perl scalar.  C<XGetImage> reads the
+server's reply directly into that scalar, C<XPutImage> sends directly from it,
+and perl code can read or modify it with C<substr>, C<unpack>, C<vec>, or pass it
+to other XS code, so pixels are never copied between Xlib and perl.
+
+The scalar is stored in C<< $image->{data} >>.  If you pass your own variable to
+L<XCreateImage|X11::Xlib/XCreateImage> or L<XGetImage|X11::Xlib/XGetImage>, that
+variable I<is> the pixel buffer, so you can keep using it, and can pass it again
+to the next call to reuse its memory.  You may assign a new string to it at any
+time; it is padded with zeroes if it is too short for the image when next used.
+
+Destroying the object (or calling C<XDestroyImage>) frees the C<XImage> struct
+but leaves the scalar alone.
+
+=head1 ATTRIBUTES
+
+All attributes are read-only, and are the fields of the C struct.
+
+=head2 width
+
+=head2 height
+
+=head2 depth
+
+Number of significant bits per pixel (or number of bit planes, for C<XYPixmap>).
+
+=head2 format
+
+C<ZPixmap>, C<XYPixmap>, or C<XYBitmap>.
+
+=head2 bytes_per_line
+
+The row stride.  Row C<$y> starts at byte offset C<< $y * $image->bytes_per_line >>.
+For C<XYPixmap> images, each plane is C<< height * bytes_per_line >> bytes,
+starting with the most significant plane.
+
+=head2 bits_per_pixel
+
+Storage size of one pixel of a C<ZPixmap>, which may be more than L</depth>;
+e.g. depth 24 is usually stored as 32 bits per pixel.
+
+=head2 byte_order
+
+C<LSBFirst> or C<MSBFirst>: the byte order of pixels (or bitmap units) wider
+than one byte.
+
+=head2 bitmap_bit_order
+
+C<LSBFirst> or C<MSBFirst>: the order of pixels within a byte, for depths less
+than 8 and for C<XYPixmap> and C<XYBitmap> images.
+
+=head2 bitmap_unit
+
+=head2 bitmap_pad
+
+=head2 xoffset
+
+=head2 red_mask
+
+=head2 green_mask
+
+=head2 blue_mask
+
+Copied from the Visual the image was created with, or 0.
+
+=head2 data
+
+The scalar holding the pixels.  This returns the scalar itself rather than a new
+copy, though assigning it to a variable makes a copy (or a copy-on-write
+reference, on newer perls).  Use C<< $image->{data} >> or your own variable to
+be certain of working on the same buffer.
+
+=head2 display
+
+See L<X11::Xlib::Opaque/display>
+
+=head1 AUTHOR
+
+Olivier Thauvin, E<lt>nanardon@nanardon.zarb.orgE<gt>
+
+Michael Conrad, E<lt>mike@nrdvana.netE<gt>
+
+=head1 COPYRIGHT AND LICENSE
+
+Copyright (C) 2009-2010 by Olivier Thauvin
+
+Copyright (C) 2017-2023 by Michael Conrad
+
+This library is free software; you can redistribute it and/or modify
+it under the same terms as Perl itself, either Perl version 5.10.0 or,
+at your option, any later version of Perl 5 you may have available.
+
+=cut
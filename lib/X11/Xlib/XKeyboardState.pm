@@ -43,6 +43,8 @@ auto-repeat enabled.
 
 See parent class L<X11::Xlib::Struct>
 
+=for Pod::Coverage get get_list set
+
 =head1 AUTHOR
 
 Olivier Thauvin, E<lt>nanardon@nanardon.zarb.orgE<gt>
@@ -28,6 +28,8 @@ X11::Xlib::XRectangle - Struct defining 16-bit x,y,width,height
 
 See parent class L<X11::Xlib::Struct>
 
+=for Pod::Coverage get get_list set
+
 =head1 AUTHOR
 
 Olivier Thauvin, E<lt>nanardon@nanardon.zarb.orgE<gt>
@@ -28,6 +28,8 @@ members inlined with an underscore.
 
 See parent class L<X11::Xlib::Struct>
 
+=for Pod::Coverage get get_list set
+
 =over 2
 
 =item colormap
@@ -0,0 +1,94 @@
+package X11::Xlib::XRenderPictureAttributes;
+require X11::Xlib::Struct;
+__END__
+
+=head1 NAME
+
+X11::Xlib::XRenderPictureAttributes - Struct defining attributes of an XRender Picture
+
+=head1 DESCRIPTION
+
+This struct contains the attributes of a Picture, to be applied with
+L<XRenderCreatePicture|X11::Xlib/XRenderCreatePicture> or
+L<XRenderChangePicture|X11::Xlib/XRenderChangePicture>.
+
+=head1 ATTRIBUTES
+
+(copied from Xrender.h)
+
+  int repeat;                     /* RepeatNone, RepeatNormal, RepeatPad, RepeatReflect */
+  Picture alpha_map;
+  int alpha_x_origin;
+  int alpha_y_origin;
+  int clip_x_origin;
+  int clip_y_origin;
+  Pixmap clip_mask;
+  Bool graphics_exposures;
+  int subwindow_mode;             /* ClipByChildren, IncludeInferiors */
+  int poly_edge;                  /* PolyEdgeSharp, PolyEdgeSmooth */
+  int poly_mode;                  /* PolyModePrecise, PolyModeImprecise */
+  Atom dither;
+  Bool component_alpha;
+
+The functions take a mask of which fields are defined, made from these
+constants:
+
+  use X11::Xlib ':const_ext_render';
+
+  # CPAlphaMap CPAlphaXOrigin CPAlphaYOrigin CPClipMask CPClipXOrigin
+  # CPClipYOrigin CPComponentAlpha CPDither CPGraphicsExposure CPPolyEdge
+  # CPPolyMode CPRepeat CPSubwindowMode
+
+=head1 METHODS
+
+See parent class L<X11::Xlib::Struct>
+
+=for Pod::Coverage get get_list set
+
+=over 2
+
+=item alpha_map
+
+=item alpha_x_origin
+
+=item alpha_y_origin
+
+=item clip_mask
+
+=item clip_x_origin
+
+=item clip_y_origin
+
+=item component_alpha
+
+=item dither
+
+=item graphics_exposures
+
+=item poly_edge
+
+=item poly_mode
+
+=item repeat
+
+=item subwindow_mode
+
+=back
+
+=head1 AUTHOR
+
+Olivier Thauvin, E<lt>nanardon@nanardon.zarb.orgE<gt>
+
+Michael Conrad, E<lt>mike@nrdvana.netE<gt>
+
+=head1 COPYRIGHT AND LICENSE
+
+Copyright (C) 2009-2010 by Olivier Thauvin
+
+Copyright (C) 2017-2023 by Michael Conrad
+
+This library is free software; you can redistribute it and/or modify
+it under the same terms as Perl itself, either Perl version 5.10.0 or,
+at your option, any later version of Perl 5 you may have available.
+
+=cut
@@ -46,6 +46,8 @@ which fields are use can be exported with
 
 See parent class L<X11::Xlib::Struct>
 
+=for Pod::Coverage get get_list set
+
 =over 2
 
 =item background_pixel
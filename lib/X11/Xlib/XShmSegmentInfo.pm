@@ -0,0 +1,126 @@
+package X11::Xlib::XShmSegmentInfo;
+use strict;
+use warnings;
+use Carp;
+use X11::Xlib;
+
+# All modules in dist share a version
+our $VERSION = '0.25';
+
+=head1 NAME
+
+X11::Xlib::XShmSegmentInfo - Shared memory segment for MIT-SHM image transfer
+
+=head1 SYNOPSIS
+
+  use X11::Xlib::XShmSegmentInfo;
+  $display->XShmQueryExtension or die "No MIT-SHM";
+  my ($w, $h)= ($display->screen->width, $display->screen->height);
+  my $seg= X11::Xlib::XShmSegmentInfo->new(size => $w * $h * 4);
+  $display->XShmAttach($seg) or die;
+  my $img= $display->XShmCreateImage($display->DefaultVisual, $display->DefaultDepth,
+    ZPixmap, $seg, $w, $h);
+  while (1) {
+    $display->XShmGetImage($display->root_window, $img, 0, 0, AllPlanes);
+    process_frame($seg->{data}, $img->bytes_per_line);
+  }
+
+=head1 DESCRIPTION
+
+The MIT-SHM extension lets a client on the same machine as the X server
+exchange pixels through a System V shared memory segment instead of the socket.
+A capture of the screen becomes a request for the server to write into memory
+which the client already has mapped, rather than a reply of C<width * height * 4>
+bytes that must be read and copied.
+
+This object creates such a segment and attaches it to this process.  Its memory
+is available as the perl scalar C<< $seg->{data} >>, whose string buffer I<is> the
+segment.  Images created by L<XShmCreateImage|X11::Xlib/XShmCreateImage> use that
+same scalar as their C<data>.
+
+Modify the pixels in place (with 4-argument C<substr>, C<vec>, or XS code) and
+never assign a longer value to the scalar: perl would then move the string to
+new memory, and the XShm functions will die rather than use it.
+
+When the object is destroyed it asks the server to detach (if it was attached
+and the connection is still open), unmaps the segment from this process, and
+removes it.  Images created from the segment hold a reference to it, so it stays
+mapped as long as they exist.
+
+=head1 CONSTRUCTOR
+
+=head2 new
+
+  my $seg= X11::Xlib::XShmSegmentInfo->new(size => $bytes, read_only => $bool);
+
+Create and attach a new private segment of C<size> bytes.  If C<read_only> is
+true, L<XShmAttach|X11::Xlib/XShmAttach> asks the server to attach it read-only,
+which is enough for C<XShmPutImage> but not for C<XShmGetImage>.
+
+=cut
+
+sub new {
+    my $class= shift;
+    my %args= (@_ == 1 and ref($_[0]) eq 'HASH')? %{ $_[0] }
+        : ((@_ & 1) == 0)? @_
+        : croak "Expected hashref or even-length list";
+    $args{size} or croak "size is required";
+    X11::Xlib->can('XShmQueryExtension')
+        or croak "X11::Xlib was built without MIT-SHM support";
+    my $self= bless {}, $class;
+    $self->_init($args{size}, $args{read_only}? 1 : 0);
+    return $self;
+}
+
+=head1 ATTRIBUTES
+
+=head2 data
+
+The scalar holding the segment's memory.  This is the same as C<< $seg->{data} >>,
+but returns a copy; use C<< $seg->{data} >> to avoid copying.
+
+=head2 size
+
+Size of the segment in bytes.
+
+=head2 shmid
+
+The kernel's id for the segment.
+
+=head2 shmseg
+
+The XID the server uses for the segment, assigned by C<XShmAttach>.
+
+=head2 read_only
+
+Whether the server attaches the segment read-only.
+
+=cut
+
+sub data { $_[0]{data} }
+
+sub DESTROY {
+    shift->_free;
+}
+
+1;
+
+__END__
+
+=head1 AUTHOR
+
+Olivier Thauvin, E<lt>nanardon@nanardon.zarb.orgE<gt>
+
+Michael Conrad, E<lt>mike@nrdvana.netE<gt>
+
+=head1 COPYRIGHT AND LICENSE
+
+Copyright (C) 2009-2010 by Olivier Thauvin
+
+Copyright (C) 2017-2023 by Michael Conrad
+
+This library is free software; you can redistribute it and/or modify
+it under the same terms as Perl itself, either Perl version 5.10.0 or,
+at your option, any later version of Perl 5 you may have available.
+
+=cut
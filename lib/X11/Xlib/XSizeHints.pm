@@ -51,6 +51,8 @@ and can be an ORed combination of:
 
 See parent class L<X11::Xlib::Struct>
 
+=for Pod::Coverage get get_list set
+
 =over 2
 
 =item base_height
@@ -40,6 +40,8 @@ making lots of method calls.
 
 See parent class L<X11::Xlib::Struct>
 
+=for Pod::Coverage get get_list set
+
 =over 2
 
 =item bits_per_rgb
@@ -41,6 +41,8 @@ with L<XGetWindowAttributes|X11::Xlib/XGetWindowAttributes>.
 
 See parent class L<X11::Xlib::Struct>
 
+=for Pod::Coverage get get_list set
+
 =over 2
 
 =item all_event_masks
@@ -32,6 +32,8 @@ The constants can be exported with
 
 See parent class L<X11::Xlib::Struct>
 
+=for Pod::Coverage get get_list set
+
 =over 2
 
 =item border_width
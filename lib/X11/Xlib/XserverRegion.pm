@@ -9,7 +9,7 @@ our $VERSION = '0.25';
 
 sub DESTROY {
     my $self= shift;
-    $self->display->XFixesDestroyRegion($self->xid)
+    $self->display->_release_xid(XFixesDestroyRegion => $self->xid)
         if $self->autofree && $self->xid;
 }
 
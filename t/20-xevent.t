@@ -1,7 +1,7 @@
 #!/usr/bin/env perl
 use strict;
 use warnings;
-use Test::More tests => 4;
+use Test::More tests => 6;
 
 use_ok('X11::Xlib::XEvent') or die;
 sub err(&) { my $code= shift; my $ret; { local $@= ''; eval { $code->() }; $ret= $@; } $ret }
@@ -91,3 +91,42 @@ subtest event_types => sub {
     
     done_testing;
 };
+
+subtest subclass_accessors => sub {
+    my $ev= X11::Xlib::XEvent->new(type => 'ConfigureNotify', x => 3, width => 40, window => 99);
+    isa_ok( $ev, 'X11::Xlib::XConfigureEvent', 'event' );
+    # accessors are installed directly in the subclass, not aliased to the generic ones
+    ok( defined &X11::Xlib::XConfigureEvent::x, 'XConfigureEvent::x is defined' );
+    isnt( \&X11::Xlib::XConfigureEvent::x, \&X11::Xlib::XEvent::_x, 'and is not the generic _x' );
+    is( $ev->x, 3, 'read x' );
+    is( $ev->width, 40, 'read width' );
+    is( $ev->window, 99, 'read window' );
+    is( $ev->_x, 3, 'generic accessor agrees' );
+    is( $ev->height(7), 7, 'set height' );
+    is( $ev->_height, 7, 'generic accessor sees it' );
+
+    # Accessor of one subclass refuses an event of another subclass
+    my $expose= X11::Xlib::XEvent->new(type => 'Expose');
+    like( err{ X11::Xlib::XConfigureEvent::x($expose) }, qr/coerce/, 'wrong subclass is rejected' );
+    # but raw buffers are still accepted
+    is( X11::Xlib::XConfigureEvent::width($ev->bytes), 40, 'accessor on plain buffer' );
+    done_testing;
+};
+
+subtest get_set => sub {
+    my $ev= X11::Xlib::XEvent->new;
+    is( $ev->set(type => X11::Xlib::ButtonPress(), x => 5, y => 6, button => 2), $ev, 'set returns self' );
+    isa_ok( $ev, 'X11::Xlib::XButtonEvent', 're-blessed by type' );
+    is_deeply( [ $ev->get(qw( x y button )) ], [ 5, 6, 2 ], 'get several fields' );
+    my %fields= $ev->get_list;
+    is( $fields{button}, 2, 'get_list includes button' );
+    ok( !exists $fields{width}, 'but not fields of other types' );
+
+    # type is applied first, no matter where it appears
+    $ev->set(width => 30, type => X11::Xlib::ConfigureNotify());
+    isa_ok( $ev, 'X11::Xlib::XConfigureEvent', 're-blessed' );
+    is( $ev->width, 30, 'width set after type change' );
+    like( err{ $ev->get('button') }, qr/Can't access XEvent.button/, 'field of wrong type dies' );
+    like( err{ $ev->set(bogus => 1) }, qr/No field 'bogus'/, 'unknown field dies' );
+    done_testing;
+};
@@ -2,7 +2,7 @@
 
 use strict;
 use warnings;
-use Test::More tests => 10;
+use Test::More tests => 16;
 
 use_ok('X11::Xlib::XRectangle') or die;
 sub err(&) { my $code= shift; my $ret; { local $@= ''; eval { $code->() }; $ret= $@; } $ret }
@@ -29,6 +29,14 @@ is( $clone->y, 55, 'y value preserved' );
 is( $clone->width, 64000, 'w value preserved' );
 is( $clone->height, 0, 'h value preserved' );
 
+# Multi-field get / set
+is_deeply( [ $clone->get(qw( width x y )) ], [ 64000, -2, 55 ], 'get several fields' );
+is_deeply( { $clone->get_list }, { x => -2, y => 55, width => 64000, height => 0 }, 'get_list of all fields' );
+is_deeply( [ $clone->get_list(qw( y x )) ], [ y => 55, x => -2 ], 'get_list of named fields' );
+is( $clone->set(x => 1, height => 2), $clone, 'set returns self' );
+is_deeply( [ $clone->get(qw( x y width height )) ], [ 1, 55, 64000, 2 ], 'set applied' );
+like( err{ $clone->get('z') }, qr/No field 'z'/, 'unknown field dies' );
+
 #my $conn= X11::Xlib->new();
 #my @visuals= map { $_->unpack } $conn->XGetVisualInfo(0, my $foo);
 #use DDP;
@@ -8,7 +8,7 @@ sub err(&) { my $code= shift; my $ret; { local $@= ''; eval { $code->() }; $ret=
 
 plan skip_all => "No X11 Server available"
     unless $ENV{DISPLAY};
-plan tests => 2;
+plan tests => 3;
 
 my $dpy= new_ok( 'X11::Xlib', [], 'connect to X11' );
 
@@ -23,3 +23,40 @@ subtest XQueryPointer => sub {
     ok( defined $ry, 'root_y defined' );
     ok( defined $mask, 'mask defined' );
 };
+
+subtest fake_input_script => sub {
+    my $script= X11::Xlib::Display->pack_input_script(
+        [ MotionNotify, -1, 100, 200 ],
+        [ ButtonPress, 1 ],
+        [ KeyPress, 38 ],
+    );
+    is( length $script, 36, 'packed 12 bytes per record' );
+    is( $dpy->fake_input_script($script), 3, 'sent' );
+    my ($root, $child, $rx, $ry, $wx, $wy, $mask)= XQueryPointer($dpy, RootWindow($dpy));
+    is_deeply( [ $rx, $ry ], [ 100, 200 ], 'pointer moved' );
+    ok( $mask & Button1Mask, 'button held' );
+    ok( (grep $_ == 38, XQueryKeymap($dpy)), 'key held' );
+    $dpy->fake_input_script([ [ KeyRelease, 38 ], [ ButtonRelease, 1 ] ], flush_every => 1);
+    ($root, $child, $rx, $ry, $wx, $wy, $mask)= XQueryPointer($dpy, RootWindow($dpy));
+    ok( !($mask & Button1Mask) && !(grep $_ == 38, XQueryKeymap($dpy)), 'arrayref script released both' );
+
+    my $serial= XNextRequest($dpy);
+    like( err { $dpy->fake_input_script([ [ KeyPress, 38 ], [ 99, 0 ] ]) }, qr/unsupported event type/, 'bad type' );
+    like( err { $dpy->fake_input_script("abc") }, qr/multiple of 12/, 'bad length' );
+    is( XNextRequest($dpy), $serial, 'nothing sent for an invalid script' );
+
+    my $n= 20_000;
+    $script= X11::Xlib::Display->pack_input_script(map [ MotionNotify, -1, $_ % 1000, $_ % 700 ], 1 .. $n);
+    $serial= XNextRequest($dpy);
+    is( $dpy->fake_input_script($script, flush_every => 1000), $n, "$n events" );
+    is( XNextRequest($dpy) - $serial, $n, 'one request per event' );
+    $dpy->XSync;
+
+    require Time::HiRes;
+    my $t0= Time::HiRes::time();
+    $dpy->fake_input_script([ map [ MotionNotify, -1, $_, $_, 30 ], 1 .. 3 ], timing => 'client');
+    cmp_ok( Time::HiRes::time() - $t0, '>=', 0.085, 'client timing waits' );
+    ($root, $child, $rx, $ry)= XQueryPointer($dpy, RootWindow($dpy));
+    is_deeply( [ $rx, $ry ], [ 3, 3 ], 'last position' );
+    ok( err { $dpy->fake_input_script('', timing => 'later') }, 'bad timing' );
+};
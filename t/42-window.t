@@ -139,6 +139,24 @@ subtest window_hierarchy_methods => sub {
     is_deeply( [ map $_->xid, $wnd->children ], \@cwnd, 'window children list' );
 };
 
+subtest snapshot_tree => sub {
+    my $table;
+    is( err{ $table= $dpy->snapshot_tree($win_id) }, '', 'snapshot_tree' );
+    is( length($table) % 40, 0, 'whole number of rows' );
+    my @rows= map [ unpack('l L l l L L L L l l', substr($table, $_*40, 40)) ], 0 .. length($table)/40 - 1;
+    is( scalar @rows, 1 + @cwnd, 'root plus children' );
+    is_deeply( [ @{$rows[0]}[0,1] ], [ -1, $win_id ], 'first row is the root' );
+    is_deeply( [ map $_->[1], @rows[1..$#rows] ], \@cwnd, 'children in stacking order' );
+    is_deeply( [ map $_->[0], @rows[1..$#rows] ], [ (0) x @cwnd ], 'children refer to root row' );
+    is_deeply( [ @{$rows[1]}[4,5] ], [ 50, 50 ], 'child geometry' );
+    XGetWindowAttributes($dpy, $cwnd[0], my $cattr);
+    is( $rows[1][8], $cattr->map_state, 'child map_state' );
+
+    $table= $dpy->snapshot_tree($win_id, fields => ['map_state']);
+    is( (unpack('l L l l L L', substr($table, 40, 40)))[4], 0, 'width not fetched when not requested' );
+    like( err{ $dpy->snapshot_tree($win_id, fields => ['bogus']) }, qr/Unknown snapshot_tree field/, 'bad field name' );
+};
+
 # Call a bunch of functions to see if any throw an error.
 # TODO: actually verify the behavior of these calls
 subtest does_it_crash => sub {
@@ -190,6 +208,34 @@ $wnd->clear_cache;
 ok( !$wnd->is_viewable, 'not is_viewable' );
 ok( $wnd->is_unmapped, 'is_unmapped' );
 
+subtest track_attributes => sub {
+    my $drain= sub { XSync($dpy); 1 while $dpy->wait_event(timeout => 0); };
+    is( err{ $wnd->track_attributes(1) }, '', 'track_attributes' );
+    ok( $wnd->event_mask & StructureNotifyMask, 'selected StructureNotifyMask' );
+    XMapWindow($dpy, $win_id);
+    $drain->();
+    ok( !$wnd->is_unmapped, 'MapNotify applied' );
+    XMoveResizeWindow($dpy, $win_id, 3, 4, 20, 30);
+    $drain->();
+    is_deeply( [ map $wnd->attributes->$_, qw( width height ) ], [ 20, 30 ], 'ConfigureNotify applied' );
+    XUnmapWindow($dpy, $win_id);
+    $drain->();
+    ok( $wnd->is_unmapped, 'UnmapNotify applied' );
+    my $frame= XCreateSimpleWindow($dpy, RootWindow($dpy), 0, 0, 50, 50, 0, 0, 0);
+    XReparentWindow($dpy, $win_id, $frame, 7, 8);
+    $drain->();
+    is_deeply( [ map $wnd->attributes->$_, qw( x y ) ], [ 7, 8 ], 'ReparentNotify applied' );
+    XReparentWindow($dpy, $win_id, RootWindow($dpy), 3, 4);
+    XDestroyWindow($dpy, $frame);
+    XMapWindow($dpy, $win_id);
+    XSync($dpy);
+    ok( $wnd->is_unmapped, 'not updated without events' );
+    $wnd->refresh;
+    ok( !$wnd->is_unmapped, 'refresh' );
+    $wnd->track_attributes(0);
+    XUnmapWindow($dpy, $win_id);
+};
+
 is( err{ XDestroyWindow($dpy, $win_id); }, '', 'XDestroyWindow' );
 
 done_testing;
@@ -0,0 +1,134 @@
+#!/usr/bin/env perl
+
+use strict;
+use warnings;
+use Test::More;
+use X11::Xlib qw( :fn_win :const_win :const_winattr RootWindow XSync None );
+use X11::Xlib::WindowTree;
+
+plan skip_all => "No X11 Server available"
+    unless $ENV{DISPLAY};
+plan tests => 9;
+
+my $dpy= new_ok( 'X11::Xlib', [], 'connect to X11' );
+
+sub err(&) { my $code= shift; my $ret; { local $@= ''; eval { $code->() }; XSync($dpy); $ret= $@; } $ret }
+sub new_win {
+    my ($parent, $x, $y, $w, $h)= @_;
+    XCreateWindow($dpy, $parent, $x, $y, $w, $h, 0, $dpy->DefaultDepth, InputOutput, $dpy->DefaultVisual, 0, {});
+}
+sub drain {
+    my $tree= shift;
+    XSync($dpy);
+    while (my $e= $dpy->wait_event(timeout => 0)) { $tree->apply_event($e) }
+}
+
+my $top= new_win(RootWindow($dpy), 0, 0, 100, 100);
+my @kids= map new_win($top, $_*10, $_*10, 20, 20), 0..2;
+XMapWindow($dpy, $kids[0]);
+
+my $tree;
+is( err{ $tree= X11::Xlib::WindowTree->new(display => $dpy, root => $top) }, '', 'new' );
+is( $tree->window_count, 4, 'window_count' );
+
+subtest initial_state => sub {
+    is_deeply( [ $tree->children($top) ], \@kids, 'children in stacking order' );
+    is( $tree->parent($kids[1]), $top, 'parent' );
+    is( $tree->parent($top), undef, 'root has no parent' );
+    is_deeply( [ $tree->geometry($kids[2]) ], [ 20, 20, 20, 20, 0 ], 'geometry' );
+    is( $tree->map_state($kids[0]), IsUnviewable, 'mapped child of unmapped window' );
+    is( $tree->map_state($kids[1]), IsUnmapped, 'unmapped child' );
+    ok( !$tree->contains(RootWindow($dpy)), 'does not contain windows outside root' );
+};
+
+subtest create_destroy => sub {
+    my $grandchild= new_win($kids[1], 1, 2, 3, 4);
+    drain($tree);
+    ok( $tree->contains($grandchild), 'CreateNotify adds window' );
+    is( $tree->parent($grandchild), $kids[1], 'parent of new window' );
+    is_deeply( [ $tree->geometry($grandchild) ], [ 1, 2, 3, 4, 0 ], 'geometry of new window' );
+    # No CreateNotify is sent for the child, since the tree can't have selected
+    # input on the other client's window yet
+    my $dpy2= X11::Xlib->new;
+    my $foreign= XCreateWindow($dpy2, $kids[1], 5, 5, 10, 10, 0, $dpy2->DefaultDepth, InputOutput, $dpy2->DefaultVisual, 0, {});
+    my $foreign_child= XCreateWindow($dpy2, $foreign, 1, 1, 2, 2, 0, $dpy2->DefaultDepth, InputOutput, $dpy2->DefaultVisual, 0, {});
+    XSync($dpy2);
+    drain($tree);
+    is( $tree->parent($foreign), $kids[1], "another client's window" );
+    is( $tree->parent($foreign_child), $foreign, 'with the children it already had' );
+    XDestroyWindow($dpy, $kids[1]);
+    drain($tree);
+    ok( !$tree->contains($kids[1]), 'DestroyNotify removes window' );
+    ok( !$tree->contains($grandchild), 'and its children' );
+    is_deeply( [ $tree->children($top) ], [ @kids[0,2] ], 'remaining children' );
+    splice @kids, 1, 1;
+};
+
+subtest configure_stacking => sub {
+    XMoveResizeWindow($dpy, $kids[0], 5, 6, 7, 8);
+    XRaiseWindow($dpy, $kids[0]);
+    drain($tree);
+    is_deeply( [ $tree->geometry($kids[0]) ], [ 5, 6, 7, 8, 0 ], 'ConfigureNotify geometry' );
+    is_deeply( [ $tree->children($top) ], [ @kids[1,0] ], 'ConfigureNotify restack' );
+    XCirculateSubwindows($dpy, $top, RaiseLowest);
+    drain($tree);
+    is_deeply( [ $tree->children($top) ], [ @kids[0,1] ], 'CirculateNotify' );
+};
+
+subtest map_reparent => sub {
+    XMapWindow($dpy, $top);
+    drain($tree);
+    is( $tree->map_state($top), IsViewable, 'MapNotify of the root' );
+    is( $tree->map_state($kids[0]), IsViewable, 'mapped child of the root is viewable' );
+    $tree->refresh;
+    XGetWindowAttributes($dpy, $kids[0], my $attrs);
+    is( $tree->map_state($kids[0]), $attrs->map_state, 'refresh' );
+    XUnmapWindow($dpy, $kids[0]);
+    drain($tree);
+    is( $tree->map_state($kids[0]), IsUnmapped, 'UnmapNotify' );
+    XReparentWindow($dpy, $kids[0], $kids[1], 3, 3);
+    drain($tree);
+    is( $tree->parent($kids[0]), $kids[1], 'ReparentNotify' );
+    is_deeply( [ ($tree->geometry($kids[0]))[0,1] ], [ 3, 3 ], 'position in new parent' );
+    XReparentWindow($dpy, $kids[0], RootWindow($dpy), 0, 0);
+    drain($tree);
+    ok( !$tree->contains($kids[0]), 'reparented out of tree' );
+    XDestroyWindow($dpy, $kids[0]);
+};
+
+subtest hit_testing => sub {
+    my $t= X11::Xlib::WindowTree->new(display => $dpy, root => $top);
+    my @w= ( new_win($top, 0, 0, 40, 40), new_win($top, 20, 20, 40, 40) );
+    XMapWindow($dpy, $_) for @w;
+    drain($t);
+    is( $t->window_at(10, 10), $w[0], 'window_at bottom window' );
+    is( $t->window_at(30, 30), $w[1], 'window_at overlap is top-most' );
+    is( $t->window_at(90, 90), undef, 'window_at nothing' );
+    is_deeply( [ $t->windows_in_rect(25, 25, 5, 5) ], \@w, 'windows_in_rect in stacking order' );
+    XRaiseWindow($dpy, $w[0]);
+    drain($t);
+    is( $t->window_at(30, 30), $w[0], 'window_at after restack' );
+    XMoveWindow($dpy, $w[0], 50, 50);
+    drain($t);
+    is( $t->window_at(10, 10), undef, 'window_at after move' );
+    is_deeply( [ $t->windows_in_rect(0, 0, 30, 30) ], [ $w[1] ], 'windows_in_rect after move' );
+    XUnmapWindow($dpy, $w[1]);
+    drain($t);
+    is( $t->window_at(30, 30), undef, 'unmapped windows are not hit' );
+    XResizeWindow($dpy, $top, 300, 300);
+    XMoveWindow($dpy, $w[0], 250, 250);
+    drain($t);
+    is_deeply( [ ($t->geometry($top))[2,3] ], [ 300, 300 ], 'ConfigureNotify of the root' );
+    is( $t->window_at(260, 260), $w[0], 'window_at after the root grew' );
+    XDestroyWindow($dpy, $_) for @w;
+};
+
+subtest display_window_tree => sub {
+    my $t= $dpy->window_tree;
+    isa_ok( $t, 'X11::Xlib::WindowTree' );
+    ok( $t->contains($top), 'contains top-level window' );
+    XDestroyWindow($dpy, $top);
+    XSync($dpy);
+    1 while $dpy->wait_event(timeout => 0);
+    ok( !$t->contains($top), 'wait_event applies events' );
+};
@@ -0,0 +1,81 @@
+#!/usr/bin/env perl
+
+use strict;
+use warnings;
+use Test::More;
+use X11::Xlib qw( :const_win :const_winattr );
+use X11::Xlib::Batch;
+
+# Record the requests that a batch would send, without needing a server
+@MockDisplay::log= ();
+sub MockDisplay::AUTOLOAD {
+    my $self= shift;
+    (my $name= $MockDisplay::AUTOLOAD) =~ s/.*:://;
+    push @MockDisplay::log, [ $name, @_ ];
+}
+sub MockDisplay::DESTROY {}
+
+my $dpy= bless {}, 'MockDisplay';
+sub requests { my @r= @MockDisplay::log; @MockDisplay::log= (); \@r }
+
+subtest merge_configure => sub {
+    my $batch= X11::Xlib::Batch->new(display => $dpy);
+    $batch->move(10, 1, 2)->resize(10, 30, 40)->move(10, 5, 6);
+    $batch->configure(11, border_width => 2);
+    is( $batch->pending, 2, 'pending' );
+    is( $batch->commit, 2, 'two requests' );
+    is_deeply( [ sort { $a->[1] <=> $b->[1] } grep $_->[0] eq 'XConfigureWindow', @{ requests() } ], [
+        [ XConfigureWindow => 10, CWX|CWY|CWWidth|CWHeight, { x => 5, y => 6, width => 30, height => 40 } ],
+        [ XConfigureWindow => 11, CWBorderWidth, { border_width => 2 } ],
+    ], 'one XConfigureWindow per window with last values' );
+    is( $batch->pending, 0, 'reset after commit' );
+};
+
+subtest merge_attributes => sub {
+    my $batch= X11::Xlib::Batch->new(display => $dpy);
+    $batch->change_attributes(10, border_pixel => 1, save_under => 1);
+    $batch->change_attributes(10, border_pixel => 2);
+    $batch->commit;
+    is_deeply( requests(), [
+        [ XChangeWindowAttributes => 10, CWBorderPixel|CWSaveUnder, { border_pixel => 2, save_under => 1 } ],
+        [ 'XFlush' ],
+    ], 'one XChangeWindowAttributes, then flush' );
+    like( eval { $batch->change_attributes(10, bogus => 1); 1 } ? '' : $@, qr/Unknown XSetWindowAttributes field/, 'bad field' );
+};
+
+subtest ordering => sub {
+    my $batch= X11::Xlib::Batch->new(display => $dpy);
+    $batch->show(20)->hide(21)->move(20, 1, 1)->show(21)->hide(20);
+    $batch->configure(30, stack_mode => Above);
+    $batch->restack(1, 2, 3);
+    $batch->restack(3, 4);
+    $batch->configure(31, stack_mode => Below, x => 9);
+    $batch->restack(5, 6);
+    $batch->commit;
+    is_deeply( requests(), [
+        [ XUnmapWindow => 20 ],
+        [ XConfigureWindow => 20, CWX|CWY, { x => 1, y => 1 } ],
+        [ XConfigureWindow => 30, CWStackMode, { stack_mode => Above } ],
+        [ XRestackWindows => [ 1, 2, 3, 4 ] ],
+        [ XConfigureWindow => 31, CWX|CWStackMode, { x => 9, stack_mode => Below } ],
+        [ XRestackWindows => [ 5, 6 ] ],
+        [ XMapWindow => 21 ],
+        [ 'XFlush' ],
+    ], 'unmap, configure, stacking in order, map, flush' );
+
+    $batch->configure(40, stack_mode => Above, y => 3);
+    $batch->restack(41, 40);
+    $batch->commit;
+    is_deeply( requests(), [
+        [ XConfigureWindow => 40, CWY, { y => 3 } ],
+        [ XRestackWindows => [ 41, 40 ] ],
+        [ 'XFlush' ],
+    ], 'restack overrides earlier stack_mode' );
+
+    $batch->move(50, 0, 0);
+    $batch->discard;
+    is( $batch->commit, 0, 'discard' );
+    requests();
+};
+
+done_testing;
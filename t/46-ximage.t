@@ -0,0 +1,75 @@
+#!/usr/bin/env perl
+
+use strict;
+use warnings;
+use Test::More;
+use X11::Xlib qw( :fn_image :fn_pix :const_image RootWindow DefaultGC XSync );
+
+plan skip_all => "No X11 Server available"
+    unless $ENV{DISPLAY};
+
+my $dpy= new_ok( 'X11::Xlib', [], 'connect to X11' );
+
+sub err(&) { my $code= shift; my $ret; { local $@= ''; eval { $code->() }; XSync($dpy); $ret= $@; } $ret }
+
+my $depth= $dpy->DefaultDepth;
+my ($w, $h)= (7, 5);
+
+subtest create_image => sub {
+    my $buf;
+    my $img= XCreateImage($dpy, $dpy->DefaultVisual, $depth, ZPixmap, 0, $buf, $w, $h, 32);
+    isa_ok( $img, 'X11::Xlib::XImage' );
+    is( $img->width, $w, 'width' );
+    is( $img->height, $h, 'height' );
+    is( $img->depth, $depth, 'depth' );
+    is( $img->format, ZPixmap, 'format' );
+    ok( $img->bits_per_pixel >= $depth, 'bits_per_pixel' );
+    is( $img->bytes_per_line % 4, 0, 'bytes_per_line is padded' );
+    ok( $img->bytes_per_line * 8 >= $w * $img->bits_per_pixel, 'bytes_per_line holds a row' );
+    ok( $img->byte_order == LSBFirst || $img->byte_order == MSBFirst, 'byte_order' );
+    is( length $buf, $img->bytes_per_line * $h, 'caller buffer sized for image' );
+
+    XPutPixel($img, 2, 3, 0x123456);
+    is( XGetPixel($img, 2, 3), 0x123456, 'XGetPixel reads XPutPixel' );
+    isnt( $buf =~ tr/\0//c, 0, 'XPutPixel wrote into caller buffer' );
+    $buf= "\0" x length $buf;
+    is( XGetPixel($img, 2, 3), 0, 'XGetPixel sees caller changes' );
+    like( err{ XGetPixel($img, $w, 0) }, qr/outside/, 'bounds check' );
+    is( ${\ $img->data }, $buf, 'data' );
+
+    my $short= "\xFF";
+    my $img2= XCreateImage($dpy, undef, $depth, ZPixmap, 0, $short, $w, $h, 32, 0);
+    is( length $short, $img2->bytes_per_line * $h, 'short buffer is extended' );
+    XDestroyImage($img2);
+    like( err{ XGetPixel($img2, 0, 0) }, qr/./, 'destroyed image' );
+};
+
+subtest round_trip => sub {
+    my $pix= XCreatePixmap($dpy, RootWindow($dpy), $w, $h, $depth);
+    my $src= XCreateImage($dpy, $dpy->DefaultVisual, $depth, ZPixmap, 0, my $src_buf, $w, $h, 32);
+    for my $y (0..$h-1) { XPutPixel($src, $_, $y, ($y << 16) | ($_ << 8) | 0x42) for 0..$w-1 }
+    is( err{ XPutImage($dpy, $pix, DefaultGC($dpy), $src, 0, 0, 0, 0, $w, $h) }, '', 'XPutImage' );
+
+    my $buf;
+    my $img= XGetImage($dpy, $pix, 0, 0, $w, $h, AllPlanes, ZPixmap, $buf);
+    isa_ok( $img, 'X11::Xlib::XImage' );
+    is( $img->depth, $depth, 'depth' );
+    is( XGetPixel($img, 3, 4), (4 << 16) | (3 << 8) | 0x42, 'pixel read back' );
+    is( length $buf, $img->bytes_per_line * $h, 'read into caller buffer' );
+
+    $buf= "\0" x length $buf;
+    ok( XGetSubImage($dpy, $pix, 0, 0, $w, $h, AllPlanes, ZPixmap, $img, 0, 0), 'XGetSubImage whole image' );
+    is( XGetPixel($img, 6, 1), (1 << 16) | (6 << 8) | 0x42, 'reused caller buffer' );
+
+    ok( XGetSubImage($dpy, $pix, 1, 1, 2, 2, AllPlanes, ZPixmap, $img, 0, 3), 'XGetSubImage part' );
+    is( XGetPixel($img, 1, 4), (2 << 16) | (2 << 8) | 0x42, 'part copied to offset' );
+    is( XGetPixel($img, 1, 1), (1 << 16) | (1 << 8) | 0x42, 'rest unchanged' );
+
+    # Must croak before the request, leaving the connection usable
+    like( err{ XGetImage($dpy, $pix, 0, 0, $w, $h, AllPlanes, ZPixmap, "constant") }, qr/read-only/, 'read-only buffer' );
+    my $again= XGetImage($dpy, $pix, 0, 0, $w, $h, AllPlanes, ZPixmap);
+    is( XGetPixel($again, 3, 4), (4 << 16) | (3 << 8) | 0x42, 'connection still in sync' );
+    XFreePixmap($dpy, $pix);
+};
+
+done_testing;
@@ -0,0 +1,85 @@
+#!/usr/bin/env perl
+
+use strict;
+use warnings;
+use Test::More;
+use X11::Xlib qw( :fn_image :fn_pix :const_image RootWindow DefaultGC XSync );
+
+plan skip_all => 'X11::Xlib was built without MIT-SHM'
+    unless X11::Xlib->can('XShmQueryExtension');
+
+require X11::Xlib::XShmSegmentInfo;
+
+subtest segment => sub {
+    my $seg= X11::Xlib::XShmSegmentInfo->new(size => 4096);
+    is( $seg->size, 4096, 'size' );
+    is( length $seg->{data}, 4096, 'data is the size of the segment' );
+    substr($seg->{data}, 10, 3, 'abc');
+    is( substr($seg->{data}, 9, 5), "\0abc\0", 'modify in place' );
+    shmread($seg->shmid, my $nul, 4096, 1) or die "shmread: $!";
+    is( $nul, "\0", 'NUL terminator after the end of data' );
+    my $data= \$seg->{data};
+    undef $seg;
+    ok( !defined $$data, 'data is detached on DESTROY' );
+};
+
+my $dpy;
+sub err(&) { my $code= shift; my $ret; { local $@= ''; eval { $code->() }; XSync($dpy); $ret= $@; } $ret }
+
+SKIP: {
+    skip "No X11 Server available", 2
+        unless $ENV{DISPLAY};
+    $dpy= X11::Xlib->new;
+    skip 'Server lacks MIT-SHM', 2
+        unless $dpy->XShmQueryExtension;
+
+    my $depth= $dpy->DefaultDepth;
+    my ($w, $h)= (7, 5);
+
+    subtest shm_image => sub {
+        my $seg= X11::Xlib::XShmSegmentInfo->new(size => $w * $h * 4);
+        ok( $dpy->XShmAttach($seg), 'XShmAttach' );
+        ok( $seg->shmseg, 'shmseg assigned' );
+        like( err{ $dpy->XShmCreateImage($dpy->DefaultVisual, $depth, ZPixmap, $seg, $w, $h * 2) },
+            qr/segment is only/, 'segment too small' );
+
+        my $img= $dpy->XShmCreateImage($dpy->DefaultVisual, $depth, ZPixmap, $seg, $w, $h);
+        isa_ok( $img, 'X11::Xlib::XImage' );
+        for my $y (0..$h-1) { XPutPixel($img, $_, $y, ($y << 16) | ($_ << 8) | 0x42) for 0..$w-1 }
+        is( XGetPixel($img, 2, 1), (1 << 16) | (2 << 8) | 0x42, 'XPutPixel writes the segment' );
+
+        my $pix= XCreatePixmap($dpy, RootWindow($dpy), $w, $h, $depth);
+        ok( $dpy->XShmPutImage($pix, DefaultGC($dpy), $img, 0, 0, 0, 0, $w, $h, 0), 'XShmPutImage' );
+        XSync($dpy);
+        substr($seg->{data}, 0, length $seg->{data}, "\0" x length $seg->{data});
+        is( XGetPixel($img, 3, 4), 0, 'cleared' );
+        ok( $dpy->XShmGetImage($pix, $img, 0, 0, AllPlanes), 'XShmGetImage' );
+        is( XGetPixel($img, 3, 4), (4 << 16) | (3 << 8) | 0x42, 'pixels read back into segment' );
+
+        my $buf= XGetImage($dpy, $pix, 0, 0, $w, $h, AllPlanes, ZPixmap)->{data};
+        is( $buf, $seg->{data}, 'same as XGetImage' );
+
+        $seg->{data} .= 'x';
+        like( err{ $dpy->XShmGetImage($pix, $img, 0, 0, AllPlanes) }, qr/no longer refers/, 'reassigned data' );
+        XFreePixmap($dpy, $pix);
+    };
+
+    # A segment the server may not map fails like one on a remote server would
+    subtest attach_failure => sub {
+        plan skip_all => 'root can attach any segment' if $> == 0;
+        require IPC::SharedMem;
+        require IPC::SysV;
+        my $seg= X11::Xlib::XShmSegmentInfo->new(size => 4096);
+        my $st= 'IPC::SharedMem::stat'->new;
+        shmctl($seg->shmid, IPC::SysV::IPC_STAT(), my $ds) or die "shmctl: $!";
+        $st->unpack($ds)->mode(0);
+        shmctl($seg->shmid, IPC::SysV::IPC_SET(), $st->pack) or die "shmctl: $!";
+        my @errors;
+        $dpy->on_error(sub { push @errors, $_[1] if $_[1] });
+        is( err{ ok( !$dpy->XShmAttach($seg), 'XShmAttach returns false' ) }, '', 'no exception' );
+        is( scalar @errors, 0, 'BadAccess not passed to the error handler' );
+        ok( $dpy->XGetGeometry(RootWindow($dpy)), 'connection still usable' );
+    };
+}
+
+done_testing;
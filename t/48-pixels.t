@@ -0,0 +1,127 @@
+#!/usr/bin/env perl
+
+use strict;
+use warnings;
+use Test::More;
+use X11::Xlib qw( :const_image );
+use X11::Xlib::Pixels;
+use X11::Xlib::XVisualInfo;
+
+my $max= X11::Xlib::Pixels::max_simd_level();
+note "max_simd_level=$max";
+
+# Deterministic noise, including widths that are not a multiple of the vector size
+srand(42);
+sub noise { join '', map chr(int rand 256), 1..$_[0] }
+
+# Run $code at every SIMD level, and check each against plain C
+sub same_at_all_levels {
+    my ($name, $code)= @_;
+    X11::Xlib::Pixels::simd_level(0);
+    my $expect= $code->();
+    for my $level (1..$max) {
+        is( X11::Xlib::Pixels::simd_level($level), $level, "level $level" );
+        my $got= $code->();
+        ok( $got eq $expect, "$name at level $level" )
+            or diag first_diff($got, $expect);
+    }
+    X11::Xlib::Pixels::simd_level(undef);
+    return $expect;
+}
+sub first_diff {
+    my ($a, $b)= @_;
+    return "lengths ".length($a)." vs ".length($b) if length $a != length $b;
+    for (0..length($a)-1) { return "byte $_: ".ord(substr $a, $_, 1)." vs ".ord(substr $b, $_, 1) if substr($a,$_,1) ne substr($b,$_,1) }
+}
+
+my ($w, $h)= (37, 5);
+
+subtest bgrx => sub {
+    my $src= { data => noise($w * $h * 4), width => $w, height => $h,
+        red_mask => 0xFF0000, green_mask => 0xFF00, blue_mask => 0xFF };
+    my $rgba= same_at_all_levels(bgrx => sub { X11::Xlib::Pixels::to_rgba($src) });
+    is( length $rgba, $w * $h * 4, 'length' );
+    my @px= unpack 'C4', substr($src->{data}, 4*5, 4);
+    is_deeply( [ unpack 'C4', substr($rgba, 4*5, 4) ], [ @px[2,1,0], 255 ], 'BGRX -> RGBA' );
+
+    my $argb= same_at_all_levels(argb => sub { X11::Xlib::Pixels::to_rgba($src, alpha => -1) });
+    is_deeply( [ unpack 'C4', substr($argb, 4*5, 4) ], [ @px[2,1,0,3] ], 'alpha from unused bits' );
+
+    # padded rows, and an output buffer that gets reused
+    $src->{bytes_per_line}= $w * 4 + 12;
+    $src->{data}= noise($src->{bytes_per_line} * $h);
+    my $out= 'x' x 10;
+    X11::Xlib::Pixels::to_rgba($src, $out, alpha => 7);
+    is( length $out, $w * $h * 4, 'written to dest' );
+    @px= unpack 'C4', substr($src->{data}, $src->{bytes_per_line} * 3 + 4*2, 4);
+    is_deeply( [ unpack 'C4', substr($out, ($w*3 + 2) * 4, 4) ], [ @px[2,1,0], 7 ], 'row stride honored' );
+};
+
+subtest rgb565 => sub {
+    my $src= { data => noise($w * $h * 2), width => $w, height => $h, bits_per_pixel => 16,
+        red_mask => 0xF800, green_mask => 0x07E0, blue_mask => 0x001F };
+    my $rgba= same_at_all_levels(rgb565 => sub { X11::Xlib::Pixels::to_rgba($src) });
+    my $v= unpack 'v', substr($src->{data}, 2*9, 2);
+    my ($r, $g, $b)= ($v >> 11, ($v >> 5) & 63, $v & 31);
+    is_deeply( [ unpack 'C4', substr($rgba, 4*9, 4) ],
+        [ ($r << 3) | ($r >> 2), ($g << 2) | ($g >> 4), ($b << 3) | ($b >> 2), 255 ], 'expanded' );
+    is( X11::Xlib::Pixels::to_rgba({ %$src, data => "\xFF\xFF", width => 1, height => 1 }),
+        "\xFF\xFF\xFF\xFF", 'white stays white' );
+};
+
+subtest generic => sub {
+    # MSBFirst xRGB goes through the mask-driven loop
+    my $data= pack 'N*', 0x00102030, 0xFFA0B0C0;
+    my $vinfo= X11::Xlib::XVisualInfo->new(red_mask => 0xFF0000, green_mask => 0xFF00, blue_mask => 0xFF);
+    is( X11::Xlib::Pixels::to_rgb({ data => $data, width => 2, height => 1, byte_order => MSBFirst },
+            visual_info => $vinfo),
+        "\x10\x20\x30\xA0\xB0\xC0", 'MSBFirst to RGB' );
+    is( X11::Xlib::Pixels::to_rgb({ data => "\x30\x20\x10\xC0\xB0\xA0", width => 2, height => 1,
+            bits_per_pixel => 24, red_mask => 0xFF0000, green_mask => 0xFF00, blue_mask => 0xFF }),
+        "\x10\x20\x30\xA0\xB0\xC0", '24bpp to RGB' );
+    # 10-bit channels (depth 30)
+    my $px= (0x3FF << 20) | (0x200 << 10) | 0x001;
+    is_deeply( [ unpack 'C4', X11::Xlib::Pixels::to_rgba({ data => pack('V', $px), width => 1, height => 1,
+            red_mask => 0x3FF00000, green_mask => 0xFFC00, blue_mask => 0x3FF }) ],
+        [ 255, 128, 0, 255 ], '10-bit channels' );
+    like( eval { X11::Xlib::Pixels::to_rgba({ data => '', width => 1, height => 1 }); 1 } ? '' : $@,
+        qr/no color masks/, 'masks required' );
+    like( eval { X11::Xlib::Pixels::to_rgba({ data => 'abc', width => 1, height => 1, red_mask => 1 }); 1 } ? '' : $@,
+        qr/need 4/, 'short buffer' );
+};
+
+subtest premultiply => sub {
+    my $src= noise($w * $h * 4);
+    my $pre= same_at_all_levels(premultiply => sub {
+        my $buf= $src; X11::Xlib::Pixels::premultiply($buf, $w, $h); $buf });
+    my @px= unpack 'C4', substr($src, 4*11, 4);
+    is_deeply( [ unpack 'C4', substr($pre, 4*11, 4) ],
+        [ (map { int($_ * $px[3] / 255 + .5) } @px[0..2]), $px[3] ], 'premultiplied' );
+
+    my $un= same_at_all_levels(unpremultiply => sub {
+        my $buf= $pre; X11::Xlib::Pixels::unpremultiply($buf, $w, $h); $buf });
+    my $worst= 0;
+    for (0 .. $w*$h-1) {
+        my @o= unpack 'C4', substr($src, $_*4, 4);
+        my @u= unpack 'C4', substr($un, $_*4, 4);
+        next if $o[3] < 64; # too little precision left to compare
+        for (0..2) { my $d= abs($o[$_] - $u[$_]) / (255 / $o[3]); $worst= $d if $d > $worst }
+    }
+    cmp_ok( $worst, '<=', 1, 'round trip within one premultiplied step' );
+    is( do { my $b= "\x80\x40\x20\x00"; X11::Xlib::Pixels::unpremultiply($b, 1, 1); $b },
+        "\0\0\0\0", 'alpha 0 becomes black' );
+};
+
+subtest downsample => sub {
+    my $src= noise(($w * 4 + 8) * $h);
+    my $out= same_at_all_levels(downsample => sub {
+        X11::Xlib::Pixels::downsample_2x($src, $w, $h, $w * 4 + 8, my $out); $out });
+    is( length $out, int($w/2) * int($h/2) * 4, 'size rounds down' );
+    my $at= sub { my ($x, $y, $c)= @_; ord substr($src, $y * ($w*4+8) + $x*4 + $c, 1) };
+    my @exp= map { ($at->(6,2,$_) + $at->(7,2,$_) + $at->(6,3,$_) + $at->(7,3,$_) + 2) >> 2 } 0..3;
+    is_deeply( [ unpack 'C4', substr($out, (int($w/2) * 1 + 3) * 4, 4) ], \@exp, 'box average' );
+};
+
+is( X11::Xlib::Pixels::simd_level(99), $max, 'clamped to max' );
+
+done_testing;
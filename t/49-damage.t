@@ -0,0 +1,56 @@
+#!/usr/bin/env perl
+
+use strict;
+use warnings;
+use Test::More;
+use X11::Xlib qw( :fn_image :const_image :const_ext_damage );
+use FindBin;
+use lib "$FindBin::Bin/lib";
+use X11::TestWindow;
+
+plan skip_all => 'X11::Xlib was built without DAMAGE'
+    unless X11::Xlib->can('XDamageQueryExtension');
+plan skip_all => "No X11 Server available"
+    unless $ENV{DISPLAY};
+
+my $dpy= X11::Xlib->new;
+plan skip_all => 'Server lacks DAMAGE'
+    unless $dpy->XDamageQueryExtension;
+
+require X11::Xlib::DamageCapture;
+
+my $wnd= new_test_window($dpy);
+
+subtest events => sub {
+    my $damage= $dpy->XDamageCreate($wnd, XDamageReportBoundingBox);
+    isa_ok( $damage, 'X11::Xlib::Damage' );
+    paint($wnd, 1, 2, 3, 4, 0x123456);
+    my $e= $dpy->wait_event(event_type => ($dpy->XDamageQueryExtension)[0], timeout => 2, loop => 1);
+    isa_ok( $e, 'X11::Xlib::XDamageNotifyEvent' ) or return;
+    is( $e->damage, $damage->xid, 'damage' );
+    is( $e->drawable, $wnd->xid, 'drawable' );
+    is( $e->level, XDamageReportBoundingBox, 'level' );
+    is_deeply( [ map $e->area->$_, qw( x y width height ) ], [ 1, 2, 3, 4 ], 'area' );
+};
+
+subtest capture => sub {
+    my $cap= X11::Xlib::DamageCapture->new(display => $dpy);
+    $cap->watch($wnd);
+    is_deeply( [ map $_->xid, $cap->dirty_windows ], [ $wnd->xid ], 'dirty before first capture' );
+    my @r= $cap->capture($wnd);
+    is_deeply( [ map [ $_->x, $_->y, $_->width, $_->height ], @r ], [ [ 0, 0, 40, 30 ] ], 'full capture' );
+    is( $cap->image($wnd)->width, 40, 'image' );
+    is_deeply( [ $cap->dirty_windows ], [], 'clean' );
+
+    paint($wnd, 5, 6, 7, 8, 0xABCDEF);
+    my $tries= 0;
+    $dpy->wait_event(timeout => 1, loop => 1) until $cap->dirty_windows || ++$tries > 3;
+    is_deeply( [ map $_->xid, $cap->dirty_windows ], [ $wnd->xid ], 'DamageNotify marks window dirty' );
+    @r= $cap->capture($wnd);
+    is_deeply( [ map [ $_->x, $_->y, $_->width, $_->height ], @r ], [ [ 5, 6, 7, 8 ] ], 'only damaged area read' );
+    is( XGetPixel($cap->image($wnd), 6, 7) & 0xFFFFFF, 0xABCDEF, 'copy updated' );
+    is_deeply( [ $cap->capture($wnd) ], [], 'nothing more' );
+};
+
+undef $wnd; # destroy the window while the display is still connected
+done_testing;
@@ -0,0 +1,73 @@
+#!/usr/bin/env perl
+
+use strict;
+use warnings;
+use Test::More;
+use X11::Xlib;
+use X11::Xlib::FrameDiff;
+use X11::Xlib::Pixels;
+
+srand(7);
+sub noise { join '', map chr(int rand 256), 1..$_[0] }
+sub rects { [ map [ $_->x, $_->y, $_->width, $_->height ], @_ ] }
+
+my ($w, $h)= (100, 70);
+my $frame= { width => $w, height => $h, data => noise($w * $h * 4) };
+sub poke { my ($x, $y)= @_; substr($frame->{data}, ($y * $w + $x) * 4, 1)= chr(1 + ord substr($frame->{data}, ($y * $w + $x) * 4, 1)) }
+
+subtest tiles => sub {
+    my $diff= X11::Xlib::FrameDiff->new(tile_width => 32, tile_height => 32);
+    is_deeply( rects($diff->diff($frame)),
+        [ [0,0,100,32], [0,32,100,32], [0,64,100,6] ], 'first frame reports everything' );
+    is_deeply( rects($diff->diff($frame)), [], 'same frame, no change' );
+
+    poke(40, 40);
+    is_deeply( rects($diff->diff($frame)), [ [32,32,32,32] ], 'one pixel' );
+    poke(99, 69);
+    poke(65, 69);
+    is_deeply( rects($diff->diff($frame)), [ [64,64,36,6] ], 'adjacent edge tiles merged' );
+    poke(0, 0);
+    poke(96, 0);
+    is_deeply( rects($diff->diff($frame)), [ [0,0,32,32], [96,0,4,32] ], 'separate tiles' );
+
+    # Moving a block of pixels sideways within a tile changes the hash
+    my $row= substr($frame->{data}, 4*(5*$w), 128);
+    substr($frame->{data}, 4*(5*$w), 128)= substr($row, 32) . substr($row, 0, 32);
+    is_deeply( rects($diff->diff($frame)), [ [0,0,32,32] ], 'swapped stripes detected' );
+
+    my $small= { width => 10, height => 10, data => noise(400) };
+    is_deeply( rects($diff->diff($small)), [ [0,0,10,10] ], 'size change reports everything' );
+    $diff->reset;
+    is_deeply( rects($diff->diff($small)), [ [0,0,10,10] ], 'reset' );
+    is_deeply( rects($diff->diff({ width => 0, height => 0, data => '' })), [], 'empty image' );
+};
+
+subtest formats => sub {
+    my $diff= X11::Xlib::FrameDiff->new(tile_width => 16, tile_height => 8);
+    # 16bpp with padded rows; the padding must not matter
+    my $img= { width => 21, height => 9, bits_per_pixel => 16, bytes_per_line => 48, data => noise(48 * 9) };
+    $diff->diff($img);
+    substr($img->{data}, 44, 4)= 'xxxx';
+    is_deeply( rects($diff->diff($img)), [], 'row padding ignored' );
+    substr($img->{data}, 48 * 8 + 40, 1)= 'x';
+    is_deeply( rects($diff->diff($img)), [ [16,8,5,1] ], 'last pixel' );
+    like( eval { $diff->diff({ %$img, data => 'short' }); 1 }? '' : $@, qr/need/, 'short buffer' );
+    like( eval { $diff->diff({ %$img, bits_per_pixel => 1 }); 1 }? '' : $@, qr/bits_per_pixel/, '1bpp rejected' );
+};
+
+subtest simd => sub {
+    my $max= X11::Xlib::Pixels::max_simd_level();
+    my %hashes;
+    for my $level (0..$max) {
+        X11::Xlib::Pixels::simd_level($level);
+        # tile rows of 37 pixels exercise the scalar tail after the vector stripes
+        my $diff= X11::Xlib::FrameDiff->new(tile_width => 37, tile_height => 16);
+        $diff->diff($frame);
+        $hashes{$level}= $diff->{hashes};
+    }
+    X11::Xlib::Pixels::simd_level(undef);
+    is( $hashes{$_}, $hashes{0}, "same hashes at level $_" ) for 1..$max;
+    pass('scalar only') unless $max;
+};
+
+done_testing;
@@ -0,0 +1,89 @@
+#!/usr/bin/env perl
+
+use strict;
+use warnings;
+use Test::More;
+use X11::Xlib;
+use X11::Xlib::FrameEncoder;
+use X11::Xlib::FrameDecoder;
+use X11::Xlib::Pixels;
+
+srand(3);
+sub noise { join '', map chr(int rand 256), 1..$_[0] }
+
+my ($w, $h)= (23, 11);
+# Blocks of flat color with some noise, so every QOI op gets used
+my $data= '';
+for my $y (0..$h-1) {
+    for my $x (0..$w-1) {
+        $data .= $x < 8? "\x10\x20\x30\x00" : $x < 12? pack('C4', $x, $y, $x+$y, 0) : noise(4);
+    }
+}
+my $frame= { width => $w, height => $h, data => $data,
+    red_mask => 0xFF0000, green_mask => 0xFF00, blue_mask => 0xFF };
+
+subtest qoi => sub {
+    my $qoi= X11::Xlib::FrameEncoder::encode_qoi($frame);
+    is( substr($qoi, 0, 4), 'qoif', 'magic' );
+    is( substr($qoi, -8), "\0\0\0\0\0\0\0\1", 'end marker' );
+    my ($dw, $dh, $ch, $px)= X11::Xlib::FrameEncoder::qoi_decode($qoi);
+    is_deeply( [ $dw, $dh, $ch ], [ $w, $h, 4 ], 'header' );
+    ok( $px eq X11::Xlib::Pixels::to_rgba($frame), 'round trip RGBA' );
+    ($dw, $dh, $ch, $px)= X11::Xlib::FrameEncoder::qoi_decode(
+        X11::Xlib::FrameEncoder::encode_qoi($frame, channels => 3));
+    ok( $px eq X11::Xlib::Pixels::to_rgb($frame), 'round trip RGB' );
+
+    my $flat= X11::Xlib::FrameEncoder::encode_qoi({ %$frame, data => "\0\0\0\0" x ($w*$h) });
+    cmp_ok( length $flat, '<', 14 + 8 + 8, 'flat image is a few runs' );
+    like( eval { X11::Xlib::FrameEncoder::qoi_decode(substr($qoi, 0, 40)); 1 }? '' : $@,
+        qr/truncated/, 'truncated' );
+};
+
+subtest stream => sub {
+    open my $out, '>:raw', \my $file or die;
+    my $enc= X11::Xlib::FrameEncoder->new(fh => $out, delta => 1, keyframe_interval => 2);
+    my @expect;
+    my %f= %$frame;
+    for my $i (0..4) {
+        substr($f{data}, 4 * (3*$w + $i), 4)= "\xFF\xFF\xFF\x00" if $i;
+        $enc->write_frame(\%f, timestamp => 100 + $i/4);
+        push @expect, X11::Xlib::Pixels::to_rgb(\%f);
+    }
+    $f{width}= 5;
+    $enc->write_frame(\%f, timestamp => 200);
+    push @expect, X11::Xlib::Pixels::to_rgb(\%f);
+    is( $enc->frame_count, 6, 'frame_count' );
+    close $out;
+
+    open my $in, '<:raw', \$file or die;
+    my $dec= X11::Xlib::FrameDecoder->new(fh => $in);
+    my @frames;
+    while (my $fr= $dec->read_frame) { push @frames, $fr }
+    is( scalar @frames, 6, 'read all frames' );
+    is_deeply( [ map $_->{keyframe}? 1 : 0, @frames ], [ 1, 0, 0, 1, 0, 1 ], 'key frames' );
+    is_deeply( [ map $_->{timestamp}, @frames ], [ 100, 100.25, 100.5, 100.75, 101, 200 ], 'timestamps' );
+    ok( $frames[$_]{data} eq $expect[$_], "frame $_ pixels" ) for 0..5;
+    is( $frames[5]{width}, 5, 'size change' );
+
+    open $in, '<:raw', \$file or die;
+    $dec= X11::Xlib::FrameDecoder->new(fh => $in);
+    $dec->read_frame;
+    my $fr= $dec->skip_to_keyframe;
+    ok( $fr->{keyframe} && $fr->{data} eq $expect[3], 'skip_to_keyframe' );
+    ok( $dec->read_frame->{data} eq $expect[4], 'delta after skip' );
+
+    # RGBA, with alpha from the unused bits, changing between frames
+    open $out, '>:raw', \($file= '') or die;
+    $enc= X11::Xlib::FrameEncoder->new(fh => $out, delta => 1, channels => 4);
+    my %f2= %$frame;
+    $enc->write_frame(\%f2, alpha => -1);
+    substr($f2{data}, 4*5 + 3, 1)= "\x80";
+    $enc->write_frame(\%f2, alpha => -1);
+    close $out;
+    open $in, '<:raw', \$file or die;
+    $dec= X11::Xlib::FrameDecoder->new(fh => $in);
+    $dec->read_frame;
+    ok( $dec->read_frame->{data} eq X11::Xlib::Pixels::to_rgba(\%f2, alpha => -1), 'RGBA delta' );
+};
+
+done_testing;
@@ -0,0 +1,59 @@
+#!/usr/bin/env perl
+
+use strict;
+use warnings;
+use Test::More;
+use X11::Xlib qw( :const_image );
+use X11::Xlib::Pixels;
+use X11::Xlib::FrameDiff;
+use X11::Xlib::FrameEncoder;
+
+note 'max_threads='.X11::Xlib::Pixels::max_threads();
+is( X11::Xlib::Pixels::threads(), 1, 'single-threaded by default' );
+
+srand(11);
+my ($w, $h)= (203, 331);
+my $img= { width => $w, height => $h, bytes_per_line => $w * 4 + 4,
+    data => join('', map chr(int rand 256), 1 .. ($w * 4 + 4) * $h),
+    red_mask => 0xFF0000, green_mask => 0xFF00, blue_mask => 0xFF };
+
+# Run each operation single-threaded, then with several threads
+my %ops= (
+    to_rgb => sub { X11::Xlib::Pixels::to_rgb($img) },
+    to_rgba_generic => sub { X11::Xlib::Pixels::to_rgba($img, byte_order => MSBFirst) },
+    premultiply => sub { my $b= X11::Xlib::Pixels::to_rgba($img, alpha => -1);
+        X11::Xlib::Pixels::premultiply($b, $w, $h); $b },
+    downsample => sub { X11::Xlib::Pixels::downsample_2x($img->{data}, $w, $h, $w * 4 + 4, my $out); $out },
+    framediff => sub { my $d= X11::Xlib::FrameDiff->new(tile_width => 16, tile_height => 16);
+        $d->diff($img); my %i= %$img; substr($i{data}, 4*(200*($w+1) + 50), 1)^= "\x01";
+        join ',', $d->{hashes}, map { join ' ', $_->x, $_->y, $_->width, $_->height } $d->diff(\%i) },
+    qoi_delta => sub { open my $fh, '>:raw', \my $buf or die;
+        my $e= X11::Xlib::FrameEncoder->new(fh => $fh, delta => 1);
+        $e->write_frame($img, timestamp => 1) for 1..2; $buf },
+);
+my %expect= map { $_ => $ops{$_}->() } keys %ops;
+SKIP: {
+    skip "Built without pthreads", 1 + 3 * (1 + keys %ops)
+        if X11::Xlib::Pixels::threads(2) == 1;
+    for my $n (2, 4, 7) {
+        is( X11::Xlib::Pixels::threads($n), $n, "threads($n)" );
+        for (sort keys %ops) {
+            ok( $ops{$_}->() eq $expect{$_}, "$_ with $n threads" );
+        }
+    }
+
+    # A forked child starts its own workers
+    defined(my $pid= open(my $child, '-|')) or die "fork: $!";
+    if (!$pid) {
+        print $ops{to_rgb}->() eq $expect{to_rgb}? "ok" : "wrong";
+        exit 0;
+    }
+    is( scalar <$child>, 'ok', 'works after fork' );
+    close $child;
+}
+
+is( X11::Xlib::Pixels::threads(undef), 1, 'back to one thread' );
+cmp_ok( X11::Xlib::Pixels::threads(0), '==', X11::Xlib::Pixels::max_threads(), 'threads(0) uses every CPU' );
+X11::Xlib::Pixels::threads(1);
+
+done_testing;
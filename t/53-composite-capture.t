@@ -0,0 +1,87 @@
+#!/usr/bin/env perl
+
+use strict;
+use warnings;
+use Test::More;
+use X11::Xlib qw( :fn_image :const_image :const_event );
+use FindBin;
+use lib "$FindBin::Bin/lib";
+use X11::TestWindow;
+
+plan skip_all => 'X11::Xlib was built without Composite'
+    unless X11::Xlib->can('XCompositeQueryExtension');
+plan skip_all => "No X11 Server available"
+    unless $ENV{DISPLAY};
+
+my $dpy= X11::Xlib->new;
+my ($major, $minor)= ($dpy->XCompositeQueryVersion, 0, 0);
+plan skip_all => 'Server lacks Composite 0.2'
+    unless (() = $dpy->XCompositeQueryExtension) && ($major > 0 || $minor >= 2);
+
+require X11::Xlib::CompositeCapture;
+
+my $wnd= new_test_window($dpy);
+
+# The events the server sends about $wnd, delivered the way wait_event would
+sub notify {
+    my $e= X11::Xlib::XEvent->new(window => $wnd->xid, @_);
+    $wnd->apply_event($e);
+    $_ && $_->apply_event($e) for values %{ $dpy->{composite_captures} };
+}
+
+my $cap= X11::Xlib::CompositeCapture->new(display => $dpy);
+$cap->watch($wnd);
+is_deeply( [ map $_->xid, $cap->windows ], [ $wnd->xid ], 'windows' );
+paint($wnd, 0, 0, 40, 30, 0x102030);
+paint($wnd, 2, 3, 4, 5, 0xABCDEF);
+
+for my $shm (1, 0) {
+    $cap->use_shm($shm);
+    my $img= $cap->capture($wnd);
+    isa_ok( $img, 'X11::Xlib::XImage', ($shm? 'shm' : 'plain').' capture' ) or next;
+    is_deeply( [ $img->width, $img->height ], [ 40, 30 ], 'size' );
+    is( XGetPixel($img, 3, 4) & 0xFFFFFF, 0xABCDEF, 'painted pixel' );
+    is( XGetPixel($img, 20, 20) & 0xFFFFFF, 0x102030, 'background pixel' );
+    my ($rgba, $tw, $th)= $cap->thumbnail($wnd, 10);
+    is_deeply( [ $tw, $th, length $rgba ], [ 10, 7, 10*7*4 ], 'thumbnail size' );
+    is( unpack('H8', substr($rgba, 4*9, 4)), '102030ff', 'thumbnail pixel' );
+}
+
+# A server that can't attach the segment (such as a remote one) turns SHM off
+SKIP: {
+    my $cap2= X11::Xlib::CompositeCapture->new(display => $dpy, use_shm => 1);
+    skip 'Server lacks MIT-SHM', 3 unless $cap2->use_shm;
+    no warnings 'redefine', 'once';
+    local *X11::Xlib::Display::XShmAttach= sub { 0 };
+    $cap2->watch($wnd);
+    my $img= $cap2->capture($wnd);
+    ok( !$cap2->use_shm, 'use_shm turned off when XShmAttach fails' );
+    isa_ok( $img, 'X11::Xlib::XImage', 'fallback capture' ) or last;
+    is( XGetPixel($img, 3, 4) & 0xFFFFFF, 0xABCDEF, 'fallback pixel' );
+}
+
+# Resize: the pixmap is named again at the new size
+my $pixmap= $cap->{windows}{$wnd->xid}{pixmap}->xid;
+X11::Xlib::XResizeWindow($dpy, $wnd, 50, 20);
+$dpy->XSync;
+notify(type => 'ConfigureNotify', width => 50, height => 20);
+isnt( $cap->{windows}{$wnd->xid}{pixmap}->xid, $pixmap, 'new pixmap after resize' );
+is_deeply( [ map $cap->capture($wnd)->$_, qw( width height ) ], [ 50, 20 ], 'captured at new size' );
+
+# Unmapped windows still capture their last contents
+$wnd->hide;
+$dpy->XSync;
+notify(type => 'UnmapNotify');
+ok( !$wnd->is_viewable, 'unmapped' ) if $wnd->can('is_viewable');
+is( XGetPixel($cap->capture($wnd), 3, 4) & 0xFFFFFF, 0xABCDEF, 'capture while unmapped' );
+
+$cap->unwatch($wnd);
+is_deeply( [ $cap->windows ], [], 'unwatch' );
+$cap->watch($wnd);
+notify(type => 'DestroyNotify');
+is_deeply( [ $cap->windows ], [], 'DestroyNotify unwatches' );
+
+undef $cap;
+$dpy->XSync;
+undef $wnd;
+done_testing;
@@ -0,0 +1,71 @@
+#!/usr/bin/env perl
+
+use strict;
+use warnings;
+use Test::More;
+use X11::Xlib qw( :fn_image :const_image :const_ext_render );
+
+plan skip_all => 'X11::Xlib was built without XRender'
+    unless X11::Xlib->can('XRenderCreatePicture');
+plan skip_all => "No X11 Server available"
+    unless $ENV{DISPLAY};
+
+my $dpy= X11::Xlib->new;
+plan skip_all => 'Server lacks RENDER'
+    unless () = $dpy->XRenderQueryExtension;
+
+my $wnd= $dpy->new_window(x => 0, y => 0, width => 40, height => 30, override_redirect => 1);
+$wnd->show;
+$dpy->XSync;
+
+my $fmt= $dpy->XRenderFindVisualFormat($dpy->DefaultVisual);
+isa_ok( $fmt, 'X11::Xlib::XRenderPictFormat', 'visual format' );
+my $a8= $dpy->XRenderFindStandardFormat(PictStandardA8);
+is( $a8->depth, 8, 'A8 format' );
+
+my $pict= $dpy->XRenderCreatePicture($wnd, $fmt, CPPolyEdge, { poly_edge => PolyEdgeSmooth });
+isa_ok( $pict, 'X11::Xlib::Picture' );
+
+sub pixel { XGetPixel(XGetImage($dpy, $wnd, $_[0], $_[1], 1, 1, AllPlanes, ZPixmap), 0, 0) & 0xFFFFFF }
+
+subtest fill => sub {
+    # Packed rectangles, all sent by one call
+    my $rects= join '', map pack('s s S S', $_ * 4, 1, 2, 3), 0..9;
+    $dpy->XRenderFillRectangles(PictOpSrc, $pict, [ 0x1200, 0x3400, 0x5600 ], $rects);
+    is( sprintf('%06X', pixel(4*9+1, 3)), '123456', 'packed rects' );
+    $dpy->XRenderFillRectangles(PictOpSrc, $pict, pack('S4', 0xAB00, 0xCD00, 0xEF00, 0xFFFF),
+        [ X11::Xlib::XRectangle->new(x => 5, y => 20, width => 2, height => 2), { x => 30, y => 25, width => 1, height => 1 } ]);
+    is( sprintf('%06X', pixel(6, 21)), 'ABCDEF', 'XRectangle objects' );
+    is( sprintf('%06X', pixel(30, 25)), 'ABCDEF', 'hashrefs' );
+    $dpy->XRenderFillRectangle(PictOpSrc, $pict, [ 0, 0xFF00, 0 ], 10, 10, 1, 1);
+    is( sprintf('%06X', pixel(10, 10)), '00FF00', 'single rect' );
+    like( (eval { $dpy->XRenderFillRectangles(PictOpSrc, $pict, [0,0,0], 'abc'); 1 }? '' : $@),
+        qr/multiple of 8/, 'bad packed length' );
+    $dpy->XRenderFillRectangles(PictOpSrc, $pict, [0,0,0], '');
+};
+
+subtest shapes => sub {
+    my $solid= $dpy->XCreatePixmap($wnd, 1, 1, $dpy->DefaultDepth);
+    my $src= $dpy->XRenderCreatePicture($solid, $fmt, CPRepeat, { repeat => RepeatNormal });
+    $dpy->XRenderFillRectangle(PictOpSrc, $src, [ 0xFFFF, 0, 0 ], 0, 0, 1, 1);
+    $dpy->XRenderFillRectangle(PictOpSrc, $pict, [ 0, 0, 0 ], 0, 0, 40, 30);
+    my $fx= sub { map int($_ * 65536), @_ };
+    # A 20x20 square from 10,5 as a trapezoid with vertical sides
+    my $traps= pack 'l10', $fx->(5, 25, 10, 0, 10, 30, 30, 0, 30, 30);
+    $dpy->XRenderCompositeTrapezoids(PictOpOver, $src, $pict, $a8, 0, 0, $traps);
+    is( sprintf('%06X', pixel(20, 15)), 'FF0000', 'inside trapezoid' );
+    is( sprintf('%06X', pixel(35, 15)), '000000', 'outside trapezoid' );
+    # Two corners as triangles, with no mask
+    my $tris= pack 'l6 l6', $fx->(0, 0, 8, 0, 0, 8), $fx->(0, 30, 8, 30, 0, 22);
+    $dpy->XRenderCompositeTriangles(PictOpOver, $src, $pict, undef, 0, 0, $tris);
+    is( sprintf('%06X', pixel(1, 1)), 'FF0000', 'inside triangle' );
+    is( sprintf('%06X', pixel(1, 28)), 'FF0000', 'inside second triangle' );
+    is( sprintf('%06X', pixel(6, 6)), '000000', 'outside triangles' );
+    $dpy->XRenderComposite(PictOpSrc, $src, 0, $pict, 0, 0, 0, 0, 36, 0, 4, 4);
+    is( sprintf('%06X', pixel(38, 2)), 'FF0000', 'XRenderComposite' );
+};
+
+undef $pict;
+$dpy->XSync;
+undef $wnd;
+done_testing;
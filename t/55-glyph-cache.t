@@ -0,0 +1,105 @@
+#!/usr/bin/env perl
+
+use strict;
+use warnings;
+use Test::More;
+use X11::Xlib qw( :fn_image :const_image :const_ext_render );
+
+plan skip_all => 'X11::Xlib was built without XRender'
+    unless X11::Xlib->can('XRenderCreateGlyphSet');
+plan skip_all => "No X11 Server available"
+    unless $ENV{DISPLAY};
+
+my $dpy= X11::Xlib->new;
+plan skip_all => 'Server lacks RENDER'
+    unless () = $dpy->XRenderQueryExtension;
+
+use_ok( 'X11::Xlib::GlyphCache' ) or BAIL_OUT;
+
+my $wnd= $dpy->new_window(x => 0, y => 0, width => 60, height => 20, override_redirect => 1);
+$wnd->show;
+my $fmt= $dpy->XRenderFindVisualFormat($dpy->DefaultVisual);
+my $pict= $dpy->XRenderCreatePicture($wnd, $fmt);
+my $src= $dpy->XRenderCreatePicture($dpy->XCreatePixmap($wnd, 1, 1, $dpy->DefaultDepth), $fmt,
+    CPRepeat, { repeat => RepeatNormal });
+$dpy->XRenderFillRectangle(PictOpSrc, $src, [ 0xFFFF, 0xFFFF, 0 ], 0, 0, 1, 1);
+
+sub pixel { XGetPixel(XGetImage($dpy, $wnd, $_[0], $_[1], 1, 1, AllPlanes, ZPixmap), 0, 0) & 0xFFFFFF }
+sub clear { $dpy->XRenderFillRectangle(PictOpSrc, $pict, [ 0, 0, 0 ], 0, 0, 60, 20) }
+
+# Each glyph is a 3x5 box with its origin at the bottom-left, except that the
+# glyph of 'a' + n leaves out row n, so glyphs can be told apart by their pixels.
+my @rasterized;
+my $glyphs= X11::Xlib::GlyphCache->new(display => $dpy, max_bytes => 4 * 4 * 5,
+    rasterize => sub {
+        my $cp= shift;
+        push @rasterized, chr $cp;
+        return { x_off => 4 } if $cp == ord ' ';
+        return undef if $cp == ord '?';
+        my $skip= $cp - ord 'a';
+        return { width => 3, height => 5, x => 0, y => 5, x_off => 4, y_off => 0,
+            bytes_per_line => 3, data => join '', map { $_ == $skip? "\0\0\0" : "\xFF\xFF\xFF" } 0..4 };
+    });
+is( $glyphs->format->depth, 8, 'A8 by default' );
+ok( $glyphs->glyphset, 'created glyphset' );
+
+clear();
+$glyphs->draw($src, $pict, 2, 10, "ab a");
+is( join('', @rasterized), 'ab ', 'rasterized each character once' );
+is_deeply( [ $glyphs->misses, $glyphs->hits, $glyphs->uploads, $glyphs->count ], [ 3, 0, 1, 3 ], 'stats after first draw' );
+is( $glyphs->bytes, 2 * 4 * 5, 'rows padded to 4 bytes' );
+is( sprintf('%06X', pixel(3, 6)), 'FFFF00', 'glyph a drawn' );
+is( sprintf('%06X', pixel(3, 5)), '000000', 'row 0 left out of a' );
+is( sprintf('%06X', pixel(7, 6)), '000000', 'row 1 left out of b' );
+is( sprintf('%06X', pixel(11, 8)), '000000', 'space is empty' );
+is( sprintf('%06X', pixel(15, 6)), 'FFFF00', 'second a advanced past the space' );
+clear();
+$glyphs->draw($src, $pict, 2, 10, "a?a");
+is( sprintf('%06X', pixel(7, 6)), 'FFFF00', 'undef glyph does not advance' );
+
+@rasterized= ();
+$glyphs->draw($src, $pict, 2, 10, "ab a") for 1..3;
+is( scalar @rasterized, 0, 'redraw rasterizes nothing' );
+is_deeply( [ $glyphs->hits, $glyphs->uploads ], [ 10, 2 ], 'redraw only hits' );
+
+# Budget of 4 glyph images: adding c, d, e must evict the least recently used
+$glyphs->draw($src, $pict, 2, 10, "b");
+$glyphs->draw($src, $pict, 2, 10, "cde");
+ok( $glyphs->evictions, "evicted to make room" );
+ok( $glyphs->bytes <= $glyphs->max_bytes, 'under budget' );
+@rasterized= ();
+$glyphs->load("b");
+is( scalar @rasterized, 0, 'recently used b was kept' );
+$glyphs->load("a");
+is( join('', @rasterized), 'a', 'least recently used a was evicted' );
+clear();
+$glyphs->draw($src, $pict, 2, 10, "ea");
+is( sprintf('%06X', pixel(3, 9)), '000000', 'e drawn after eviction' );
+is( sprintf('%06X', pixel(7, 9)), 'FFFF00', 'a drawn after eviction' );
+
+# A string bigger than the budget still draws all of its glyphs
+@rasterized= ();
+$glyphs->draw($src, $pict, 0, 10, "fghijk");
+is( scalar @rasterized, 6, 'all glyphs of a long string loaded' );
+ok( $glyphs->bytes > $glyphs->max_bytes, 'over budget while in use' );
+$glyphs->load("l");
+ok( $glyphs->bytes <= $glyphs->max_bytes, 'trimmed on next miss' );
+$glyphs->clear;
+is( $glyphs->count, 0, 'clear' );
+
+# The raw functions accept packed or arrayref glyph lists
+my $gs= $dpy->XRenderCreateGlyphSet($dpy->XRenderFindStandardFormat(PictStandardA8));
+$dpy->XRenderAddGlyphs($gs, pack('L', 7), pack('S S s s s s', 1, 1, 0, 1, 2, 0), "\xFF\0\0\0");
+like( (eval { $dpy->XRenderAddGlyphs($gs, [1, 2], pack('S S s s s s', 1, 1, 0, 1, 2, 0), "\xFF\0\0\0"); 1 }? '' : $@),
+    qr/2 glyph ids but 1/, 'mismatched glyph count' );
+clear();
+$dpy->XRenderCompositeString32(PictOpOver, $src, $pict, undef, $gs, 0, 0, 30, 15, [ 7, 7 ]);
+$dpy->XRenderCompositeString8(PictOpOver, $src, $pict, undef, $gs, 0, 0, 40, 15, "\x07");
+$dpy->XSync;
+is( sprintf('%06X', pixel(32, 14)), 'FFFF00', 'XRenderCompositeString32 with arrayref' );
+is( sprintf('%06X', pixel(40, 14)), 'FFFF00', 'XRenderCompositeString8' );
+$dpy->XRenderFreeGlyphs($gs, [ 7 ]);
+$dpy->XRenderFreeGlyphSet($gs);
+$dpy->XSync;
+
+done_testing;
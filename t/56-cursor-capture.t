@@ -0,0 +1,84 @@
+#!/usr/bin/env perl
+
+use strict;
+use warnings;
+use Test::More;
+use X11::Xlib qw( :const_ext_xfixes );
+
+plan skip_all => 'X11::Xlib was built without XFixes'
+    unless X11::Xlib->can('XFixesGetCursorImage');
+plan skip_all => "No X11 Server available"
+    unless $ENV{DISPLAY};
+
+my $dpy= X11::Xlib->new;
+plan skip_all => 'Server lacks XFixes'
+    unless () = $dpy->XFixesQueryExtension;
+
+use_ok( 'X11::Xlib::CursorCapture' ) or BAIL_OUT;
+my $root= $dpy->root_window;
+
+my $img= $dpy->XFixesGetCursorImage;
+ok( $img->{width} && $img->{height}, 'XFixesGetCursorImage' );
+is( length $img->{pixels}, 4 * $img->{width} * $img->{height}, 'pixels packed as 32 bits each' );
+ok( defined $img->{cursor_serial}, 'has serial' );
+
+my $cap= X11::Xlib::CursorCapture->new(display => $dpy);
+my $first= $cap->cursor;
+is( $first->{cursor_serial}, $img->{cursor_serial}, 'first call fetches' );
+$cap->cursor for 1..5;
+is_deeply( [ $cap->fetches, $cap->hits ], [ 1, 5 ], 'unchanged cursor is not fetched again' );
+
+# Any change of cursor image on the screen causes a notify event
+# (shapes from X11/cursorfont.h)
+my %cursor= map { $_ => $dpy->XCreateFontCursor($_) } 150, 34;
+sub change_cursor {
+    my $shape= shift;
+    $shape? $dpy->XDefineCursor($root, $cursor{$shape}) : $dpy->XUndefineCursor($root);
+    my $ev= $dpy->wait_event(timeout => 2);
+    ok( $ev && $ev->isa('X11::Xlib::XFixesCursorNotifyEvent'), 'got cursor notify event' );
+}
+SKIP: {
+    change_cursor(150); # XC_watch
+    skip 'Server sent no cursor event', 8 unless $cap->changes;
+    isnt( $cap->serial, $first->{cursor_serial}, 'serial changed' );
+    my $second= $cap->cursor;
+    is( $cap->fetches, 2, 'new cursor fetched' );
+    is( $second->{cursor_serial}, $cap->serial, 'image of new serial' );
+    change_cursor(0);
+    is( $cap->cursor, $first, 'returning to a seen cursor uses the cache' );
+    is( $cap->fetches, 2, 'no fetch' );
+
+    $cap->max_cached(2);
+    change_cursor(34); # XC_crosshair
+    $cap->cursor;
+    is( scalar keys %{ $cap->{cache} }, 2, 'least recently used image dropped' );
+}
+
+# Blending the cursor onto a frame
+my $cur= $cap->cursor;
+my ($w, $h)= ($cur->{width} + 2, $cur->{height} + 2);
+my $frame= { width => $w, height => $h, data => pack('L*', (0x00102030) x ($w * $h)) };
+ok( $cap->draw_onto($frame, $cur->{xhot} + 1, $cur->{yhot} + 1), 'draw_onto' );
+my @src= unpack 'L*', $cur->{pixels};
+my @out= unpack 'L*', $frame->{data};
+is( $out[0], 0x00102030, 'pixel outside cursor untouched' );
+my $inv= sub { my ($d, $a)= @_; int(($d * (255 - $a) + 127) / 255) };
+for my $i (0 .. $#src) {
+    my ($x, $y)= ($i % $cur->{width} + 1, int($i / $cur->{width}) + 1);
+    my $s= $src[$i]; my $a= $s >> 24;
+    my $expect= 0;
+    for my $shift (24, 16, 8, 0) {
+        $expect |= ((($s >> $shift) & 0xFF) + $inv->((0x00102030 >> $shift) & 0xFF, $a)) << $shift;
+    }
+    is( sprintf('%08X', $out[$y * $w + $x]), sprintf('%08X', $expect), "blended pixel $x,$y" );
+}
+# Clipped at the edges
+my $small= { width => 1, height => 1, data => pack('L', 0) };
+ok( $cap->draw_onto($small, -5, -5), 'off the edge' );
+is( unpack('L', $small->{data}), 0, 'nothing drawn' );
+
+$dpy->XFreeCursor($_) for values %cursor;
+undef $cap;
+ok( !grep(defined, values %{ $dpy->{cursor_captures} }), 'unregistered' );
+
+done_testing;
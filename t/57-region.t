@@ -0,0 +1,143 @@
+#!/usr/bin/env perl
+
+use strict;
+use warnings;
+use Test::More;
+use X11::Xlib;
+
+use_ok( 'X11::Xlib::Region' ) or BAIL_OUT;
+
+sub rect { X11::Xlib::XRectangle->new({ x => $_[0], y => $_[1], width => $_[2], height => $_[3] }) }
+
+# Reference implementation: set of "x,y" pixels
+sub pixels_of {
+    my %p;
+    for (@_) {
+        my ($x, $y, $w, $h)= @$_;
+        for my $j ($y .. $y+$h-1) { $p{"$_,$j"}= 1 for $x .. $x+$w-1 }
+    }
+    return \%p;
+}
+sub region_pixels {
+    pixels_of(map [ $_->x, $_->y, $_->width, $_->height ], $_[0]->rects);
+}
+# Check that the boxes are in banded form: sorted, disjoint within each band,
+# bands don't overlap, and touching bands differ
+sub is_banded {
+    my @b= unpack('l*', shift->boxes);
+    my @boxes; push @boxes, [splice(@b, 0, 4)] while @b;
+    my ($prev_band, $band)= (undef, []);
+    my @bands;
+    for (@boxes) {
+        return 0 unless $_->[0] < $_->[2] && $_->[1] < $_->[3];
+        if (@$band && $band->[0][1] == $_->[1]) {
+            return 0 unless $band->[0][3] == $_->[3] && $band->[-1][2] < $_->[0];
+            push @$band, $_;
+        } else {
+            push @bands, $band= [ $_ ];
+        }
+    }
+    for (1 .. $#bands) {
+        my ($a, $b)= @bands[$_-1, $_];
+        return 0 unless $a->[0][3] <= $b->[0][1];
+        return 0 if $a->[0][3] == $b->[0][1]
+            && join(',', map "$_->[0]:$_->[2]", @$a) eq join(',', map "$_->[0]:$_->[2]", @$b);
+    }
+    return 1;
+}
+
+my $empty= X11::Xlib::Region->new;
+ok( $empty->is_empty, 'empty' );
+is_deeply( [ $empty->extents ], [ 0, 0, 0, 0 ], 'empty extents' );
+
+my $r= X11::Xlib::Region->new([ rect(0,0,10,10), rect(5,5,10,10) ]);
+is( $r->count, 3, 'two overlapping squares make three bands' );
+is_deeply( [ $r->extents ], [ 0, 0, 15, 15 ], 'extents' );
+ok( $r->contains(9,9) && $r->contains(14,14) && !$r->contains(14,0) && !$r->contains(15,15), 'contains point' );
+ok( $r->contains(0,0,10,10) && !$r->contains(0,0,15,15), 'contains rect' );
+ok( $r->overlaps(10,0,10,10) && !$r->overlaps(10,0,10,5), 'overlaps' );
+
+my $same= X11::Xlib::Region->new(pack('(s s S S)*', 5,5,10,10, 0,0,10,10, 2,2,1,1));
+ok( $r->equals($same), 'packed input in other order gives identical region' );
+ok( $r->union(X11::Xlib::Region->new([ rect(0,0,5,5) ]))->equals($r), 'union with subset' );
+ok( $r->subtract($r)->is_empty, 'subtract self' );
+ok( X11::Xlib::Region->new([ rect(0,0,10,5), rect(0,5,10,5) ])->count == 1, 'touching bands merged' );
+
+# Random regions against the reference
+srand(42);
+for my $round (1 .. 30) {
+    my @ra= map [ int rand 30, int rand 30, int rand 12, int rand 12 ], 1 .. 1 + int rand 8;
+    my @rb= map [ int rand 30, int rand 30, int rand 12, int rand 12 ], 1 .. 1 + int rand 8;
+    my $a= X11::Xlib::Region->new([ map rect(@$_), @ra ]);
+    my $b= X11::Xlib::Region->new([ map rect(@$_), @rb ]);
+    my ($pa, $pb)= (pixels_of(@ra), pixels_of(@rb));
+    my %expect= (
+        union     => { %$pa, %$pb },
+        intersect => { map { $pb->{$_}? ($_ => 1) : () } keys %$pa },
+        subtract  => { map { $pb->{$_}? () : ($_ => 1) } keys %$pa },
+    );
+    my $ok= is_deeply( region_pixels($a), $pa, "round $round: new" );
+    for my $op (qw( union intersect subtract )) {
+        my $got= $a->$op($b);
+        $ok &&= is_deeply( region_pixels($got), $expect{$op}, "round $round: $op" )
+            && ok( is_banded($got), "round $round: $op is banded" );
+    }
+    my $t= $a->translate(-100, 7);
+    ok( $t->translate(100, -7)->equals($a), "round $round: translate" );
+    my ($px)= keys %$pa;
+    ok( !$px || $a->contains(split /,/, $px), "round $round: contains a member" );
+    last unless $ok;
+}
+
+# Masks, against a per-pixel reference
+for my $case ([ 1, 0 ], [ 1, 1 ], [ 8, 0 ]) {
+    my ($depth, $msb)= @$case;
+    for my $w (1, 7, 64, 65, 130) {
+        my $h= 9;
+        my $row_bytes= $depth == 1? (($w + 7) >> 3) + 3 : $w + 5; # with padding
+        my ($data, %expect)= ('');
+        for my $y (0 .. $h-1) {
+            # runs of random length, sometimes whole rows alike
+            my @px= map { ($_ * 3 + $y) % 11 < ($y % 4) * 3 ? 1 : 0 } 0 .. $w-1;
+            @px= map { rand() < .5 ? 1 : 0 } @px if $y == 4;
+            $px[$_] and $expect{"$_,$y"}= 1 for 0 .. $w-1;
+            my $row= $depth == 8? pack('C*', map { $_? 1 + int rand 255 : 0 } @px)
+                : pack($msb? 'B*' : 'b*', join '', @px);
+            # garbage in the unused bits of the last byte
+            substr($row, -1) |= chr($msb? (1 << (8 - $w % 8)) - 1 : 0xFF & ~((1 << $w % 8) - 1))
+                if $depth == 1 && $w % 8;
+            $data .= $row . ("\xFF" x ($row_bytes - length $row));
+        }
+        my $m= X11::Xlib::Region->from_mask({ data => $data, width => $w, height => $h,
+            depth => $depth, bytes_per_line => $row_bytes, bit_order => $msb? X11::Xlib::MSBFirst() : 0 });
+        is_deeply( region_pixels($m), \%expect, "mask depth=$depth msb=$msb width=$w" )
+            && ok( is_banded($m), '...is banded' );
+    }
+}
+my $alpha= X11::Xlib::Region->from_mask({ data => pack('C*', 0, 50, 200, 255), width => 4, height => 1, depth => 8 }, threshold => 128);
+ok( $alpha->equals([ rect(2,0,2,1) ]), 'threshold' );
+my $solid= X11::Xlib::Region->from_mask({ data => "\xFF" x (16 * 100), width => 128, height => 100 });
+ok( $solid->equals([ rect(0,0,128,100) ]) && $solid->count == 1, 'solid mask is one rect' );
+ok( !eval { X11::Xlib::Region->from_mask({ data => "\0" x 10, width => 16, height => 10 }) }, 'short buffer dies' );
+
+# Server side
+SKIP: {
+    skip 'No X11 Server available', 6 unless $ENV{DISPLAY};
+    my $dpy= X11::Xlib->new;
+    skip 'XFixes unavailable', 6
+        unless X11::Xlib->can('XFixesUnionRegion') && (() = $dpy->XFixesQueryExtension);
+    my $s= $r->to_server($dpy);
+    isa_ok( $s, 'X11::Xlib::XserverRegion' );
+    ok( X11::Xlib::Region->from_server($dpy, $s)->equals($r), 'round trip' );
+    my $s2= $dpy->XFixesCreateRegion([ rect(0,0,5,5) ]);
+    $dpy->XFixesSubtractRegion($s, $s, $s2);
+    ok( X11::Xlib::Region->from_server($dpy, $s)->equals($r->subtract([ rect(0,0,5,5) ])), 'XFixesSubtractRegion' );
+    $dpy->XFixesUnionRegion($s, $s, $s2);
+    ok( X11::Xlib::Region->from_server($dpy, $s)->equals($r), 'XFixesUnionRegion' );
+    $dpy->XFixesTranslateRegion($s, 3, 4);
+    ok( X11::Xlib::Region->from_server($dpy, $s)->equals($r->translate(3, 4)), 'XFixesTranslateRegion' );
+    $dpy->XFixesSetRegion($s, pack('s s S S', 1, 1, 2, 2));
+    ok( X11::Xlib::Region->from_server($dpy, $s)->equals([ rect(1,1,2,2) ]), 'XFixesSetRegion' );
+}
+
+done_testing;
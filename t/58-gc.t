@@ -0,0 +1,102 @@
+#!/usr/bin/env perl
+
+use strict;
+use warnings;
+use Test::More;
+use X11::Xlib qw( :all );
+sub err(&) { my $code= shift; my $ret; { local $@= ''; eval { $code->() }; $ret= $@; } $ret }
+
+plan skip_all => "No X11 Server available"
+    unless $ENV{DISPLAY};
+
+my $dpy= new_ok( 'X11::Xlib', [], 'connect to X11' );
+my $s= $dpy->screen;
+my $depth= $s->visual_info->depth;
+my $pmap= $dpy->new_pixmap($s->root_window, 64, 64, $depth);
+
+is( X11::Xlib::XGCValues->field_mask(qw( foreground line_width )), GCForeground|GCLineWidth, 'field_mask' );
+ok( err { X11::Xlib::XGCValues->field_mask('color') }, 'field_mask unknown field' );
+
+my $gc= $dpy->new_gc($pmap, foreground => 0, line_width => 3, function => GXcopy);
+isa_ok( $gc, 'X11::Xlib::GC' );
+ok( $dpy->XGetGCValues($gc, GCForeground|GCLineWidth, my $vals), 'XGetGCValues' );
+is_deeply( [ $vals->foreground, $vals->line_width ], [ 0, 3 ], 'values read back' );
+$dpy->XChangeGC($gc, GCLineWidth, { line_width => 0 });
+$dpy->XGetGCValues($gc, GCLineWidth, $vals);
+is( $vals->line_width, 0, 'XChangeGC' );
+
+# Clear, then draw one of each primitive in a different color
+$dpy->XFillRectangles($pmap, $gc, [ { x => 0, y => 0, width => 64, height => 64 } ]);
+$dpy->XSetForeground($gc, 0x0000FF);
+$dpy->XFillRectangles($pmap, $gc, pack('(s s S S)*', 2, 2, 4, 4, 10, 2, 2, 2));
+$dpy->XSetForeground($gc, 0x00FF00);
+my @xy= map { ($_ % 60 + 2, 20 + int($_ / 60)) } 0 .. 119;
+$dpy->XDrawPoints($pmap, $gc, pack('s*', @xy));
+$dpy->XSetForeground($gc, 0xFF0000);
+$dpy->XDrawSegments($pmap, $gc, pack('s*', 2, 30, 40, 30));
+$dpy->XFillArcs($pmap, $gc, pack('s s S S s s', 40, 40, 20, 20, 0, 360*64));
+$dpy->copy_areas($pmap, $pmap, $gc, pack('(s s S S s s)*', 2, 2, 4, 4, 2, 50, 10, 2, 2, 2, 10, 50));
+
+my $img= $dpy->XGetImage($pmap, 0, 0, 64, 64, 0xFFFFFF, ZPixmap);
+my $px= sub { XGetPixel($img, @_) & 0xFFFFFF };
+is( $px->(0, 0), 0, 'background' );
+is( $px->(3, 3), 0x0000FF, 'XFillRectangles packed' );
+is( $px->(11, 3), 0x0000FF, 'second rectangle' );
+is( $px->(12, 3), 0, 'outside rectangle' );
+ok( !grep($px->($xy[$_*2], $xy[$_*2+1]) != 0x00FF00, 0 .. 119), 'XDrawPoints' );
+is( $px->(20, 30), 0xFF0000, 'XDrawSegments' );
+is( $px->(50, 50), 0xFF0000, 'XFillArcs center' );
+is( $px->(41, 41), 0, 'XFillArcs corner' );
+is( $px->(3, 51), 0x0000FF, 'copy_areas first' );
+is( $px->(11, 51), 0x0000FF, 'copy_areas second' );
+
+# Many shapes in one call
+my $n= 50_000;
+my $points= pack('s*', map { ($_ % 64, int($_ / 64) % 64) } 0 .. $n-1);
+is( err { $dpy->XDrawPoints($pmap, $gc, $points); $dpy->XSync }, '', "$n points" );
+ok( err { $dpy->XDrawPoints($pmap, $gc, "abc") }, 'bad packed length' );
+ok( err { $dpy->XDrawPoints($pmap, $gc, [ 1, 2 ]) }, 'points must be packed' );
+
+# State cache
+my $cgc= $dpy->new_gc($pmap, foreground => 0);
+is( $cgc->foreground, 0, 'cached value loaded from Xlib' );
+$cgc->foreground(0);
+is_deeply( [ $cgc->suppressed, $cgc->changes, $cgc->flushes ], [ 1, 0, 0 ], 'same value suppressed' );
+$cgc->set(foreground => 0x00FF00, line_width => 1);
+is( $cgc->foreground, 0x00FF00, 'pending value visible' );
+is( $cgc->flushes, 0, 'nothing sent before drawing' );
+$cgc->fill_rectangles($pmap, pack('s s S S', 0, 60, 4, 4));
+is_deeply( [ $cgc->changes, $cgc->flushes ], [ 2, 1 ], 'both fields sent in one XChangeGC' );
+$dpy->XGetGCValues($cgc, GCForeground|GCLineWidth, my $cv);
+is_deeply( [ $cv->foreground, $cv->line_width ], [ 0x00FF00, 1 ], 'GC really changed' );
+for (1 .. 100) {
+    $cgc->foreground(0x00FF00);
+    $cgc->line_width(1);
+    $cgc->draw_points($pmap, pack('s s', 5, 60));
+}
+is_deeply( [ $cgc->suppressed, $cgc->flushes ], [ 201, 1 ], 'redundant settings in a loop cost nothing' );
+$cgc->foreground(0xFF0000);
+$cgc->foreground(0x00FF00);
+ok( !$cgc->flush, 'changed and changed back sends nothing' );
+$cgc->foreground(0xFFFFFF);
+$cgc->copy_area($pmap, $pmap, 0, 60, 1, 1, 10, 60);
+$cgc->fill_rectangles($pmap, pack('s s S S', 20, 60, 1, 1));
+$img= $dpy->XGetImage($pmap, 0, 0, 64, 64, 0xFFFFFF, ZPixmap);
+is_deeply( [ map $px->(@$_), [0,60], [5,60], [10,60], [20,60] ], [ 0x00FF00, 0x00FF00, 0x00FF00, 0xFFFFFF ],
+    'drawing used the pending values' );
+$dpy->XSetForeground($cgc, 0x123456);
+$cgc->invalidate;
+is( $cgc->foreground, 0x123456, 'invalidate reloads' );
+ok( err { $cgc->set(colour => 1) }, 'unknown field' );
+$cgc->clip_mask(0);
+ok( $cgc->flush, 'clip_mask is always sent the first time' );
+undef $cgc;
+
+is( err { $dpy->XFreeGC($gc); $dpy->XSync }, '', 'XFreeGC' );
+ok( err { $dpy->XSetForeground($gc, 0) }, 'freed GC is unusable' );
+
+my $gc2= $dpy->new_gc($pmap);
+undef $gc2;
+is( err { $dpy->XSync }, '', 'autofree' );
+
+done_testing;
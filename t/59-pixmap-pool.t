@@ -0,0 +1,97 @@
+#!/usr/bin/env perl
+
+use strict;
+use warnings;
+use Test::More;
+use X11::Xlib;
+sub err(&) { my $code= shift; my $ret; { local $@= ''; eval { $code->() }; $ret= $@; } $ret }
+
+plan skip_all => "No X11 Server available"
+    unless $ENV{DISPLAY};
+
+use_ok( 'X11::Xlib::PixmapPool' ) or BAIL_OUT;
+
+my $dpy= new_ok( 'X11::Xlib', [], 'connect to X11' );
+my $s= $dpy->screen;
+my $depth= $s->visual_info->depth;
+
+my @freed;
+{
+    no warnings 'redefine', 'once';
+    my $orig= \&X11::Xlib::XFreePixmap;
+    *X11::Xlib::Display::XFreePixmap= sub { push @freed, $_[1]; $orig->(@_) };
+}
+
+my $pool= X11::Xlib::PixmapPool->new(display => $dpy, max_bytes => 100 * 100 * 4 * 2, max_idle => 0);
+my $p1= $pool->acquire($s->root_window, 100, 100, 32);
+isa_ok( $p1, 'X11::Xlib::Pixmap' );
+is_deeply( [ $p1->get_w_h, $p1->depth ], [ 100, 100, 32 ], 'attributes' );
+my $xid1= $p1->xid;
+undef $p1;
+is_deeply( \@freed, [], 'not freed when dropped' );
+is_deeply( [ $pool->idle_count, $pool->idle_bytes, $pool->active_count ], [ 1, 40000, 0 ], 'went back to the pool' );
+
+my $p2= $pool->acquire($s, 100, 100, 32);
+is( $p2->xid, $xid1, 'same size reuses the XID' );
+my $p3= $pool->acquire(undef, 100, 100, 32);
+isnt( $p3->xid, $xid1, 'second one is new' );
+my $p4= $pool->acquire(undef, 50, 100, 32);
+is_deeply( [ $pool->hits, $pool->allocations, $pool->active_count ], [ 1, 3, 3 ], 'statistics' );
+my $p_default= $pool->acquire(undef, 10, 10);
+is( $p_default->depth, $depth, 'depth defaults to the screen' );
+
+# Usable for drawing
+my $gc= $dpy->new_gc($p2, foreground => 0x00FF00);
+$dpy->XFillRectangles($p2, $gc, pack('s s S S', 0, 0, 10, 10));
+is( X11::Xlib::XGetPixel($dpy->XGetImage($p2, 5, 5, 1, 1, 0xFFFFFF, X11::Xlib::ZPixmap()), 0, 0) & 0xFFFFFF,
+    0x00FF00, 'drawing works' );
+undef $gc;
+
+# Memory cap: room for two 100x100x32, the oldest released goes first
+@freed= ();
+my ($x2, $x3, $x4)= map $_->xid, $p2, $p3, $p4;
+undef $p2; undef $p3; undef $p4;
+is_deeply( \@freed, [ $x2 ], 'oldest evicted to stay under max_bytes' );
+is( $pool->idle_bytes, 60000, 'idle_bytes' );
+ok( $pool->idle_bytes <= $pool->max_bytes, 'under the cap' );
+my $big= $pool->acquire(undef, 200, 200, 32);
+my $xbig= $big->xid;
+undef $big;
+is( $freed[-1], $xbig, 'too big to keep' );
+is( $pool->evictions, 2, 'evictions' );
+
+# Explicit release
+my $p5= $pool->acquire(undef, 50, 100, 32);
+is( $p5->xid, $x4, 'reused' );
+ok( $pool->release($p5), 'release' );
+ok( !$pool->release($p5), 'second release is ignored' );
+@freed= ();
+undef $p5;
+is_deeply( \@freed, [], 'destroying a released object does nothing' );
+my $p6= $pool->acquire(undef, 50, 100, 32);
+is( $p6->xid, $x4, 'released pixmap handed out again' );
+is( $p6->pool, $pool, 'as a new object' );
+ok( !$pool->release($dpy->new_pixmap($s, 10, 10, $depth)), 'pixmap from elsewhere not accepted' );
+
+# Expiry
+$pool->max_idle(0.2);
+undef $p6;
+is( $pool->idle_count, 2, 'idle before expiry' );
+is( $pool->expire, 0, 'nothing expired yet' );
+select(undef, undef, undef, 0.3);
+@freed= ();
+is( $pool->expire, 2, 'expired' );
+is( scalar @freed, 2, 'and freed' );
+is_deeply( [ $pool->idle_count, $pool->idle_bytes ], [ 0, 0 ], 'pool empty' );
+
+# Trim, and pool going away first
+my @held= map $pool->acquire(undef, 8, 8, 32), 1 .. 3;
+shift @held;
+is( $pool->trim, 1, 'trim' );
+undef $pool;
+@freed= ();
+@held= ();
+is( scalar @freed, 2, 'outstanding pixmaps freed normally after the pool is gone' );
+is( err { $dpy->XSync }, '', 'no errors' );
+
+done_testing;
@@ -0,0 +1,66 @@
+#!/usr/bin/env perl
+
+use strict;
+use warnings;
+use Test::More;
+use X11::Xlib qw( :all );
+
+plan skip_all => "No X11 Server available"
+    unless $ENV{DISPLAY};
+
+my $dpy= new_ok( 'X11::Xlib', [], 'connect to X11' );
+my @errors;
+$dpy->on_error(sub { push @errors, $_[1] if $_[1] });
+
+my $serial= XNextRequest($dpy);
+$dpy->XSync;
+ok( LastKnownRequestProcessed($dpy) >= $serial, 'LastKnownRequestProcessed after XSync' );
+ok( XNextRequest($dpy) > $serial, 'XNextRequest advances' );
+
+my $root= $dpy->root_window;
+my @direct;
+{
+    no warnings 'redefine', 'once';
+    my $orig= \&X11::Xlib::XDestroyWindow;
+    *X11::Xlib::Display::XDestroyWindow= sub { push @direct, $_[1]; $orig->(@_) };
+}
+
+ok( !$dpy->defer_free, 'off by default' );
+my $w= $dpy->XCreateSimpleWindow($root, 0, 0, 10, 10, 0, 0, 0);
+undef $w;
+is( scalar @direct, 1, 'freed immediately' );
+
+$dpy->defer_free(1);
+my $parent= $dpy->XCreateSimpleWindow($root, 0, 0, 10, 10, 0, 0, 0);
+my @kids= map $dpy->XCreateSimpleWindow($parent, 0, 0, 5, 5, 0, 0, 0), 1 .. 20;
+my $pmap= $dpy->new_pixmap($root, 8, 8, $dpy->screen->visual_info->depth);
+my @xids= map $_->xid, $parent, @kids;
+$dpy->XSync;
+# The parent goes first, so the children are already gone by the time they are freed
+undef $parent;
+@kids= ();
+undef $pmap;
+is( scalar @direct, 1, 'nothing freed at scope exit' );
+is( $dpy->pending_frees, 22, 'pending_frees' );
+$dpy->flush_sync;
+is( $dpy->pending_frees, 0, 'collected by flush_sync' );
+is( scalar @errors, 0, 'errors for the children were suppressed' )
+    or diag explain [ map $_->summarize, @errors ];
+is( $dpy->XGetGeometry($xids[0]), undef, 'parent destroyed' );
+is( scalar @errors, 1, 'errors outside the batch still reported' );
+
+@errors= ();
+my $w2= $dpy->XCreateSimpleWindow($root, 0, 0, 10, 10, 0, 0, 0);
+undef $w2;
+is( $dpy->collect, 1, 'explicit collect' );
+is( $dpy->collect, 0, 'queue empty' );
+$dpy->XDestroyWindow($xids[0]);
+$dpy->XSync;
+is( scalar @errors, 1, 'error for a later request is not suppressed' );
+
+my $w3= $dpy->XCreateSimpleWindow($root, 0, 0, 10, 10, 0, 0, 0);
+undef $w3;
+$dpy->defer_free(0);
+is( $dpy->pending_frees, 0, 'turning it off collects' );
+
+done_testing;
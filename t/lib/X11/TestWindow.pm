@@ -0,0 +1,46 @@
+package X11::TestWindow;
+use strict;
+use warnings;
+use X11::Xlib qw( XCreateImage XPutPixel XPutImage ZPixmap );
+use Exporter 'import';
+our @EXPORT= qw( new_test_window paint );
+
+=head1 DESCRIPTION
+
+Helpers shared by the tests that capture the contents of a window.
+
+=head2 new_test_window
+
+  my $wnd= new_test_window($display);
+
+Create and map a 40x30 override-redirect window at 0,0, so no window manager
+moves or decorates it, and wait until the server has processed that.
+
+=cut
+
+sub new_test_window {
+    my $dpy= shift;
+    my $wnd= $dpy->new_window(x => 0, y => 0, width => 40, height => 30, override_redirect => 1);
+    $wnd->show;
+    $dpy->XSync;
+    return $wnd;
+}
+
+=head2 paint
+
+  paint($drawable, $x, $y, $w, $h, $color);
+
+Draw a block of solid color with XPutImage.
+
+=cut
+
+sub paint {
+    my ($drawable, $x, $y, $w, $h, $color)= @_;
+    my $dpy= $drawable->display;
+    my $img= XCreateImage($dpy, $dpy->DefaultVisual, $dpy->DefaultDepth, ZPixmap, 0,
+        my $buf, $w, $h, 32, 0);
+    XPutPixel($img, $_ % $w, int($_ / $w), $color) for 0 .. $w*$h-1;
+    XPutImage($dpy, $drawable, $dpy->DefaultGC, $img, 0, 0, $x, $y, $w, $h);
+}
+
+1;
@@ -157,8 +157,8 @@ if ($def_bits{$goal}) {
 
 my %int_types= map { $_ => 1 } qw( int short long Bool char );
 my %unsigned_types= map { $_ => 1 } 'unsigned', 'unsigned int', 'unsigned long', 'unsigned short',
-	qw( Time VisualID );
-my %xid_types= map { $_ => 1 } qw( Window Drawable Colormap Cursor Atom Pixmap XserverRegion PictFormat Picture Glyph GlyphSet );
+	qw( Time VisualID Atom );
+my %xid_types= map { $_ => 1 } qw( Window Drawable Colormap Cursor Atom Pixmap Font XserverRegion PictFormat Picture Glyph GlyphSet );
 
 sub sv_read {
     my ($type, $access, $svname)= @_;
@@ -208,7 +208,7 @@ sub generate_xs_accessor {
          SV *dpy_sv= PerlXlib_objref_get_display(self);
          Display *dpy= PerlXlib_display_objref_get_pointer(dpy_sv, PerlXlib_OR_NULL);"
         : "$goal *s= self;";
-    return <<"@";
+    my $xs= <<"@";
 void
 $member->{pl_name}(self, value=NULL)
     $self_type *self
@@ -224,6 +224,8 @@ $member->{pl_name}(self, value=NULL)
     }
 
 @
+    $xs =~ s/sv_2mortal\(newSVsv\((PerlXlib_get_objref\(.*)\)\)/sv_mortalcopy($1)/g;
+    return $xs;
 }
 
 sub generate_pack_c {
@@ -262,16 +264,7 @@ void PerlXlib_${goal}_unpack_obj($goal *s, HV *fields, SV *obj_ref) {
     # methods.  But, don't do any of this unless domething needs it.
     my $need_dpy= grep sv_create($_->{c_type}, 'x') =~ /\b dpy \b/x, values %members;
 
-    if ($need_dpy) {
-        if ($members{display} && $members{display}{c_type} =~ /Display/) {
-            $c .= "    Display *dpy= s->display;\n";
-        } elsif ($members{screen} && $members{screen}{c_type} =~ /Screen/) {
-            $c .= "    Display *dpy= s->screen? DisplayOfScreen(s->screen) : NULL;\n";
-        } else {
-            $c .= "    SV *dpy_sv= PerlXlib_objref_get_display(obj_ref);\n";
-            $c .= "    Display *dpy= PerlXlib_display_objref_get_pointer(dpy_sv, PerlXlib_OR_NULL);\n";
-        }
-    }
+    $c .= dpy_lookup_c() if $need_dpy;
 
     for my $c_name (sort keys %members) {
         my $member= $members{$c_name};
@@ -296,6 +289,121 @@ void PerlXlib_${goal}_unpack_obj($goal *s, HV *fields, SV *obj_ref) {
     return $c;
 }
 
+# Code to find a Display* for inflating objects, in order of preference.
+sub dpy_lookup_c {
+    if ($members{display} && $members{display}{c_type} =~ /Display/) {
+        return "    Display *dpy= s->display;\n";
+    } elsif ($members{screen} && $members{screen}{c_type} =~ /Screen/) {
+        return "    Display *dpy= s->screen? DisplayOfScreen(s->screen) : NULL;\n";
+    } else {
+        return "    SV *dpy_sv= PerlXlib_objref_get_display(obj_ref);\n"
+             . "    Display *dpy= PerlXlib_display_objref_get_pointer(dpy_sv, PerlXlib_OR_NULL);\n";
+    }
+}
+
+# The field table is sorted by perl name, so that the generated get/set methods
+# can binary-search it, and the field number is the index into that table.
+sub generate_fields_c {
+    my @fields= sort { $a->{pl_name} cmp $b->{pl_name} } values %members;
+    my $c= "static const char * const PerlXlib_${goal}_field_names[]= {\n";
+    $c .= qq{    "$_->{pl_name}",\n} for @fields;
+    $c .= "};\n\n";
+
+    $c .= "static SV* PerlXlib_${goal}_get_field($goal *s, int idx, SV *obj_ref) {\n"
+        . "    switch (idx) {\n";
+    for my $i (0..$#fields) {
+        my $sv_create= sv_create($fields[$i]{c_type}, "s->$fields[$i]{c_name}");
+        if ($sv_create =~ /\b dpy \b/x) {
+            my $dpy= dpy_lookup_c();
+            $dpy =~ s/^    /      /mg;
+            $c .= "    case $i: {\n$dpy      return $sv_create;\n    }\n";
+        } else {
+            $c .= "    case $i: return $sv_create;\n";
+        }
+    }
+    $c .= "    }\n    return NULL;\n}\n\n";
+
+    $c .= "static Bool PerlXlib_${goal}_set_field($goal *s, int idx, SV *value) {\n"
+        . "    switch (idx) {\n";
+    for my $i (0..$#fields) {
+        my $member= $fields[$i];
+        my $sv_read= sv_read($member->{c_type}, "s->$member->{c_name}", "value");
+        my $mark_defined= $member->{defined_flag}? "s->$member->{defined_field} |= $member->{defined_flag}; " : '';
+        $c .= "    case $i: $mark_defined$sv_read break;\n";
+    }
+    $c .= "    default: return 0;\n    }\n    return 1;\n}\n\n";
+
+    $c .= <<"@";
+const PerlXlib_struct_fields PerlXlib_${goal}_fields= {
+    ${\ scalar @fields}, PerlXlib_${goal}_field_names,
+    (PerlXlib_struct_get_field_fn*) &PerlXlib_${goal}_get_field,
+    (PerlXlib_struct_set_field_fn*) &PerlXlib_${goal}_set_field
+};
+@
+    return $c;
+}
+
+sub generate_get_set_xs {
+    return <<"@";
+void
+get(self, ...)
+    SV *self
+  ALIAS:
+    get_list = 1
+  INIT:
+    $goal *s= ( $goal * ) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::$goal", sizeof($goal),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_${goal}_pack);
+    const PerlXlib_struct_fields *f= &PerlXlib_${goal}_fields;
+    SV **names;
+    const char *name;
+    STRLEN len;
+    int i, idx, n= items - 1;
+  PPCODE:
+    if (ix == 1 && n == 0) {
+      EXTEND(SP, f->count * 2);
+      for (i= 0; i < f->count; i++) {
+        PUSHs(sv_2mortal(newSVpv(f->names[i], 0)));
+        PUSHs(sv_2mortal(f->get_field(s, i, self)));
+      }
+    }
+    else if (n > 0) {
+      /* results overwrite the argument list, so save the names first */
+      Newx(names, n, SV*);
+      SAVEFREEPV(names);
+      Copy(&ST(1), names, n, SV*);
+      EXTEND(SP, ix? n * 2 : n);
+      for (i= 0; i < n; i++) {
+        name= SvPV(names[i], len);
+        if ((idx= PerlXlib_struct_field_index(f, name, len)) < 0)
+          croak("No field '%s' in X11::Xlib::$goal", name);
+        if (ix) PUSHs(names[i]);
+        PUSHs(sv_2mortal(f->get_field(s, idx, self)));
+      }
+    }
+
+void
+set(self, ...)
+    SV *self
+  INIT:
+    $goal *s= ( $goal * ) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::$goal", sizeof($goal),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_${goal}_pack);
+    const PerlXlib_struct_fields *f= &PerlXlib_${goal}_fields;
+    const char *name;
+    STRLEN len;
+    int i, idx;
+  PPCODE:
+    if (!(items & 1)) croak("Odd number of arguments to set()");
+    for (i= 1; i < items; i+= 2) {
+      name= SvPV(ST(i), len);
+      if ((idx= PerlXlib_struct_field_index(f, name, len)) < 0)
+        croak("No field '%s' in X11::Xlib::$goal", name);
+      f->set_field(s, idx, ST(i+1));
+    }
+    PUSHs(self);
+
+@
+}
+
 sub patch_file {
     my ($fname, $token, $new_content)= @_;
     my $begin_token= "BEGIN $token";
@@ -354,6 +462,7 @@ _unpack(s, fields)
         PerlXlib_${goal}_unpack_obj(s, fields, ST(0));
 
 @
+$out_xs .= generate_get_set_xs();
 $out_xs .= generate_xs_accessor($_) for map { $members{$_} } sort keys %members;
 
 my $out_pl= "\n";
@@ -361,6 +470,6 @@ my $out_const= "";
 
 my $file_splice_token= "GENERATED X11_Xlib_${goal}";
 
-my $out_c=  "\n" . generate_pack_c() . "\n" . generate_unpack_c() . "\n";
+my $out_c=  "\n" . generate_pack_c() . "\n" . generate_unpack_c() . "\n" . generate_fields_c() . "\n";
 patch_file("Xlib.xs", $file_splice_token, $out_xs);
 patch_file("PerlXlib.c", $file_splice_token, $out_c);
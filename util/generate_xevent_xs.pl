@@ -368,7 +368,7 @@ const char* PerlXlib_xevent_pkg_for_type(int type) {
     $c .= qq{  case $_: return "X11::Xlib::$type_to_struct{$_}";\n}
         for sort keys %type_to_struct;
     $c .= <<"@";
-  default: return "X11::Xlib::XEvent";
+  default: return PerlXlib_xevent_ext_pkg_for_type(type);
   }
 }
 
@@ -507,19 +507,143 @@ sub generate_subclasses {
         next if $member_struct eq 'XAnyEvent' or !$typecodes or !@$typecodes;
         $pod .= "=head2 $member_struct\n\n"
             . "Used for event type: ".join(', ', sort @$typecodes)."\n\n";
-        $subclasses .= "\n\n\@X11::Xlib::${member_struct}::ISA= ( __PACKAGE__ );\n";
-        my $n;
+        # Accessors for the subclass are installed by XS, so only need to declare inheritance
+        $subclasses .= "\@X11::Xlib::${member_struct}::ISA= ( __PACKAGE__ );\n";
         for my $path (sort grep { $_ =~ qr/^$field\./ and $_ !~ $ignore_re } keys %members) {
             my ($name)= ($path =~ /([^.]+)$/);
             next if $have{$name};
-            ++$n;
             $pod .= sprintf("  %-17s - %s\n", $name, $members{$path});
-            $subclasses .= "*X11::Xlib::${member_struct}::$name= *_$name;\n";
         }
         $pod .= "\n";
     }
     $pod .= "=cut\n\n";
-    return $subclasses . "\n" . $pod;
+    return "\n" . $subclasses . "\n" . $pod;
+}
+
+# Each subclass gets its own set of accessors which read the union member directly.
+# The object class is checked against the subclass (which is cheap for an exact match)
+# so there is no need to switch on event->type like the generic _$field accessors do.
+sub generate_subclass_xs {
+    my $xs= '';
+    my %have= ( display => 1, send_event => 1, serial => 1, type => 1 );
+
+    for my $member_struct (sort keys %struct_to_field) {
+        my $field= $struct_to_field{$member_struct};
+        my $typecodes= $field_to_type{$field};
+        next if $member_struct eq 'XAnyEvent' or !$typecodes or !@$typecodes;
+        $xs .= "\nMODULE = X11::Xlib                PACKAGE = X11::Xlib::$member_struct\n\n";
+        for my $path (sort grep { $_ =~ qr/^$field\./ and $_ !~ $ignore_re } keys %members) {
+            my ($name)= ($path =~ /([^.]+)$/);
+            next if $have{$name};
+            my $sv_read= sv_read($members{$path}, "event->$path", 'value');
+            my $sv_create= sv_create($members{$path}, "event->$path");
+            $xs .= <<"@";
+void
+$name(self, value=NULL)
+  SV *self
+  SV *value
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::$member_struct", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+  PPCODE:
+    if (value) {
+      $sv_read
+      PUSHs(value);
+    } else {
+      PUSHs(sv_2mortal($sv_create));
+    }
+
+@
+        }
+    }
+    return $xs;
+}
+
+# Field table for get/get_list/set, sorted by name for binary search.  The
+# field number is the index into the table, and the code for each field
+# switches on event->type to find the union member, the same as the _$field
+# accessors.  Fields that don't apply to the event type give NULL / false.
+sub generate_fields_c {
+    my (@names, %variations);
+    for my $name (sort keys %distinct_leaf) {
+        my @paths= sort grep { $_ =~ /(^|\.)$name$/ && $_ !~ $ignore_re && $members{$_} ne 'void *' } keys %members;
+        if ($name ne 'type' && $name ne 'display' && $name ne 'serial' && $name ne 'send_event') {
+            @paths= grep { my ($prefix)= ($_ =~ /^(\w+)/); $field_to_type{$prefix} } @paths;
+        }
+        next unless @paths;
+        push @names, $name;
+        $variations{$name}= \@paths;
+    }
+    my $c= "static const char * const PerlXlib_${goal}_field_names[]= {\n";
+    $c .= qq{    "$_",\n} for @names;
+    $c .= "};\n\n";
+
+    my ($get, $set)= ('', '');
+    for my $i (0..$#names) {
+        my $name= $names[$i];
+        if ($name eq 'type') {
+            $get .= "    case $i: return newSViv(s->type);\n";
+            $set .= <<"@";
+    case $i:
+      newtype= SvIV(value);
+      if (s->type != newtype) {
+        oldpkg= PerlXlib_xevent_pkg_for_type(s->type);
+        newpkg= PerlXlib_xevent_pkg_for_type(newtype);
+        s->type= newtype;
+        if (oldpkg != newpkg) {
+          /* re-initialize all fields in the area that changed */
+          memset( ((char*)(void*)s) + sizeof(XAnyEvent), 0, sizeof(XEvent)-sizeof(XAnyEvent) );
+        }
+      }
+      return 1;
+@
+        }
+        elsif ($name eq 'display' or $name eq 'serial') {
+            my $type= $members{"xany.$name"};
+            $get .= "    case $i: return ".sv_create($type, "(s->type? s->xany.$name : s->xerror.$name)").";\n";
+            $set .= "    case $i: if (s->type) ".sv_read($type, "s->xany.$name", 'value')
+                . " else ".sv_read($type, "s->xerror.$name", 'value')." return 1;\n";
+        }
+        elsif ($name eq 'send_event') {
+            my $type= $members{"xany.$name"};
+            $get .= "    case $i: return s->type? ".sv_create($type, "s->xany.$name")." : NULL;\n";
+            $set .= "    case $i: if (!s->type) return 0; ".sv_read($type, "s->xany.$name", 'value')." return 1;\n";
+        }
+        else {
+            $get .= "    case $i:\n      switch (s->type) {\n";
+            $set .= "    case $i:\n      switch (s->type) {\n";
+            for my $path (@{ $variations{$name} }) {
+                my ($prefix)= ($path =~ /^(\w+)/);
+                my $cases= join '', map "      case $_:\n", sort @{ $field_to_type{$prefix} };
+                $get .= $cases . "        return ".sv_create($members{$path}, "s->$path").";\n";
+                $set .= $cases . "        ".sv_read($members{$path}, "s->$path", 'value')." return 1;\n";
+            }
+            $get .= "      }\n      return NULL;\n";
+            $set .= "      }\n      return 0;\n";
+        }
+    }
+    $c .= <<"@";
+static SV* PerlXlib_${goal}_get_field($goal *s, int idx, SV *obj_ref) {
+    switch (idx) {
+$get    }
+    return NULL;
+}
+
+static Bool PerlXlib_${goal}_set_field($goal *s, int idx, SV *value) {
+    int newtype;
+    const char *oldpkg, *newpkg;
+    switch (idx) {
+$set    }
+    return 0;
+}
+
+const PerlXlib_struct_fields PerlXlib_${goal}_fields= {
+    ${\ scalar @names}, PerlXlib_${goal}_field_names,
+    (PerlXlib_struct_get_field_fn*) &PerlXlib_${goal}_get_field,
+    (PerlXlib_struct_set_field_fn*) &PerlXlib_${goal}_set_field
+};
+@
+    return $c;
 }
 
 sub patch_file {
@@ -583,6 +707,78 @@ _unpack(e, fields)
     PPCODE:
         PerlXlib_XEvent_unpack(e, fields);
 
+void
+get(self, ...)
+  SV *self
+  ALIAS:
+    get_list = 1
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+    const PerlXlib_struct_fields *f= &PerlXlib_XEvent_fields;
+    SV **names, *val;
+    const char *name;
+    STRLEN len;
+    int i, idx, n= items - 1;
+  PPCODE:
+    if (ix == 1 && n == 0) {
+      /* all fields which are valid for this event type */
+      EXTEND(SP, f->count * 2);
+      for (i= 0; i < f->count; i++) {
+        if (!(val= f->get_field(event, i, self))) continue;
+        PUSHs(sv_2mortal(newSVpv(f->names[i], 0)));
+        PUSHs(sv_2mortal(val));
+      }
+    }
+    else if (n > 0) {
+      /* results overwrite the argument list, so save the names first */
+      Newx(names, n, SV*);
+      SAVEFREEPV(names);
+      Copy(&ST(1), names, n, SV*);
+      EXTEND(SP, ix? n * 2 : n);
+      for (i= 0; i < n; i++) {
+        name= SvPV(names[i], len);
+        if ((idx= PerlXlib_struct_field_index(f, name, len)) < 0)
+          croak("No field '%s' in X11::Xlib::XEvent", name);
+        if (!(val= f->get_field(event, idx, self)))
+          croak("Can't access XEvent.%s for type=%d", name, event->type);
+        if (ix) PUSHs(names[i]);
+        PUSHs(sv_2mortal(val));
+      }
+    }
+
+void
+set(self, ...)
+  SV *self
+  INIT:
+    XEvent *event= (XEvent*) PerlXlib_get_struct_ptr(self, 0, "X11::Xlib::XEvent", sizeof(XEvent),
+        (PerlXlib_struct_pack_fn*) &PerlXlib_XEvent_pack);
+    const PerlXlib_struct_fields *f= &PerlXlib_XEvent_fields;
+    const char *name, *oldpkg, *newpkg;
+    STRLEN len;
+    int i, idx, type_idx= PerlXlib_struct_field_index(f, "type", 4);
+  PPCODE:
+    if (!(items & 1)) croak("Odd number of arguments to set()");
+    oldpkg= PerlXlib_xevent_pkg_for_type(event->type);
+    /* type must be applied first, since it determines which other fields exist */
+    for (i= 1; i < items; i+= 2) {
+      name= SvPV(ST(i), len);
+      if (len == 4 && memcmp(name, "type", 4) == 0)
+        f->set_field(event, type_idx, ST(i+1));
+    }
+    for (i= 1; i < items; i+= 2) {
+      name= SvPV(ST(i), len);
+      if ((idx= PerlXlib_struct_field_index(f, name, len)) < 0)
+        croak("No field '%s' in X11::Xlib::XEvent", name);
+      if (idx != type_idx && !f->set_field(event, idx, ST(i+1)))
+        croak("Can't access XEvent.%s for type=%d", name, event->type);
+    }
+    newpkg= PerlXlib_xevent_pkg_for_type(event->type);
+    /* re-bless the object if the thing passed to us was actually an object */
+    if (oldpkg != newpkg && sv_derived_from(self, "X11::Xlib::XEvent"))
+      sv_bless(self, gv_stashpv(newpkg, GV_ADD));
+    PUSHs(self);
+
 @
 
 my $out_c=  "\n";
@@ -594,7 +790,8 @@ for my $leaf (sort keys %distinct_leaf) {
 	my $xs= generate_xs_accessors($leaf) or next;
 	$out_xs .= $xs;
 }
-$out_c  .= generate_pack_c() . "\n" . generate_unpack_c() . "\n";
+$out_xs .= generate_subclass_xs();
+$out_c  .= generate_pack_c() . "\n" . generate_unpack_c() . "\n" . generate_fields_c() . "\n";
 $out_pl .= generate_subclasses();
 patch_file("Xlib.xs", $file_splice_token, $out_xs);
 patch_file("PerlXlib.c", $file_splice_token, $out_c);